@@ -46,6 +46,16 @@
 
 /*Set an address for the memory pool instead of allocating it as a normal array. Can be in external SRAM too.*/
 #  define LV_MEM_ADR          0     /*0: unused*/
+
+/*Add a new memory pool of at least this size when `LV_MEM_SIZE` is exhausted. 0: don't add pools*/
+#  define LV_MEM_POOL_EXPAND_SIZE   0     /*[bytes]*/
+#  if LV_MEM_POOL_EXPAND_SIZE
+/*Max. total size of the memory pools including `LV_MEM_SIZE`*/
+#    define LV_MEM_POOL_MAX_SIZE    (64U * 1024U * 1024U)  /*[bytes]*/
+#    define LV_MEM_POOL_INCLUDE     <stdlib.h>   /*Header for the functions providing the memory of the pools*/
+#    define LV_MEM_POOL_ALLOC       malloc
+#    define LV_MEM_POOL_FREE        free
+#  endif  /*LV_MEM_POOL_EXPAND_SIZE*/
 #else       /*LV_MEM_CUSTOM*/
 #  define LV_MEM_CUSTOM_INCLUDE <stdlib.h>   /*Header for the dynamic memory function*/
 #  define LV_MEM_CUSTOM_ALLOC     malloc
@@ -56,6 +66,19 @@
 /*Use the standard `memcpy` and `memset` instead of LVGL's own functions. (Might or might not be faster).*/
 #define LV_MEMCPY_MEMSET_STD    0
 
+/*Max. size of the arena of `lv_mem_buf_get()`. It grows to the need of the frames up to this size
+ *and shrinks if it's much larger than needed for a while. Larger needs are allocated from the heap.*/
+#define LV_MEM_BUF_ARENA_MAX_SIZE   (16U * 1024U)   /*[bytes]*/
+
+/*1: Attribute every allocation to a subsystem (object, style, timer, etc.) and its call site
+ *to find what fills the heap. See `lv_mem_tag_monitor()` and `lv_mem_tag_dump()`.
+ *Adds a small header to every allocation*/
+#define LV_USE_MEM_TAG          0
+#if LV_USE_MEM_TAG
+/*Number of call sites to track. The allocations of further call sites are counted only for their tag*/
+#  define LV_MEM_TAG_SITE_CNT   64
+#endif  /*LV_USE_MEM_TAG*/
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -95,8 +118,29 @@
  *LV_SHADOW_CACHE_SIZE is the max. shadow size to buffer, where shadow size is `shadow_width + radius`
  *Caching has LV_SHADOW_CACHE_SIZE^2 RAM cost*/
 #define LV_SHADOW_CACHE_SIZE    0
+
+/*Number of circle (rounded corner) coverage tables to cache.
+ *Radius masks with a cached radius don't need to calculate the coverage of the corners again.
+ *A table takes about `radius * 7` bytes. 0: to disable caching*/
+#define LV_CIRCLE_CACHE_SIZE    4
+
+/*Max. memory of the cached circle coverage tables. Larger circles are not cached*/
+#define LV_CIRCLE_CACHE_MEM_SIZE    (8U * 1024U)    /*[bytes]*/
+
+/*Max. memory (in bytes) to cache the colors of gradients.
+ *Gradients with the same colors, stops and size are calculated only once.
+ *0: to disable caching and calculate the colors for every draw*/
+#define LV_GRAD_CACHE_DEF_SIZE  0
+
+/*Dither the gradients with an ordered (4x4 Bayer) pattern to avoid color banding.
+ *Used only with LV_COLOR_DEPTH 16. Requires 3 times more memory in the gradient cache and a line buffer while drawing*/
+#define LV_DITHER_GRADIENT      0
 #endif /*LV_DRAW_COMPLEX*/
 
+/*1: Don't draw the parts of the objects which are covered by opaque objects drawn later.
+ *Relies on `LV_EVENT_COVER_CHECK`, so custom widgets should report the covered areas correctly.*/
+#define LV_USE_OCCLUSION_CULLING    0
+
 /*Default image cache size. Image caching keeps the images opened.
  *If only the built-in image formats are used there is no real advantage of caching. (I.e. if no new image decoder is added)
  *With complex image decoders (e.g. PNG or JPG) caching can save the continuous open/decode of images.
@@ -104,7 +148,8 @@
  *0: to disable caching*/
 #define LV_IMG_CACHE_DEF_SIZE       0
 
-/*Maximum buffer size to allocate for rotation. Only used if software rotation is enabled in the display driver.*/
+/*Maximum buffer size to allocate for rotation. Only used if software rotation is enabled in the display driver.
+ *Two buffers of this size are used to rotate the next part of the image while the previous part is being flushed.*/
 #define LV_DISP_ROT_MAX_BUF         (10*1024)
 /*-------------
  * GPU
@@ -165,6 +210,18 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 
 #endif  /*LV_USE_LOG*/
 
+/*-------------
+ * Tracing
+ *-----------*/
+
+/*1: Record the time spent in the timers, layout update, rendering, drawing and flushing into a ring buffer.
+ *It can be dumped in Chrome's trace event format with `lv_trace_dump()`*/
+#define LV_USE_TRACE        0
+#if LV_USE_TRACE
+/*Number of events to store. The oldest events are overwritten*/
+#  define LV_TRACE_BUF_SIZE 4096
+#endif  /*LV_USE_TRACE*/
+
 /*-------------
  * Asserts
  *-----------*/
@@ -185,8 +242,15 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
  * Others
  *-----------*/
 
-/*1: Show CPU usage and FPS count in the right bottom corner*/
+/*1: Collect frame time statistics of the displays (see `lv_disp_get_perf_stats()`)*/
 #define LV_USE_PERF_MONITOR     0
+#if LV_USE_PERF_MONITOR
+    /*1: Show FPS, CPU usage and frame time percentiles in the right bottom corner*/
+    #define LV_PERF_MONITOR_SHOW_LABEL  1
+
+    /*Number of 1 ms wide bins of the frame time histograms. Longer times are counted in the last bin*/
+    #define LV_PERF_MONITOR_HIST_SIZE   64
+#endif
 
 /*1: Show the used memory and the memory fragmentation  in the left bottom corner
  * Requires LV_MEM_CUSTOM = 0*/
@@ -195,6 +259,14 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 /*1: Draw random colored rectangles over the redrawn areas*/
 #define LV_USE_REFR_DEBUG       0
 
+/*1: Measure the time and pixels spent drawing each object and each widget class.
+ *See `lv_refr_profiler.h` for the API to get the most expensive ones*/
+#define LV_USE_REFR_PROFILER    0
+#if LV_USE_REFR_PROFILER
+    /*Number of objects to keep statistics about. If the table is full the cheapest objects are dropped*/
+    #define LV_REFR_PROFILER_OBJ_CNT    64
+#endif
+
 /*Change the built in (v)snprintf functions*/
 #define LV_SPRINTF_CUSTOM   0
 #if LV_SPRINTF_CUSTOM
@@ -205,6 +277,11 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 #  define LV_SPRINTF_USE_FLOAT 0
 #endif  /*LV_SPRINTF_CUSTOM*/
 
+/*Number of inherited style property values (e.g. text font and color) to cache.
+ *The cached values are not searched in the parents again until a style, state or parent changes.
+ *A list of ~20 labels needs ~64 to keep the hit rate around 90%. 0: to disable caching*/
+#define LV_STYLE_INHERIT_CACHE_SIZE 64
+
 #define LV_USE_USER_DATA      1
 
 /*Garbage Collector settings
@@ -480,6 +557,10 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 
 /*Default transition time in [ms]*/
 # define LV_THEME_DEFAULT_TRANSITON_TIME    80
+
+/*1: Use constant styles generated by scripts/style_const_gen.py if the display has LV_DPI_DEF.
+ *   Saves RAM and the time of building the styles*/
+# define LV_THEME_DEFAULT_CONST             0
 #endif /*LV_USE_THEME_DEFAULT*/
 
 /*An very simple them that is a good starting point for a custom theme*/
@@ -23,6 +23,7 @@ extern "C" {
  *********************/
 
 #include "src/misc/lv_log.h"
+#include "src/misc/lv_trace.h"
 #include "src/misc/lv_timer.h"
 #include "src/misc/lv_math.h"
 #include "src/misc/lv_async.h"
@@ -34,6 +35,7 @@ extern "C" {
 #include "src/core/lv_indev.h"
 
 #include "src/core/lv_refr.h"
+#include "src/core/lv_refr_profiler.h"
 #include "src/core/lv_disp.h"
 #include "src/core/lv_theme.h"
 
@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+
+"""
+Generate constant (flash resident) style tables from a style description.
+
+Usage: style_const_gen.py [description.json] [output.h]
+Without arguments the styles of the default theme are generated.
+
+The description is a JSON file:
+  "prefix":   prefix of the generated names
+  "defines":  macros to define while the tables are compiled (e.g. "DPX(n)": "...")
+  "variants": list of {"name": ..., "values": [...]} axes. A style is generated for every
+              combination of the axes, e.g. for light/dark mode and small/medium/large displays.
+  "symbols":  named values which can be used in the property values.
+  "init":     optional {"function", "set", "target"}. Generate `function(variant)` calling
+              `set(&target, &const_style)` for every style. `{}` in `target` is replaced by the style's name.
+  "styles":   list of {"name", "if" (optional C condition), "props": {PROP_NAME: value}}
+
+A value is a C constant expression, a "#RRGGBB" color, null (the property is not set),
+or an object selecting the value by the values of an axis, e.g. {"light": "#FFFFFF", "dark": "#282B30"}.
+PAD_ALL, PAD_HOR, PAD_VER, PAD_GAP and SIZE can be used as in the `lv_style_set_...` functions.
+
+The properties are sorted by their ID and the `has_group` bits of the styles are precomputed,
+so the tables can be used directly as `const lv_style_t`.
+"""
+
+import sys, os, re, json, itertools
+
+base_dir = os.path.abspath(os.path.dirname(__file__))
+
+shorthands = {
+  'PAD_ALL': ['PAD_TOP', 'PAD_BOTTOM', 'PAD_LEFT', 'PAD_RIGHT'],
+  'PAD_HOR': ['PAD_LEFT', 'PAD_RIGHT'],
+  'PAD_VER': ['PAD_TOP', 'PAD_BOTTOM'],
+  'PAD_GAP': ['PAD_ROW', 'PAD_COLUMN'],
+  'SIZE':    ['WIDTH', 'HEIGHT'],
+}
+
+def read_prop_ids():
+  """Get the ID of the built-in properties from the `lv_style_prop_t` enum"""
+  ids = {}
+  with open(base_dir + '/../src/misc/lv_style.h') as f:
+    for line in f:
+      m = re.match(r'\s*LV_STYLE_(\w+)\s*=\s*(\d+)\s*[|,]', line)
+      if m: ids[m.group(1)] = int(m.group(2))
+  return ids
+
+def prop_group(prop_id):
+  """The same as `_lv_style_get_prop_group()`"""
+  return min((prop_id & 0x1FF) >> 4, 7)
+
+def color_to_c(v):
+  m = re.fullmatch(r'#([0-9a-fA-F]{2})([0-9a-fA-F]{2})([0-9a-fA-F]{2})', v)
+  if m is None: return None
+  return "LV_COLOR_MAKE(0x%s, 0x%s, 0x%s)" % (m.group(1).upper(), m.group(2).upper(), m.group(3).upper())
+
+class Generator:
+  def __init__(self, dsc):
+    self.dsc = dsc
+    self.prefix = dsc['prefix']
+    self.axes = dsc.get('variants', [])
+    self.symbols = dsc.get('symbols', {})
+    self.prop_ids = read_prop_ids()
+    self.variants = list(itertools.product(*[a['values'] for a in self.axes])) or [()]
+
+  def select(self, value, variant):
+    """Select the value of a variant from an object keyed by the values of an axis"""
+    while isinstance(value, dict):
+      for axis_value in variant:
+        if axis_value in value:
+          value = value[axis_value]
+          break
+      else:
+        sys.exit("No value for variant %s in %s" % (str(variant), str(value)))
+    return value
+
+  def resolve(self, value, variant):
+    value = self.select(value, variant)
+    if value is None: return None
+    if not isinstance(value, str): return str(value).lower() if isinstance(value, bool) else str(value)
+
+    color = color_to_c(value)
+    if color: return color
+
+    def sym(m):
+      v = self.resolve(self.symbols[m.group(0)], variant)
+      return v if v.startswith("LV_COLOR_MAKE") else "(" + v + ")"
+
+    if self.symbols:
+      value = re.sub(r'\b(' + '|'.join(map(re.escape, self.symbols.keys())) + r')\b', sym, value)
+    return value
+
+  def props_of(self, style, variant):
+    """Get the sorted (name, value) pairs of a style in a variant"""
+    props = {}
+    for name, value in style['props'].items():
+      v = self.resolve(value, variant)
+      for n in shorthands.get(name, [name]):
+        if n not in self.prop_ids: sys.exit("Unknown property: " + n)
+        if v is None: props.pop(n, None)
+        else: props[n] = v
+    return sorted(props.items(), key=lambda p: self.prop_ids[p[0]])
+
+  def print_value(self, name, value):
+    if not re.fullmatch(r'\w+(\(.*\))?', value): value = "(" + value + ")"
+    print("    LV_STYLE_CONST_" + name + "(" + value + "),")
+
+  def style(self, style):
+    name = self.prefix + "_" + style['name']
+    tables = []
+    table_idx = []
+    for variant in self.variants:
+      props = self.props_of(style, variant)
+      if props not in tables: tables.append(props)
+      table_idx.append(tables.index(props))
+
+    if 'if' in style: print("#if " + style['if'])
+    for i, props in enumerate(tables):
+      print("static const lv_style_const_prop_t " + name + "_props_" + str(i) + "[] = {")
+      for p in props: self.print_value(p[0], p[1])
+      print("    { .prop = LV_STYLE_PROP_INV }")
+      print("};")
+      print("")
+
+    print("static const lv_style_t " + name + "[" + self.prefix.upper() + "_VARIANT_CNT] = {")
+    for i, variant in zip(table_idx, self.variants):
+      groups = 0
+      for p in tables[i]: groups |= 1 << prop_group(self.prop_ids[p[0]])
+      print("    LV_STYLE_CONST_INITIALIZER(" + name + "_props_" + str(i) + ", 0x%02X)," % groups +
+            (" /*" + ", ".join(variant) + "*/" if variant else ""))
+    print("};")
+    if 'if' in style: print("#endif")
+    print("")
+
+  def init_function(self):
+    init = self.dsc['init']
+    print("static void " + init['function'] + "(uint32_t variant)")
+    print("{")
+    for style in self.dsc['styles']:
+      if 'if' in style: print("#if " + style['if'])
+      target = init['target'].replace("{}", style['name'])
+      print("    " + init['set'] + "(&" + target + ", &" + self.prefix + "_" + style['name'] + "[variant]);")
+      if 'if' in style: print("#endif")
+    print("}")
+    print("")
+
+  def run(self, out_name):
+    P = self.prefix.upper()
+    print("/**")
+    print(" * @file " + out_name)
+    print(" * Constant style tables generated by scripts/style_const_gen.py. Don't edit.")
+    print(" */")
+    print("")
+    for d, v in self.dsc.get('defines', {}).items():
+      print("#define " + d + " " + v)
+    print("")
+
+    cnt = 1
+    for a in self.axes:
+      for i, v in enumerate(a['values']):
+        print("#define " + P + "_" + a['name'].upper() + "_" + v.upper() + " " + str(i))
+      cnt *= len(a['values'])
+    print("#define " + P + "_VARIANT_CNT " + str(cnt))
+
+    if self.axes:
+      args = ", ".join(a['name'] for a in self.axes)
+      expr = "(" + self.axes[0]['name'] + ")"
+      for a in self.axes[1:]:
+        expr = "(" + expr + " * " + str(len(a['values'])) + " + (" + a['name'] + "))"
+      print("#define " + P + "_VARIANT(" + args + ") " + expr)
+    print("")
+
+    for style in self.dsc['styles']:
+      self.style(style)
+
+    if 'init' in self.dsc: self.init_function()
+
+    for d in self.dsc.get('defines', {}).keys():
+      print("#undef " + re.sub(r'\(.*', '', d))
+
+if len(sys.argv) == 3:
+  dsc_path = sys.argv[1]
+  out_path = sys.argv[2]
+else:
+  dsc_path = base_dir + '/lv_theme_default_styles.json'
+  out_path = base_dir + '/../src/extra/themes/default/lv_theme_default_styles.h'
+
+with open(dsc_path) as f:
+  dsc = json.load(f)
+
+sys.stdout = open(out_path, 'w')
+Generator(dsc).run(os.path.basename(out_path))
@@ -12,6 +12,7 @@ CSRCS += lv_obj_style_gen.c
 CSRCS += lv_obj_tree.c
 CSRCS += lv_event.c
 CSRCS += lv_refr.c
+CSRCS += lv_refr_profiler.c
 CSRCS += lv_theme.c
 
 DEPPATH += --dep-path $(LVGL_DIR)/$(LVGL_DIR_NAME)/src/core
@@ -38,6 +38,8 @@
 /*********************
  *      DEFINES
  *********************/
+#undef LV_MEM_FILE_TAG
+#define LV_MEM_FILE_TAG LV_MEM_TAG_OBJ
 #define MY_CLASS &lv_obj_class
 #define LV_OBJ_DEF_WIDTH    (LV_DPX(100))
 #define LV_OBJ_DEF_HEIGHT   (LV_DPX(50))
@@ -65,6 +67,7 @@ static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state);
  **********************/
 static bool lv_initialized = false;
 const lv_obj_class_t lv_obj_class = {
+    .name = "obj",
     .constructor_cb = lv_obj_constructor,
     .destructor_cb = lv_obj_destructor,
     .event_cb = lv_obj_event,
@@ -173,6 +176,9 @@ void lv_init(void)
 
 void lv_deinit(void)
 {
+#if LV_DRAW_COMPLEX
+    _lv_draw_mask_cleanup();
+#endif
     _lv_gc_clear_roots();
 
     lv_disp_set_default(NULL);
@@ -408,6 +414,9 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_obj_remove_style_all(obj);
     lv_obj_enable_style_refresh(true);
 
+    /*A new object might be created on the same address*/
+    _lv_obj_style_inherit_invalidate(obj);
+
     /*Remove the animations from this object*/
     lv_anim_del(obj, NULL);
 
@@ -783,6 +792,7 @@ static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
 
     lv_state_t prev_state = obj->state;
     obj->state = new_state;
+    _lv_obj_style_inherit_invalidate(obj);    /*The children might inherit other values*/
 
     _lv_style_state_cmp_t cmp_res = _lv_obj_style_state_compare(obj, prev_state, new_state);
     /*If there is no difference in styles there is nothing else to do*/
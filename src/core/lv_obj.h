@@ -181,6 +181,8 @@ typedef struct _lv_obj_t {
     uint16_t style_cnt  :6;
     uint16_t h_layout   :1;
     uint16_t w_layout   :1;
+    uint16_t batch_pending :1;  /**< Created in a batch and not refreshed yet*/
+    uint16_t theme_pending :1;  /**< Created in a batch and the theme is not applied yet*/
 }lv_obj_t;
 
 
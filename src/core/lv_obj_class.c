@@ -12,6 +12,8 @@
 /*********************
  *      DEFINES
  *********************/
+#undef LV_MEM_FILE_TAG
+#define LV_MEM_FILE_TAG LV_MEM_TAG_OBJ
 #define MY_CLASS &lv_obj_class
 
 /**********************
@@ -27,10 +29,13 @@
  **********************/
 static void lv_obj_construct(lv_obj_t * obj);
 static uint32_t get_instance_size(const lv_obj_class_t * class_p);
+static void batch_finish(lv_obj_t * obj);
+static void batch_finish_obj(lv_obj_t * obj);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+static uint32_t batch_depth;
 
 /**********************
  *      MACROS
@@ -102,19 +107,30 @@ void lv_obj_class_init_obj(lv_obj_t * obj)
     lv_obj_mark_layout_as_dirty(obj);
     lv_obj_enable_style_refresh(false);
 
-    lv_theme_apply(obj);
+    /*In a batch the theme and the rest will be applied in `lv_obj_batch_end()`*/
+    if(batch_depth) {
+        obj->batch_pending = 1;
+        obj->theme_pending = 1;
+    }
+    else {
+        lv_theme_apply(obj);
+    }
+
     lv_obj_construct(obj);
 
     lv_obj_enable_style_refresh(true);
-    lv_obj_refresh_style(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
-
-    lv_obj_refresh_self_size(obj);
 
     lv_group_t * def_group = lv_group_get_default();
     if(def_group && lv_obj_is_group_def(obj)) {
         lv_group_add_obj(def_group, obj);
     }
 
+    if(obj->batch_pending) return;
+
+    lv_obj_refresh_style(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
+
+    lv_obj_refresh_self_size(obj);
+
     lv_obj_t * parent = lv_obj_get_parent(obj);
     if(parent) {
         /*Call the ancestor's event handler to the parent to notify it about the new child.
@@ -139,6 +155,39 @@ void _lv_obj_destruct(lv_obj_t * obj)
     }
 }
 
+void lv_obj_batch_begin(void)
+{
+    batch_depth++;
+}
+
+void lv_obj_batch_end(void)
+{
+    if(batch_depth == 0) {
+        LV_LOG_WARN("lv_obj_batch_end: no batch is started");
+        return;
+    }
+
+    batch_depth--;
+    if(batch_depth) return;
+
+    /*Find the objects created in the batch on all displays*/
+    lv_disp_t * d = lv_disp_get_next(NULL);
+    while(d) {
+        uint32_t i;
+        for(i = 0; i < d->screen_cnt; i++) {
+            batch_finish(d->screens[i]);
+        }
+        batch_finish(d->top_layer);
+        batch_finish(d->sys_layer);
+        d = lv_disp_get_next(d);
+    }
+}
+
+bool lv_obj_is_batch_active(void)
+{
+    return batch_depth ? true : false;
+}
+
 bool lv_obj_is_editable(lv_obj_t * obj)
 {
     const lv_obj_class_t * class_p = obj->class_p;
@@ -185,6 +234,57 @@ static void lv_obj_construct(lv_obj_t * obj)
     if(obj->class_p->constructor_cb) obj->class_p->constructor_cb(obj->class_p, obj);
 }
 
+/**
+ * Search the objects created in a batch and finish their initialization
+ * @param obj pointer to an object whose children should be checked too
+ */
+static void batch_finish(lv_obj_t * obj)
+{
+    if(obj == NULL) return;
+
+    if(obj->batch_pending) {
+        /*All the children are refreshed too, so invalidating only the top most pending object is enough*/
+        batch_finish_obj(obj);
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+        batch_finish(lv_obj_get_child(obj, i));
+    }
+}
+
+/**
+ * Do the deferred part of `lv_obj_class_init_obj()` on an object and its children.
+ * It's the same as `lv_obj_refresh_style(obj, LV_PART_ANY, LV_STYLE_PROP_ANY)` but
+ * the children are handled only once.
+ * @param obj pointer to an object
+ */
+static void batch_finish_obj(lv_obj_t * obj)
+{
+    /*Still pending to skip the invalidations*/
+    obj->batch_pending = 1;
+    if(obj->theme_pending) _lv_obj_style_apply_pending_theme(obj);
+    lv_event_send(obj, LV_EVENT_STYLE_CHANGED, NULL);
+    lv_obj_mark_layout_as_dirty(obj);
+    lv_obj_refresh_ext_draw_size(obj);
+    lv_obj_refresh_self_size(obj);
+    obj->batch_pending = 0;
+
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+        batch_finish_obj(lv_obj_get_child(obj, i));
+    }
+
+    /*Notify the parent about the new child. Also triggers layout update*/
+    lv_obj_t * parent = lv_obj_get_parent(obj);
+    if(parent) {
+        lv_obj_mark_layout_as_dirty(parent);
+        lv_event_send(parent, LV_EVENT_CHILD_CHANGED, obj);
+    }
+}
+
 static uint32_t get_instance_size(const lv_obj_class_t * class_p)
 {
     /*Find a base in which instance size is set*/
@@ -54,6 +54,7 @@ typedef struct _lv_obj_class_t {
     void * user_data;
 #endif
     void (*event_cb)(const struct _lv_obj_class_t * class_p, struct _lv_event_t * e);  /**< Widget type specific event function*/
+    const char * name;                 /**< Name of the class, e.g. "btn". Used only for debugging.*/
     lv_coord_t width_def;
     lv_coord_t height_def;
     uint32_t editable : 2;             /**< Value from ::lv_obj_class_editable_t*/
@@ -81,6 +82,27 @@ bool lv_obj_is_editable(struct _lv_obj_t * obj);
 
 bool lv_obj_is_group_def(struct _lv_obj_t * obj);
 
+/**
+ * Start creating objects in a batch. Until `lv_obj_batch_end()` the theme, style refresh,
+ * extra draw size calculation, invalidation and layout update of the new objects are deferred.
+ * Useful to speed up building large screens. Batches can be nested.
+ * @note the theme's style properties and the size of the objects created in the batch
+ *       are not available until the end of the batch
+ */
+void lv_obj_batch_begin(void);
+
+/**
+ * Finish creating objects in a batch. Apply the theme, refresh the style, size and layout of the objects
+ * created since `lv_obj_batch_begin()` and invalidate them.
+ */
+void lv_obj_batch_end(void);
+
+/**
+ * Tell whether objects are being created in a batch
+ * @return true: `lv_obj_batch_begin()` was called without a closing `lv_obj_batch_end()`
+ */
+bool lv_obj_is_batch_active(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -10,6 +10,7 @@
 #include "lv_disp.h"
 #include "lv_refr.h"
 #include "../misc/lv_gc.h"
+#include "../misc/lv_trace.h"
 
 /*********************
  *      DEFINES
@@ -301,7 +302,9 @@ void lv_obj_update_layout(const lv_obj_t * obj)
     while(scr->scr_layout_inv) {
         LV_LOG_INFO("Layout update begin")
         scr->scr_layout_inv = 0;
+        LV_TRACE_BEGIN("layout");
         layout_update_core(scr);
+        LV_TRACE_END("layout");
         LV_LOG_TRACE("Layout update end")
     }
 
@@ -770,6 +773,9 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*The objects created in a batch are invalidated at the end of the batch*/
+    if(obj->batch_pending) return;
+
     lv_area_t area_tmp;
     lv_area_copy(&area_tmp, area);
     bool visible = lv_obj_area_is_visible(obj, &area_tmp);
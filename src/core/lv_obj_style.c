@@ -8,11 +8,14 @@
  *********************/
 #include "lv_obj.h"
 #include "lv_disp.h"
+#include "lv_theme.h"
 #include "../misc/lv_gc.h"
 
 /*********************
  *      DEFINES
  *********************/
+#undef LV_MEM_FILE_TAG
+#define LV_MEM_FILE_TAG LV_MEM_TAG_STYLE
 #define MY_CLASS &lv_obj_class
 
 /**********************
@@ -35,6 +38,18 @@ typedef enum {
     CACHE_NEED_CHECK = 4,
 }cache_t;
 
+/*A resolved value of an inherited property*/
+typedef struct {
+    const lv_obj_t * obj;
+    const lv_obj_t * obj_found;     /*Where the value was found. NULL if it's the default value*/
+    lv_style_value_t value;
+    uint32_t gen;                   /*Valid only while `_lv_style_get_inherit_gen()` returns this*/
+    lv_part_t part;
+    lv_part_t part_found;
+    uint16_t prop;
+    lv_state_t state;
+} inherit_cache_t;
+
 /**********************
  *  GLOBAL PROTOTYPES
  **********************/
@@ -46,7 +61,17 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
 static _lv_obj_style_t * get_trans_style(lv_obj_t * obj, uint32_t part);
 static bool get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v);
 static lv_style_value_t apply_color_filter(const lv_obj_t * obj, uint32_t part, lv_style_value_t v);
-static void report_style_change_core(void * style, lv_obj_t * obj);
+#if LV_STYLE_INHERIT_CACHE_SIZE
+static inherit_cache_t * inherit_cache_get(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
+static lv_style_value_t get_prop_inherit_cached(const lv_obj_t ** obj_p, lv_part_t * part_p, lv_style_prop_t prop);
+#endif
+static void set_obj_style_prop(lv_obj_t * obj, lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value);
+static bool remove_obj_style_prop(lv_obj_t * obj, lv_style_t * style, lv_style_prop_t prop);
+static void report_style_change_core(lv_obj_t * obj);
+static bool has_normal_style(const lv_obj_t * obj, const lv_style_t * style);
+static _lv_obj_style_users_t * style_users_find(const lv_style_t * style, uint32_t * idx);
+static void style_users_add(lv_obj_t * obj, const lv_style_t * style);
+static void style_users_remove(lv_obj_t * obj, const lv_style_t * style);
 static void refresh_children_style(lv_obj_t * obj);
 static bool trans_del(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
 static void trans_anim_cb(void * _tr, int32_t v);
@@ -59,6 +84,12 @@ static void fade_in_anim_ready(lv_anim_t * a);
  *  STATIC VARIABLES
  **********************/
 static bool style_refr = true;
+static uint32_t style_users_cnt;
+static uint32_t style_users_cap;
+#if LV_STYLE_INHERIT_CACHE_SIZE
+static inherit_cache_t inherit_cache[LV_STYLE_INHERIT_CACHE_SIZE];
+static lv_obj_style_inherit_cache_monitor_t inherit_cache_mon;
+#endif
 
 /**********************
  *      MACROS
@@ -71,12 +102,22 @@ static bool style_refr = true;
 void _lv_obj_style_init(void)
 {
     _lv_ll_init(&LV_GC_ROOT(_lv_obj_style_trans_ll), sizeof(trans_t));
+    LV_GC_ROOT(_lv_obj_style_users) = NULL;
+    style_users_cnt = 0;
+    style_users_cap = 0;
+#if LV_STYLE_INHERIT_CACHE_SIZE
+    lv_memset_00(inherit_cache, sizeof(inherit_cache));
+    lv_memset_00(&inherit_cache_mon, sizeof(inherit_cache_mon));
+#endif
 }
 
 void lv_obj_add_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t selector)
 {
     trans_del(obj, selector, LV_STYLE_PROP_ANY, NULL);
 
+    if(!has_normal_style(obj, style)) style_users_add(obj, style);
+    _lv_obj_style_inherit_invalidate(obj);
+
     uint32_t i;
     /*Go after the transition and local styles*/
     for(i = 0; i < obj->style_cnt; i++) {
@@ -110,6 +151,13 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
     lv_style_prop_t prop = LV_STYLE_PROP_ANY;
     if(style && style->prop_cnt == 0) prop = LV_STYLE_PROP_INV;
 
+    /*The theme of the objects created in a batch is not applied yet.
+     *It needs to be applied only if some of its styles might remain.*/
+    if(obj->theme_pending) {
+        if(style == NULL && selector == (LV_PART_ANY | LV_STATE_ANY)) obj->theme_pending = 0;
+        else _lv_obj_style_apply_pending_theme(obj);
+    }
+
     uint32_t i = 0;
     bool deleted = false;
     while(i <  obj->style_cnt) {
@@ -127,11 +175,15 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
             trans_del(obj, part, LV_STYLE_PROP_ANY, NULL);
         }
 
+        lv_style_t * style_removed = NULL;
         if(obj->styles[i].is_local || obj->styles[i].is_trans) {
-            lv_style_reset(obj->styles[i].style);
+            _lv_style_reset_of_obj(obj->styles[i].style);
             lv_mem_free(obj->styles[i].style);
             obj->styles[i].style = NULL;
         }
+        else {
+            style_removed = obj->styles[i].style;
+        }
 
         /*Shift the styles after `i` by one*/
         uint32_t j;
@@ -142,10 +194,14 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
         obj->style_cnt--;
         obj->styles = lv_mem_realloc(obj->styles, obj->style_cnt * sizeof(_lv_obj_style_t));
 
+        /*The object is not a user of the style if it was added only with this selector*/
+        if(style_removed && !has_normal_style(obj, style_removed)) style_users_remove(obj, style_removed);
+
         deleted = true;
         /*The style from the current `i` index is removed, so `i` points to the next style.
          *Therefore it doesn't needs to be incremented*/
     }
+    if(deleted) _lv_obj_style_inherit_invalidate(obj);
     if(deleted && prop != LV_STYLE_PROP_INV) {
         lv_obj_refresh_style(obj, part, prop);
     }
@@ -154,14 +210,34 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
 void lv_obj_report_style_change(lv_style_t * style)
 {
     if(!style_refr) return;
-    lv_disp_t * d = lv_disp_get_next(NULL);
 
-    while(d) {
-        uint32_t i;
-        for(i = 0; i < d->screen_cnt; i++) {
-            report_style_change_core(style, d->screens[i]);
+    uint32_t i;
+    if(style == NULL) {
+        lv_disp_t * d = lv_disp_get_next(NULL);
+        while(d) {
+            for(i = 0; i < d->screen_cnt; i++) {
+                report_style_change_core(d->screens[i]);
+            }
+            d = lv_disp_get_next(d);
         }
-        d = lv_disp_get_next(d);
+
+        /*All changes are reported*/
+        for(i = 0; i < style_users_cnt; i++) {
+            lv_style_t * s = (lv_style_t *)LV_GC_ROOT(_lv_obj_style_users)[i].style;
+            if(!s->is_const || s->is_const_copy) s->changed_flags = 0;
+        }
+        return;
+    }
+
+    /*Constant styles have no changed flags*/
+    lv_style_prop_t prop = style->is_const && !style->is_const_copy ? LV_STYLE_PROP_ANY : style->changed_flags;
+    if(!style->is_const || style->is_const_copy) style->changed_flags = 0;
+
+    /*Look up the users in every iteration because an event handler might add or remove styles*/
+    for(i = 0; ; i++) {
+        _lv_obj_style_users_t * users = style_users_find(style, NULL);
+        if(users == NULL || i >= users->obj_cnt) break;
+        lv_obj_refresh_style(users->objs[i], LV_PART_ANY, prop);
     }
 }
 
@@ -169,7 +245,8 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
-    if(!style_refr) return;
+    /*The objects created in a batch are refreshed at the end of the batch*/
+    if(!style_refr || obj->batch_pending) return;
 
     lv_obj_invalidate(obj);
 
@@ -211,6 +288,15 @@ lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_
     if(filter) {
         prop &= ~LV_STYLE_PROP_FILTER;
     }
+
+#if LV_STYLE_INHERIT_CACHE_SIZE
+    if(inherit) {
+        value_act = get_prop_inherit_cached(&obj, &part, prop);
+        if(filter) value_act = apply_color_filter(obj, part, value_act);
+        return value_act;
+    }
+#endif
+
     bool found = false;
     while(obj) {
         found = get_prop_core(obj, part, prop, &value_act);
@@ -251,7 +337,7 @@ lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_
 void lv_obj_set_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_style_value_t value, lv_style_selector_t selector)
 {
     lv_style_t * style = get_local_style(obj, selector);
-    lv_style_set_prop(style, prop, value);
+    set_obj_style_prop(obj, style, prop, value);
     lv_obj_refresh_style(obj, selector, prop);
 }
 
@@ -286,7 +372,7 @@ bool lv_obj_remove_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_sty
     /*The style is not found*/
     if(i == obj->style_cnt) return false;
 
-    return lv_style_remove_prop(obj->styles[i].style, prop);
+    return remove_obj_style_prop(obj, obj->styles[i].style, prop);
 }
 
 void _lv_obj_style_create_transition(lv_obj_t * obj, lv_part_t part, lv_state_t prev_state, lv_state_t new_state, const _lv_obj_style_transition_dsc_t * tr_dsc)
@@ -307,7 +393,7 @@ void _lv_obj_style_create_transition(lv_obj_t * obj, lv_part_t part, lv_state_t
     obj->state = new_state;
 
     _lv_obj_style_t * style_trans = get_trans_style(obj, part);
-    lv_style_set_prop(style_trans->style, tr_dsc->prop, v1);   /*Be sure `trans_style` has a valid value*/
+    set_obj_style_prop(obj, style_trans->style, tr_dsc->prop, v1);   /*Be sure `trans_style` has a valid value*/
 
     if(tr_dsc->prop == LV_STYLE_RADIUS) {
         if(v1.num == LV_RADIUS_CIRCLE || v2.num == LV_RADIUS_CIRCLE) {
@@ -449,6 +535,85 @@ lv_part_t lv_obj_style_get_selector_part(lv_style_selector_t selector)
     return selector & 0xFF0000;
 }
 
+void lv_obj_style_inherit_cache_monitor(lv_obj_style_inherit_cache_monitor_t * mon_p)
+{
+#if LV_STYLE_INHERIT_CACHE_SIZE
+    *mon_p = inherit_cache_mon;
+#else
+    lv_memset_00(mon_p, sizeof(lv_obj_style_inherit_cache_monitor_t));
+#endif
+}
+
+void _lv_obj_style_inherit_invalidate(const lv_obj_t * obj)
+{
+#if LV_STYLE_INHERIT_CACHE_SIZE
+    /*The objects created in a batch are not cached until the end of the batch (see `get_prop_inherit_cached()`)*/
+    if(obj->batch_pending) return;
+
+    inherit_cache_mon.inv_cnt++;
+
+    /*Drop the values of the object and its descendants, they might inherit from the object*/
+    bool has_children = obj->spec_attr && obj->spec_attr->child_cnt;
+    uint32_t i;
+    for(i = 0; i < LV_STYLE_INHERIT_CACHE_SIZE; i++) {
+        const lv_obj_t * o = inherit_cache[i].obj;
+        if(has_children) {
+            while(o && o != obj) o = o->parent;
+        }
+
+        if(o == obj) inherit_cache[i].obj = NULL;
+    }
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
+void _lv_obj_style_apply_pending_theme(lv_obj_t * obj)
+{
+    obj->theme_pending = 0;
+
+    /*Apply the theme without the current styles*/
+    _lv_obj_style_t * styles = obj->styles;
+    uint32_t style_cnt = obj->style_cnt;
+    obj->styles = NULL;
+    obj->style_cnt = 0;
+    lv_theme_apply(obj);
+
+    if(obj->style_cnt == 0) {
+        lv_mem_free(obj->styles);
+        obj->styles = styles;
+        obj->style_cnt = style_cnt;
+        return;
+    }
+
+    /*Put the current styles before the theme's styles to keep their precedence*/
+    _lv_obj_style_t * theme_styles = obj->styles;
+    uint32_t theme_style_cnt = obj->style_cnt;
+    obj->styles = lv_mem_realloc(styles, (style_cnt + theme_style_cnt) * sizeof(_lv_obj_style_t));
+    LV_ASSERT_MALLOC(obj->styles);
+    lv_memcpy(&obj->styles[style_cnt], theme_styles, theme_style_cnt * sizeof(_lv_obj_style_t));
+    lv_mem_free(theme_styles);
+    obj->style_cnt = style_cnt + theme_style_cnt;
+
+    /*The theme added the object to the users of its styles again if they were added earlier too*/
+    uint32_t i;
+    for(i = style_cnt; i < obj->style_cnt; i++) {
+        lv_style_t * style = obj->styles[i].style;
+
+        /*The theme might add a style with more selectors, handle it only once*/
+        uint32_t j = style_cnt;
+        while(j < i && obj->styles[j].style != style) j++;
+        if(j < i) continue;
+
+        for(j = 0; j < style_cnt; j++) {
+            if(obj->styles[j].style == style && !obj->styles[j].is_local && !obj->styles[j].is_trans) {
+                style_users_remove(obj, style);
+                break;
+            }
+        }
+    }
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -485,7 +650,7 @@ static lv_style_t * get_local_style(lv_obj_t * obj,  lv_style_selector_t selecto
 
     lv_memset_00(&obj->styles[i], sizeof(_lv_obj_style_t));
     obj->styles[i].style = lv_mem_alloc(sizeof(lv_style_t));
-    lv_style_init(obj->styles[i].style);
+    _lv_style_init_of_obj(obj->styles[i].style);
     obj->styles[i].is_local = 1;
     obj->styles[i].selector = selector;
     return obj->styles[i].style;
@@ -518,7 +683,7 @@ static _lv_obj_style_t * get_trans_style(lv_obj_t * obj,  lv_style_selector_t se
 
     lv_memset_00(&obj->styles[0], sizeof(_lv_obj_style_t));
     obj->styles[0].style = lv_mem_alloc(sizeof(lv_style_t));
-    lv_style_init(obj->styles[0].style);
+    _lv_style_init_of_obj(obj->styles[0].style);
     obj->styles[0].is_trans = 1;
     obj->styles[0].selector = selector;
     return &obj->styles[0];
@@ -598,24 +763,274 @@ static lv_style_value_t apply_color_filter(const lv_obj_t * obj, uint32_t part,
     return v;
 }
 
+#if LV_STYLE_INHERIT_CACHE_SIZE
 /**
- * Refresh the style of all children of an object. (Called recursively)
- * @param style refresh objects only with this
+ * Get the cache entry where an inherited value of an object can be stored.
+ * The bits are mixed because the objects are allocated next to each other and
+ * their addresses would map only to a few entries.
+ * @param obj   pointer to an object
+ * @param part  the part of the object
+ * @param prop  an inherited property
+ * @return      pointer to the cache entry
+ */
+static inherit_cache_t * inherit_cache_get(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+    uint32_t h = (uint32_t)((lv_uintptr_t)obj >> 3) ^ ((uint32_t)prop << 16) ^ (part >> 16);
+    h *= 2654435761U;   /*Knuth's multiplicative hash*/
+    return &inherit_cache[(h >> 16) % LV_STYLE_INHERIT_CACHE_SIZE];
+}
+
+/**
+ * Get the value of an inherited property using and updating the cache.
+ * The resolved value is cached for every object on the way to the ancestor having the value,
+ * so e.g. the siblings of the object will find it in the cache of their parent.
+ * @param obj_p pointer to the object. Will be set to where the value was found or NULL if not found
+ * @param part_p pointer to the part. Will be set to the part where the value was found
+ * @param prop an inherited property (without the filter flag)
+ * @return the value of the property
+ */
+static lv_style_value_t get_prop_inherit_cached(const lv_obj_t ** obj_p, lv_part_t * part_p, lv_style_prop_t prop)
+{
+    uint32_t gen = _lv_style_get_inherit_gen();
+    const lv_obj_t * obj = *obj_p;
+    lv_part_t part = *part_p;
+    inherit_cache_t res;
+    bool cacheable = true;
+    bool hit = false;
+    while(1) {
+        if(obj == NULL) {
+            res.value = lv_style_prop_get_default(prop);
+            res.obj_found = NULL;
+            res.part_found = part;
+            break;
+        }
+
+        /*The transitions are skipped temporarily, don't cache such values.
+         *The styles of the objects created in a batch change a lot until the end of the batch, don't cache them either.*/
+        if(obj->skip_trans || obj->batch_pending) cacheable = false;
+
+        if(cacheable) {
+            inherit_cache_t * c = inherit_cache_get(obj, part, prop);
+            if(c->gen == gen && c->obj == obj && c->part == part && c->prop == prop && c->state == obj->state) {
+                res = *c;
+                hit = true;
+                break;
+            }
+        }
+
+        if(get_prop_core(obj, part, prop, &res.value)) {
+            res.obj_found = obj;
+            res.part_found = part;
+            break;
+        }
+
+        /*If not found, check the `MAIN` style first*/
+        if(part != LV_PART_MAIN) part = LV_PART_MAIN;
+        else obj = lv_obj_get_parent(obj); /*Check the parent too*/
+    }
+
+    if(hit) inherit_cache_mon.hit_cnt++;
+    else inherit_cache_mon.miss_cnt++;
+
+    if(cacheable) {
+        /*Store the value for each object on the way, they have the same value*/
+        const lv_obj_t * obj_stop = obj;
+        lv_part_t part_stop = part;
+        obj = *obj_p;
+        part = *part_p;
+        while(obj) {
+            inherit_cache_t * c = inherit_cache_get(obj, part, prop);
+            *c = res;
+            c->obj = obj;
+            c->part = part;
+            c->prop = prop;
+            c->state = obj->state;
+            c->gen = gen;
+
+            if(obj == obj_stop && part == part_stop) break;
+
+            if(part != LV_PART_MAIN) part = LV_PART_MAIN;
+            else obj = lv_obj_get_parent(obj);
+        }
+    }
+
+    *obj_p = res.obj_found;
+    *part_p = res.part_found;
+    return res.value;
+}
+#endif
+
+/**
+ * Set a property in a local or transition style of an object.
+ * Only the object and its children can inherit the new value so only their cached values are invalidated.
+ * @param obj   pointer to an object
+ * @param style the local or transition style of `obj`
+ * @param prop  the property to set
+ * @param value the new value
+ */
+static void set_obj_style_prop(lv_obj_t * obj, lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value)
+{
+    _lv_style_set_prop_of_obj(style, prop, value);
+    if(prop & LV_STYLE_PROP_INHERIT) _lv_obj_style_inherit_invalidate(obj);
+}
+
+/**
+ * Remove a property from a local or transition style of an object.
+ * @param obj   pointer to an object
+ * @param style the local or transition style of `obj`
+ * @param prop  the property to remove
+ * @return true: the property was found and removed; false: the property wasn't found
+ */
+static bool remove_obj_style_prop(lv_obj_t * obj, lv_style_t * style, lv_style_prop_t prop)
+{
+    if(_lv_style_remove_prop_of_obj(style, prop) == false) return false;
+
+    if(prop & LV_STYLE_PROP_INHERIT) _lv_obj_style_inherit_invalidate(obj);
+    return true;
+}
+
+/**
+ * Refresh the style of an object and all of its children (Called recursively)
+ * according to the changed properties of their styles.
  * @param obj pointer to an object
  */
-static void report_style_change_core(void * style, lv_obj_t * obj)
+static void report_style_change_core(lv_obj_t * obj)
 {
     uint32_t i;
-    for(i = 0; i < obj->style_cnt; i++) {
-        if(style == NULL || obj->styles[i].style == style) {
-            lv_obj_refresh_style(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
-            break;
+    if(obj->style_cnt) {
+        uint32_t prop = 0;
+        for(i = 0; i < obj->style_cnt; i++) {
+            /*The changes of the local and transition styles are refreshed immediately*/
+            if(obj->styles[i].is_local || obj->styles[i].is_trans) continue;
+            const lv_style_t * style = obj->styles[i].style;
+            if(style->is_const && !style->is_const_copy) prop = LV_STYLE_PROP_ANY;
+            else prop |= style->changed_flags;
         }
+        lv_obj_refresh_style(obj, LV_PART_ANY, (lv_style_prop_t)prop);
     }
 
     uint32_t child_cnt = lv_obj_get_child_cnt(obj);
     for(i = 0; i < child_cnt; i++) {
-        report_style_change_core(style, lv_obj_get_child(obj, i));
+        report_style_change_core(lv_obj_get_child(obj, i));
+    }
+}
+
+/**
+ * Check if an object has a style (not counting the local and transition styles)
+ * @param obj pointer to an object
+ * @param style pointer to a style
+ * @return true: the style is added to the object with any selector
+ */
+static bool has_normal_style(const lv_obj_t * obj, const lv_style_t * style)
+{
+    uint32_t i;
+    for(i = 0; i < obj->style_cnt; i++) {
+        if(obj->styles[i].style == style && !obj->styles[i].is_local && !obj->styles[i].is_trans) return true;
+    }
+    return false;
+}
+
+/**
+ * Find the users of a style. The list of users is ordered by the address of the styles.
+ * @param style pointer to a style
+ * @param idx store the index of the style's users or where they should be inserted. Can be NULL.
+ * @return pointer to the users of the style or NULL if the style has no users
+ */
+static _lv_obj_style_users_t * style_users_find(const lv_style_t * style, uint32_t * idx)
+{
+    _lv_obj_style_users_t * list = LV_GC_ROOT(_lv_obj_style_users);
+    uint32_t first = 0;
+    uint32_t last = style_users_cnt;
+    while(first < last) {
+        uint32_t mid = (first + last) / 2;
+        if((lv_uintptr_t)list[mid].style < (lv_uintptr_t)style) first = mid + 1;
+        else last = mid;
+    }
+
+    if(idx) *idx = first;
+    if(first < style_users_cnt && list[first].style == style) return &list[first];
+    else return NULL;
+}
+
+/**
+ * Add an object to the users of a style
+ * @param obj pointer to an object
+ * @param style pointer to a style which is not used by the object yet
+ */
+static void style_users_add(lv_obj_t * obj, const lv_style_t * style)
+{
+    uint32_t idx;
+    _lv_obj_style_users_t * users = style_users_find(style, &idx);
+    if(users == NULL) {
+        _lv_obj_style_users_t * list = LV_GC_ROOT(_lv_obj_style_users);
+        if(style_users_cnt == style_users_cap) {
+            /*Grow geometrically to not reallocate on every new style*/
+            uint32_t new_cap = style_users_cap ? style_users_cap * 2 : 8;
+            list = lv_mem_realloc(list, new_cap * sizeof(_lv_obj_style_users_t));
+            LV_ASSERT_MALLOC(list);
+            if(list == NULL) return;
+            LV_GC_ROOT(_lv_obj_style_users) = list;
+            style_users_cap = new_cap;
+        }
+
+        uint32_t i;
+        for(i = style_users_cnt; i > idx; i--) {
+            list[i] = list[i - 1];
+        }
+        style_users_cnt++;
+
+        users = &list[idx];
+        lv_memset_00(users, sizeof(_lv_obj_style_users_t));
+        users->style = style;
+    }
+
+    if(users->obj_cnt == users->obj_cap) {
+        uint32_t new_cap = users->obj_cap ? users->obj_cap * 2 : 4;
+        lv_obj_t ** objs = lv_mem_realloc(users->objs, new_cap * sizeof(lv_obj_t *));
+        LV_ASSERT_MALLOC(objs);
+        if(objs == NULL) return;
+        users->objs = objs;
+        users->obj_cap = new_cap;
+    }
+
+    users->objs[users->obj_cnt] = obj;
+    users->obj_cnt++;
+}
+
+/**
+ * Remove an object from the users of a style
+ * @param obj pointer to an object
+ * @param style pointer to a style
+ */
+static void style_users_remove(lv_obj_t * obj, const lv_style_t * style)
+{
+    uint32_t idx;
+    _lv_obj_style_users_t * users = style_users_find(style, &idx);
+    if(users == NULL) return;
+
+    /*The recently added objects are usually deleted first so search from the end*/
+    uint32_t i;
+    for(i = users->obj_cnt; i > 0; i--) {
+        if(users->objs[i - 1] == obj) break;
+    }
+    if(i == 0) return;
+
+    /*The order of the users doesn't matter so just move the last one here. Keep the capacity.*/
+    users->objs[i - 1] = users->objs[users->obj_cnt - 1];
+    users->obj_cnt--;
+    if(users->obj_cnt) return;
+
+    /*No more users: remove the style from the list*/
+    lv_mem_free(users->objs);
+    style_users_cnt--;
+    for(i = idx; i < style_users_cnt; i++) {
+        LV_GC_ROOT(_lv_obj_style_users)[i] = LV_GC_ROOT(_lv_obj_style_users)[i + 1];
+    }
+
+    if(style_users_cnt == 0) {
+        lv_mem_free(LV_GC_ROOT(_lv_obj_style_users));
+        LV_GC_ROOT(_lv_obj_style_users) = NULL;
+        style_users_cap = 0;
     }
 }
 
@@ -665,7 +1080,7 @@ static bool trans_del(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, tran
             uint32_t i;
             for(i = 0; i < obj->style_cnt; i++) {
                 if(obj->styles[i].is_trans && (part == LV_PART_ANY || obj->styles[i].selector == part)) {
-                    lv_style_remove_prop(obj->styles[i].style, tr->prop);
+                    remove_obj_style_prop(obj, obj->styles[i].style, tr->prop);
                     lv_anim_del(tr, NULL);
                     _lv_ll_remove(&LV_GC_ROOT(_lv_obj_style_trans_ll), tr);
                     lv_mem_free(tr);
@@ -733,7 +1148,7 @@ static void trans_anim_cb(void * _tr, int32_t v)
                 refr = false;
             }
         }
-        lv_style_set_prop(obj->styles[i].style, tr->prop, value_final);
+        set_obj_style_prop(obj, obj->styles[i].style, tr->prop, value_final);
         if (refr) lv_obj_refresh_style(tr->obj, tr->selector, tr->prop);
         break;
 
@@ -758,7 +1173,7 @@ static void trans_anim_start_cb(lv_anim_t * a)
     tr->prop = prop_tmp;
 
     _lv_obj_style_t * style_trans = get_trans_style(tr->obj, tr->selector);
-    lv_style_set_prop(style_trans->style, tr->prop, tr->start_value);   /*Be sure `trans_style` has a valid value*/
+    set_obj_style_prop(tr->obj, style_trans->style, tr->prop, tr->start_value);   /*Be sure `trans_style` has a valid value*/
 
 }
 
@@ -788,7 +1203,7 @@ static void trans_anim_ready_cb(lv_anim_t * a)
                 lv_mem_free(tr);
 
                 _lv_obj_style_t * obj_style = &obj->styles[i];
-                lv_style_remove_prop(obj_style->style, prop);
+                remove_obj_style_prop(obj, obj_style->style, prop);
 
                 if(lv_style_is_empty(obj->styles[i].style)) {
                     lv_obj_remove_style(obj, obj_style->style, obj_style->selector);
@@ -43,6 +43,14 @@ typedef struct {
     uint32_t is_trans :1;
 }_lv_obj_style_t;
 
+/*The objects using a style. Used to find the objects to refresh when the style changes*/
+typedef struct {
+    const lv_style_t * style;
+    struct _lv_obj_t ** objs;
+    uint32_t obj_cnt;
+    uint32_t obj_cap;       /*Number of objects `objs` has space for*/
+}_lv_obj_style_users_t;
+
 typedef struct {
     uint16_t time;
     uint16_t delay;
@@ -54,6 +62,13 @@ typedef struct {
 #endif
 }_lv_obj_style_transition_dsc_t;
 
+/*Statistics of the cache of inherited style properties*/
+typedef struct {
+    uint32_t hit_cnt;       /*Number of inherited values found in the cache of the object or an ancestor*/
+    uint32_t miss_cnt;      /*Number of inherited values searched in the styles up to the ancestor having it*/
+    uint32_t inv_cnt;       /*Number of times the values of an object and its children were invalidated*/
+} lv_obj_style_inherit_cache_monitor_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -95,7 +110,8 @@ static inline void lv_obj_remove_style_all(struct _lv_obj_t * obj)
 }
 
 /**
- * Notify all object if a style is modified
+ * Notify all object if a style is modified.
+ * Only the refreshes required by the properties changed since the last report are done.
  * @param style     pointer to a style. Only the objects with this style will be notified
  *                  (NULL to notify all objects)
  */
@@ -191,6 +207,27 @@ lv_state_t lv_obj_style_get_selector_state(lv_style_selector_t selector);
 
 lv_part_t lv_obj_style_get_selector_part(lv_style_selector_t selector);
 
+/**
+ * Get the statistics of the inherited style property cache since `lv_init()`.
+ * All zero if `LV_STYLE_INHERIT_CACHE_SIZE` is 0.
+ * @param mon_p     pointer to a `lv_obj_style_inherit_cache_monitor_t` variable to store the result
+ */
+void lv_obj_style_inherit_cache_monitor(lv_obj_style_inherit_cache_monitor_t * mon_p);
+
+/**
+ * Invalidate the cached inherited style properties of an object and its descendants.
+ * Called when something changes which affects only the object's subtree, e.g. its state, styles or parent.
+ * @param obj       pointer to an object
+ */
+void _lv_obj_style_inherit_invalidate(const struct _lv_obj_t * obj);
+
+/**
+ * Apply the theme on an object created in a batch. The theme's styles are added with lower precedence
+ * than the styles added since the object was created, as if the theme was applied on creation.
+ * @param obj       pointer to an object
+ */
+void _lv_obj_style_apply_pending_theme(struct _lv_obj_t * obj);
+
 #include "lv_obj_style_gen.h"
 
 static inline void lv_obj_set_style_pad_all(struct _lv_obj_t * obj, lv_coord_t value, lv_style_selector_t selector) {
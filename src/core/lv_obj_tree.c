@@ -8,6 +8,7 @@
  *********************/
 #include "lv_obj.h"
 #include "lv_indev.h"
+#include "lv_refr_profiler.h"
 #include "../misc/lv_anim.h"
 #include "../misc/lv_gc.h"
 #include "../misc/lv_async.h"
@@ -15,6 +16,8 @@
 /*********************
  *      DEFINES
  *********************/
+#undef LV_MEM_FILE_TAG
+#define LV_MEM_FILE_TAG LV_MEM_TAG_OBJ
 #define MY_CLASS &lv_obj_class
 
 #if defined(LV_USER_DATA_FREE_INCLUDE)
@@ -176,6 +179,7 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
     parent->spec_attr->children[lv_obj_get_child_cnt(parent) - 1] = obj;
 
     obj->parent = parent;
+    _lv_obj_style_inherit_invalidate(obj);
 
     if(new_base_dir != LV_BASE_DIR_RTL) {
         lv_obj_set_pos(obj, old_pos.x, old_pos.y);
@@ -368,6 +372,10 @@ static void obj_del_core(lv_obj_t * obj)
         indev = lv_indev_get_next(indev);
     }
 
+#if LV_USE_REFR_PROFILER
+    _lv_refr_profiler_obj_deleted(obj);
+#endif
+
     /*All children deleted. Now clean up the object specific data*/
     _lv_obj_destruct(obj);
 
@@ -7,14 +7,18 @@
  *      INCLUDES
  *********************/
 #include <stddef.h>
+#include <string.h>
 #include "lv_refr.h"
 #include "lv_disp.h"
+#include "lv_refr_profiler.h"
 #include "../hal/lv_hal_tick.h"
 #include "../hal/lv_hal_disp.h"
 #include "../misc/lv_timer.h"
 #include "../misc/lv_mem.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_gc.h"
+#include "../misc/lv_trace.h"
+#include "../misc/lv_printf.h"
 #include "../draw/lv_draw.h"
 #include "../font/lv_font_fmt_txt.h"
 
@@ -25,10 +29,35 @@
 /*********************
  *      DEFINES
  *********************/
+/*Show the performance statistics on a label*/
+#if LV_USE_PERF_MONITOR && LV_PERF_MONITOR_SHOW_LABEL && LV_USE_LABEL
+    #define PERF_LABEL  1
+#else
+    #define PERF_LABEL  0
+#endif
+
+/*Number of buffers to rotate into while the previous one is being flushed*/
+#define ROT_BUF_CNT     2
+
+/*Size of the tiles in pixels used when rotating by 90 or 270 degrees*/
+#define ROT_TILE_SIZE   32
+
+/*Max. number of opaque objects to consider when culling the covered draws of an area*/
+#define OCCLUDER_MAX        8
+
+/*Max. depth of the object tree where the drawing order can be compared*/
+#define OCCLUDER_MAX_DEPTH  16
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_USE_OCCLUSION_CULLING
+/*An object which fully covers `area` with opaque pixels*/
+typedef struct {
+    lv_obj_t * obj;
+    lv_area_t area;
+} occluder_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -36,10 +65,21 @@
 static void lv_refr_join_area(void);
 static void lv_refr_areas(void);
 static void lv_refr_area(const lv_area_t * area_p);
+static void buf_age_prepare(void);
 static void lv_refr_area_part(const lv_area_t * area_p);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void lv_refr_obj_and_children(lv_obj_t * top_p, const lv_area_t * mask_p);
 static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p);
+#if LV_USE_OCCLUSION_CULLING
+static void occluders_collect(lv_obj_t * obj, const lv_area_t * clip_area);
+static bool occlusion_clip(lv_obj_t * obj, lv_area_t * area, bool after_children);
+static bool draw_later(lv_obj_t * obj, lv_obj_t * other, bool after_children);
+#endif
+static void rot_buf_release(void);
+static void flush_wait(uint32_t max_cnt);
+static void * draw_buf_get_next(lv_disp_draw_buf_t * draw_buf);
+static void flush_start(bool last);
+static void update_flushing_flags(void);
 static void draw_buf_flush(void);
 static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
 
@@ -48,6 +88,15 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
  **********************/
 static uint32_t px_num;
 static lv_disp_t * disp_refr; /*Display being refreshed*/
+static lv_color_t * rot_bufs[ROT_BUF_CNT];   /*Ring of buffers for software rotation*/
+static uint8_t rot_buf_act;
+static bool rot_buf_flushing;               /*The buffer being flushed is a rotation buffer*/
+static lv_refr_overdraw_t overdraw;
+static uint32_t flush_wait_time;            /*Time spent with waiting for the flushing in this refresh*/
+#if LV_USE_OCCLUSION_CULLING
+    static occluder_t occluders[OCCLUDER_MAX];
+    static uint32_t occluder_cnt;
+#endif
 #if LV_USE_PERF_MONITOR
     static uint32_t fps_sum_cnt;
     static uint32_t fps_sum_all;
@@ -127,8 +176,9 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
     suc = _lv_area_intersect(&com_area, area_p, &scr_area);
     if(suc == false)  return; /*Out of the screen*/
 
-    /*If there were at least 1 invalid area in full refresh mode, redraw the whole screen*/
-    if(disp->driver->full_refresh) {
+    /*If there were at least 1 invalid area in full refresh mode, redraw the whole screen.
+     *With buffer age only the invalid areas will be redrawn*/
+    if(disp->driver->full_refresh && !disp->driver->buffer_age) {
         disp->inv_areas[0] = scr_area;
         disp->inv_p = 1;
         lv_timer_resume(disp->refr_timer);
@@ -187,8 +237,9 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     volatile uint32_t elaps = 0;
 
     disp_refr = tmr->user_data;
+    LV_TRACE_BEGIN("refr");
 
-#if LV_USE_PERF_MONITOR == 0 && LV_USE_MEM_MONITOR == 0
+#if PERF_LABEL == 0 && LV_USE_MEM_MONITOR == 0
     /**
      * Ensure the timer does not run again automatically.
      * This is done before refreshing in case refreshing invalidates something else.
@@ -202,17 +253,22 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
 
     lv_obj_update_layout(disp_refr->top_layer);
     lv_obj_update_layout(disp_refr->sys_layer);
+#if LV_USE_PERF_MONITOR
+    uint32_t layout_time = lv_tick_elaps(start);
+#endif
 
     /*Do nothing if there is no active screen*/
     if(disp_refr->act_scr == NULL) {
         disp_refr->inv_p = 0;
         LV_LOG_WARN("there is no active screen");
         TRACE_REFR("finished");
+        LV_TRACE_END("refr");
         return;
     }
 
     lv_refr_join_area();
 
+    flush_wait_time = 0;
     lv_refr_areas();
 
     /*If refresh happened ...*/
@@ -227,16 +283,38 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         disp_refr->inv_p = 0;
 
         elaps = lv_tick_elaps(start);
+        LV_TRACE_COUNTER("refr_px", px_num);
+
+        /*Update the frame pacing statistics*/
+        lv_disp_frame_stats_t * stats = &disp_refr->frame_stats;
+        stats->frame_cnt++;
+        stats->flush_wait_time = LV_MIN(flush_wait_time, elaps);
+        stats->render_time = elaps - stats->flush_wait_time;
+        stats->flush_wait_time_sum += stats->flush_wait_time;
+        stats->render_time_sum += stats->render_time;
+        uint32_t period = tmr->period;
+        if(period > 0 && elaps > period) stats->dropped_cnt += (elaps - 1) / period;
+#if LV_USE_PERF_MONITOR
+        layout_time = LV_MIN(layout_time, stats->render_time);
+        _lv_disp_perf_add_frame(disp_refr, layout_time, stats->render_time - layout_time, stats->flush_wait_time, px_num);
+#endif
         /*Call monitor cb if present*/
         if(disp_refr->driver->monitor_cb) {
             disp_refr->driver->monitor_cb(disp_refr->driver, elaps, px_num);
         }
     }
 
-    lv_mem_buf_free_all();
+    rot_buf_release();
+    _lv_mem_buf_frame_end();
     _lv_font_clean_up_fmt_txt();
+    LV_TRACE_END("refr");
 
-#if LV_USE_PERF_MONITOR && LV_USE_LABEL
+#if LV_USE_REFR_PROFILER
+    _lv_refr_profiler_frame_end();
+#endif
+
+#if LV_USE_PERF_MONITOR
+#if PERF_LABEL
     static lv_obj_t * perf_label = NULL;
     if(perf_label == NULL) {
         perf_label = lv_label_create(lv_layer_sys());
@@ -251,10 +329,19 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         lv_label_set_text(perf_label, "?");
         lv_obj_align(perf_label, LV_ALIGN_BOTTOM_RIGHT, 0, 0);
     }
+#endif
 
     static uint32_t perf_last_time = 0;
     static uint32_t elaps_sum = 0;
     static uint32_t frame_cnt = 0;
+#if PERF_LABEL
+    static uint32_t px_refr_sum = 0;
+    static uint32_t px_drawn_sum = 0;
+    if(px_num) {
+        px_refr_sum += overdraw.px_refr;
+        px_drawn_sum += overdraw.px_drawn;
+    }
+#endif
     if(lv_tick_elaps(perf_last_time) < 300) {
         if(px_num > 5000) {
             elaps_sum += elaps;
@@ -275,8 +362,23 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
 
         fps_sum_all += fps;
         fps_sum_cnt ++;
-        uint32_t cpu = 100 - lv_timer_get_idle();
-        lv_label_set_text_fmt(perf_label, "%d FPS\n%d%% CPU", fps, cpu);
+
+#if PERF_LABEL
+        /*Overdraw in percentage*/
+        uint32_t ovd = px_refr_sum ? (uint64_t)px_drawn_sum * 100 / px_refr_sum : 0;
+        px_refr_sum = 0;
+        px_drawn_sum = 0;
+
+        lv_disp_perf_stats_t perf;
+        lv_disp_get_perf_stats(disp_refr, &perf);
+        char buf[128];
+        lv_snprintf(buf, sizeof(buf), "%d FPS, %d%% CPU\n%d/%d/%d ms p50/95/99\n%d jank\n%d.%02dx overdraw",
+                    (int)fps, 100 - perf.cpu_idle, (int)perf.frame.p50, (int)perf.frame.p95, (int)perf.frame.p99,
+                    (int)perf.jank_cnt, (int)(ovd / 100), (int)(ovd % 100));
+
+        /*Don't cause another refresh if nothing has changed*/
+        if(strcmp(lv_label_get_text(perf_label), buf) != 0) lv_label_set_text(perf_label, buf);
+#endif
     }
 #endif
 
@@ -317,6 +419,11 @@ uint32_t lv_refr_get_fps_avg(void)
 }
 #endif
 
+void lv_refr_get_overdraw(lv_refr_overdraw_t * dsc)
+{
+    *dsc = overdraw;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -367,6 +474,10 @@ static void lv_refr_areas(void)
 
     if(disp_refr->inv_p == 0) return;
 
+    lv_memset_00(&overdraw, sizeof(overdraw));
+
+    if(disp_refr->driver->full_refresh && disp_refr->driver->buffer_age) buf_age_prepare();
+
     /*Find the last area which will be drawn*/
     int32_t i;
     int32_t last_i = 0;
@@ -391,6 +502,64 @@ static void lv_refr_areas(void)
             px_num += lv_area_get_size(&disp_refr->inv_areas[i]);
         }
     }
+
+    overdraw.px_refr = px_num;
+}
+
+/**
+ * Prepare the draw buffer to render only the invalid areas in `full_refresh` mode.
+ * The buffer contains an earlier frame, so copy the areas changed since then from the previous (front) buffer.
+ * If it's not possible make the whole screen invalid.
+ */
+static void buf_age_prepare(void)
+{
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
+    lv_disp_drv_t * drv = disp_refr->driver;
+
+    /*The changed area of this frame. (The joined areas are inside the others so they don't matter.)*/
+    lv_area_t damage;
+    lv_area_copy(&damage, &disp_refr->inv_areas[0]);
+    int32_t i;
+    for(i = 1; i < disp_refr->inv_p; i++) {
+        _lv_area_join(&damage, &damage, &disp_refr->inv_areas[i]);
+    }
+
+    /*In a chain of N buffers the active buffer was rendered N frames ago.
+     *(Rotated frames are rendered elsewhere and converted frames are not in `lv_color_t` format anymore.)*/
+    uint32_t age = draw_buf->buf_cnt;
+    bool full = disp_refr->damage_frame_cnt < age || age - 1 > LV_DISP_DAMAGE_HISTORY ||
+                (drv->rotated != LV_DISP_ROT_NONE && drv->sw_rotate) ||
+                !lv_disp_color_format_is_native(drv->color_format);
+
+    if(full) {
+        disp_refr->inv_areas[0].x1 = 0;
+        disp_refr->inv_areas[0].y1 = 0;
+        disp_refr->inv_areas[0].x2 = lv_disp_get_hor_res(disp_refr) - 1;
+        disp_refr->inv_areas[0].y2 = lv_disp_get_ver_res(disp_refr) - 1;
+        disp_refr->inv_area_joined[0] = 0;
+        disp_refr->inv_p = 1;
+    }
+    else if(age > 1) {
+        /*Copy the changes of the frames rendered into the other buffers*/
+        lv_color_t * buf_act = draw_buf->buf_act;
+        lv_color_t * buf_front;
+        if(draw_buf->buf_chain) buf_front = draw_buf->buf_chain[(draw_buf->buf_act_id + age - 1) % age];
+        else buf_front = draw_buf->buf_act == draw_buf->buf1 ? draw_buf->buf2 : draw_buf->buf1;
+
+        lv_coord_t hor_res = lv_disp_get_hor_res(disp_refr);
+        uint32_t a;
+        for(a = 1; a < age; a++) {
+            const lv_area_t * h = &disp_refr->damage_history[(disp_refr->damage_frame_cnt - a) % LV_DISP_DAMAGE_HISTORY];
+            uint32_t w = lv_area_get_width(h) * sizeof(lv_color_t);
+            lv_coord_t y;
+            for(y = h->y1; y <= h->y2; y++) {
+                lv_memcpy(&buf_act[y * hor_res + h->x1], &buf_front[y * hor_res + h->x1], w);
+            }
+        }
+    }
+
+    disp_refr->damage_history[disp_refr->damage_frame_cnt % LV_DISP_DAMAGE_HISTORY] = damage;
+    disp_refr->damage_frame_cnt++;
 }
 
 /**
@@ -421,6 +590,10 @@ static void lv_refr_area(const lv_area_t * area_p)
 
     int32_t max_row = (uint32_t)draw_buf->size / w;
 
+    /*Render less rows if the converted pixels are larger*/
+    uint32_t px_size = lv_disp_color_format_get_size(disp_refr->driver->color_format);
+    if(px_size > sizeof(lv_color_t)) max_row = (uint32_t)draw_buf->size * sizeof(lv_color_t) / px_size / w;
+
     if(max_row > h) max_row = h;
 
     /*Round down the lines of draw_buf if rounding is added*/
@@ -487,15 +660,22 @@ static void lv_refr_area(const lv_area_t * area_p)
 static void lv_refr_area_part(const lv_area_t * area_p)
 {
     lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
+    LV_TRACE_BEGIN_ARG("refr_area_part", lv_area_get_size(area_p));
 
     /* Below the `area_p` area will be redrawn into the draw buffer.
-     * In single buffered mode wait here until the buffer is freed.*/
-    if(draw_buf->buf1 && !draw_buf->buf2) {
-		while(draw_buf->flushing) {
-			if(disp_refr->driver->wait_cb) disp_refr->driver->wait_cb(disp_refr->driver);
-		}
+     * In single buffered mode wait here until the buffer is freed.
+     * If a rotation buffer is being flushed the draw buffer is already free.*/
+    if(draw_buf->buf_cnt == 1 && !rot_buf_flushing) {
+        flush_wait(0);
     }
 
+    /*Render into the draw buffer*/
+    lv_draw_target_t target;
+    lv_draw_target_init(&target, draw_buf->buf_act, &draw_buf->area, LV_IMG_CF_TRUE_COLOR);
+    target.drv = disp_refr->driver;
+    target.antialiasing = disp_refr->driver->antialiasing;
+    lv_draw_target_t * target_ori = _lv_draw_target_set(&target);
+
     lv_obj_t * top_act_scr = NULL;
     lv_obj_t * top_prev_scr = NULL;
 
@@ -504,6 +684,15 @@ static void lv_refr_area_part(const lv_area_t * area_p)
     lv_area_t start_mask;
     _lv_area_intersect(&start_mask, area_p, &draw_buf->area);
 
+#if LV_USE_OCCLUSION_CULLING
+    /*Find the opaque objects to skip the draws covered by them*/
+    occluder_cnt = 0;
+    if(disp_refr->prev_scr) occluders_collect(disp_refr->prev_scr, &start_mask);
+    occluders_collect(disp_refr->act_scr, &start_mask);
+    occluders_collect(disp_refr->top_layer, &start_mask);
+    occluders_collect(disp_refr->sys_layer, &start_mask);
+#endif
+
     /*Get the most top object which is not covered by others*/
     top_act_scr = lv_refr_get_top_obj(&start_mask, lv_disp_get_scr_act(disp_refr));
     if(disp_refr->prev_scr) {
@@ -558,11 +747,14 @@ static void lv_refr_area_part(const lv_area_t * area_p)
     lv_refr_obj_and_children(lv_disp_get_layer_top(disp_refr), &start_mask);
     lv_refr_obj_and_children(lv_disp_get_layer_sys(disp_refr), &start_mask);
 
+    _lv_draw_target_set(target_ori);
+
     /*In true double buffered mode flush only once when all areas were rendered.
      *In normal mode flush after every area*/
     if(disp_refr->driver->full_refresh == false) {
         draw_buf_flush();
     }
+    LV_TRACE_END("refr_area_part");
 }
 
 /**
@@ -682,10 +874,41 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
 
     /*Draw the parent and its children only if they ore on 'mask_parent'*/
     if(union_ok != false) {
-        /*Redraw the object*/
-        lv_event_send(obj, LV_EVENT_DRAW_MAIN_BEGIN, &obj_ext_mask);
-        lv_event_send(obj, LV_EVENT_DRAW_MAIN, &obj_ext_mask);
-        lv_event_send(obj, LV_EVENT_DRAW_MAIN_END, &obj_ext_mask);
+        /*Don't draw the parts which will be covered by an opaque object later anyway*/
+        lv_area_t main_mask;
+        lv_area_copy(&main_mask, &obj_ext_mask);
+        bool main_visible = true;
+#if LV_USE_OCCLUSION_CULLING
+        main_visible = occlusion_clip(obj, &main_mask, false);
+#endif
+#if LV_USE_REFR_PROFILER
+        uint32_t prof_time = 0;     /*Time spent drawing only this object, without the children*/
+        uint32_t prof_px = 0;
+        uint32_t prof_start = 0;
+#endif
+        uint32_t ext_size_px = lv_area_get_size(&obj_ext_mask);
+        if(main_visible) {
+            uint32_t main_size_px = lv_area_get_size(&main_mask);
+            overdraw.px_drawn += main_size_px;
+            overdraw.px_culled += ext_size_px - main_size_px;
+
+            /*Redraw the object*/
+            LV_TRACE_BEGIN_ARG("draw_main", main_size_px);
+#if LV_USE_REFR_PROFILER
+            prof_start = _lv_refr_profiler_get_time();
+#endif
+            lv_event_send(obj, LV_EVENT_DRAW_MAIN_BEGIN, &main_mask);
+            lv_event_send(obj, LV_EVENT_DRAW_MAIN, &main_mask);
+            lv_event_send(obj, LV_EVENT_DRAW_MAIN_END, &main_mask);
+#if LV_USE_REFR_PROFILER
+            prof_time += _lv_refr_profiler_get_time() - prof_start;
+            prof_px = main_size_px;
+#endif
+            LV_TRACE_END("draw_main");
+        }
+        else {
+            overdraw.px_culled += ext_size_px;
+        }
 
 #if LV_USE_REFR_DEBUG
         lv_color_t debug_color = lv_color_make(lv_rand(0, 0xFF), lv_rand(0, 0xFF), lv_rand(0, 0xFF));
@@ -726,12 +949,182 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
             }
         }
 
-        /*If all the children are redrawn make 'post draw' draw*/
-        lv_event_send(obj, LV_EVENT_DRAW_POST_BEGIN, &obj_ext_mask);
-        lv_event_send(obj, LV_EVENT_DRAW_POST, &obj_ext_mask);
-        lv_event_send(obj, LV_EVENT_DRAW_POST_END, &obj_ext_mask);
+        /*If all the children are redrawn make 'post draw' draw.
+         *Keep it if the main part was drawn because it might clean up something (e.g. remove masks)*/
+        bool post_visible = true;
+#if LV_USE_OCCLUSION_CULLING
+        if(main_visible == false) {
+            lv_area_copy(&main_mask, &obj_ext_mask);
+            post_visible = occlusion_clip(obj, &main_mask, true);
+        }
+#endif
+        if(post_visible) {
+            LV_TRACE_BEGIN("draw_post");
+#if LV_USE_REFR_PROFILER
+            prof_start = _lv_refr_profiler_get_time();
+#endif
+            lv_event_send(obj, LV_EVENT_DRAW_POST_BEGIN, &obj_ext_mask);
+            lv_event_send(obj, LV_EVENT_DRAW_POST, &obj_ext_mask);
+            lv_event_send(obj, LV_EVENT_DRAW_POST_END, &obj_ext_mask);
+#if LV_USE_REFR_PROFILER
+            prof_time += _lv_refr_profiler_get_time() - prof_start;
+#endif
+            LV_TRACE_END("draw_post");
+        }
+
+#if LV_USE_REFR_PROFILER
+        if(main_visible || post_visible) _lv_refr_profiler_add(obj, prof_time, prof_px);
+#endif
+    }
+}
+
+#if LV_USE_OCCLUSION_CULLING
+/**
+ * Find the objects which cover a part of an area with opaque pixels.
+ * The largest `OCCLUDER_MAX` of them are stored in `occluders`.
+ * @param obj           the object to check with its children
+ * @param clip_area     the visible area of the object (the draw area clipped by the parents)
+ */
+static void occluders_collect(lv_obj_t * obj, const lv_area_t * clip_area)
+{
+    if(obj == NULL) return;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+
+    lv_area_t area;
+    if(_lv_area_intersect(&area, clip_area, &obj->coords) == false) return;
+
+    lv_cover_check_info_t info;
+    info.res = LV_COVER_RES_COVER;
+    info.area = &area;
+    lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
+
+    /*The children might be masked by this object too, so they can't cover anything*/
+    if(info.res == LV_COVER_RES_MASKED) return;
+
+    if(info.res == LV_COVER_RES_COVER) {
+        uint32_t size = lv_area_get_size(&area);
+        uint32_t i = occluder_cnt;
+        if(occluder_cnt >= OCCLUDER_MAX) {
+            /*Replace the smallest one if this is larger*/
+            uint32_t min_i = 0;
+            for(i = 1; i < OCCLUDER_MAX; i++) {
+                if(lv_area_get_size(&occluders[i].area) < lv_area_get_size(&occluders[min_i].area)) min_i = i;
+            }
+            i = size > lv_area_get_size(&occluders[min_i].area) ? min_i : OCCLUDER_MAX;
+        }
+        else {
+            occluder_cnt++;
+        }
+
+        if(i < OCCLUDER_MAX) {
+            occluders[i].obj = obj;
+            lv_area_copy(&occluders[i].area, &area);
+        }
+    }
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for(i = 0; i < child_cnt; i++) {
+        occluders_collect(lv_obj_get_child(obj, i), &area);
+    }
+}
+
+/**
+ * Remove the parts of an area which will be covered by opaque objects drawn later.
+ * Only whole stripes are removed to keep the area a rectangle.
+ * @param obj               the object to draw on `area`
+ * @param area              the area to draw. It will be reduced
+ * @param after_children    true: consider only the objects drawn after the children of `obj`
+ * @return                  false: the whole area is covered
+ */
+static bool occlusion_clip(lv_obj_t * obj, lv_area_t * area, bool after_children)
+{
+    uint32_t i;
+    for(i = 0; i < occluder_cnt; i++) {
+        const lv_area_t * oa = &occluders[i].area;
+
+        bool cover_hor = oa->x1 <= area->x1 && oa->x2 >= area->x2;
+        bool cover_ver = oa->y1 <= area->y1 && oa->y2 >= area->y2;
+        bool cover_top = cover_hor && oa->y1 <= area->y1 && oa->y2 >= area->y1;
+        bool cover_bottom = cover_hor && oa->y1 <= area->y2 && oa->y2 >= area->y2;
+        bool cover_left = cover_ver && oa->x1 <= area->x1 && oa->x2 >= area->x1;
+        bool cover_right = cover_ver && oa->x1 <= area->x2 && oa->x2 >= area->x2;
+        if(!cover_top && !cover_bottom && !cover_left && !cover_right) continue;
+
+        /*Only the objects drawn later can cover `obj`*/
+        if(draw_later(occluders[i].obj, obj, after_children) == false) continue;
+
+        if(cover_top && cover_bottom) return false;
+        if(cover_top) area->y1 = oa->y2 + 1;
+        else if(cover_bottom) area->y2 = oa->y1 - 1;
+        else if(cover_left) area->x1 = oa->x2 + 1;
+        else area->x2 = oa->x1 - 1;
+
+        if(area->x1 > area->x2 || area->y1 > area->y2) return false;
+    }
+
+    return true;
+}
+
+/**
+ * Tell whether an object is drawn later than an other object
+ * @param obj               the object to check
+ * @param other             the reference object
+ * @param after_children    true: `obj` should be drawn after the children of `other` too
+ * @return                  true: `obj` is drawn later; false: earlier or can't be decided
+ */
+static bool draw_later(lv_obj_t * obj, lv_obj_t * other, bool after_children)
+{
+    if(obj == other) return false;
+
+    /*Collect the parents of `obj`*/
+    lv_obj_t * parents[OCCLUDER_MAX_DEPTH];
+    uint32_t depth = 0;
+    lv_obj_t * o = obj;
+    while(o) {
+        if(depth >= OCCLUDER_MAX_DEPTH) return false;
+        parents[depth] = o;
+        depth++;
+        o = lv_obj_get_parent(o);
+    }
+
+    /*If `other` is a parent of `obj` it's drawn before its children*/
+    uint32_t i;
+    for(i = 1; i < depth; i++) {
+        if(parents[i] == other) return !after_children;
+    }
+
+    /*Go up from `other` until reaching a common parent*/
+    lv_obj_t * other_child = other;
+    while(1) {
+        lv_obj_t * par = lv_obj_get_parent(other_child);
+
+        /*Different screens or layers*/
+        if(par == NULL) {
+            lv_obj_t * roots[] = {disp_refr->prev_scr, disp_refr->act_scr, disp_refr->top_layer, disp_refr->sys_layer};
+            int32_t obj_root = -1;
+            int32_t other_root = -1;
+            for(i = 0; i < sizeof(roots) / sizeof(roots[0]); i++) {
+                if(roots[i] == NULL) continue;
+                if(roots[i] == parents[depth - 1]) obj_root = i;
+                if(roots[i] == other_child) other_root = i;
+            }
+            return obj_root >= 0 && other_root >= 0 && obj_root > other_root;
+        }
+
+        for(i = 0; i < depth; i++) {
+            if(parents[i] == par) {
+                /*`obj` is a parent of `other`*/
+                if(i == 0) return false;
+                /*Compare the siblings on the common parent*/
+                return lv_obj_get_child_id(parents[i - 1]) > lv_obj_get_child_id(other_child);
+            }
+        }
+
+        other_child = par;
     }
 }
+#endif /*LV_USE_OCCLUSION_CULLING*/
 
 static void draw_buf_rotate_180(lv_disp_drv_t *drv, lv_area_t *area, lv_color_t *color_p) {
     lv_coord_t area_w = lv_area_get_width(area);
@@ -756,20 +1149,42 @@ static void draw_buf_rotate_180(lv_disp_drv_t *drv, lv_area_t *area, lv_color_t
     area->x1 = drv->hor_res - tmp_coord - 1;
 }
 
-static LV_ATTRIBUTE_FAST_MEM void draw_buf_rotate_90(bool invert_i, lv_coord_t area_w, lv_coord_t area_h, lv_color_t *orig_color_p, lv_color_t *rot_buf) {
-
-    uint32_t invert = (area_w * area_h) - 1;
-    uint32_t initial_i = ((area_w - 1) * area_h);
-    for(lv_coord_t y = 0; y < area_h; y++) {
-        uint32_t i = initial_i + y;
-        if(invert_i)
-            i = invert - i;
-        for(lv_coord_t x = 0; x < area_w; x++) {
-            rot_buf[i] = *(orig_color_p++);
-            if(invert_i)
-                i += area_h;
-            else
-                i -= area_h;
+/**
+ * Rotate a `area_w` x `area_h` block of pixels by 90 or 270 degrees into an other buffer.
+ * The block is processed in `ROT_TILE_SIZE` x `ROT_TILE_SIZE` tiles so that both the read and the
+ * written pixels of a tile stay in the cache.
+ */
+static LV_ATTRIBUTE_FAST_MEM void draw_buf_rotate_90(bool invert_i, lv_coord_t area_w, lv_coord_t area_h,
+                                                     const lv_color_t * orig_color_p, lv_color_t * rot_buf)
+{
+    lv_coord_t tile_x;
+    lv_coord_t tile_y;
+    for(tile_y = 0; tile_y < area_h; tile_y += ROT_TILE_SIZE) {
+        lv_coord_t tile_h = LV_MIN(ROT_TILE_SIZE, area_h - tile_y);
+        for(tile_x = 0; tile_x < area_w; tile_x += ROT_TILE_SIZE) {
+            lv_coord_t tile_x_end = LV_MIN(tile_x + ROT_TILE_SIZE, area_w);
+            lv_coord_t x;
+            for(x = tile_x; x < tile_x_end; x++) {
+                /*A column of the tile becomes a row in the rotated buffer*/
+                const lv_color_t * src = &orig_color_p[tile_y * area_w + x];
+                lv_coord_t y;
+                if(invert_i) {
+                    lv_color_t * dest = &rot_buf[x * area_h + (area_h - 1 - tile_y)];
+                    for(y = 0; y < tile_h; y++) {
+                        *dest = *src;
+                        dest--;
+                        src += area_w;
+                    }
+                }
+                else {
+                    lv_color_t * dest = &rot_buf[(area_w - 1 - x) * area_h + tile_y];
+                    for(y = 0; y < tile_h; y++) {
+                        *dest = *src;
+                        dest++;
+                        src += area_w;
+                    }
+                }
+            }
         }
     }
 }
@@ -816,80 +1231,142 @@ static void draw_buf_rotate_90_sqr(bool is_270, lv_coord_t w, lv_color_t * color
 }
 
 /**
- * Rotate the draw_buf to the display's native orientation.
+ * Get the native (not rotated) coordinates of `height` rows of `area` starting from `row`
+ * after they were rotated by 90 or 270 degrees.
  */
-static void draw_buf_rotate(lv_area_t *area, lv_color_t *color_p) {
-    lv_disp_drv_t * drv = disp_refr->driver;
-    if(disp_refr->driver->full_refresh && drv->sw_rotate) {
-        LV_LOG_ERROR("cannot rotate a full refreshed display!");
-        return;
+static void draw_buf_rotate_area(lv_disp_drv_t * drv, const lv_area_t * area, lv_coord_t row, lv_coord_t height,
+                                 lv_area_t * rot_area)
+{
+    lv_coord_t area_w = lv_area_get_width(area);
+    if(drv->rotated == LV_DISP_ROT_90) {
+        rot_area->y2 = drv->ver_res - area->x1 - 1;
+        rot_area->y1 = rot_area->y2 - area_w + 1;
+        rot_area->x1 = area->y1 + row;
+        rot_area->x2 = rot_area->x1 + height - 1;
+    }
+    else {
+        rot_area->y1 = area->x1;
+        rot_area->y2 = rot_area->y1 + area_w - 1;
+        rot_area->x2 = drv->hor_res - 1 - area->y1 - row;
+        rot_area->x1 = rot_area->x2 - height + 1;
     }
+}
+
+/**
+ * Get the next buffer of the rotation ring.
+ * The buffers are kept until the end of the refresh to allow flushing the last one in the background.
+ */
+static lv_color_t * rot_buf_get_next(void)
+{
+    rot_buf_act = (rot_buf_act + 1) % ROT_BUF_CNT;
+    if(rot_bufs[rot_buf_act] == NULL) rot_bufs[rot_buf_act] = lv_mem_buf_get(LV_DISP_ROT_MAX_BUF);
+    return rot_bufs[rot_buf_act];
+}
+
+/**
+ * Release the rotation buffers when their content is not flushed anymore
+ */
+static void rot_buf_release(void)
+{
+    if(rot_buf_flushing) {
+        flush_wait(0);
+        rot_buf_flushing = false;
+    }
+
+    uint32_t i;
+    for(i = 0; i < ROT_BUF_CNT; i++) {
+        if(rot_bufs[i]) {
+            lv_mem_buf_release(rot_bufs[i]);
+            rot_bufs[i] = NULL;
+        }
+    }
+}
+
+/**
+ * Rotate the draw_buf to the display's native orientation and flush it.
+ * @param area the area of the draw buffer. Its coordinates will be converted to the native orientation.
+ * @param color_p the rendered pixels
+ * @param flush_last true: this is the last flush of the refresh cycle
+ * @return true: the rotated image was written into the other (idle) draw buffer so the draw buffers shouldn't be swapped
+ */
+static bool draw_buf_rotate(lv_area_t * area, lv_color_t * color_p, bool flush_last)
+{
+    lv_disp_drv_t * drv = disp_refr->driver;
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
+
+    /*Wait until the last chunk of the previous area is flushed from a rotation buffer
+     *(and all the other buffers are flushed from the chain as they can be used for rotation too)*/
+    flush_wait(0);
+
     if(drv->rotated == LV_DISP_ROT_180) {
         draw_buf_rotate_180(drv, area, color_p);
+        flush_start(flush_last);
         call_flush_cb(drv, area, color_p);
-    } else if(drv->rotated == LV_DISP_ROT_90 || drv->rotated == LV_DISP_ROT_270) {
-        /*Allocate a temporary buffer to store rotated image*/
-        lv_color_t * rot_buf = NULL;
-        lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
-        lv_coord_t area_w = lv_area_get_width(area);
-        lv_coord_t area_h = lv_area_get_height(area);
-        /*Determine the maximum number of rows that can be rotated at a time*/
-        lv_coord_t max_row = LV_MIN((lv_coord_t)((LV_DISP_ROT_MAX_BUF/sizeof(lv_color_t)) / area_w), area_h);
-        lv_coord_t init_y_off;
-        init_y_off = area->y1;
-        if(drv->rotated == LV_DISP_ROT_90) {
-            area->y2 = drv->ver_res - area->x1 - 1;
-            area->y1 = area->y2 - area_w + 1;
+        return false;
+    }
+
+    bool is_270 = drv->rotated == LV_DISP_ROT_270;
+    lv_coord_t area_w = lv_area_get_width(area);
+    lv_coord_t area_h = lv_area_get_height(area);
+
+    /*With full refresh and two buffers the other buffer is free (the previous frame is flushed)
+     *so rotate the whole frame into it and flush it at once.
+     *The current buffer can be used for the next frame as it will be fully redrawn anyway.*/
+    if(drv->full_refresh && draw_buf->buf_cnt > 1) {
+        lv_color_t * idle_buf = draw_buf_get_next(draw_buf);
+        draw_buf_rotate_90(is_270, area_w, area_h, color_p, idle_buf);
+        lv_area_t rot_area;
+        draw_buf_rotate_area(drv, area, 0, area_h, &rot_area);
+        *area = rot_area;
+        flush_start(flush_last);
+        call_flush_cb(drv, area, idle_buf);
+        return true;
+    }
+
+    /*Determine the maximum number of rows that can be rotated at a time*/
+    lv_coord_t max_row = LV_MIN((lv_coord_t)((LV_DISP_ROT_MAX_BUF / sizeof(lv_color_t)) / area_w), area_h);
+    if(max_row < 1) {
+        LV_LOG_WARN("LV_DISP_ROT_MAX_BUF is too small to rotate a row of %d pixels", area_w);
+        return false;
+    }
+
+    /*Rotate the screen in chunks. The next chunk is rotated into an other buffer
+     *while the previous one is being flushed*/
+    lv_area_t ori_area = *area;
+    lv_coord_t row = 0;
+    while(row < area_h) {
+        lv_coord_t height = LV_MIN(max_row, area_h - row);
+        lv_color_t * flush_p;
+        bool flush_rot_buf;
+        if((row == 0) && (area_h >= area_w)) {
+            /*Rotate the initial area as a square*/
+            height = area_w;
+            draw_buf_rotate_90_sqr(is_270, area_w, color_p);
+            flush_p = color_p;
+            flush_rot_buf = false;
         }
         else {
-            area->y1 = area->x1;
-            area->y2 = area->y1 + area_w - 1;
+            /*Rotate other areas using a maximum buffer size*/
+            flush_p = rot_buf_get_next();
+            draw_buf_rotate_90(is_270, area_w, height, color_p, flush_p);
+            flush_rot_buf = true;
         }
-        draw_buf->flushing = 0;
-        /*Rotate the screen in chunks, flushing after each one*/
-        lv_coord_t row = 0;
-        while(row < area_h) {
-            lv_coord_t height = LV_MIN(max_row, area_h-row);
-            draw_buf->flushing = 1;
-            if((row == 0) && (area_h >= area_w)) {
-                /*Rotate the initial area as a square*/
-                height = area_w;
-                draw_buf_rotate_90_sqr(drv->rotated == LV_DISP_ROT_270, area_w, color_p);
-                if(drv->rotated == LV_DISP_ROT_90) {
-                    area->x1 = init_y_off;
-                    area->x2 = init_y_off + area_w - 1;
-                }
-                else {
-                    area->x2 = drv->hor_res - 1 - init_y_off;
-                    area->x1 = area->x2 - area_w + 1;
-                }
-            }
-            else {
-                /*Rotate other areas using a maximum buffer size*/
-                if(rot_buf == NULL) rot_buf = lv_mem_buf_get(LV_DISP_ROT_MAX_BUF);
-                draw_buf_rotate_90(drv->rotated == LV_DISP_ROT_270, area_w, height, color_p, rot_buf);
+        draw_buf_rotate_area(drv, &ori_area, row, height, area);
 
-                if(drv->rotated == LV_DISP_ROT_90) {
-                    area->x1 = init_y_off + row;
-                    area->x2 = init_y_off + row + height - 1;
-                }
-                else {
-                    area->x2 = drv->hor_res - 1 - init_y_off - row;
-                    area->x1 = area->x2 - height + 1;
-                }
-            }
-            /*Flush the completed area to the display*/
-            call_flush_cb(drv, area, rot_buf == NULL ? color_p : rot_buf);
-            /*FIXME: Rotation forces legacy behavior where rendering and flushing are done serially*/
-            while(draw_buf->flushing) {
-                if(drv->wait_cb) drv->wait_cb(drv);
-            }
-            color_p += area_w * height;
-            row += height;
-        }
-        /*Free the allocated buffer at the end if necessary*/
-        if(rot_buf != NULL) lv_mem_buf_release(rot_buf);
+        /*Wait only now for the previous chunk to overlap its flushing with the rotation*/
+        flush_wait(0);
+
+        color_p += area_w * height;
+        row += height;
+
+        flush_start(flush_last && row >= area_h);
+        rot_buf_flushing = flush_rot_buf;
+
+        /*Flush the completed area to the display*/
+        call_flush_cb(drv, area, flush_p);
     }
+
+    return false;
 }
 
 /**
@@ -899,42 +1376,100 @@ static void draw_buf_flush(void)
 {
     lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
     lv_color_t * color_p = draw_buf->buf_act;
+    bool keep_buf_act = false;
+    bool flush_last = disp_refr->driver->draw_buf->last_area && disp_refr->driver->draw_buf->last_part;
 
     /*Flush the rendered content to the display*/
     lv_disp_t * disp = _lv_refr_get_disp_refreshing();
-    if(disp->driver->gpu_wait_cb) disp->driver->gpu_wait_cb(disp->driver);
-
-     /* In double buffered mode wait until the other buffer is freed
-	  * and driver is ready to receive the new buffer */
-	 if(draw_buf->buf1 && draw_buf->buf2) {
-		 while(draw_buf->flushing) {
-			 if(disp_refr->driver->wait_cb) disp_refr->driver->wait_cb(disp_refr->driver);
-		 }
-	 }
-
-	 draw_buf->flushing = 1;
-
-	if(disp_refr->driver->draw_buf->last_area && disp_refr->driver->draw_buf->last_part) draw_buf->flushing_last = 1;
-	else draw_buf->flushing_last = 0;
-
-    if(disp->driver->flush_cb) {
-        /*Rotate the buffer to the display's native orientation if necessary*/
-        if(disp->driver->rotated != LV_DISP_ROT_NONE && disp->driver->sw_rotate) {
-            draw_buf_rotate(&draw_buf->area, draw_buf->buf_act);
-        } else {
-            call_flush_cb(disp->driver, &draw_buf->area, color_p);
-        }
+    _lv_draw_backend_wait(disp->driver);
+
+    /*With more buffers wait until the next buffer is freed and driver is ready to receive the new buffer.
+     *With two buffers it means the previous flush should be finished, with a longer chain the driver
+     *can have more buffers in its queue.*/
+    if(draw_buf->buf_cnt > 1) {
+        flush_wait(draw_buf->buf_cnt - 2);
+    }
+
+    if(disp->driver->flush_cb && disp->driver->rotated != LV_DISP_ROT_NONE && disp->driver->sw_rotate) {
+        /*Rotate the buffer to the display's native orientation. It also starts the flushes of the rotated parts*/
+        keep_buf_act = draw_buf_rotate(&draw_buf->area, draw_buf->buf_act, flush_last);
     }
-    if(draw_buf->buf1 && draw_buf->buf2) {
-        if(draw_buf->buf_act == draw_buf->buf1)
-            draw_buf->buf_act = draw_buf->buf2;
-        else
-            draw_buf->buf_act = draw_buf->buf1;
+    else if(disp->driver->flush_cb) {
+        flush_start(flush_last);
+        call_flush_cb(disp->driver, &draw_buf->area, color_p);
+    }
+    if(draw_buf->buf_cnt > 1 && !keep_buf_act) {
+        draw_buf->buf_act = draw_buf_get_next(draw_buf);
+        if(draw_buf->buf_chain) draw_buf->buf_act_id = (draw_buf->buf_act_id + 1) % draw_buf->buf_cnt;
     }
 }
 
+/**
+ * Wait until the driver has only a given number of flushes in progress
+ * @param max_cnt max. number of unfinished flushes. 0: wait until all flushes are finished
+ */
+static void flush_wait(uint32_t max_cnt)
+{
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
+    if(draw_buf->flush_start_cnt - draw_buf->flush_ready_cnt <= max_cnt) {
+        update_flushing_flags();
+        return;
+    }
+
+    uint32_t t = lv_tick_get();
+    LV_TRACE_BEGIN("flush_wait");
+    while(draw_buf->flush_start_cnt - draw_buf->flush_ready_cnt > max_cnt) {
+        if(disp_refr->driver->wait_cb) disp_refr->driver->wait_cb(disp_refr->driver);
+    }
+    LV_TRACE_END("flush_wait");
+    flush_wait_time += lv_tick_elaps(t);
+    update_flushing_flags();
+}
+
+/**
+ * Get the buffer which will be used after the active buffer
+ * @param draw_buf pointer to a draw buffer with at least 2 buffers
+ * @return the next buffer
+ */
+static void * draw_buf_get_next(lv_disp_draw_buf_t * draw_buf)
+{
+    if(draw_buf->buf_chain) return draw_buf->buf_chain[(draw_buf->buf_act_id + 1) % draw_buf->buf_cnt];
+    return draw_buf->buf_act == draw_buf->buf1 ? draw_buf->buf2 : draw_buf->buf1;
+}
+
+/**
+ * Mark a flush as started. Should be called right before calling `flush_cb`
+ * @param last true: it's the last flush of the refresh
+ */
+static void flush_start(bool last)
+{
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
+    /*Keep the last-ness per flush as the driver can still have the previous ones in its queue*/
+    if(last) draw_buf->flush_last_cnt = draw_buf->flush_start_cnt + 1;
+    draw_buf->flush_start_cnt++;
+    update_flushing_flags();
+}
+
+/**
+ * Update the `flushing` and `flushing_last` fields of the draw buffer from the flush counters.
+ * Only the rendering writes them so they can't be overwritten with an outdated value by `lv_disp_flush_ready`.
+ */
+static void update_flushing_flags(void)
+{
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
+    bool pending = lv_disp_flush_is_pending(disp_refr->driver);
+    draw_buf->flushing = pending ? 1 : 0;
+    draw_buf->flushing_last = pending && lv_disp_flush_is_last(disp_refr->driver) ? 1 : 0;
+}
+
 static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
 {
     TRACE_REFR("Calling flush_cb on (%d;%d)(%d;%d) area with %p image pointer", area->x1, area->y1, area->x2, area->y2, color_p);
+
+    /*Convert the rendered pixels to the display's color format*/
+    if(drv->set_px_cb == NULL) lv_disp_color_format_convert(color_p, lv_area_get_size(area), drv->color_format);
+
+    LV_TRACE_BEGIN_ARG("flush", lv_area_get_size(area));
     drv->flush_cb(drv, area, color_p);
+    LV_TRACE_END("flush");
 }
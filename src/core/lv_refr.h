@@ -26,6 +26,13 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/*Drawing statistics of the last refresh*/
+typedef struct {
+    uint32_t px_refr;       /*Number of refreshed pixels*/
+    uint32_t px_drawn;      /*Sum of the areas where the objects were drawn. `px_drawn / px_refr` is the overdraw*/
+    uint32_t px_culled;     /*Sum of the areas not drawn because they were covered by opaque objects*/
+} lv_refr_overdraw_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -86,6 +93,12 @@ void _lv_refr_set_disp_refreshing(lv_disp_t * disp);
 uint32_t lv_refr_get_fps_avg(void);
 #endif
 
+/**
+ * Get how many times the pixels were drawn in the last refresh
+ * @param dsc       store the result here
+ */
+void lv_refr_get_overdraw(lv_refr_overdraw_t * dsc);
+
 /**
  * Called periodically to handle the refreshing
  * @param timer pointer to the timer itself
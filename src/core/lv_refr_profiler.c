@@ -0,0 +1,280 @@
+/**
+ * @file lv_refr_profiler.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_refr_profiler.h"
+#if LV_USE_REFR_PROFILER
+
+#include "lv_disp.h"
+#include "../hal/lv_hal_tick.h"
+#include "../misc/lv_printf.h"
+#if LV_USE_LABEL
+    #include "../widgets/lv_label.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CLASS_CNT       32  /*Number of classes to keep statistics about*/
+#define OVERLAY_TOP_CNT 5   /*Number of classes and objects to show on the overlay*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_refr_profiler_entry_t objs[LV_REFR_PROFILER_OBJ_CNT];
+    lv_refr_profiler_entry_t classes[CLASS_CNT];
+} profiler_data_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_refr_profiler_entry_t * get_entry(lv_refr_profiler_entry_t entries[], uint32_t cnt,
+                                            lv_obj_t * obj, const lv_obj_class_t * class_p, uint32_t time);
+static uint32_t get_top(const lv_refr_profiler_entry_t src[], uint32_t src_cnt,
+                        lv_refr_profiler_entry_t dest[], uint32_t max_cnt);
+static void overlay_update(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static profiler_data_t acc;     /*Data of the current window*/
+static profiler_data_t res;     /*Data of the last complete window*/
+static lv_refr_profiler_time_cb_t custom_time_cb;
+static uint32_t window = 1000;
+static uint32_t window_start;
+static lv_obj_t * overlay;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_refr_profiler_register_time_cb(lv_refr_profiler_time_cb_t time_cb)
+{
+    custom_time_cb = time_cb;
+}
+
+void lv_refr_profiler_set_window(uint32_t window_ms)
+{
+    window = window_ms;
+    window_start = lv_tick_get();
+}
+
+void lv_refr_profiler_reset(void)
+{
+    lv_memset_00(&acc, sizeof(acc));
+    lv_memset_00(&res, sizeof(res));
+    window_start = lv_tick_get();
+}
+
+uint32_t lv_refr_profiler_get_top_objs(lv_refr_profiler_entry_t entries[], uint32_t max_cnt)
+{
+    const profiler_data_t * d = window ? &res : &acc;
+    return get_top(d->objs, LV_REFR_PROFILER_OBJ_CNT, entries, max_cnt);
+}
+
+uint32_t lv_refr_profiler_get_top_classes(lv_refr_profiler_entry_t entries[], uint32_t max_cnt)
+{
+    const profiler_data_t * d = window ? &res : &acc;
+    return get_top(d->classes, CLASS_CNT, entries, max_cnt);
+}
+
+const char * lv_refr_profiler_get_class_name(const lv_obj_class_t * class_p)
+{
+    while(class_p) {
+        if(class_p->name) return class_p->name;
+        class_p = class_p->base_class;
+    }
+
+    return "?";
+}
+
+void lv_refr_profiler_show_overlay(bool en)
+{
+#if LV_USE_LABEL
+    if(en && overlay == NULL) {
+        overlay = lv_label_create(lv_layer_sys());
+        lv_obj_set_style_bg_opa(overlay, LV_OPA_50, 0);
+        lv_obj_set_style_bg_color(overlay, lv_color_black(), 0);
+        lv_obj_set_style_text_color(overlay, lv_color_white(), 0);
+        lv_obj_set_style_pad_all(overlay, 3, 0);
+        lv_label_set_text(overlay, "?");
+        lv_obj_align(overlay, LV_ALIGN_TOP_RIGHT, 0, 0);
+        overlay_update();
+    }
+    else if(!en && overlay) {
+        lv_obj_t * o = overlay;
+        overlay = NULL;
+        lv_obj_del(o);
+    }
+#else
+    LV_UNUSED(en);
+    LV_LOG_WARN("LV_USE_LABEL is required for the overlay");
+#endif
+}
+
+uint32_t _lv_refr_profiler_get_time(void)
+{
+    return custom_time_cb ? custom_time_cb() : lv_tick_get() * 1000;
+}
+
+void _lv_refr_profiler_add(lv_obj_t * obj, uint32_t time, uint32_t px)
+{
+    /*Don't let the overlay distort the results*/
+    if(obj == overlay) return;
+
+    lv_refr_profiler_entry_t * e = get_entry(acc.objs, LV_REFR_PROFILER_OBJ_CNT, obj, obj->class_p, time);
+    if(e) {
+        e->time += time;
+        e->px += px;
+        e->draw_cnt++;
+    }
+
+    e = get_entry(acc.classes, CLASS_CNT, NULL, obj->class_p, time);
+    if(e) {
+        e->time += time;
+        e->px += px;
+        e->draw_cnt++;
+    }
+}
+
+void _lv_refr_profiler_frame_end(void)
+{
+    if(window == 0) return;
+    if(lv_tick_elaps(window_start) < window) return;
+
+    window_start = lv_tick_get();
+    lv_memcpy(&res, &acc, sizeof(res));
+    lv_memset_00(&acc, sizeof(acc));
+
+    overlay_update();
+}
+
+void _lv_refr_profiler_obj_deleted(lv_obj_t * obj)
+{
+    if(obj == overlay) overlay = NULL;
+
+    uint32_t i;
+    for(i = 0; i < LV_REFR_PROFILER_OBJ_CNT; i++) {
+        if(acc.objs[i].obj == obj) acc.objs[i].obj = NULL;
+        if(res.objs[i].obj == obj) res.objs[i].obj = NULL;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Find the entry of an object or class or allocate a new one.
+ * If the table is full the cheapest entry is replaced if it took less time than the new drawing.
+ * @param entries   the table to search in
+ * @param cnt       number of elements in `entries`
+ * @param obj       the object to search or NULL to search a class
+ * @param class_p   class of the object or the class to search
+ * @param time      time of the drawing to add
+ * @return          the entry or NULL if the table is full with more expensive entries
+ */
+static lv_refr_profiler_entry_t * get_entry(lv_refr_profiler_entry_t entries[], uint32_t cnt,
+                                            lv_obj_t * obj, const lv_obj_class_t * class_p, uint32_t time)
+{
+    lv_refr_profiler_entry_t * cheapest = NULL;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_refr_profiler_entry_t * e = &entries[i];
+        /*The end of the used entries*/
+        if(e->class_p == NULL) {
+            e->obj = obj;
+            e->class_p = class_p;
+            return e;
+        }
+
+        if(e->obj == obj && e->class_p == class_p) return e;
+        if(cheapest == NULL || e->time < cheapest->time) cheapest = e;
+    }
+
+    /*Keep the table for the expensive entries. Cheap ones can't evict each other.*/
+    if(cheapest == NULL || cheapest->time >= time) return NULL;
+
+    lv_memset_00(cheapest, sizeof(lv_refr_profiler_entry_t));
+    cheapest->obj = obj;
+    cheapest->class_p = class_p;
+    return cheapest;
+}
+
+/**
+ * Copy the used entries with the longest draw times in descending order.
+ * @param src       the table to select from
+ * @param src_cnt   number of elements in `src`
+ * @param dest      store the result here
+ * @param max_cnt   number of elements in `dest`
+ * @return          number of entries written to `dest`
+ */
+static uint32_t get_top(const lv_refr_profiler_entry_t src[], uint32_t src_cnt,
+                        lv_refr_profiler_entry_t dest[], uint32_t max_cnt)
+{
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < src_cnt && src[i].class_p; i++) {
+        /*Insertion sort: find the place of the entry and shift the faster ones*/
+        uint32_t j = cnt;
+        while(j > 0 && dest[j - 1].time < src[i].time) {
+            if(j < max_cnt) dest[j] = dest[j - 1];
+            j--;
+        }
+
+        if(j < max_cnt) {
+            dest[j] = src[i];
+            if(cnt < max_cnt) cnt++;
+        }
+    }
+
+    return cnt;
+}
+
+static void overlay_update(void)
+{
+#if LV_USE_LABEL
+    if(overlay == NULL) return;
+
+    lv_refr_profiler_entry_t top[OVERLAY_TOP_CNT];
+    char buf[64 * OVERLAY_TOP_CNT * 2 + 32];
+    uint32_t len = 0;
+
+    len += lv_snprintf(buf + len, sizeof(buf) - len, "Slowest classes:");
+    uint32_t cnt = lv_refr_profiler_get_top_classes(top, OVERLAY_TOP_CNT);
+    uint32_t i;
+    for(i = 0; i < cnt && len < sizeof(buf); i++) {
+        len += lv_snprintf(buf + len, sizeof(buf) - len, "\n%s: %d us, %d px, %d draws",
+                           lv_refr_profiler_get_class_name(top[i].class_p),
+                           (int)top[i].time, (int)top[i].px, (int)top[i].draw_cnt);
+    }
+
+    if(len < sizeof(buf)) len += lv_snprintf(buf + len, sizeof(buf) - len, "\nSlowest objects:");
+    cnt = lv_refr_profiler_get_top_objs(top, OVERLAY_TOP_CNT);
+    for(i = 0; i < cnt && len < sizeof(buf); i++) {
+        const char * name = lv_refr_profiler_get_class_name(top[i].class_p);
+        if(top[i].obj) {
+            len += lv_snprintf(buf + len, sizeof(buf) - len, "\n%s (%d;%d): %d us, %d px",
+                               name, (int)top[i].obj->coords.x1, (int)top[i].obj->coords.y1,
+                               (int)top[i].time, (int)top[i].px);
+        }
+        else {
+            len += lv_snprintf(buf + len, sizeof(buf) - len, "\n%s (deleted): %d us, %d px",
+                               name, (int)top[i].time, (int)top[i].px);
+        }
+    }
+
+    lv_label_set_text(overlay, buf);
+#endif
+}
+
+#endif /*LV_USE_REFR_PROFILER*/
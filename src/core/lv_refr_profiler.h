@@ -0,0 +1,135 @@
+/**
+ * @file lv_refr_profiler.h
+ *
+ */
+
+#ifndef LV_REFR_PROFILER_H
+#define LV_REFR_PROFILER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_obj.h"
+
+#if LV_USE_REFR_PROFILER
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Drawing statistics of an object or a class
+ */
+typedef struct {
+    lv_obj_t * obj;                     /**< The object or NULL for classes and deleted objects*/
+    const lv_obj_class_t * class_p;     /**< The class of the object or the class the entry is about*/
+    uint32_t time;                      /**< Time spent in the `DRAW_MAIN` and `DRAW_POST` events [us]*/
+    uint32_t px;                        /**< Number of pixels in the drawn areas of the main part*/
+    uint32_t draw_cnt;                  /**< Number of times the object was drawn*/
+} lv_refr_profiler_entry_t;
+
+/**
+ * Get the current time in microseconds
+ */
+typedef uint32_t (*lv_refr_profiler_time_cb_t)(void);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Register a function to measure the drawing time.
+ * Without it `lv_tick_get() * 1000` is used which has only millisecond resolution.
+ * @param time_cb a function returning the current time in microseconds, or NULL to use `lv_tick_get()`
+ */
+void lv_refr_profiler_register_time_cb(lv_refr_profiler_time_cb_t time_cb);
+
+/**
+ * Set the length of the measurement window. At the end of each window the results are updated
+ * and the measurement starts again. The default is 1000 ms.
+ * @param window_ms length of the window in milliseconds, or 0 to accumulate until `lv_refr_profiler_reset()`
+ */
+void lv_refr_profiler_set_window(uint32_t window_ms);
+
+/**
+ * Clear all the measured data
+ */
+void lv_refr_profiler_reset(void);
+
+/**
+ * Get the objects which were the most expensive to draw.
+ * If more objects are drawn than `LV_REFR_PROFILER_OBJ_CNT` the cheapest ones are dropped.
+ * With a window the results of the last complete window are returned, else the data measured since the last reset.
+ * @param entries   an array to store the results in, ordered by the draw time, the slowest first
+ * @param max_cnt   the number of elements in `entries`
+ * @return          number of entries written
+ */
+uint32_t lv_refr_profiler_get_top_objs(lv_refr_profiler_entry_t entries[], uint32_t max_cnt);
+
+/**
+ * Get the classes whose objects were the most expensive to draw.
+ * With a window the results of the last complete window are returned, else the data measured since the last reset.
+ * @param entries   an array to store the results in, ordered by the draw time, the slowest first
+ * @param max_cnt   the number of elements in `entries`
+ * @return          number of entries written
+ */
+uint32_t lv_refr_profiler_get_top_classes(lv_refr_profiler_entry_t entries[], uint32_t max_cnt);
+
+/**
+ * Get the name of class for reporting. If the class has no name the name of its closest named ancestor is used.
+ * @param class_p   pointer to a class
+ * @return          the name of the class
+ */
+const char * lv_refr_profiler_get_class_name(const lv_obj_class_t * class_p);
+
+/**
+ * Show the slowest classes and objects of the last window on `lv_layer_sys()`.
+ * The overlay is updated at the end of each window and not profiled itself.
+ * @param en    true: show the overlay; false: delete it
+ */
+void lv_refr_profiler_show_overlay(bool en);
+
+/**
+ * Get the current time for profiling. Used by the rendering.
+ * @return the current time in microseconds
+ */
+uint32_t _lv_refr_profiler_get_time(void);
+
+/**
+ * Add the drawing cost of an object. Used by the rendering.
+ * @param obj       the drawn object
+ * @param time      time spent drawing the object (without its children) [us]
+ * @param px        number of pixels in the drawn area of the main part
+ */
+void _lv_refr_profiler_add(lv_obj_t * obj, uint32_t time, uint32_t px);
+
+/**
+ * Close the window if it has elapsed and update the overlay. Called at the end of each refresh.
+ */
+void _lv_refr_profiler_frame_end(void);
+
+/**
+ * Forget an object which is being deleted but keep its statistics.
+ * @param obj   the object being deleted
+ */
+void _lv_refr_profiler_obj_deleted(lv_obj_t * obj);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_REFR_PROFILER*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_REFR_PROFILER_H*/
@@ -27,7 +27,11 @@ extern "C" {
 #include "lv_draw_triangle.h"
 #include "lv_draw_arc.h"
 #include "lv_draw_blend.h"
+#include "lv_draw_blur.h"
+#include "lv_draw_grad.h"
 #include "lv_draw_mask.h"
+#include "lv_draw_backend.h"
+#include "lv_draw_target.h"
 
 /*********************
  *      DEFINES
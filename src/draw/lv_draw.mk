@@ -1,10 +1,14 @@
 CSRCS += lv_draw_arc.c
+CSRCS += lv_draw_backend.c
 CSRCS += lv_draw_blend.c
+CSRCS += lv_draw_blur.c
+CSRCS += lv_draw_grad.c
 CSRCS += lv_draw_img.c
 CSRCS += lv_draw_label.c
 CSRCS += lv_draw_line.c
 CSRCS += lv_draw_mask.c
 CSRCS += lv_draw_rect.c
+CSRCS += lv_draw_target.c
 CSRCS += lv_draw_triangle.c
 CSRCS += lv_img_buf.c
 CSRCS += lv_img_cache.c
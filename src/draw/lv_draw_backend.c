@@ -0,0 +1,78 @@
+/**
+ * @file lv_draw_backend.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_backend.h"
+
+#if LV_USE_GPU_NXP_PXP
+    #include "../gpu/lv_gpu_nxp_pxp.h"
+#elif LV_USE_GPU_NXP_VG_LITE
+    #include "../gpu/lv_gpu_nxp_vglite.h"
+#elif LV_USE_GPU_STM32_DMA2D
+    #include "../gpu/lv_gpu_stm32_dma2d.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+const lv_draw_backend_t lv_draw_backend_sw = {0};
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Get the backend set by default in `lv_disp_drv_init`.
+ * It's the enabled GPU's backend or `lv_draw_backend_sw`.
+ * @return pointer to a draw backend
+ */
+const lv_draw_backend_t * lv_draw_backend_get_default(void)
+{
+#if LV_USE_GPU_NXP_PXP
+    return &lv_gpu_nxp_pxp_backend;
+#elif LV_USE_GPU_NXP_VG_LITE
+    return &lv_gpu_nxp_vglite_backend;
+#elif LV_USE_GPU_STM32_DMA2D
+    return &lv_gpu_stm32_dma2d_backend;
+#else
+    return &lv_draw_backend_sw;
+#endif
+}
+
+/**
+ * Wait for the draw backend and `gpu_wait_cb` of a display before accessing its draw buffer.
+ * @param disp_drv pointer to a display driver
+ */
+void _lv_draw_backend_wait(lv_disp_drv_t * disp_drv)
+{
+    if(disp_drv->draw_backend && disp_drv->draw_backend->wait) disp_drv->draw_backend->wait(disp_drv);
+    if(disp_drv->gpu_wait_cb) disp_drv->gpu_wait_cb(disp_drv);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
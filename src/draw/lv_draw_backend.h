@@ -0,0 +1,103 @@
+/**
+ * @file lv_draw_backend.h
+ *
+ */
+
+#ifndef LV_DRAW_BACKEND_H
+#define LV_DRAW_BACKEND_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "../misc/lv_color.h"
+#include "../misc/lv_area.h"
+#include "../hal/lv_hal_disp.h"
+#include "lv_draw_rect.h"
+#include "lv_draw_label.h"
+#include "lv_draw_img.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Draw operations which can be offloaded from the software renderer, e.g. to a GPU.
+ * Every callback is optional. If a callback is `NULL` or returns `LV_RES_INV` the operation is done by software.
+ * The callbacks are called only with `LV_BLEND_MODE_NORMAL` and without `set_px_cb`.
+ * If other masks are active (`lv_draw_mask_get_cnt() != 0`) the backend has to apply them or return `LV_RES_INV`.
+ * The areas relative to `dest_area` are in the coordinate system of `dest_buf`, the others are absolute coordinates.
+ */
+typedef struct _lv_draw_backend_t {
+    /** Fill `fill_area` (relative to `dest_area`) of `dest_buf` with a color*/
+    lv_res_t (*fill)(struct _lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, const lv_area_t * dest_area,
+                     const lv_area_t * fill_area, lv_color_t color, lv_opa_t opa);
+
+    /** Blend `draw_area` (relative to `dest_area`) of `src_buf` covering `src_area` to `dest_buf`*/
+    lv_res_t (*blend_map)(struct _lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, const lv_area_t * dest_area,
+                          const lv_area_t * draw_area, const lv_color_t * src_buf, const lv_area_t * src_area, lv_opa_t opa);
+
+    /** Draw a complete rectangle (background, shadow, border, outline etc) like `lv_draw_rect`*/
+    lv_res_t (*draw_rect)(struct _lv_disp_drv_t * disp_drv, const lv_area_t * coords, const lv_area_t * clip,
+                          const lv_draw_rect_dsc_t * dsc);
+
+    /** Draw a line of text from `pos` with the font, color and letter space of `dsc`.
+     * Selection and recoloring are never offloaded.*/
+    lv_res_t (*draw_glyph_run)(struct _lv_disp_drv_t * disp_drv, const lv_point_t * pos, const lv_area_t * clip,
+                               const char * txt, uint32_t txt_len, const lv_draw_label_dsc_t * dsc);
+
+    /** Draw a decoded image (maybe zoomed or rotated) like `lv_draw_img`.
+     * With `alpha_byte` every pixel is followed by an alpha byte.
+     * With `chroma_key` the pixels with `LV_COLOR_CHROMA_KEY` color are transparent.*/
+    lv_res_t (*draw_img)(struct _lv_disp_drv_t * disp_drv, const lv_area_t * coords, const lv_area_t * clip,
+                         const uint8_t * map_p, const lv_draw_img_dsc_t * dsc, bool chroma_key, bool alpha_byte);
+
+    /** Wait until the started operations are finished and the draw buffer can be accessed by the CPU*/
+    void (*wait)(struct _lv_disp_drv_t * disp_drv);
+
+#if LV_USE_USER_DATA
+    void * user_data; /**< Custom backend user data*/
+#endif
+} lv_draw_backend_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get the backend set by default in `lv_disp_drv_init`.
+ * It's the enabled GPU's backend or `lv_draw_backend_sw`.
+ * @return pointer to a draw backend
+ */
+const lv_draw_backend_t * lv_draw_backend_get_default(void);
+
+/**
+ * Wait for the draw backend and `gpu_wait_cb` of a display before accessing its draw buffer.
+ * @param disp_drv pointer to a display driver
+ */
+void _lv_draw_backend_wait(struct _lv_disp_drv_t * disp_drv);
+
+/**********************
+ * GLOBAL VARIABLES
+ **********************/
+
+/*The software renderer: doesn't offload anything*/
+extern const lv_draw_backend_t lv_draw_backend_sw;
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_BACKEND_H*/
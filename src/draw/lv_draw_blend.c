@@ -9,16 +9,11 @@
 #include "lv_draw_blend.h"
 #include "lv_img_decoder.h"
 #include "../misc/lv_math.h"
+#include "../misc/lv_mem.h"
+#include "../misc/lv_trace.h"
 #include "../hal/lv_hal_disp.h"
-#include "../core/lv_refr.h"
-
-#if LV_USE_GPU_NXP_PXP
-    #include "../gpu/lv_gpu_nxp_pxp.h"
-#elif LV_USE_GPU_NXP_VG_LITE
-    #include "../gpu/lv_gpu_nxp_vglite.h"
-#elif LV_USE_GPU_STM32_DMA2D
-    #include "../gpu/lv_gpu_stm32_dma2d.h"
-#endif
+#include "lv_draw_backend.h"
+#include "lv_draw_target.h"
 
 /*********************
  *      DEFINES
@@ -66,6 +61,19 @@ static inline lv_color_t color_blend_true_color_additive(lv_color_t fg, lv_color
 static inline lv_color_t color_blend_true_color_subtractive(lv_color_t fg, lv_color_t bg, lv_opa_t opa);
 #endif
 
+static void fill_cf(const lv_draw_target_t * target, const lv_area_t * draw_area, lv_color_t color, lv_opa_t opa,
+                    const lv_opa_t * mask, lv_draw_mask_res_t mask_res);
+
+static void map_cf(const lv_draw_target_t * target, const lv_area_t * draw_area,
+                   const lv_area_t * map_area, const lv_color_t * map_buf, lv_opa_t opa,
+                   const lv_opa_t * mask, lv_draw_mask_res_t mask_res);
+
+LV_ATTRIBUTE_FAST_MEM static void blend_row_cf(uint8_t * row, lv_img_cf_t cf, int32_t x, int32_t w,
+                                               const lv_color_t * colors, uint32_t color_step,
+                                               const lv_opa_t * mask, lv_opa_t opa);
+
+static uint32_t get_row_size(const lv_draw_target_t * target);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -84,7 +92,7 @@ static inline lv_color_t color_blend_true_color_subtractive(lv_color_t fg, lv_co
 #define FILL_NORMAL_MASK_PX_SCR_TRANSP(out_x,  color)                                               \
     if(*mask_tmp_x) {          \
         if(*mask_tmp_x == LV_OPA_COVER) disp_buf_first[out_x] = color;                                 \
-        else if(disp->driver->screen_transp) lv_color_mix_with_alpha(disp_buf_first[out_x], disp_buf_first[out_x].ch.alpha,              \
+        else if(drv && drv->screen_transp) lv_color_mix_with_alpha(disp_buf_first[out_x], disp_buf_first[out_x].ch.alpha,              \
                                                                         color, *mask_tmp_x, &disp_buf_first[out_x], &disp_buf_first[out_x].ch.alpha);           \
         else disp_buf_first[out_x] = lv_color_mix(color, disp_buf_first[out_x], *mask_tmp_x);            \
     }                                                                                                      \
@@ -100,7 +108,7 @@ static inline lv_color_t color_blend_true_color_subtractive(lv_color_t fg, lv_co
 #define MAP_NORMAL_MASK_PX_SCR_TRANSP(x)                        \
     if(*mask_tmp_x) {          \
         if(*mask_tmp_x == LV_OPA_COVER) disp_buf_first[x] = map_buf_first[x];                                 \
-        else if(disp->driver->screen_transp) lv_color_mix_with_alpha(disp_buf_first[x], disp_buf_first[x].ch.alpha,              \
+        else if(drv && drv->screen_transp) lv_color_mix_with_alpha(disp_buf_first[x], disp_buf_first[x].ch.alpha,              \
                                                                         map_buf_first[x], *mask_tmp_x, &disp_buf_first[x], &disp_buf_first[x].ch.alpha);                  \
         else disp_buf_first[x] = lv_color_mix(map_buf_first[x], disp_buf_first[x], *mask_tmp_x);            \
     }                                                                                               \
@@ -131,12 +139,12 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_fill(const lv_area_t * clip_area, const lv_
     if(opa < LV_OPA_MIN) return;
     if(mask_res == LV_DRAW_MASK_RES_TRANSP) return;
 
-    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
-    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp);
-    const lv_area_t * disp_area = &draw_buf->area;
-    lv_color_t * disp_buf = draw_buf->buf_act;
+    lv_draw_target_t * target = _lv_draw_target_get();
+    const lv_area_t * disp_area = &target->area;
+    lv_color_t * disp_buf = target->buf;
+    lv_disp_drv_t * drv = target->drv;
 
-    if(disp->driver->gpu_wait_cb) disp->driver->gpu_wait_cb(disp->driver);
+    if(drv) _lv_draw_backend_wait(drv);
 
     /*Get clipped fill area which is the real draw area.
      *It is always the same or inside `fill_area`*/
@@ -153,23 +161,36 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_fill(const lv_area_t * clip_area, const lv_
     draw_area.y2 -= disp_area->y1;
 
     /*Round the values in the mask if anti-aliasing is disabled*/
-    if(mask && disp->driver->antialiasing == 0 && mask) {
+    if(mask && target->antialiasing == 0) {
         int32_t mask_w = lv_area_get_width(&draw_area);
         int32_t i;
         for(i = 0; i < mask_w; i++)  mask[i] = mask[i] > 128 ? LV_OPA_COVER : LV_OPA_TRANSP;
     }
 
-    if(disp->driver->set_px_cb) {
+    LV_TRACE_BEGIN_ARG("blend_fill", lv_area_get_size(&draw_area));
+    if(drv && drv->set_px_cb) {
         fill_set_px(disp_area, disp_buf, &draw_area, color, opa, mask, mask_res);
     }
+    else if(_lv_draw_target_is_direct(target) == false) {
+        fill_cf(target, &draw_area, color, opa, mask, mask_res);
+    }
     else if(mode == LV_BLEND_MODE_NORMAL) {
-        fill_normal(disp_area, disp_buf, &draw_area, color, opa, mask, mask_res);
+        /*Let the draw backend fill if there is no mask*/
+        const lv_draw_backend_t * backend = drv ? drv->draw_backend : NULL;
+        if(mask_res == LV_DRAW_MASK_RES_FULL_COVER && backend && backend->fill &&
+           backend->fill(drv, disp_buf, disp_area, &draw_area, color, opa) == LV_RES_OK) {
+            /*Filled by the backend*/
+        }
+        else {
+            fill_normal(disp_area, disp_buf, &draw_area, color, opa, mask, mask_res);
+        }
     }
 #if LV_DRAW_COMPLEX
     else {
         fill_blended(disp_area, disp_buf, &draw_area, color, opa, mask, mask_res, mode);
     }
 #endif
+    LV_TRACE_END("blend_fill");
 }
 
 /**
@@ -201,12 +222,12 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_map(const lv_area_t * clip_area, const lv_a
     is_common = _lv_area_intersect(&draw_area, clip_area, map_area);
     if(!is_common) return;
 
-    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
-    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp);
-    const lv_area_t * disp_area = &draw_buf->area;
-    lv_color_t * disp_buf = draw_buf->buf_act;
+    lv_draw_target_t * target = _lv_draw_target_get();
+    const lv_area_t * disp_area = &target->area;
+    lv_color_t * disp_buf = target->buf;
+    lv_disp_drv_t * drv = target->drv;
 
-    if(disp->driver->gpu_wait_cb) disp->driver->gpu_wait_cb(disp->driver);
+    if(drv) _lv_draw_backend_wait(drv);
 
     /*Now `draw_area` has absolute coordinates.
      *Make it relative to `disp_area` to simplify draw to `disp_buf`*/
@@ -216,24 +237,110 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_map(const lv_area_t * clip_area, const lv_a
     draw_area.y2 -= disp_area->y1;
 
     /*Round the values in the mask if anti-aliasing is disabled*/
-    if(mask && disp->driver->antialiasing == 0)
-    {
+    if(mask && target->antialiasing == 0) {
         int32_t mask_w = lv_area_get_width(&draw_area);
         int32_t i;
         for(i = 0; i < mask_w; i++)  mask[i] = mask[i] > 128 ? LV_OPA_COVER : LV_OPA_TRANSP;
     }
-    if(disp->driver->set_px_cb) {
+    LV_TRACE_BEGIN_ARG("blend_map", lv_area_get_size(&draw_area));
+    if(drv && drv->set_px_cb) {
         map_set_px(disp_area, disp_buf, &draw_area, map_area, map_buf, opa, mask, mask_res);
     }
+    else if(_lv_draw_target_is_direct(target) == false) {
+        map_cf(target, &draw_area, map_area, map_buf, opa, mask, mask_res);
+    }
     else if(mode == LV_BLEND_MODE_NORMAL) {
-        map_normal(disp_area, disp_buf, &draw_area, map_area, map_buf, opa, mask, mask_res);
+        /*Let the draw backend blend if there is no mask*/
+        const lv_draw_backend_t * backend = drv ? drv->draw_backend : NULL;
+        if(mask_res == LV_DRAW_MASK_RES_FULL_COVER && backend && backend->blend_map &&
+           backend->blend_map(drv, disp_buf, disp_area, &draw_area, map_buf, map_area, opa) == LV_RES_OK) {
+            /*Blended by the backend*/
+        }
+        else {
+            map_normal(disp_area, disp_buf, &draw_area, map_area, map_buf, opa, mask, mask_res);
+        }
     }
 #if LV_DRAW_COMPLEX
     else {
         map_blended(disp_area, disp_buf, &draw_area, map_area, map_buf, opa, mask, mask_res, mode);
     }
 #endif
+    LV_TRACE_END("blend_map");
+}
+
+#if LV_DRAW_COMPLEX
+/**
+ * Fill an area and apply the added masks on it.
+ * The masks are calculated only on the partially covered parts of the rows.
+ * The fully covered parts are filled without mask (the same parts of the adjacent rows at once)
+ * and the transparent parts are skipped.
+ * @param clip_area clip the fill to this area  (absolute coordinates)
+ * @param fill_area fill this area  (absolute coordinates)
+ * @param color fill color
+ * @param opa overall opacity in 0x00..0xff range
+ * @param mode blend mode from `lv_blend_mode_t`
+ */
+LV_ATTRIBUTE_FAST_MEM void _lv_blend_fill_masked(const lv_area_t * clip_area, const lv_area_t * fill_area,
+                                                 lv_color_t color, lv_opa_t opa, lv_blend_mode_t mode)
+{
+    if(opa < LV_OPA_MIN) return;
+
+    lv_area_t draw_area;
+    if(_lv_area_intersect(&draw_area, clip_area, fill_area) == false) return;
+
+    int32_t draw_area_w = lv_area_get_width(&draw_area);
+    lv_opa_t * mask_buf = lv_mem_buf_get(draw_area_w);
+
+    lv_area_t cover_area;
+    bool cover_pending = false;
+
+    lv_coord_t y;
+    for(y = draw_area.y1; y <= draw_area.y2; y++) {
+        lv_draw_mask_span_t span;
+        lv_draw_mask_res_t span_res = lv_draw_mask_get_span(draw_area.x1, y, draw_area_w, &span);
+        if(span_res == LV_DRAW_MASK_RES_TRANSP) continue;
+
+        /*Collect the fully covered parts while they are the same in the rows*/
+        if(span.cover_x1 <= span.cover_x2) {
+            if(cover_pending && cover_area.x1 == span.cover_x1 && cover_area.x2 == span.cover_x2 &&
+               cover_area.y2 == y - 1) {
+                cover_area.y2 = y;
+            }
+            else {
+                if(cover_pending) {
+                    _lv_blend_fill(clip_area, &cover_area, color, NULL, LV_DRAW_MASK_RES_FULL_COVER, opa, mode);
+                }
+                lv_area_set(&cover_area, span.cover_x1, y, span.cover_x2, y);
+                cover_pending = true;
+            }
+        }
+
+        /*Apply the masks on the partially covered parts on the left and the right*/
+        lv_area_t part_area;
+        part_area.y1 = y;
+        part_area.y2 = y;
+        uint32_t i;
+        for(i = 0; i < 2; i++) {
+            part_area.x1 = i == 0 ? span.x1 : span.cover_x2 + 1;
+            part_area.x2 = i == 0 ? span.cover_x1 - 1 : span.x2;
+            if(part_area.x1 > part_area.x2) continue;
+
+            /*Set the base opacity in the mask to mix it with the masks' opacity*/
+            int32_t part_w = lv_area_get_width(&part_area);
+            lv_memset(mask_buf, opa, part_w);
+            lv_draw_mask_res_t mask_res = lv_draw_mask_apply(mask_buf, part_area.x1, y, part_w);
+            _lv_blend_fill(clip_area, &part_area, color, mask_buf, mask_res,
+                           mask_res == LV_DRAW_MASK_RES_CHANGED ? LV_OPA_COVER : opa, mode);
+        }
+    }
+
+    if(cover_pending) {
+        _lv_blend_fill(clip_area, &cover_area, color, NULL, LV_DRAW_MASK_RES_FULL_COVER, opa, mode);
+    }
+
+    lv_mem_buf_release(mask_buf);
 }
+#endif
 
 /**********************
  *   STATIC FUNCTIONS
@@ -244,7 +351,7 @@ static void fill_set_px(const lv_area_t * disp_area, lv_color_t * disp_buf,  con
                         const lv_opa_t * mask, lv_draw_mask_res_t mask_res)
 {
 
-    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    lv_disp_drv_t * drv = _lv_draw_target_get()->drv;
 
     /*Get the width of the `disp_area` it will be used to go to the next line*/
     int32_t disp_w = lv_area_get_width(disp_area);
@@ -255,7 +362,7 @@ static void fill_set_px(const lv_area_t * disp_area, lv_color_t * disp_buf,  con
     if(mask_res == LV_DRAW_MASK_RES_FULL_COVER) {
         for(y = draw_area->y1; y <= draw_area->y2; y++) {
             for(x = draw_area->x1; x <= draw_area->x2; x++) {
-                disp->driver->set_px_cb(disp->driver, (void *)disp_buf, disp_w, x, y, color, opa);
+                drv->set_px_cb(drv, (void *)disp_buf, disp_w, x, y, color, opa);
             }
         }
     }
@@ -271,7 +378,7 @@ static void fill_set_px(const lv_area_t * disp_area, lv_color_t * disp_buf,  con
         for(y = draw_area->y1; y <= draw_area->y2; y++) {
             for(x = draw_area->x1; x <= draw_area->x2; x++) {
                 if(mask_tmp[x]) {
-                    disp->driver->set_px_cb(disp->driver, (void *)disp_buf, disp_w, x, y, color,
+                    drv->set_px_cb(drv, (void *)disp_buf, disp_w, x, y, color,
                                            (uint32_t)((uint32_t)opa * mask_tmp[x]) >> 8);
                 }
             }
@@ -299,7 +406,7 @@ LV_ATTRIBUTE_FAST_MEM static void fill_normal(const lv_area_t * disp_area, lv_co
                                               const lv_opa_t * mask, lv_draw_mask_res_t mask_res)
 {
 
-    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    lv_disp_drv_t * drv = _lv_draw_target_get()->drv;
 
     /*Get the width of the `disp_area` it will be used to go to the next line*/
     int32_t disp_w = lv_area_get_width(disp_area);
@@ -316,27 +423,8 @@ LV_ATTRIBUTE_FAST_MEM static void fill_normal(const lv_area_t * disp_area, lv_co
     /*Simple fill (maybe with opacity), no masking*/
     if(mask_res == LV_DRAW_MASK_RES_FULL_COVER) {
         if(opa > LV_OPA_MAX) {
-#if LV_USE_GPU_NXP_PXP
-            if(lv_area_get_size(draw_area) >= LV_GPU_NXP_PXP_FILL_SIZE_LIMIT) {
-                lv_gpu_nxp_pxp_fill(disp_buf, disp_w, draw_area, color, opa);
-                return;
-            }
-#elif LV_USE_GPU_NXP_VG_LITE
-            if(lv_area_get_size(draw_area) >= LV_GPU_NXP_VG_LITE_FILL_SIZE_LIMIT) {
-                if(lv_gpu_nxp_vglite_fill(disp_buf, disp_w, lv_area_get_height(disp_area), draw_area, color, opa) == LV_RES_OK) {
-                    return;
-                }
-                /*Fall down to SW render in case of error*/
-            }
-#elif LV_USE_GPU_STM32_DMA2D
-            if(lv_area_get_size(draw_area) >= 240) {
-                lv_gpu_stm32_dma2d_fill(disp_buf_first, disp_w, color, draw_area_w, draw_area_h);
-                return;
-            }
-#endif
-
-            if(disp->driver->gpu_fill_cb && lv_area_get_size(draw_area) > GPU_SIZE_LIMIT) {
-                disp->driver->gpu_fill_cb(disp->driver, disp_buf, disp_w, draw_area, color);
+            if(drv && drv->gpu_fill_cb && lv_area_get_size(draw_area) > GPU_SIZE_LIMIT) {
+                drv->gpu_fill_cb(drv, disp_buf, disp_w, draw_area, color);
                 return;
             }
 
@@ -348,19 +436,6 @@ LV_ATTRIBUTE_FAST_MEM static void fill_normal(const lv_area_t * disp_area, lv_co
         }
         /*No mask with opacity*/
         else {
-#if LV_USE_GPU_NXP_PXP
-            if(lv_area_get_size(draw_area) >= LV_GPU_NXP_PXP_FILL_OPA_SIZE_LIMIT) {
-                lv_gpu_nxp_pxp_fill(disp_buf, disp_w, draw_area, color, opa);
-                return;
-            }
-#elif LV_USE_GPU_NXP_VG_LITE
-            if(lv_area_get_size(draw_area) >= LV_GPU_NXP_VG_LITE_FILL_OPA_SIZE_LIMIT) {
-                if(lv_gpu_nxp_vglite_fill(disp_buf, disp_w, lv_area_get_height(disp_area), draw_area, color, opa) == LV_RES_OK) {
-                    return;
-                }
-                /*Fall down to SW render in case of error*/
-            }
-#endif
             lv_color_t last_dest_color = lv_color_black();
             lv_color_t last_res_color = lv_color_mix(color, last_dest_color, opa);
 
@@ -374,7 +449,7 @@ LV_ATTRIBUTE_FAST_MEM static void fill_normal(const lv_area_t * disp_area, lv_co
                         last_dest_color = disp_buf_first[x];
 
 #if LV_COLOR_SCREEN_TRANSP
-                        if(disp->driver->screen_transp) {
+                        if(drv && drv->screen_transp) {
                             lv_color_mix_with_alpha(disp_buf_first[x], disp_buf_first[x].ch.alpha, color, opa, &last_res_color,
                                                     &last_res_color.ch.alpha);
                         }
@@ -473,7 +548,7 @@ LV_ATTRIBUTE_FAST_MEM static void fill_normal(const lv_area_t * disp_area, lv_co
                                                                    (uint32_t)((uint32_t)(*mask_tmp_x) * opa) >> 8;
                         if(*mask_tmp_x != last_mask || last_dest_color.full != disp_buf_first[x].full) {
 #if LV_COLOR_SCREEN_TRANSP
-                            if(disp->driver->screen_transp) {
+                            if(drv && drv->screen_transp) {
                                 lv_color_mix_with_alpha(disp_buf_first[x], disp_buf_first[x].ch.alpha, color, opa_tmp, &last_res_color,
                                                         &last_res_color.ch.alpha);
                             }
@@ -594,7 +669,7 @@ static void map_set_px(const lv_area_t * disp_area, lv_color_t * disp_buf,  cons
                        const lv_opa_t * mask, lv_draw_mask_res_t mask_res)
 
 {
-    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    lv_disp_drv_t * drv = _lv_draw_target_get()->drv;
 
     /*Get the width of the `disp_area` it will be used to go to the next line*/
     int32_t disp_w = lv_area_get_width(disp_area);
@@ -616,7 +691,7 @@ static void map_set_px(const lv_area_t * disp_area, lv_color_t * disp_buf,  cons
     if(mask_res == LV_DRAW_MASK_RES_FULL_COVER) {
         for(y = draw_area->y1; y <= draw_area->y2; y++) {
             for(x = draw_area->x1; x <= draw_area->x2; x++) {
-                disp->driver->set_px_cb(disp->driver, (void *)disp_buf, disp_w, x, y, map_buf_tmp[x], opa);
+                drv->set_px_cb(drv, (void *)disp_buf, disp_w, x, y, map_buf_tmp[x], opa);
             }
             map_buf_tmp += map_w;
         }
@@ -630,7 +705,7 @@ static void map_set_px(const lv_area_t * disp_area, lv_color_t * disp_buf,  cons
         for(y = draw_area->y1; y <= draw_area->y2; y++) {
             for(x = draw_area->x1; x <= draw_area->x2; x++) {
                 if(mask_tmp[x]) {
-                    disp->driver->set_px_cb(disp->driver, (void *)disp_buf, disp_w, x, y, map_buf_tmp[x],
+                    drv->set_px_cb(drv, (void *)disp_buf, disp_w, x, y, map_buf_tmp[x],
                                            (uint32_t)((uint32_t)opa * mask_tmp[x]) >> 8);
                 }
             }
@@ -676,7 +751,7 @@ LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_col
     map_buf_first += (draw_area->x1 - (map_area->x1 - disp_area->x1));
 
 #if LV_COLOR_SCREEN_TRANSP
-    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    lv_disp_drv_t * drv = _lv_draw_target_get()->drv;
 #endif
 
     int32_t x;
@@ -685,48 +760,6 @@ LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_col
     /*Simple fill (maybe with opacity), no masking*/
     if(mask_res == LV_DRAW_MASK_RES_FULL_COVER) {
         if(opa > LV_OPA_MAX) {
-#if LV_USE_GPU_NXP_PXP
-            if(lv_area_get_size(draw_area) >= LV_GPU_NXP_PXP_BLIT_SIZE_LIMIT) {
-                lv_gpu_nxp_pxp_blit(disp_buf_first, disp_w, map_buf_first, map_w, draw_area_w, draw_area_h, opa);
-                return;
-            }
-#elif (LV_USE_GPU_NXP_VG_LITE)
-            if(lv_area_get_size(draw_area) >= LV_GPU_NXP_VG_LITE_BLIT_SIZE_LIMIT) {
-
-                lv_gpu_nxp_vglite_blit_info_t blit;
-
-                blit.src = map_buf;
-                blit.src_width = draw_area_w;
-                blit.src_height = draw_area_h;
-                blit.src_stride = lv_area_get_width(map_area) * sizeof(lv_color_t);
-                blit.src_area.x1 = (draw_area->x1 - (map_area->x1 - disp_area->x1));
-                blit.src_area.y1 = (draw_area->y1 - (map_area->y1 - disp_area->y1));
-                blit.src_area.x2 = blit.src_area.x1 + draw_area_w - 1;
-                blit.src_area.y2 = blit.src_area.y1 + draw_area_h - 1;
-
-                blit.dst = disp_buf;
-                blit.dst_width = lv_area_get_width(disp_area);
-                blit.dst_height = lv_area_get_height(disp_area);
-                blit.dst_stride = lv_area_get_width(disp_area) * sizeof(lv_color_t);
-                blit.dst_area.x1 = draw_area->x1;
-                blit.dst_area.y1 = draw_area->y1;
-                blit.dst_area.x2 = blit.dst_area.x1 + draw_area_w - 1;
-                blit.dst_area.y2 = blit.dst_area.y1 + draw_area_h - 1;
-
-                blit.opa = opa;
-
-                if(lv_gpu_nxp_vglite_blit(&blit) == LV_RES_OK) {
-                    return;
-                }
-                /*Fall down to SW render in case of error*/
-            }
-#elif LV_USE_GPU_STM32_DMA2D
-            if(lv_area_get_size(draw_area) >= 240) {
-                lv_gpu_stm32_dma2d_copy(disp_buf_first, disp_w, map_buf_first, map_w, draw_area_w, draw_area_h);
-                return;
-            }
-#endif
-
             /*Software rendering*/
             for(y = 0; y < draw_area_h; y++) {
                 lv_memcpy(disp_buf_first, map_buf_first, draw_area_w * sizeof(lv_color_t));
@@ -735,54 +768,12 @@ LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_col
             }
         }
         else {
-#if LV_USE_GPU_NXP_PXP
-            if(lv_area_get_size(draw_area) >= LV_GPU_NXP_PXP_BLIT_OPA_SIZE_LIMIT) {
-                lv_gpu_nxp_pxp_blit(disp_buf_first, disp_w, map_buf_first, map_w, draw_area_w, draw_area_h, opa);
-                return;
-            }
-#elif (LV_USE_GPU_NXP_VG_LITE)
-            if(lv_area_get_size(draw_area) >= LV_GPU_NXP_VG_LITE_BLIT_OPA_SIZE_LIMIT) {
-
-                lv_gpu_nxp_vglite_blit_info_t blit;
-
-                blit.src = map_buf;
-                blit.src_width = lv_area_get_width(map_area);
-                blit.src_height = lv_area_get_height(map_area);
-                blit.src_stride = lv_area_get_width(map_area) * sizeof(lv_color_t);
-                blit.src_area.x1 = (draw_area->x1 - (map_area->x1 - disp_area->x1));
-                blit.src_area.y1 = (draw_area->y1 - (map_area->y1 - disp_area->y1));
-                blit.src_area.x2 = blit.src_area.x1 + draw_area_w - 1;
-                blit.src_area.y2 = blit.src_area.y1 + draw_area_h - 1;
-
-                blit.dst = disp_buf;
-                blit.dst_width = lv_area_get_width(disp_area);
-                blit.dst_height = lv_area_get_height(disp_area);
-                blit.dst_stride = lv_area_get_width(disp_area) * sizeof(lv_color_t);
-                blit.dst_area.x1 = draw_area->x1;
-                blit.dst_area.y1 = draw_area->y1;
-                blit.dst_area.x2 = blit.dst_area.x1 + draw_area_w - 1;
-                blit.dst_area.y2 = blit.dst_area.y1 + draw_area_h - 1;
-
-                blit.opa = opa;
-
-                if(lv_gpu_nxp_vglite_blit(&blit) == LV_RES_OK) {
-                    return;
-                }
-                /*Fall down to SW render in case of error*/
-            }
-#elif LV_USE_GPU_STM32_DMA2D
-            if(lv_area_get_size(draw_area) >= 240) {
-                lv_gpu_stm32_dma2d_blend(disp_buf_first, disp_w, map_buf_first, opa, map_w, draw_area_w, draw_area_h);
-                return;
-            }
-#endif
-
             /*Software rendering*/
 
             for(y = 0; y < draw_area_h; y++) {
                 for(x = 0; x < draw_area_w; x++) {
 #if LV_COLOR_SCREEN_TRANSP
-                    if(disp->driver->screen_transp) {
+                    if(drv && drv->screen_transp) {
                         lv_color_mix_with_alpha(disp_buf_first[x], disp_buf_first[x].ch.alpha, map_buf_first[x], opa, &disp_buf_first[x],
                                                 &disp_buf_first[x].ch.alpha);
                     }
@@ -868,7 +859,7 @@ LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_col
                     if(mask[x]) {
                         lv_opa_t opa_tmp = mask[x] >= LV_OPA_MAX ? opa : ((opa * mask[x]) >> 8);
 #if LV_COLOR_SCREEN_TRANSP
-                        if(disp->driver->screen_transp) {
+                        if(drv && drv->screen_transp) {
                             lv_color_mix_with_alpha(disp_buf_first[x], disp_buf_first[x].ch.alpha, map_buf_first[x], opa_tmp, &disp_buf_first[x],
                                                     &disp_buf_first[x].ch.alpha);
                         }
@@ -1050,3 +1041,169 @@ static inline lv_color_t color_blend_true_color_subtractive(lv_color_t fg, lv_co
     return lv_color_mix(fg, bg, opa);
 }
 #endif
+
+/**
+ * Fill an area of a target which is not an `lv_color_t` array (e.g. a TRUE_COLOR_ALPHA or ALPHA_8BIT canvas).
+ * Only the normal blend mode is supported.
+ * @param target the target to draw to
+ * @param draw_area fill this area (relative to `target->area`)
+ * @param color fill color
+ * @param opa overall opacity in 0x00..0xff range
+ * @param mask a mask to apply on every pixel (uint8_t array with 0x00..0xff values).
+ *                It fits into draw_area.
+ * @param mask_res LV_MASK_RES_COVER: the mask has only 0xff values (no mask),
+ *                 LV_MASK_RES_TRANSP: the mask has only 0x00 values (full transparent),
+ *                 LV_MASK_RES_CHANGED: the mask has mixed values
+ */
+static void fill_cf(const lv_draw_target_t * target, const lv_area_t * draw_area, lv_color_t color, lv_opa_t opa,
+                    const lv_opa_t * mask, lv_draw_mask_res_t mask_res)
+{
+    uint32_t row_size = get_row_size(target);
+    if(row_size == 0) return;
+
+    int32_t draw_area_w = lv_area_get_width(draw_area);
+    uint8_t * row = (uint8_t *)target->buf + row_size * draw_area->y1;
+    if(mask_res == LV_DRAW_MASK_RES_FULL_COVER) mask = NULL;
+
+    int32_t y;
+    for(y = draw_area->y1; y <= draw_area->y2; y++) {
+        blend_row_cf(row, target->cf, draw_area->x1, draw_area_w, &color, 0, mask, opa);
+        row += row_size;
+        if(mask) mask += draw_area_w;
+    }
+}
+
+/**
+ * Copy an image to an area of a target which is not an `lv_color_t` array.
+ * Only the normal blend mode is supported.
+ * @param target the target to draw to
+ * @param draw_area the area to draw (relative to `target->area`)
+ * @param map_area coordinates of the map (image) to copy. (absolute coordinates)
+ * @param map_buf the pixel of the image
+ * @param opa overall opacity in 0x00..0xff range
+ * @param mask a mask to apply on every pixel (uint8_t array with 0x00..0xff values).
+ *                It fits into draw_area.
+ * @param mask_res LV_MASK_RES_COVER: the mask has only 0xff values (no mask),
+ *                 LV_MASK_RES_TRANSP: the mask has only 0x00 values (full transparent),
+ *                 LV_MASK_RES_CHANGED: the mask has mixed values
+ */
+static void map_cf(const lv_draw_target_t * target, const lv_area_t * draw_area,
+                   const lv_area_t * map_area, const lv_color_t * map_buf, lv_opa_t opa,
+                   const lv_opa_t * mask, lv_draw_mask_res_t mask_res)
+{
+    uint32_t row_size = get_row_size(target);
+    if(row_size == 0) return;
+
+    const lv_area_t * disp_area = &target->area;
+    int32_t draw_area_w = lv_area_get_width(draw_area);
+    int32_t map_w = lv_area_get_width(map_area);
+
+    /*Create a temp. map_buf which always point to first pixel to draw from the map*/
+    const lv_color_t * map_buf_first = map_buf + map_w * (draw_area->y1 - (map_area->y1 - disp_area->y1));
+    map_buf_first += (draw_area->x1 - (map_area->x1 - disp_area->x1));
+
+    uint8_t * row = (uint8_t *)target->buf + row_size * draw_area->y1;
+    if(mask_res == LV_DRAW_MASK_RES_FULL_COVER) mask = NULL;
+
+    int32_t y;
+    for(y = draw_area->y1; y <= draw_area->y2; y++) {
+        blend_row_cf(row, target->cf, draw_area->x1, draw_area_w, map_buf_first, 1, mask, opa);
+        row += row_size;
+        map_buf_first += map_w;
+        if(mask) mask += draw_area_w;
+    }
+}
+
+/**
+ * Blend colors to a row of a TRUE_COLOR_ALPHA or ALPHA_1/2/4/8BIT buffer.
+ * The alpha only formats store the brightness of the colors.
+ * @param row pointer to the first byte of the row
+ * @param cf color format of the row
+ * @param x index of the first pixel to blend in the row
+ * @param w number of pixels to blend
+ * @param colors the colors to blend
+ * @param color_step 0: blend `colors[0]` to every pixel; 1: blend `colors[i]` to the i-th pixel
+ * @param mask opacity of every pixel or `NULL` to use only `opa`
+ * @param opa overall opacity in 0x00..0xff range
+ */
+LV_ATTRIBUTE_FAST_MEM static void blend_row_cf(uint8_t * row, lv_img_cf_t cf, int32_t x, int32_t w,
+                                               const lv_color_t * colors, uint32_t color_step,
+                                               const lv_opa_t * mask, lv_opa_t opa)
+{
+    int32_t i;
+    lv_opa_t px_opa = opa;
+
+    if(cf == LV_IMG_CF_TRUE_COLOR_ALPHA) {
+        uint8_t * px = row + x * LV_IMG_PX_SIZE_ALPHA_BYTE;
+        for(i = 0; i < w; i++) {
+            if(mask) px_opa = opa > LV_OPA_MAX ? mask[i] : (uint32_t)((uint32_t)opa * mask[i]) >> 8;
+            if(px_opa > LV_OPA_MIN) {
+                lv_color_t color = colors[i * color_step];
+                lv_opa_t bg_opa = px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+                lv_opa_t res_opa = px_opa;
+                /*Mix only if both the new and the old pixel are semi-transparent*/
+                if(px_opa < LV_OPA_MAX && bg_opa > LV_OPA_MIN) {
+                    lv_color_t bg_color = lv_color_black();
+                    lv_memcpy_small(&bg_color, px, LV_IMG_PX_SIZE_ALPHA_BYTE - 1);
+                    lv_color_mix_with_alpha(bg_color, bg_opa, color, px_opa, &color, &res_opa);
+                }
+                lv_memcpy_small(px, &color, LV_IMG_PX_SIZE_ALPHA_BYTE - 1);
+                px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = res_opa;
+            }
+            px += LV_IMG_PX_SIZE_ALPHA_BYTE;
+        }
+    }
+    else if(cf == LV_IMG_CF_ALPHA_8BIT) {
+        uint8_t * px = row + x;
+        if(mask == NULL && opa > LV_OPA_MAX && color_step == 0) {
+            lv_memset(px, lv_color_brightness(colors[0]), w);
+            return;
+        }
+
+        for(i = 0; i < w; i++) {
+            if(mask) px_opa = opa > LV_OPA_MAX ? mask[i] : (uint32_t)((uint32_t)opa * mask[i]) >> 8;
+            if(px_opa > LV_OPA_MIN) {
+                uint8_t br = lv_color_brightness(colors[i * color_step]);
+                if(px_opa < LV_OPA_MAX) br = (uint16_t)((uint16_t)br * px_opa + px[i] * (255 - px_opa)) >> 8;
+                px[i] = br;
+            }
+        }
+    }
+    else {
+        /*1, 2 or 4 bit per pixel from the MSB*/
+        uint8_t bpp = lv_img_cf_get_px_size(cf);
+        uint8_t px_max = (1 << bpp) - 1;
+        uint8_t px_scale = 255 / px_max;    /*Scale a pixel to 0..255*/
+        uint32_t bit = (uint32_t)x * bpp;
+        for(i = 0; i < w; i++) {
+            if(mask) px_opa = opa > LV_OPA_MAX ? mask[i] : (uint32_t)((uint32_t)opa * mask[i]) >> 8;
+            if(px_opa > LV_OPA_MIN) {
+                uint8_t * px = &row[bit >> 3];
+                uint8_t shift = 8 - bpp - (bit & 0x7);
+                uint8_t br = lv_color_brightness(colors[i * color_step]);
+                if(px_opa < LV_OPA_MAX) {
+                    uint8_t bg = ((*px >> shift) & px_max) * px_scale;
+                    br = (uint16_t)((uint16_t)br * px_opa + bg * (255 - px_opa)) >> 8;
+                }
+                *px = (*px & ~(px_max << shift)) | ((br >> (8 - bpp)) << shift);
+            }
+            bit += bpp;
+        }
+    }
+}
+
+/**
+ * Get the size of a row of a target in bytes
+ * @param target a target which is not an `lv_color_t` array
+ * @return the size of a row or 0 if the color format of the target is not supported
+ */
+static uint32_t get_row_size(const lv_draw_target_t * target)
+{
+    if(target->cf != LV_IMG_CF_TRUE_COLOR_ALPHA &&
+       (target->cf < LV_IMG_CF_ALPHA_1BIT || target->cf > LV_IMG_CF_ALPHA_8BIT)) {
+        LV_LOG_WARN("Can't draw to this color format");
+        return 0;
+    }
+
+    return ((uint32_t)lv_area_get_width(&target->area) * lv_img_cf_get_px_size(target->cf) + 7) >> 3;
+}
@@ -38,6 +38,11 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_map(const lv_area_t * clip_area, const lv_a
                                          const lv_color_t * map_buf,
                                          lv_opa_t * mask, lv_draw_mask_res_t mask_res, lv_opa_t opa, lv_blend_mode_t mode);
 
+#if LV_DRAW_COMPLEX
+LV_ATTRIBUTE_FAST_MEM void _lv_blend_fill_masked(const lv_area_t * clip_area, const lv_area_t * fill_area,
+                                                 lv_color_t color, lv_opa_t opa, lv_blend_mode_t mode);
+#endif
+
 //! @endcond
 /**********************
  *      MACROS
@@ -0,0 +1,107 @@
+/**
+ * @file lv_draw_blur.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_blur.h"
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+LV_ATTRIBUTE_FAST_MEM void lv_draw_blur_box(uint16_t * buf, uint32_t len, uint32_t stride, uint32_t r_back,
+                                            uint32_t r_front, uint32_t div, uint16_t * tmp)
+{
+    if(len == 0 || div == 0) return;
+
+    uint32_t last = len - 1;
+
+    /*Divide with shift if possible*/
+    uint32_t shift = 0;
+    bool pow2 = (div & (div - 1)) == 0 ? true : false;
+    if(pow2) {
+        while((1U << shift) < div) shift++;
+    }
+
+    /*The sum of the window of the first value. The values before the first one are the same as the first.*/
+    uint32_t sum = buf[0] * (r_back + 1);
+    uint32_t i;
+    for(i = 1; i <= r_front; i++) {
+        sum += buf[(i < last ? i : last) * stride];
+    }
+
+    /*Until the window reaches the first value the first value is removed*/
+    uint32_t i_end = r_back < len ? r_back : len;
+    for(i = 0; i < i_end; i++) {
+        tmp[i] = pow2 ? sum >> shift : sum / div;
+        uint32_t i_in = i + r_front + 1;
+        sum += buf[(i_in < last ? i_in : last) * stride];
+        sum -= buf[0];
+    }
+
+    /*Both ends of the window are in the array: no need to check the indices*/
+    i_end = last > r_front ? last - r_front : 0;
+    if(i < i_end) {
+        const uint16_t * out_p = &buf[(i - r_back) * stride];
+        const uint16_t * in_p = &buf[(i + r_front + 1) * stride];
+        if(pow2) {
+            for(; i < i_end; i++) {
+                tmp[i] = sum >> shift;
+                sum += *in_p;
+                sum -= *out_p;
+                in_p += stride;
+                out_p += stride;
+            }
+        }
+        else {
+            for(; i < i_end; i++) {
+                tmp[i] = sum / div;
+                sum += *in_p;
+                sum -= *out_p;
+                in_p += stride;
+                out_p += stride;
+            }
+        }
+    }
+
+    /*The window is over the last value: add the last value instead of the missing ones*/
+    for(; i < len; i++) {
+        tmp[i] = pow2 ? sum >> shift : sum / div;
+        sum += buf[last * stride];
+        sum -= buf[(i - r_back) * stride];
+    }
+
+    uint16_t * buf_p = buf;
+    for(i = 0; i < len; i++) {
+        *buf_p = tmp[i];
+        buf_p += stride;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
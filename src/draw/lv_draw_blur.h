@@ -0,0 +1,58 @@
+/**
+ * @file lv_draw_blur.h
+ *
+ */
+
+#ifndef LV_DRAW_BLUR_H
+#define LV_DRAW_BLUR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#include <stdint.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Blur values with a box filter using a running sum, so the cost doesn't depend on the size of the filter.
+ * Every value is replaced by the sum of the values in the `[i - r_back; i + r_front]` range divided by `div`.
+ * The values out of the array are considered to be the same as the first and last values.
+ * It can be used on a channel of a row (`stride = 1`) or a column (`stride = width`) of an image.
+ * Repeating the blur 2-3 times gives a good approximation of a Gaussian blur.
+ * @param buf       pointer to the first value. The result is written here too.
+ * @param len       number of values
+ * @param stride    distance between two adjacent values in `buf`
+ * @param r_back    number of values to use before the current value
+ * @param r_front   number of values to use after the current value
+ * @param div       divide the sums with this value. `r_back + r_front + 1` results the average.
+ *                  If `div` is small the sums might not fit into the 16 bit values.
+ * @param tmp       a buffer for `len` values
+ */
+LV_ATTRIBUTE_FAST_MEM void lv_draw_blur_box(uint16_t * buf, uint32_t len, uint32_t stride, uint32_t r_back,
+                                            uint32_t r_front, uint32_t div, uint16_t * tmp);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_BLUR_H*/
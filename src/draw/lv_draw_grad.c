@@ -0,0 +1,243 @@
+/**
+ * @file lv_draw_grad.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_grad.h"
+#if LV_DRAW_COMPLEX
+#include "../misc/lv_mem.h"
+#include "../misc/lv_gc.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#if _LV_GRAD_DITHER
+#define GRAD_COLOR_SIZE sizeof(_lv_grad_hcolor_t)
+#else
+#define GRAD_COLOR_SIZE sizeof(lv_color_t)
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void grad_calc(_lv_grad_t * grad);
+#if LV_GRAD_CACHE_DEF_SIZE
+static _lv_grad_t * grad_cache_find(lv_color_t main_color, lv_color_t grad_color, uint8_t main_stop, uint8_t grad_stop,
+                                    lv_coord_t size);
+static _lv_grad_t * grad_cache_alloc(uint32_t mem_size);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_GRAD_CACHE_DEF_SIZE
+static uint32_t grad_cache_life;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+_lv_grad_t * _lv_grad_get(lv_color_t main_color, lv_color_t grad_color, uint8_t main_stop, uint8_t grad_stop,
+                          lv_coord_t size)
+{
+    if(size <= 0) return NULL;
+
+    _lv_grad_t * grad;
+#if LV_GRAD_CACHE_DEF_SIZE
+    grad = grad_cache_find(main_color, grad_color, main_stop, grad_stop, size);
+    if(grad) return grad;
+#endif
+
+    uint32_t mem_size = sizeof(_lv_grad_t) + size * GRAD_COLOR_SIZE;
+    grad = NULL;
+#if LV_GRAD_CACHE_DEF_SIZE
+    grad = grad_cache_alloc(mem_size);
+#endif
+    /*Too large for the cache or the cache is disabled*/
+    if(grad == NULL) {
+        grad = lv_mem_buf_get(mem_size);
+        if(grad == NULL) return NULL;
+        grad->cached = 0;
+    }
+
+    grad->main_color = main_color;
+    grad->grad_color = grad_color;
+    grad->main_stop = main_stop;
+    grad->grad_stop = grad_stop;
+    grad->size = size;
+    grad->mem_size = mem_size;
+#if _LV_GRAD_DITHER
+    grad->hmap = (_lv_grad_hcolor_t *)(grad + 1);
+#else
+    grad->map = (lv_color_t *)(grad + 1);
+#endif
+    grad_calc(grad);
+
+    return grad;
+}
+
+void _lv_grad_release(_lv_grad_t * grad)
+{
+    if(grad && grad->cached == 0) lv_mem_buf_release(grad);
+}
+
+void _lv_grad_cache_clean(void)
+{
+#if LV_GRAD_CACHE_DEF_SIZE
+    _lv_grad_t ** cache = LV_GC_ROOT(_lv_grad_cache);
+    uint32_t i;
+    for(i = 0; i < _LV_GRAD_CACHE_MAX_NUM; i++) {
+        if(cache[i]) {
+            lv_mem_free(cache[i]);
+            cache[i] = NULL;
+        }
+    }
+#endif
+}
+
+#if _LV_GRAD_DITHER
+LV_ATTRIBUTE_FAST_MEM void _lv_grad_dither(const _lv_grad_hcolor_t * src, int32_t src_step, lv_coord_t x,
+                                           lv_coord_t y, lv_coord_t len, lv_color_t * out)
+{
+    /*4x4 Bayer matrix*/
+    static const uint8_t threshold[4][4] = {
+        {0,  8,  2, 10},
+        {12, 4, 14,  6},
+        {3, 11,  1,  9},
+        {15, 7, 13,  5}
+    };
+
+    const uint8_t * th_row = threshold[y & 0x3];
+    lv_coord_t i;
+    for(i = 0; i < len; i++) {
+        uint32_t th = th_row[(x + i) & 0x3];
+        LV_COLOR_SET_R(out[i], (src->red + th) >> 4);
+        LV_COLOR_SET_G(out[i], (src->green + th) >> 4);
+        LV_COLOR_SET_B(out[i], (src->blue + th) >> 4);
+        src += src_step;
+    }
+}
+#endif
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Calculate the colors of a gradient
+ * @param grad the gradient with initialized colors, stops, size and map
+ */
+static void grad_calc(_lv_grad_t * grad)
+{
+    int32_t s = grad->size;
+    int32_t min = (grad->main_stop * s) >> 8;
+    int32_t max = (grad->grad_stop * s) >> 8;
+    int32_t d = ((grad->grad_stop - grad->main_stop) * s) >> 8;
+
+#if _LV_GRAD_DITHER
+    _lv_grad_hcolor_t c1;
+    c1.red = LV_COLOR_GET_R(grad->grad_color) << 4;
+    c1.green = LV_COLOR_GET_G(grad->grad_color) << 4;
+    c1.blue = LV_COLOR_GET_B(grad->grad_color) << 4;
+    _lv_grad_hcolor_t c2;
+    c2.red = LV_COLOR_GET_R(grad->main_color) << 4;
+    c2.green = LV_COLOR_GET_G(grad->main_color) << 4;
+    c2.blue = LV_COLOR_GET_B(grad->main_color) << 4;
+#endif
+
+    int32_t i;
+    for(i = 0; i < s; i++) {
+        /*The same as the gradient was calculated earlier pixel by pixel*/
+        lv_opa_t mix;
+        if(i <= min) mix = 0;
+        else if(i >= max) mix = 255;
+        else mix = ((i - min) * 255) / d;
+
+#if _LV_GRAD_DITHER
+        grad->hmap[i].red = (c1.red * mix + c2.red * (255 - mix)) / 255;
+        grad->hmap[i].green = (c1.green * mix + c2.green * (255 - mix)) / 255;
+        grad->hmap[i].blue = (c1.blue * mix + c2.blue * (255 - mix)) / 255;
+#else
+        if(i <= min) grad->map[i] = grad->main_color;
+        else if(i >= max) grad->map[i] = grad->grad_color;
+        else grad->map[i] = lv_color_mix(grad->grad_color, grad->main_color, mix);
+#endif
+    }
+}
+
+#if LV_GRAD_CACHE_DEF_SIZE
+static _lv_grad_t * grad_cache_find(lv_color_t main_color, lv_color_t grad_color, uint8_t main_stop, uint8_t grad_stop,
+                                    lv_coord_t size)
+{
+    _lv_grad_t ** cache = LV_GC_ROOT(_lv_grad_cache);
+    grad_cache_life++;
+
+    uint32_t i;
+    for(i = 0; i < _LV_GRAD_CACHE_MAX_NUM; i++) {
+        _lv_grad_t * grad = cache[i];
+        if(grad == NULL) continue;
+        if(grad->size == size && grad->main_color.full == main_color.full && grad->grad_color.full == grad_color.full &&
+           grad->main_stop == main_stop && grad->grad_stop == grad_stop) {
+            grad->life = grad_cache_life;
+            return grad;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Allocate a new gradient in the cache. Remove the least recently used gradients if required.
+ * @param mem_size size of the gradient with its colors
+ * @return the allocated gradient or NULL if it doesn't fit into the cache
+ */
+static _lv_grad_t * grad_cache_alloc(uint32_t mem_size)
+{
+    if(mem_size > LV_GRAD_CACHE_DEF_SIZE) return NULL;
+
+    _lv_grad_t ** cache = LV_GC_ROOT(_lv_grad_cache);
+    while(1) {
+        /*Find a free slot, the least recently used gradient and the used memory*/
+        int32_t free_i = -1;
+        int32_t lru_i = -1;
+        uint32_t used_size = 0;
+        uint32_t i;
+        for(i = 0; i < _LV_GRAD_CACHE_MAX_NUM; i++) {
+            if(cache[i] == NULL) {
+                if(free_i < 0) free_i = i;
+            }
+            else {
+                used_size += cache[i]->mem_size;
+                if(lru_i < 0 || cache[i]->life < cache[lru_i]->life) lru_i = i;
+            }
+        }
+
+        if(free_i >= 0 && used_size + mem_size <= LV_GRAD_CACHE_DEF_SIZE) {
+            _lv_grad_t * grad = lv_mem_alloc(mem_size);
+            if(grad == NULL) return NULL;
+            cache[free_i] = grad;
+            grad->cached = 1;
+            grad->life = grad_cache_life;
+            return grad;
+        }
+
+        if(lru_i < 0) return NULL;
+        lv_mem_free(cache[lru_i]);
+        cache[lru_i] = NULL;
+    }
+}
+#endif /*LV_GRAD_CACHE_DEF_SIZE*/
+
+#endif /*LV_DRAW_COMPLEX*/
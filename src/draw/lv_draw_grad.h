@@ -0,0 +1,116 @@
+/**
+ * @file lv_draw_grad.h
+ *
+ */
+
+#ifndef LV_DRAW_GRAD_H
+#define LV_DRAW_GRAD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "../misc/lv_color.h"
+#include "../misc/lv_area.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Dithering is applied only where it makes difference*/
+#if LV_DRAW_COMPLEX && LV_DITHER_GRADIENT && LV_COLOR_DEPTH == 16
+#define _LV_GRAD_DITHER     1
+#else
+#define _LV_GRAD_DITHER     0
+#endif
+
+#if LV_DRAW_COMPLEX
+/*Maximal number of gradients in the cache. (`LV_GRAD_CACHE_DEF_SIZE` limits their total size)*/
+#define _LV_GRAD_CACHE_MAX_NUM  16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*A color in the precision used for dithering: 16 times of the channels of `lv_color_t`*/
+typedef struct {
+    uint16_t red;
+    uint16_t green;
+    uint16_t blue;
+} _lv_grad_hcolor_t;
+
+/*A gradient rasterized to a color ramp*/
+typedef struct {
+#if _LV_GRAD_DITHER
+    _lv_grad_hcolor_t * hmap;   /*The colors to dither with `_lv_grad_dither`*/
+#else
+    lv_color_t * map;           /*The colors of the gradient*/
+#endif
+    lv_color_t main_color;
+    lv_color_t grad_color;
+    lv_coord_t size;            /*Number of colors*/
+    uint8_t main_stop;
+    uint8_t grad_stop;
+    uint8_t cached : 1;         /*0: created only for one draw and freed by `_lv_grad_release`*/
+    uint32_t life;              /*When the gradient was used last time*/
+    uint32_t mem_size;
+} _lv_grad_t;
+
+typedef _lv_grad_t * _lv_grad_cache_arr_t[_LV_GRAD_CACHE_MAX_NUM];
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get the color ramp of a gradient. It's taken from the cache if the same gradient was used recently.
+ * @param main_color    color at the beginning
+ * @param grad_color    color at the end
+ * @param main_stop     the gradient starts here (0..255 on the whole size)
+ * @param grad_stop     the gradient ends here (0..255 on the whole size)
+ * @param size          length of the gradient (width or height of the drawn area)
+ * @return              the gradient or NULL on out of memory. Should be released with `_lv_grad_release`.
+ */
+_lv_grad_t * _lv_grad_get(lv_color_t main_color, lv_color_t grad_color, uint8_t main_stop, uint8_t grad_stop,
+                          lv_coord_t size);
+
+/**
+ * Release a gradient returned by `_lv_grad_get`. It remains in the cache if it's cached.
+ * @param grad          pointer to a gradient
+ */
+void _lv_grad_release(_lv_grad_t * grad);
+
+/**
+ * Remove all the gradients from the cache.
+ */
+void _lv_grad_cache_clean(void);
+
+#if _LV_GRAD_DITHER
+/**
+ * Convert high precision gradient colors to `lv_color_t` with ordered dithering.
+ * @param src           pointer to the first color
+ * @param src_step      1: use the next color for the next pixel (horizontal gradient),
+ *                      0: use the same color for all pixels (a row of a vertical gradient)
+ * @param x             x coordinate of the first pixel
+ * @param y             y coordinate of the pixels
+ * @param len           number of pixels
+ * @param out           store the colors here
+ */
+LV_ATTRIBUTE_FAST_MEM void _lv_grad_dither(const _lv_grad_hcolor_t * src, int32_t src_step, lv_coord_t x,
+                                           lv_coord_t y, lv_coord_t len, lv_color_t * out);
+#endif
+
+#endif /*LV_DRAW_COMPLEX*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_GRAD_H*/
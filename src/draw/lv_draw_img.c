@@ -10,14 +10,10 @@
 #include "lv_img_cache.h"
 #include "../hal/lv_hal_disp.h"
 #include "../misc/lv_log.h"
-#include "../core/lv_refr.h"
 #include "../misc/lv_mem.h"
 #include "../misc/lv_math.h"
-#if LV_USE_GPU_STM32_DMA2D
-    #include "../gpu/lv_gpu_stm32_dma2d.h"
-#elif LV_USE_GPU_NXP_PXP
-    #include "../gpu/lv_gpu_nxp_pxp.h"
-#endif
+#include "lv_draw_backend.h"
+#include "lv_draw_target.h"
 
 /*********************
  *      DEFINES
@@ -342,9 +338,14 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_map(const lv_area_t * map_area, const
     lv_area_t draw_area;
     lv_area_copy(&draw_area, clip_area);
 
-    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
-    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp);
-    const lv_area_t * disp_area = &draw_buf->area;
+    lv_draw_target_t * target = _lv_draw_target_get();
+    const lv_area_t * disp_area = &target->area;
+
+    /*Offer the whole image to the draw backend first*/
+    const lv_draw_backend_t * backend = target->drv ? target->drv->draw_backend : NULL;
+    if(backend && backend->draw_img && draw_dsc->blend_mode == LV_BLEND_MODE_NORMAL && _lv_draw_target_is_direct(target)) {
+        if(backend->draw_img(target->drv, map_area, clip_area, map_p, draw_dsc, chroma_key, alpha_byte) == LV_RES_OK) return;
+    }
 
     /*Now `draw_area` has absolute coordinates.
      *Make it relative to `disp_area` to simplify draw to `disp_buf`*/
@@ -362,23 +363,6 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_map(const lv_area_t * map_area, const
                       draw_dsc->blend_mode);
     }
 
-#if LV_USE_GPU_NXP_PXP
-    /*Simple case without masking and transformations*/
-    else if(other_mask_cnt == 0 && draw_dsc->angle == 0 && draw_dsc->zoom == LV_IMG_ZOOM_NONE && alpha_byte == false &&
-            chroma_key == true && draw_dsc->recolor_opa == LV_OPA_TRANSP) { /*copy with color keying (+ alpha)*/
-        lv_gpu_nxp_pxp_enable_color_key();
-        _lv_blend_map(clip_area, map_area, (lv_color_t *)map_p, NULL, LV_DRAW_MASK_RES_FULL_COVER, draw_dsc->opa,
-                      draw_dsc->blend_mode);
-        lv_gpu_nxp_pxp_disable_color_key();
-    }
-    else if(other_mask_cnt == 0 && draw_dsc->angle == 0 && draw_dsc->zoom == LV_IMG_ZOOM_NONE && alpha_byte == false &&
-            chroma_key == false && draw_dsc->recolor_opa != LV_OPA_TRANSP) { /*copy with recolor (+ alpha)*/
-        lv_gpu_nxp_pxp_enable_recolor(draw_dsc->recolor, draw_dsc->recolor_opa);
-        _lv_blend_map(clip_area, map_area, (lv_color_t *)map_p, NULL, LV_DRAW_MASK_RES_FULL_COVER, draw_dsc->opa,
-                      draw_dsc->blend_mode);
-        lv_gpu_nxp_pxp_disable_recolor();
-    }
-#endif
     /*In the other cases every pixel need to be checked one-by-one*/
     else {
 //#if LV_DRAW_COMPLEX
@@ -409,18 +393,7 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_map(const lv_area_t * map_area, const
         bool transform = draw_dsc->angle != 0 || draw_dsc->zoom != LV_IMG_ZOOM_NONE ? true : false;
         /*Simple ARGB image. Handle it as special case because it's very common*/
         if(other_mask_cnt == 0 && !transform && !chroma_key && draw_dsc->recolor_opa == LV_OPA_TRANSP && alpha_byte) {
-#if LV_USE_GPU_STM32_DMA2D && LV_COLOR_DEPTH == 32
-            /*Blend ARGB images directly*/
-            if(lv_area_get_size(&draw_area) > 240) {
-                int32_t disp_w = lv_area_get_width(disp_area);
-                lv_color_t * disp_buf = draw_buf->buf_act;
-                lv_color_t * disp_buf_first = disp_buf + disp_w * draw_area.y1 + draw_area.x1;
-                lv_gpu_stm32_dma2d_blend(disp_buf_first, disp_w, (const lv_color_t *)map_buf_tmp, draw_dsc->opa, map_w, draw_area_w,
-                                         draw_area_h);
-                return;
-            }
-#endif
-            uint32_t hor_res = (uint32_t) lv_disp_get_hor_res(disp);
+            uint32_t hor_res = (uint32_t)_lv_draw_target_get_hor_res(target);
             uint32_t mask_buf_size = lv_area_get_size(&draw_area) > (uint32_t) hor_res ? hor_res : lv_area_get_size(&draw_area);
             lv_color_t * map2 = lv_mem_buf_get(mask_buf_size * sizeof(lv_color_t));
             lv_opa_t * mask_buf = lv_mem_buf_get(mask_buf_size);
@@ -471,7 +444,7 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_map(const lv_area_t * map_area, const
         /*Most complicated case: transform or other mask or chroma keyed*/
         else {
             /*Build the image and a mask line-by-line*/
-            uint32_t hor_res = (uint32_t) lv_disp_get_hor_res(disp);
+            uint32_t hor_res = (uint32_t)_lv_draw_target_get_hor_res(target);
             uint32_t mask_buf_size = lv_area_get_size(&draw_area) > hor_res ? hor_res : lv_area_get_size(&draw_area);
             lv_color_t * map2 = lv_mem_buf_get(mask_buf_size * sizeof(lv_color_t));
             lv_opa_t * mask_buf = lv_mem_buf_get(mask_buf_size);
@@ -591,7 +564,7 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_map(const lv_area_t * map_area, const
                 /*Apply the masks if any*/
                 if(other_mask_cnt) {
                     lv_draw_mask_res_t mask_res_sub;
-                    mask_res_sub = lv_draw_mask_apply(mask_buf + px_i_start, draw_area.x1 + draw_buf->area.x1, y + draw_area.y1 + draw_buf->area.y1,
+                    mask_res_sub = lv_draw_mask_apply(mask_buf + px_i_start, draw_area.x1 + disp_area->x1, y + draw_area.y1 + disp_area->y1,
                                                       lv_area_get_width(&draw_area));
                     if(mask_res_sub == LV_DRAW_MASK_RES_TRANSP) {
                         lv_memset_00(mask_buf + px_i_start, lv_area_get_width(&draw_area));
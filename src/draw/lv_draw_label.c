@@ -7,9 +7,11 @@
  *      INCLUDES
  *********************/
 #include "lv_draw_label.h"
+#include "lv_draw_line.h"
 #include "../misc/lv_math.h"
 #include "../hal/lv_hal_disp.h"
-#include "../core/lv_refr.h"
+#include "lv_draw_backend.h"
+#include "lv_draw_target.h"
 #include "../misc/lv_bidi.h"
 #include "../misc/lv_assert.h"
 
@@ -29,12 +31,31 @@ enum {
 };
 typedef uint8_t cmd_state_t;
 
+/*Describes the draw buffer to write the glyphs directly into it*/
+typedef struct {
+    lv_disp_drv_t * drv;
+    lv_color_t * buf;
+    const lv_area_t * buf_area;
+    /*1: there are no masks or special blending, so the glyphs can be written directly into `buf`*/
+    uint8_t direct : 1;
+} glyph_blit_dsc_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void glyph_blit_init(glyph_blit_dsc_t * blit, lv_blend_mode_t blend_mode);
+LV_ATTRIBUTE_FAST_MEM static void draw_letter(const lv_point_t * pos_p, const lv_area_t * clip_area,
+                                              const lv_font_t * font_p, uint32_t letter,
+                                              lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode,
+                                              const glyph_blit_dsc_t * blit);
 LV_ATTRIBUTE_FAST_MEM static void draw_letter_normal(lv_coord_t pos_x, lv_coord_t pos_y, lv_font_glyph_dsc_t * g,
                                                      const lv_area_t * clip_area,
-                                                     const uint8_t * map_p, lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode);
+                                                     const uint8_t * map_p, lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode,
+                                                     const glyph_blit_dsc_t * blit);
+LV_ATTRIBUTE_FAST_MEM static void blit_letter(const glyph_blit_dsc_t * blit, lv_coord_t pos_x, lv_coord_t pos_y,
+                                              const lv_font_glyph_dsc_t * g, const lv_area_t * draw_area,
+                                              const uint8_t * map_p, const lv_opa_t * opa_table, uint32_t bpp,
+                                              lv_color_t color);
 #if LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX
 static void draw_letter_subpx(lv_coord_t pos_x, lv_coord_t pos_y, lv_font_glyph_dsc_t * g, const lv_area_t * clip_area,
                               const uint8_t * map_p, lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode);
@@ -234,6 +255,19 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(const lv_area_t * coords, const lv_area
     lv_draw_rect_dsc_init(&draw_dsc_sel);
     draw_dsc_sel.bg_color = dsc->sel_bg_color;
 
+    /*Get the draw buffer only once for all the glyphs*/
+    glyph_blit_dsc_t blit;
+    glyph_blit_init(&blit, dsc->blend_mode);
+
+    /*The lines can be offered to the draw backend if they are drawn with one color*/
+    lv_draw_target_t * target = _lv_draw_target_get();
+    const lv_draw_backend_t * run_backend = target->drv ? target->drv->draw_backend : NULL;
+    if(run_backend && (run_backend->draw_glyph_run == NULL || dsc->blend_mode != LV_BLEND_MODE_NORMAL ||
+                       _lv_draw_target_is_direct(target) == false || (dsc->flag & LV_TEXT_FLAG_RECOLOR) ||
+                       (sel_start != 0xFFFF && sel_end != 0xFFFF))) {
+        run_backend = NULL;
+    }
+
     int32_t pos_x_start = pos.x;
     /*Write out all lines*/
     while(txt[line_start] != '\0') {
@@ -249,6 +283,16 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(const lv_area_t * coords, const lv_area
         const char * bidi_txt = txt + line_start;
 #endif
 
+        if(run_backend) {
+            uint32_t run_len = line_end - line_start;
+            if(run_backend->draw_glyph_run(target->drv, &pos, mask, bidi_txt, run_len, dsc) == LV_RES_OK) {
+                /*Skip the letters but move to the end of the line as they were drawn here*/
+                lv_coord_t run_w = lv_txt_get_width(bidi_txt, run_len, font, dsc->letter_space, dsc->flag);
+                if(run_w > 0) pos.x += run_w + dsc->letter_space;
+                i = run_len;
+            }
+        }
+
         while(i < line_end - line_start) {
             uint32_t logical_char_pos = 0;
             if(sel_start != 0xFFFF && sel_end != 0xFFFF) {
@@ -322,7 +366,7 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(const lv_area_t * coords, const lv_area
                 }
             }
 
-            lv_draw_letter(&pos, mask, font, letter, color, opa, dsc->blend_mode);
+            draw_letter(&pos, mask, font, letter, color, opa, dsc->blend_mode, &blit);
 
             if(letter_w > 0) {
                 pos.x += letter_w + dsc->letter_space;
@@ -382,10 +426,6 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(const lv_area_t * coords, const lv_area
     LV_ASSERT_MEM_INTEGRITY();
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
-
 /**
  * Draw a letter in the Virtual Display Buffer
  * @param pos_p left-top coordinate of the latter
@@ -399,6 +439,57 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_letter(const lv_point_t * pos_p, const lv_are
                                           const lv_font_t * font_p,
                                           uint32_t letter,
                                           lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode)
+{
+    glyph_blit_dsc_t blit;
+    glyph_blit_init(&blit, blend_mode);
+    draw_letter(pos_p, clip_area, font_p, letter, color, opa, blend_mode, &blit);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Check whether the glyphs can be written directly into the draw buffer.
+ * @param blit store the draw buffer's parameters here
+ * @param blend_mode the blend mode of the text
+ */
+static void glyph_blit_init(glyph_blit_dsc_t * blit, lv_blend_mode_t blend_mode)
+{
+    lv_draw_target_t * target = _lv_draw_target_get();
+    blit->direct = 0;
+    if(target == NULL) return;
+
+    blit->drv = target->drv;
+    blit->buf = target->buf;
+    blit->buf_area = &target->area;
+
+    /*Masks, blend modes, other color formats, `set_px_cb` and disabled anti-aliasing are handled by `_lv_blend_fill`*/
+    if(blend_mode != LV_BLEND_MODE_NORMAL) return;
+    if(_lv_draw_target_is_direct(target) == false || target->antialiasing == 0) return;
+    if(lv_draw_mask_get_cnt() != 0) return;
+#if LV_COLOR_SCREEN_TRANSP
+    if(blit->drv && blit->drv->screen_transp) return;
+#endif
+
+    blit->direct = 1;
+}
+
+/**
+ * Draw a letter
+ * @param pos_p left-top coordinate of the latter
+ * @param clip_area the letter will be drawn only on this area
+ * @param font_p pointer to font
+ * @param letter a letter to draw
+ * @param color color of letter
+ * @param opa opacity of letter (0..255)
+ * @param blend_mode blend mode
+ * @param blit the draw buffer initialized by `glyph_blit_init`
+ */
+LV_ATTRIBUTE_FAST_MEM static void draw_letter(const lv_point_t * pos_p, const lv_area_t * clip_area,
+                                              const lv_font_t * font_p, uint32_t letter,
+                                              lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode,
+                                              const glyph_blit_dsc_t * blit)
 {
     if(opa < LV_OPA_MIN) return;
     if(opa > LV_OPA_MAX) opa = LV_OPA_COVER;
@@ -448,13 +539,14 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_letter(const lv_point_t * pos_p, const lv_are
     LV_LOG_WARN("Can't draw sub-pixel rendered letter because LV_USE_FONT_SUBPX == 0 in lv_conf.h");
 #endif
     } else {
-        draw_letter_normal(pos_x, pos_y, &g, clip_area, map_p, color, opa, blend_mode);
+        draw_letter_normal(pos_x, pos_y, &g, clip_area, map_p, color, opa, blend_mode, blit);
     }
 }
 
 LV_ATTRIBUTE_FAST_MEM static void draw_letter_normal(lv_coord_t pos_x, lv_coord_t pos_y, lv_font_glyph_dsc_t * g,
                                                      const lv_area_t * clip_area,
-                                                     const uint8_t * map_p, lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode)
+                                                     const uint8_t * map_p, lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode,
+                                                     const glyph_blit_dsc_t * blit)
 {
     const uint8_t * bpp_opa_table_p;
     uint32_t bitmask_init;
@@ -515,6 +607,16 @@ LV_ATTRIBUTE_FAST_MEM static void draw_letter_normal(lv_coord_t pos_x, lv_coord_
     int32_t row_start = pos_y >= clip_area->y1 ? 0 : clip_area->y1 - pos_y;
     int32_t row_end   = pos_y + box_h <= clip_area->y2 ? box_h : clip_area->y2 - pos_y + 1;
 
+    if(blit->direct) {
+        lv_area_t draw_area;
+        draw_area.x1 = pos_x + col_start;
+        draw_area.x2 = pos_x + col_end - 1;
+        draw_area.y1 = pos_y + row_start;
+        draw_area.y2 = pos_y + row_end - 1;
+        blit_letter(blit, pos_x, pos_y, g, &draw_area, map_p, bpp_opa_table_p, bpp, color);
+        return;
+    }
+
     /*Move on the map too*/
     uint32_t bit_ofs = (row_start * width_bit) + (col_start * bpp);
     map_p += bit_ofs >> 3;
@@ -523,7 +625,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_letter_normal(lv_coord_t pos_x, lv_coord_
     uint32_t col_bit;
     col_bit = bit_ofs & 0x7; /*"& 0x7" equals to "% 8" just faster*/
 
-    lv_coord_t hor_res = lv_disp_get_hor_res(_lv_refr_get_disp_refreshing());
+    lv_coord_t hor_res = _lv_draw_target_get_hor_res(_lv_draw_target_get());
     uint32_t mask_buf_size = box_w * box_h > hor_res ? hor_res : box_w * box_h;
     lv_opa_t * mask_buf = lv_mem_buf_get(mask_buf_size);
     int32_t mask_p = 0;
@@ -611,10 +713,100 @@ LV_ATTRIBUTE_FAST_MEM static void draw_letter_normal(lv_coord_t pos_x, lv_coord_
     lv_mem_buf_release(mask_buf);
 }
 
+/**
+ * Write the rows of a glyph into the draw buffer.
+ * It's inlined with constant `bpp`s in `blit_letter` to get a specialized loop for each bpp.
+ */
+LV_ATTRIBUTE_FAST_MEM static inline void blit_rows(lv_color_t * dest, int32_t dest_w, const uint8_t * map_p,
+                                                   int32_t box_w, int32_t col_start, int32_t col_end,
+                                                   int32_t row_start, int32_t row_end,
+                                                   const lv_opa_t * opa_table, lv_color_t color, const uint32_t bpp)
+{
+    const uint32_t px_mask = (1 << bpp) - 1;
+    int32_t w = col_end - col_start;
+    int32_t row;
+    int32_t x;
+    for(row = row_start; row < row_end; row++) {
+        uint32_t bit_ofs = (row * box_w + col_start) * bpp;
+        const uint8_t * p = map_p + (bit_ofs >> 3);
+        uint32_t shift = 8 - bpp - (bit_ofs & 0x7);
+        for(x = 0; x < w; x++) {
+            /*Mix the same way as `_lv_blend_fill` does with a mask*/
+            lv_opa_t px_opa = opa_table[(*p >> shift) & px_mask];
+            if(px_opa == LV_OPA_COVER) dest[x] = color;
+            else if(px_opa) dest[x] = lv_color_mix(color, dest[x], px_opa);
+
+            if(shift == 0) {
+                shift = 8 - bpp;
+                p++;
+            }
+            else {
+                shift -= bpp;
+            }
+        }
+        dest += dest_w;
+    }
+}
+
+/**
+ * Write a glyph directly into the draw buffer. Gives the same result as blending it with `_lv_blend_fill`.
+ * @param blit the draw buffer
+ * @param pos_x x coordinate of the glyph's box
+ * @param pos_y y coordinate of the glyph's box
+ * @param g the glyph's descriptor
+ * @param draw_area the visible part of the glyph's box
+ * @param map_p the glyph's bitmap
+ * @param opa_table opacity of each pixel value (the letter's opacity is already applied)
+ * @param bpp bit per pixel of the bitmap (1, 2, 4 or 8)
+ * @param color color of letter
+ */
+LV_ATTRIBUTE_FAST_MEM static void blit_letter(const glyph_blit_dsc_t * blit, lv_coord_t pos_x, lv_coord_t pos_y,
+                                              const lv_font_glyph_dsc_t * g, const lv_area_t * draw_area,
+                                              const uint8_t * map_p, const lv_opa_t * opa_table, uint32_t bpp,
+                                              lv_color_t color)
+{
+    if(draw_area->x1 > draw_area->x2 || draw_area->y1 > draw_area->y2) return;
+
+    /*Wait for the GPU as `_lv_blend_fill` would do*/
+    if(blit->drv) _lv_draw_backend_wait(blit->drv);
+
+    int32_t buf_w = lv_area_get_width(blit->buf_area);
+    lv_color_t * dest = blit->buf + buf_w * (draw_area->y1 - blit->buf_area->y1) + (draw_area->x1 - blit->buf_area->x1);
+
+    int32_t col_start = draw_area->x1 - pos_x;
+    int32_t col_end = draw_area->x2 - pos_x + 1;
+    int32_t row_start = draw_area->y1 - pos_y;
+    int32_t row_end = draw_area->y2 - pos_y + 1;
+
+    switch(bpp) {
+        case 1:
+            blit_rows(dest, buf_w, map_p, g->box_w, col_start, col_end, row_start, row_end, opa_table, color, 1);
+            break;
+        case 2:
+            blit_rows(dest, buf_w, map_p, g->box_w, col_start, col_end, row_start, row_end, opa_table, color, 2);
+            break;
+        case 4:
+            blit_rows(dest, buf_w, map_p, g->box_w, col_start, col_end, row_start, row_end, opa_table, color, 4);
+            break;
+        case 8:
+            blit_rows(dest, buf_w, map_p, g->box_w, col_start, col_end, row_start, row_end, opa_table, color, 8);
+            break;
+        default:
+            break;
+    }
+}
+
 #if LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX
 static void draw_letter_subpx(lv_coord_t pos_x, lv_coord_t pos_y, lv_font_glyph_dsc_t * g, const lv_area_t * clip_area,
                               const uint8_t * map_p, lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode)
 {
+    /*The sub-pixels are mixed with the colors of the draw buffer*/
+    lv_draw_target_t * target = _lv_draw_target_get();
+    if(target->cf != LV_IMG_CF_TRUE_COLOR && target->cf != LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED) {
+        LV_LOG_WARN("Can't draw sub-pixel rendered letter to this color format");
+        return;
+    }
+
     const uint8_t * bpp_opa_table;
     uint32_t bitmask_init;
     uint32_t bitmask;
@@ -678,14 +870,11 @@ static void draw_letter_subpx(lv_coord_t pos_x, lv_coord_t pos_y, lv_font_glyph_
 
     lv_color_t * color_buf = lv_mem_buf_get(mask_buf_size * sizeof(lv_color_t));
 
-    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
-    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp);
-
-    int32_t disp_buf_width = lv_area_get_width(&draw_buf->area);
-    lv_color_t * disp_buf_buf_tmp = draw_buf->buf_act;
+    int32_t disp_buf_width = lv_area_get_width(&target->area);
+    lv_color_t * disp_buf_buf_tmp = target->buf;
 
     /*Set a pointer on draw_buf to the first pixel of the letter*/
-    disp_buf_buf_tmp += ((pos_y - draw_buf->area.y1) * disp_buf_width) + pos_x - draw_buf->area.x1;
+    disp_buf_buf_tmp += ((pos_y - target->area.y1) * disp_buf_width) + pos_x - target->area.x1;
 
     /*If the letter is partially out of mask the move there on draw_buf*/
     disp_buf_buf_tmp += (row_start * disp_buf_width) + col_start / 3;
@@ -7,9 +7,11 @@
  *      INCLUDES
  *********************/
 #include <stdbool.h>
+#include "lv_draw_line.h"
+#include "lv_draw_rect.h"
 #include "lv_draw_mask.h"
 #include "lv_draw_blend.h"
-#include "../core/lv_refr.h"
+#include "lv_draw_target.h"
 #include "../misc/lv_math.h"
 
 /*********************
@@ -19,6 +21,14 @@
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_DRAW_COMPLEX
+/*A part of a polyline: a line segment or a join described by its bounding box and masks*/
+typedef struct {
+    lv_area_t area;
+    void * masks[4];
+    uint8_t mask_cnt;
+} polyline_shape_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -34,6 +44,15 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_hor(const lv_point_t * point1, const
 LV_ATTRIBUTE_FAST_MEM static void draw_line_ver(const lv_point_t * point1, const lv_point_t * point2,
                                                 const lv_area_t * clip,
                                                 const lv_draw_line_dsc_t * dsc);
+#if LV_DRAW_COMPLEX
+static uint8_t line_skew_masks_init(const lv_point_t * point1, const lv_point_t * point2,
+                                    const lv_draw_line_dsc_t * dsc, lv_area_t * area,
+                                    lv_draw_mask_line_param_t mask_param[]);
+static void line_straight_area_init(const lv_point_t * point1, const lv_point_t * point2,
+                                    const lv_draw_line_dsc_t * dsc, lv_area_t * area);
+LV_ATTRIBUTE_FAST_MEM static void polyline_add_shape(lv_opa_t * band_buf, lv_opa_t * row_buf, const lv_area_t * band,
+                                                     const polyline_shape_t * shape);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -113,6 +132,148 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_line(const lv_point_t * point1, const lv_poin
     }
 }
 
+/**
+ * Draw a polyline: lines between the adjacent points of an array.
+ * The whole polyline is rasterized in one pass so the joints are not overdrawn
+ * and only one blending is required for a band of rows.
+ * @param points an array of points. The first and last points are the ends of the polyline.
+ * @param point_cnt number of points in `points`
+ * @param clip the polyline will be drawn only in this area
+ * @param dsc pointer to an initialized `lv_draw_line_dsc_t` variable.
+ *            `round_start` and `round_end` are applied only on the first and last points.
+ *            The inner joints are always round if `width > 2`.
+ */
+LV_ATTRIBUTE_FAST_MEM void lv_draw_polyline(const lv_point_t points[], uint32_t point_cnt, const lv_area_t * clip,
+                                            const lv_draw_line_dsc_t * dsc)
+{
+    if(point_cnt < 2) return;
+    if(dsc->width == 0) return;
+    if(dsc->opa <= LV_OPA_MIN) return;
+
+    /*Dashes are aligned to the segments and there is no other way without complex drawing*/
+    bool fallback = point_cnt == 2 || (dsc->dash_gap && dsc->dash_width) ? true : false;
+#if LV_DRAW_COMPLEX == 0
+    fallback = true;
+#endif
+
+    if(fallback) {
+        /*Round the inner joints by the round end of the segments*/
+        bool join = dsc->width > 2 ? true : false;
+        lv_draw_line_dsc_t seg_dsc;
+        lv_memcpy(&seg_dsc, dsc, sizeof(lv_draw_line_dsc_t));
+        uint32_t i;
+        for(i = 0; i < point_cnt - 1; i++) {
+            seg_dsc.round_start = i == 0 ? dsc->round_start : 0;
+            seg_dsc.round_end = i == point_cnt - 2 ? dsc->round_end : join;
+            lv_draw_line(&points[i], &points[i + 1], clip, &seg_dsc);
+        }
+        return;
+    }
+
+#if LV_DRAW_COMPLEX
+    /*Get the area of the whole polyline*/
+    lv_area_t draw_area;
+    draw_area.x1 = points[0].x;
+    draw_area.x2 = points[0].x;
+    draw_area.y1 = points[0].y;
+    draw_area.y2 = points[0].y;
+    uint32_t i;
+    for(i = 1; i < point_cnt; i++) {
+        draw_area.x1 = LV_MIN(draw_area.x1, points[i].x);
+        draw_area.x2 = LV_MAX(draw_area.x2, points[i].x);
+        draw_area.y1 = LV_MIN(draw_area.y1, points[i].y);
+        draw_area.y2 = LV_MAX(draw_area.y2, points[i].y);
+    }
+    lv_area_increase(&draw_area, dsc->width, dsc->width);
+
+    bool is_common = _lv_area_intersect(&draw_area, &draw_area, clip);
+    if(is_common == false) return;
+
+    int32_t draw_area_w = lv_area_get_width(&draw_area);
+    uint32_t hor_res = (uint32_t)_lv_draw_target_get_hor_res(_lv_draw_target_get());
+    uint32_t band_buf_size = LV_MIN(lv_area_get_size(&draw_area), LV_MAX(hor_res, (uint32_t)draw_area_w));
+    int32_t band_h = band_buf_size / draw_area_w;
+    band_buf_size = band_h * draw_area_w;
+
+    lv_opa_t * band_buf = lv_mem_buf_get(band_buf_size);
+    lv_opa_t * row_buf = lv_mem_buf_get(draw_area_w);
+
+    /*Round joins if the line is wide enough to have gaps on the outer side of the joints*/
+    int32_t r = (dsc->width >> 1);
+    int32_t r_corr = (dsc->width & 1) ? 0 : 1;
+    bool join = dsc->width > 2 ? true : false;
+
+    lv_draw_mask_line_param_t line_mask_param[4];
+    lv_draw_mask_radius_param_t join_mask_param;
+    polyline_shape_t shape;
+
+    lv_area_t band;
+    band.x1 = draw_area.x1;
+    band.x2 = draw_area.x2;
+    for(band.y1 = draw_area.y1; band.y1 <= draw_area.y2; band.y1 += band_h) {
+        band.y2 = LV_MIN(band.y1 + band_h - 1, draw_area.y2);
+        lv_memset_00(band_buf, band_buf_size);
+
+        for(i = 0; i < point_cnt; i++) {
+            const lv_point_t * p1 = &points[i];
+
+            /*Add the join or the round ending on the point*/
+            bool first = i == 0 ? true : false;
+            bool last = i == point_cnt - 1 ? true : false;
+            if((first && dsc->round_start) || (last && dsc->round_end) || (!first && !last && join)) {
+                shape.area.x1 = p1->x - r;
+                shape.area.y1 = p1->y - r;
+                shape.area.x2 = p1->x + r - r_corr;
+                shape.area.y2 = p1->y + r - r_corr;
+                if(shape.area.y1 <= band.y2 && shape.area.y2 >= band.y1) {
+                    lv_draw_mask_radius_init(&join_mask_param, &shape.area, LV_RADIUS_CIRCLE, false);
+                    shape.masks[0] = &join_mask_param;
+                    shape.mask_cnt = 1;
+                    polyline_add_shape(band_buf, row_buf, &band, &shape);
+                }
+            }
+
+            if(last) break;
+
+            /*Add the segment to the next point if it's in the band*/
+            const lv_point_t * p2 = &points[i + 1];
+            if(p1->x == p2->x && p1->y == p2->y) continue;
+            if(LV_MIN(p1->y, p2->y) - dsc->width > band.y2) continue;
+            if(LV_MAX(p1->y, p2->y) + dsc->width < band.y1) continue;
+
+            if(p1->x == p2->x || p1->y == p2->y) {
+                line_straight_area_init(p1, p2, dsc, &shape.area);
+                shape.mask_cnt = 0;
+            }
+            else {
+                shape.mask_cnt = line_skew_masks_init(p1, p2, dsc, &shape.area, line_mask_param);
+                uint32_t m;
+                for(m = 0; m < shape.mask_cnt; m++) shape.masks[m] = &line_mask_param[m];
+            }
+            polyline_add_shape(band_buf, row_buf, &band, &shape);
+        }
+
+        /*Apply the other masks only once on the whole polyline*/
+        if(lv_draw_mask_get_cnt()) {
+            lv_coord_t y;
+            lv_opa_t * band_row = band_buf;
+            for(y = band.y1; y <= band.y2; y++) {
+                lv_draw_mask_res_t mask_res = lv_draw_mask_apply(band_row, band.x1, y, draw_area_w);
+                if(mask_res == LV_DRAW_MASK_RES_TRANSP) lv_memset_00(band_row, draw_area_w);
+                band_row += draw_area_w;
+            }
+        }
+
+        _lv_blend_fill(clip, &band,
+                       dsc->color, band_buf, LV_DRAW_MASK_RES_CHANGED, dsc->opa,
+                       dsc->blend_mode);
+    }
+
+    lv_mem_buf_release(row_buf);
+    lv_mem_buf_release(band_buf);
+#endif /*LV_DRAW_COMPLEX*/
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -148,9 +309,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_hor(const lv_point_t * point1, const
 #if LV_DRAW_COMPLEX
     /*If there other mask apply it*/
     else {
-        lv_disp_t * disp = _lv_refr_get_disp_refreshing();
-        lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp);
-        const lv_area_t * disp_area = &draw_buf->area;
+        const lv_area_t * disp_area = &_lv_draw_target_get()->area;
         /*Get clipped fill area which is the real draw area.
          *It is always the same or inside `fill_area`*/
         bool is_common;
@@ -174,14 +333,14 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_hor(const lv_point_t * point1, const
 
         lv_coord_t dash_start = 0;
         if(dashed) {
-            dash_start = (draw_buf->area.x1 + draw_area.x1) % (dsc->dash_gap + dsc->dash_width);
+            dash_start = (disp_area->x1 + draw_area.x1) % (dsc->dash_gap + dsc->dash_width);
         }
 
         lv_opa_t * mask_buf = lv_mem_buf_get(draw_area_w);
         int32_t h;
         for(h = draw_area.y1; h <= draw_area.y2; h++) {
             lv_memset_ff(mask_buf, draw_area_w);
-            lv_draw_mask_res_t mask_res = lv_draw_mask_apply(mask_buf, draw_buf->area.x1 + draw_area.x1, draw_buf->area.y1 + h, draw_area_w);
+            lv_draw_mask_res_t mask_res = lv_draw_mask_apply(mask_buf, disp_area->x1 + draw_area.x1, disp_area->y1 + h, draw_area_w);
 
             if(dashed) {
                 if(mask_res != LV_DRAW_MASK_RES_TRANSP) {
@@ -249,9 +408,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_ver(const lv_point_t * point1, const
 #if LV_DRAW_COMPLEX
     /*If there other mask apply it*/
     else {
-        lv_disp_t * disp = _lv_refr_get_disp_refreshing();
-        lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp);
-        const lv_area_t * disp_area = &draw_buf->area;
+        const lv_area_t * disp_area = &_lv_draw_target_get()->area;
         /*Get clipped fill area which is the real draw area.
          *It is always the same or inside `fill_area`*/
         bool is_common;
@@ -260,10 +417,10 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_ver(const lv_point_t * point1, const
 
         /*Now `draw_area` has absolute coordinates.
          *Make it relative to `disp_area` to simplify draw to `disp_buf`*/
-        draw_area.x1 -= draw_buf->area.x1;
-        draw_area.y1 -= draw_buf->area.y1;
-        draw_area.x2 -= draw_buf->area.x1;
-        draw_area.y2 -= draw_buf->area.y1;
+        draw_area.x1 -= disp_area->x1;
+        draw_area.y1 -= disp_area->y1;
+        draw_area.x2 -= disp_area->x1;
+        draw_area.y2 -= disp_area->y1;
 
         int32_t draw_area_w = lv_area_get_width(&draw_area);
 
@@ -277,7 +434,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_ver(const lv_point_t * point1, const
 
         lv_coord_t dash_start = 0;
         if(dashed) {
-            dash_start = (draw_buf->area.y1 + draw_area.y1) % (dsc->dash_gap + dsc->dash_width);
+            dash_start = (disp_area->y1 + draw_area.y1) % (dsc->dash_gap + dsc->dash_width);
         }
 
         lv_coord_t dash_cnt = dash_start;
@@ -285,7 +442,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_ver(const lv_point_t * point1, const
         int32_t h;
         for(h = draw_area.y1; h <= draw_area.y2; h++) {
             lv_memset_ff(mask_buf, draw_area_w);
-            lv_draw_mask_res_t mask_res = lv_draw_mask_apply(mask_buf, draw_buf->area.x1 + draw_area.x1, draw_buf->area.y1 + h, draw_area_w);
+            lv_draw_mask_res_t mask_res = lv_draw_mask_apply(mask_buf, disp_area->x1 + draw_area.x1, disp_area->y1 + h, draw_area_w);
 
             if(dashed) {
                 if(mask_res != LV_DRAW_MASK_RES_TRANSP) {
@@ -317,48 +474,9 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_skew(const lv_point_t * point1, cons
                                                  const lv_draw_line_dsc_t * dsc)
 {
 #if LV_DRAW_COMPLEX
-    /*Keep the great y in p1*/
-    lv_point_t p1;
-    lv_point_t p2;
-    if(point1->y < point2->y) {
-        p1.y = point1->y;
-        p2.y = point2->y;
-        p1.x = point1->x;
-        p2.x = point2->x;
-    }
-    else {
-        p1.y = point2->y;
-        p2.y = point1->y;
-        p1.x = point2->x;
-        p2.x = point1->x;
-    }
-
-    int32_t xdiff = p2.x - p1.x;
-    int32_t ydiff = p2.y - p1.y;
-    bool flat = LV_ABS(xdiff) > LV_ABS(ydiff) ? true : false;
-
-    static const uint8_t wcorr[] = {
-        128, 128, 128, 129, 129, 130, 130, 131,
-        132, 133, 134, 135, 137, 138, 140, 141,
-        143, 145, 147, 149, 151, 153, 155, 158,
-        160, 162, 165, 167, 170, 173, 175, 178,
-        181,
-    };
-
-    int32_t w = dsc->width;
-    int32_t wcorr_i = 0;
-    if(flat) wcorr_i = (LV_ABS(ydiff) << 5) / LV_ABS(xdiff);
-    else wcorr_i = (LV_ABS(xdiff) << 5) / LV_ABS(ydiff);
-
-    w = (w * wcorr[wcorr_i] + 63) >> 7;     /*+ 63 for rounding*/
-    int32_t w_half0 = w >> 1;
-    int32_t w_half1 = w_half0 + (w & 0x1); /*Compensate rounding error*/
-
     lv_area_t draw_area;
-    draw_area.x1 = LV_MIN(p1.x, p2.x) - w;
-    draw_area.x2 = LV_MAX(p1.x, p2.x) + w;
-    draw_area.y1 = LV_MIN(p1.y, p2.y) - w;
-    draw_area.y2 = LV_MAX(p1.y, p2.y) + w;
+    lv_draw_mask_line_param_t mask_param[4];
+    uint8_t mask_cnt = line_skew_masks_init(point1, point2, dsc, &draw_area, mask_param);
 
     /*Get the union of `coords` and `clip`*/
     /*`clip` is already truncated to the `draw_buf` size
@@ -366,50 +484,12 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_skew(const lv_point_t * point1, cons
     bool is_common = _lv_area_intersect(&draw_area, &draw_area, clip);
     if(is_common == false) return;
 
-    lv_draw_mask_line_param_t mask_left_param;
-    lv_draw_mask_line_param_t mask_right_param;
-    lv_draw_mask_line_param_t mask_top_param;
-    lv_draw_mask_line_param_t mask_bottom_param;
-
-    if(flat) {
-        if(xdiff > 0) {
-            lv_draw_mask_line_points_init(&mask_left_param, p1.x, p1.y - w_half0, p2.x, p2.y - w_half0,
-                                          LV_DRAW_MASK_LINE_SIDE_LEFT);
-            lv_draw_mask_line_points_init(&mask_right_param, p1.x, p1.y + w_half1, p2.x, p2.y + w_half1,
-                                          LV_DRAW_MASK_LINE_SIDE_RIGHT);
-        }
-        else {
-            lv_draw_mask_line_points_init(&mask_left_param, p1.x, p1.y + w_half1, p2.x, p2.y + w_half1,
-                                          LV_DRAW_MASK_LINE_SIDE_LEFT);
-            lv_draw_mask_line_points_init(&mask_right_param, p1.x, p1.y - w_half0, p2.x, p2.y - w_half0,
-                                          LV_DRAW_MASK_LINE_SIDE_RIGHT);
-        }
-    }
-    else {
-        lv_draw_mask_line_points_init(&mask_left_param, p1.x + w_half1, p1.y, p2.x + w_half1, p2.y,
-                                      LV_DRAW_MASK_LINE_SIDE_LEFT);
-        lv_draw_mask_line_points_init(&mask_right_param, p1.x - w_half0, p1.y, p2.x - w_half0, p2.y,
-                                      LV_DRAW_MASK_LINE_SIDE_RIGHT);
-    }
-
-    /*Use the normal vector for the endings*/
-
-    int16_t mask_left_id = lv_draw_mask_add(&mask_left_param, NULL);
-    int16_t mask_right_id = lv_draw_mask_add(&mask_right_param, NULL);
-    int16_t mask_top_id = LV_MASK_ID_INV;
-    int16_t mask_bottom_id = LV_MASK_ID_INV;
-
-    if(!dsc->raw_end) {
-        lv_draw_mask_line_points_init(&mask_top_param, p1.x, p1.y, p1.x - ydiff, p1.y + xdiff, LV_DRAW_MASK_LINE_SIDE_BOTTOM);
-        lv_draw_mask_line_points_init(&mask_bottom_param, p2.x, p2.y, p2.x - ydiff, p2.y + xdiff,  LV_DRAW_MASK_LINE_SIDE_TOP);
-        mask_top_id = lv_draw_mask_add(&mask_top_param, NULL);
-        mask_bottom_id = lv_draw_mask_add(&mask_bottom_param, NULL);
-    }
+    int16_t mask_ids[4];
+    uint8_t m;
+    for(m = 0; m < mask_cnt; m++) mask_ids[m] = lv_draw_mask_add(&mask_param[m], NULL);
 
-    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
-    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp);
-
-    const lv_area_t * disp_area = &draw_buf->area;
+    lv_draw_target_t * target = _lv_draw_target_get();
+    const lv_area_t * disp_area = &target->area;
 
     /*Store the coordinates of the `draw_a` relative to the draw_buf*/
     draw_area.x1 -= disp_area->x1;
@@ -424,7 +504,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_skew(const lv_point_t * point1, cons
 
     /*Draw the background line by line*/
     int32_t h;
-    uint32_t hor_res = (uint32_t)lv_disp_get_hor_res(disp);
+    uint32_t hor_res = (uint32_t)_lv_draw_target_get_hor_res(target);
     size_t mask_buf_size = LV_MIN(lv_area_get_size(&draw_area), hor_res);
     lv_opa_t * mask_buf = lv_mem_buf_get(mask_buf_size);
 
@@ -434,7 +514,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_skew(const lv_point_t * point1, cons
     fill_area.y1 = draw_area.y1 + disp_area->y1;
     fill_area.y2 = fill_area.y1;
 
-    int32_t x = draw_buf->area.x1 + draw_area.x1;
+    int32_t x = disp_area->x1 + draw_area.x1;
 
     uint32_t mask_p = 0;
 
@@ -474,10 +554,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_skew(const lv_point_t * point1, cons
 
     lv_mem_buf_release(mask_buf);
 
-    lv_draw_mask_remove_id(mask_left_id);
-    lv_draw_mask_remove_id(mask_right_id);
-    lv_draw_mask_remove_id(mask_top_id);
-    lv_draw_mask_remove_id(mask_bottom_id);
+    for(m = 0; m < mask_cnt; m++) lv_draw_mask_remove_id(mask_ids[m]);
 #else
     LV_UNUSED(point1);
     LV_UNUSED(point2);
@@ -487,3 +564,169 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_skew(const lv_point_t * point1, cons
 #endif /*LV_DRAW_COMPLEX*/
 }
 
+#if LV_DRAW_COMPLEX
+
+/**
+ * Initialize the masks of a skewed line
+ * @param point1 first point of the line
+ * @param point2 second point of the line
+ * @param dsc pointer to an initialized `lv_draw_line_dsc_t` variable
+ * @param area store the area of the line here
+ * @param mask_param an array of 4 line masks to initialize
+ * @return number of initialized masks (2 or 4 if the endings are also masked)
+ */
+static uint8_t line_skew_masks_init(const lv_point_t * point1, const lv_point_t * point2,
+                                    const lv_draw_line_dsc_t * dsc, lv_area_t * area,
+                                    lv_draw_mask_line_param_t mask_param[])
+{
+    /*Keep the great y in p1*/
+    lv_point_t p1;
+    lv_point_t p2;
+    if(point1->y < point2->y) {
+        p1.y = point1->y;
+        p2.y = point2->y;
+        p1.x = point1->x;
+        p2.x = point2->x;
+    }
+    else {
+        p1.y = point2->y;
+        p2.y = point1->y;
+        p1.x = point2->x;
+        p2.x = point1->x;
+    }
+
+    int32_t xdiff = p2.x - p1.x;
+    int32_t ydiff = p2.y - p1.y;
+    bool flat = LV_ABS(xdiff) > LV_ABS(ydiff) ? true : false;
+
+    static const uint8_t wcorr[] = {
+        128, 128, 128, 129, 129, 130, 130, 131,
+        132, 133, 134, 135, 137, 138, 140, 141,
+        143, 145, 147, 149, 151, 153, 155, 158,
+        160, 162, 165, 167, 170, 173, 175, 178,
+        181,
+    };
+
+    int32_t w = dsc->width;
+    int32_t wcorr_i = 0;
+    if(flat) wcorr_i = (LV_ABS(ydiff) << 5) / LV_ABS(xdiff);
+    else wcorr_i = (LV_ABS(xdiff) << 5) / LV_ABS(ydiff);
+
+    w = (w * wcorr[wcorr_i] + 63) >> 7;     /*+ 63 for rounding*/
+    int32_t w_half0 = w >> 1;
+    int32_t w_half1 = w_half0 + (w & 0x1); /*Compensate rounding error*/
+
+    area->x1 = LV_MIN(p1.x, p2.x) - w;
+    area->x2 = LV_MAX(p1.x, p2.x) + w;
+    area->y1 = LV_MIN(p1.y, p2.y) - w;
+    area->y2 = LV_MAX(p1.y, p2.y) + w;
+
+    lv_draw_mask_line_param_t * mask_left_param = &mask_param[0];
+    lv_draw_mask_line_param_t * mask_right_param = &mask_param[1];
+
+    if(flat) {
+        if(xdiff > 0) {
+            lv_draw_mask_line_points_init(mask_left_param, p1.x, p1.y - w_half0, p2.x, p2.y - w_half0,
+                                          LV_DRAW_MASK_LINE_SIDE_LEFT);
+            lv_draw_mask_line_points_init(mask_right_param, p1.x, p1.y + w_half1, p2.x, p2.y + w_half1,
+                                          LV_DRAW_MASK_LINE_SIDE_RIGHT);
+        }
+        else {
+            lv_draw_mask_line_points_init(mask_left_param, p1.x, p1.y + w_half1, p2.x, p2.y + w_half1,
+                                          LV_DRAW_MASK_LINE_SIDE_LEFT);
+            lv_draw_mask_line_points_init(mask_right_param, p1.x, p1.y - w_half0, p2.x, p2.y - w_half0,
+                                          LV_DRAW_MASK_LINE_SIDE_RIGHT);
+        }
+    }
+    else {
+        lv_draw_mask_line_points_init(mask_left_param, p1.x + w_half1, p1.y, p2.x + w_half1, p2.y,
+                                      LV_DRAW_MASK_LINE_SIDE_LEFT);
+        lv_draw_mask_line_points_init(mask_right_param, p1.x - w_half0, p1.y, p2.x - w_half0, p2.y,
+                                      LV_DRAW_MASK_LINE_SIDE_RIGHT);
+    }
+
+    /*Use the normal vector for the endings*/
+    if(dsc->raw_end) return 2;
+
+    lv_draw_mask_line_points_init(&mask_param[2], p1.x, p1.y, p1.x - ydiff, p1.y + xdiff, LV_DRAW_MASK_LINE_SIDE_BOTTOM);
+    lv_draw_mask_line_points_init(&mask_param[3], p2.x, p2.y, p2.x - ydiff, p2.y + xdiff,  LV_DRAW_MASK_LINE_SIDE_TOP);
+    return 4;
+}
+
+/**
+ * Get the area of a horizontal or vertical line the same way as `draw_line_hor/ver` does
+ * @param point1 first point of the line
+ * @param point2 second point of the line
+ * @param dsc pointer to an initialized `lv_draw_line_dsc_t` variable
+ * @param area store the area of the line here
+ */
+static void line_straight_area_init(const lv_point_t * point1, const lv_point_t * point2,
+                                    const lv_draw_line_dsc_t * dsc, lv_area_t * area)
+{
+    int32_t w = dsc->width - 1;
+    int32_t w_half0 = w >> 1;
+    int32_t w_half1 = w_half0 + (w & 0x1); /*Compensate rounding error*/
+
+    if(point1->y == point2->y) {
+        area->x1 = LV_MIN(point1->x, point2->x);
+        area->x2 = LV_MAX(point1->x, point2->x)  - 1;
+        area->y1 = point1->y - w_half1;
+        area->y2 = point1->y + w_half0;
+    }
+    else {
+        area->x1 = point1->x - w_half1;
+        area->x2 = point1->x + w_half0;
+        area->y1 = LV_MIN(point1->y, point2->y);
+        area->y2 = LV_MAX(point1->y, point2->y) - 1;
+    }
+}
+
+/**
+ * Add the coverage of a shape to a band of a polyline's mask.
+ * Where the shapes overlap the greater opacity is kept.
+ * @param band_buf the mask of the band
+ * @param row_buf a buffer for one row of the band
+ * @param band the area of the band (absolute coordinates)
+ * @param shape the shape to add
+ */
+LV_ATTRIBUTE_FAST_MEM static void polyline_add_shape(lv_opa_t * band_buf, lv_opa_t * row_buf, const lv_area_t * band,
+                                                     const polyline_shape_t * shape)
+{
+    lv_area_t a;
+    if(_lv_area_intersect(&a, &shape->area, band) == false) return;
+
+    int32_t band_w = lv_area_get_width(band);
+    int32_t len = lv_area_get_width(&a);
+    lv_opa_t * dest = &band_buf[(a.y1 - band->y1) * band_w + (a.x1 - band->x1)];
+
+    lv_coord_t y;
+    for(y = a.y1; y <= a.y2; y++, dest += band_w) {
+        if(shape->mask_cnt == 0) {
+            lv_memset_ff(dest, len);
+            continue;
+        }
+
+        lv_memset_ff(row_buf, len);
+        lv_draw_mask_res_t mask_res = LV_DRAW_MASK_RES_FULL_COVER;
+        uint32_t m;
+        for(m = 0; m < shape->mask_cnt; m++) {
+            _lv_draw_mask_common_dsc_t * mask_dsc = shape->masks[m];
+            lv_draw_mask_res_t res = mask_dsc->cb(row_buf, a.x1, y, len, shape->masks[m]);
+            if(res == LV_DRAW_MASK_RES_TRANSP) break;
+            if(res == LV_DRAW_MASK_RES_CHANGED) mask_res = LV_DRAW_MASK_RES_CHANGED;
+        }
+        if(m != shape->mask_cnt) continue;
+
+        if(mask_res == LV_DRAW_MASK_RES_FULL_COVER) {
+            lv_memset_ff(dest, len);
+        }
+        else {
+            int32_t x;
+            for(x = 0; x < len; x++) {
+                if(row_buf[x] > dest[x]) dest[x] = row_buf[x];
+            }
+        }
+    }
+}
+
+#endif /*LV_DRAW_COMPLEX*/
@@ -49,6 +49,19 @@ typedef struct {
 LV_ATTRIBUTE_FAST_MEM void lv_draw_line(const lv_point_t * point1, const lv_point_t * point2, const lv_area_t * clip,
                                         const lv_draw_line_dsc_t * dsc);
 
+/**
+ * Draw a polyline: lines between the adjacent points of an array.
+ * The whole polyline is rasterized in one pass so the joints are not overdrawn.
+ * @param points an array of points. The first and last points are the ends of the polyline.
+ * @param point_cnt number of points in `points`
+ * @param clip the polyline will be drawn only in this area
+ * @param dsc pointer to an initialized `lv_draw_line_dsc_t` variable.
+ *            `round_start` and `round_end` are applied only on the first and last points.
+ *            The inner joints are always round if `width > 2`.
+ */
+LV_ATTRIBUTE_FAST_MEM void lv_draw_polyline(const lv_point_t points[], uint32_t point_cnt, const lv_area_t * clip,
+                                            const lv_draw_line_dsc_t * dsc);
+
 LV_ATTRIBUTE_FAST_MEM void lv_draw_line_dsc_init(lv_draw_line_dsc_t * dsc);
 
 //! @endcond
@@ -18,6 +18,8 @@
 /*********************
  *      DEFINES
  *********************/
+/*The expected size of the coverage table of a circle*/
+#define CIRCLE_EST_SIZE(r) (sizeof(uint16_t) * (2 * (r) + 1) + 3 * (r))
 
 /**********************
  *      TYPEDEFS
@@ -49,12 +51,32 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t line_mask_steep(lv_opa_t * mask_
                                                                 lv_coord_t len,
                                                                 lv_draw_mask_line_param_t * p);
 
+static void lv_draw_mask_radius_span(lv_coord_t abs_y, lv_draw_mask_span_t * span,
+                                     lv_draw_mask_radius_param_t * param);
+static void lv_draw_mask_fade_span(lv_coord_t abs_y, lv_draw_mask_span_t * span, lv_draw_mask_fade_param_t * param);
+static void lv_draw_mask_map_span(lv_coord_t abs_y, lv_draw_mask_span_t * span, lv_draw_mask_map_param_t * param);
+static inline void span_exclude_cover(lv_draw_mask_span_t * span, lv_coord_t x1, lv_coord_t x2);
+
+static void radius_param_init(lv_draw_mask_radius_param_t * param, const lv_area_t * rect, lv_coord_t radius,
+                              bool inv);
+#if LV_CIRCLE_CACHE_SIZE
+static _lv_draw_mask_radius_circle_dsc_t * circle_cache_get(lv_coord_t radius, bool outer);
+static bool circle_calc(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t radius, bool outer);
+static void circle_cache_free(_lv_draw_mask_radius_circle_dsc_t * c);
+LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t circle_apply(lv_opa_t * mask_buf, int32_t k, int32_t len, int32_t w,
+                                                             const _lv_draw_mask_radius_circle_dsc_t * c, int32_t y);
+#endif
+
 LV_ATTRIBUTE_FAST_MEM static inline lv_opa_t mask_mix(lv_opa_t mask_act, lv_opa_t mask_new);
 LV_ATTRIBUTE_FAST_MEM static inline void sqrt_approx(lv_sqrt_res_t * q, lv_sqrt_res_t * ref, uint32_t x);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_CIRCLE_CACHE_SIZE
+static uint32_t circle_cache_life;
+static uint32_t circle_cache_mem;   /*Size of the cached tables in bytes*/
+#endif
 
 /**********************
  *      MACROS
@@ -121,6 +143,55 @@ LV_ATTRIBUTE_FAST_MEM lv_draw_mask_res_t lv_draw_mask_apply(lv_opa_t * mask_buf,
     return changed ? LV_DRAW_MASK_RES_CHANGED : LV_DRAW_MASK_RES_FULL_COVER;
 }
 
+/**
+ * Get which parts of a line are transparent, fully covered or need to be calculated by the added masks.
+ * Used internally by the library's drawing routines.
+ * @param abs_x absolute X coordinate where the line to calculate start
+ * @param abs_y absolute Y coordinate where the line to calculate start
+ * @param len length of the line to calculate (in pixel count)
+ * @param span store the result here. If there is no fully covered part `cover_x1` will be `x2 + 1`
+ *             and `cover_x2` will be `x2`.
+ * @return One of these values:
+ * - `LV_DRAW_MASK_RES_FULL_TRANSP`: the whole line is transparent
+ * - `LV_DRAW_MASK_RES_FULL_COVER`: the whole line is fully visible
+ * - `LV_DRAW_MASK_RES_CHANGED`: `span` describes the parts of the line
+ */
+LV_ATTRIBUTE_FAST_MEM lv_draw_mask_res_t lv_draw_mask_get_span(lv_coord_t abs_x, lv_coord_t abs_y, lv_coord_t len,
+                                                               lv_draw_mask_span_t * span)
+{
+    span->x1 = abs_x;
+    span->x2 = abs_x + len - 1;
+    span->cover_x1 = span->x1;
+    span->cover_x2 = span->x2;
+
+    _lv_draw_mask_common_dsc_t * dsc;
+    _lv_draw_mask_saved_t * m = LV_GC_ROOT(_lv_draw_mask_list);
+    while(m->param) {
+        dsc = m->param;
+        /*Without span callback the mask can change any pixel*/
+        if(dsc->span_cb) dsc->span_cb(abs_y, span, m->param);
+        else span_exclude_cover(span, span->x1, span->x2);
+
+        if(span->x1 > span->x2) return LV_DRAW_MASK_RES_TRANSP;
+        m++;
+    }
+
+    /*Keep the covered part in the not transparent part*/
+    if(span->cover_x1 < span->x1) span->cover_x1 = span->x1;
+    if(span->cover_x2 > span->x2) span->cover_x2 = span->x2;
+    if(span->cover_x1 > span->cover_x2) {
+        span->cover_x1 = span->x2 + 1;
+        span->cover_x2 = span->x2;
+    }
+
+    if(span->x1 == abs_x && span->x2 == abs_x + len - 1 &&
+       span->cover_x1 == span->x1 && span->cover_x2 == span->x2) {
+        return LV_DRAW_MASK_RES_FULL_COVER;
+    }
+
+    return LV_DRAW_MASK_RES_CHANGED;
+}
+
 /**
  * Remove a mask with a given ID
  * @param id the ID of the mask.  Returned by `lv_draw_mask_add`
@@ -218,6 +289,7 @@ void lv_draw_mask_line_points_init(lv_draw_mask_line_param_t * param, lv_coord_t
     param->yx_steep = 0;
     param->xy_steep = 0;
     param->dsc.cb = (lv_draw_mask_xcb_t)lv_draw_mask_line;
+    param->dsc.span_cb = NULL;
     param->dsc.type = LV_DRAW_MASK_TYPE_LINE;
 
     int32_t dx = p2x - p1x;
@@ -334,6 +406,7 @@ void lv_draw_mask_angle_init(lv_draw_mask_angle_param_t * param, lv_coord_t vert
     param->cfg.vertex_p.x = vertex_x;
     param->cfg.vertex_p.y = vertex_y;
     param->dsc.cb = (lv_draw_mask_xcb_t)lv_draw_mask_angle;
+    param->dsc.span_cb = NULL;
     param->dsc.type = LV_DRAW_MASK_TYPE_ANGLE;
 
     LV_ASSERT_MSG(start_angle >= 0 && start_angle <= 360, "Unexpected start angle");
@@ -371,19 +444,14 @@ void lv_draw_mask_angle_init(lv_draw_mask_angle_param_t * param, lv_coord_t vert
  */
 void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area_t * rect, lv_coord_t radius, bool inv)
 {
-    lv_coord_t w = lv_area_get_width(rect);
-    lv_coord_t h = lv_area_get_height(rect);
-    int32_t short_side = LV_MIN(w, h);
-    if(radius > short_side >> 1) radius = short_side >> 1;
+    radius_param_init(param, rect, radius, inv);
 
-    lv_area_copy(&param->cfg.rect, rect);
-    param->cfg.radius = radius;
-    param->cfg.outer = inv ? 1 : 0;
-    param->dsc.cb = (lv_draw_mask_xcb_t)lv_draw_mask_radius;
-    param->dsc.type = LV_DRAW_MASK_TYPE_RADIUS;
-    param->y_prev = INT32_MIN;
-    param->y_prev_x.f = 0;
-    param->y_prev_x.i = 0;
+#if LV_CIRCLE_CACHE_SIZE
+    if(param->cfg.radius > 0) {
+        param->circle = circle_cache_get(param->cfg.radius, inv);
+        if(param->circle) param->circle_id = param->circle->id;
+    }
+#endif
 }
 
 /**
@@ -405,6 +473,7 @@ void lv_draw_mask_fade_init(lv_draw_mask_fade_param_t * param, const lv_area_t *
     param->cfg.y_top = y_top;
     param->cfg.y_bottom = y_bottom;
     param->dsc.cb = (lv_draw_mask_xcb_t)lv_draw_mask_fade;
+    param->dsc.span_cb = (lv_draw_mask_span_xcb_t)lv_draw_mask_fade_span;
     param->dsc.type = LV_DRAW_MASK_TYPE_FADE;
 }
 
@@ -419,9 +488,24 @@ void lv_draw_mask_map_init(lv_draw_mask_map_param_t * param, const lv_area_t * c
     lv_area_copy(&param->cfg.coords, coords);
     param->cfg.map = map;
     param->dsc.cb = (lv_draw_mask_xcb_t)lv_draw_mask_map;
+    param->dsc.span_cb = (lv_draw_mask_span_xcb_t)lv_draw_mask_map_span;
     param->dsc.type = LV_DRAW_MASK_TYPE_MAP;
 }
 
+/**
+ * Free the cached circle coverage tables. The masks using them fall back to calculating the corners.
+ */
+void _lv_draw_mask_cleanup(void)
+{
+#if LV_CIRCLE_CACHE_SIZE
+    _lv_draw_mask_radius_circle_dsc_t * cache = LV_GC_ROOT(_lv_circle_cache);
+    uint32_t i;
+    for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
+        circle_cache_free(&cache[i]);
+    }
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -944,6 +1028,17 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_radius(lv_opa_t * m
     /*Handle corner areas*/
     if(abs_y < radius || abs_y > h - radius - 1) {
 
+#if LV_CIRCLE_CACHE_SIZE
+        if(p->circle) {
+            if(p->circle->id == p->circle_id) {
+                int32_t y_circle = abs_y < radius ? radius - abs_y : radius - (h - abs_y) + 1;
+                return circle_apply(mask_buf, k, len, w, p->circle, y_circle);
+            }
+            /*The cache entry was reused for an other radius meanwhile*/
+            p->circle = NULL;
+        }
+#endif
+
         uint32_t sqrt_mask;
         if(radius <= 32) sqrt_mask = 0x200;
         if(radius <= 256) sqrt_mask = 0x800;
@@ -1212,6 +1307,324 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_map(lv_opa_t * mask
     return LV_DRAW_MASK_RES_CHANGED;
 }
 
+static void lv_draw_mask_radius_span(lv_coord_t abs_y, lv_draw_mask_span_t * span,
+                                     lv_draw_mask_radius_param_t * p)
+{
+    const lv_area_t * rect = &p->cfg.rect;
+    if(abs_y < rect->y1 || abs_y > rect->y2) {
+        /*Out of the rectangle the inner mask is transparent and the outer mask has no effect*/
+        if(p->cfg.outer == 0) span->x2 = span->x1 - 1;
+        return;
+    }
+
+    /*The outer mask is transparent in the middle of the row so it can't be described by a span*/
+    if(p->cfg.outer) {
+        span_exclude_cover(span, span->x1, span->x2);
+        return;
+    }
+
+    int32_t radius = p->cfg.radius;
+    int32_t cover_ofs = 0;
+    if(abs_y < rect->y1 + radius || abs_y > rect->y2 - radius) {
+        /*In the corners only the pixels which are inside the circle in their whole height are covered.
+         *Calculate it the same way as `lv_draw_mask_radius` does*/
+        int32_t y_rel = abs_y - rect->y1;
+        int32_t y;
+        if(y_rel < radius) y = radius - y_rel;
+        else y = radius - (lv_area_get_height(rect) - y_rel) + 1;
+
+#if LV_CIRCLE_CACHE_SIZE
+        const _lv_draw_mask_radius_circle_dsc_t * c = p->circle;
+        if(c && c->id == p->circle_id) {
+            /*The pixels after the circumference are covered*/
+            cover_ofs = c->x_start_on_y[y - 1] + c->opa_start_on_y[y] - c->opa_start_on_y[y - 1];
+        }
+        else
+#endif
+        {
+            lv_sqrt_res_t x0;
+            lv_sqrt(radius * radius - y * y, &x0, radius <= 256 ? 0x800 : 0x8000);
+            cover_ofs = radius - x0.i;
+        }
+    }
+
+    if(span->x1 < rect->x1) span->x1 = rect->x1;
+    if(span->x2 > rect->x2) span->x2 = rect->x2;
+    if(span->cover_x1 < rect->x1 + cover_ofs) span->cover_x1 = rect->x1 + cover_ofs;
+    if(span->cover_x2 > rect->x2 - cover_ofs) span->cover_x2 = rect->x2 - cover_ofs;
+}
+
+static void lv_draw_mask_fade_span(lv_coord_t abs_y, lv_draw_mask_span_t * span, lv_draw_mask_fade_param_t * p)
+{
+    if(abs_y < p->cfg.coords.y1 || abs_y > p->cfg.coords.y2) return;
+
+    lv_opa_t opa_act;
+    if(abs_y <= p->cfg.y_top) opa_act = p->cfg.opa_top;
+    else if(abs_y >= p->cfg.y_bottom) opa_act = p->cfg.opa_bottom;
+    else {
+        span_exclude_cover(span, p->cfg.coords.x1, p->cfg.coords.x2);
+        return;
+    }
+
+    if(opa_act >= LV_OPA_MAX) return;
+    else if(opa_act <= LV_OPA_MIN) {
+        /*Transparent on the sides can be clipped*/
+        if(p->cfg.coords.x1 <= span->x1) {
+            if(span->x1 <= p->cfg.coords.x2) span->x1 = p->cfg.coords.x2 + 1;
+            return;
+        }
+        else if(p->cfg.coords.x2 >= span->x2) {
+            if(span->x2 >= p->cfg.coords.x1) span->x2 = p->cfg.coords.x1 - 1;
+            return;
+        }
+    }
+
+    span_exclude_cover(span, p->cfg.coords.x1, p->cfg.coords.x2);
+}
+
+static void lv_draw_mask_map_span(lv_coord_t abs_y, lv_draw_mask_span_t * span, lv_draw_mask_map_param_t * p)
+{
+    if(abs_y < p->cfg.coords.y1 || abs_y > p->cfg.coords.y2) return;
+
+    span_exclude_cover(span, p->cfg.coords.x1, p->cfg.coords.x2);
+}
+
+/**
+ * Initialize the parameters of a radius mask without looking up the circle cache.
+ * @param param pointer to a `lv_draw_mask_param_t` to initialize
+ * @param rect coordinates of the rectangle to affect (absolute coordinates)
+ * @param radius radius of the rectangle
+ * @param inv true: keep the pixels inside the rectangle; keep the pixels outside of the rectangle
+ */
+static void radius_param_init(lv_draw_mask_radius_param_t * param, const lv_area_t * rect, lv_coord_t radius,
+                              bool inv)
+{
+    lv_coord_t w = lv_area_get_width(rect);
+    lv_coord_t h = lv_area_get_height(rect);
+    int32_t short_side = LV_MIN(w, h);
+    if(radius > short_side >> 1) radius = short_side >> 1;
+
+    lv_area_copy(&param->cfg.rect, rect);
+    param->cfg.radius = radius;
+    param->cfg.outer = inv ? 1 : 0;
+    param->dsc.cb = (lv_draw_mask_xcb_t)lv_draw_mask_radius;
+    param->dsc.span_cb = (lv_draw_mask_span_xcb_t)lv_draw_mask_radius_span;
+    param->dsc.type = LV_DRAW_MASK_TYPE_RADIUS;
+    param->y_prev = INT32_MIN;
+    param->y_prev_x.f = 0;
+    param->y_prev_x.i = 0;
+    param->circle = NULL;
+    param->circle_id = 0;
+}
+
+#if LV_CIRCLE_CACHE_SIZE
+/**
+ * Get the coverage table of a circle from the cache. Calculate it if it's not cached yet.
+ * @param radius radius of the circle
+ * @param outer true: get the table of an inverted mask
+ * @return pointer to the cache entry or NULL if it couldn't be calculated
+ */
+static _lv_draw_mask_radius_circle_dsc_t * circle_cache_get(lv_coord_t radius, bool outer)
+{
+    _lv_draw_mask_radius_circle_dsc_t * cache = LV_GC_ROOT(_lv_circle_cache);
+
+    /*Don't cache the circles which alone would take too much memory*/
+    if(CIRCLE_EST_SIZE(radius) > LV_CIRCLE_CACHE_MEM_SIZE) return NULL;
+
+    circle_cache_life++;
+
+    uint32_t i;
+    for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
+        if(cache[i].buf && cache[i].radius == radius && cache[i].outer == outer) {
+            cache[i].life = circle_cache_life;
+            return &cache[i];
+        }
+    }
+
+    /*Not cached yet. Replace the least recently used entry*/
+    _lv_draw_mask_radius_circle_dsc_t * c = &cache[0];
+    for(i = 1; i < LV_CIRCLE_CACHE_SIZE; i++) {
+        if(cache[i].life < c->life) c = &cache[i];
+    }
+
+    /*Invalidate the masks which still use the entry*/
+    c->id = 0;
+    c->life = 0;
+    if(circle_calc(c, radius, outer) == false) return NULL;
+
+    c->life = circle_cache_life;
+    c->id = circle_cache_life;
+
+    /*Free the least recently used other tables while the cache is too large*/
+    while(circle_cache_mem > LV_CIRCLE_CACHE_MEM_SIZE) {
+        _lv_draw_mask_radius_circle_dsc_t * lru = NULL;
+        for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
+            if(&cache[i] == c || cache[i].buf == NULL) continue;
+            if(lru == NULL || cache[i].life < lru->life) lru = &cache[i];
+        }
+
+        /*Even the new table alone is too large*/
+        if(lru == NULL) lru = c;
+        circle_cache_free(lru);
+        if(lru == c) return NULL;
+    }
+
+    return c;
+}
+
+/**
+ * Free the table of a cache entry and invalidate the masks using it.
+ * @param c the cache entry
+ */
+static void circle_cache_free(_lv_draw_mask_radius_circle_dsc_t * c)
+{
+    if(c->buf) lv_mem_free(c->buf);
+    circle_cache_mem -= c->buf_size;
+    c->buf = NULL;
+    c->buf_size = 0;
+    c->id = 0;
+    c->life = 0;
+}
+
+/**
+ * Calculate the coverage table of a circle.
+ * To get exactly the same result the rows are calculated by `lv_draw_mask_radius` on a fully covered buffer.
+ * @param c the cache entry to (re)fill
+ * @param radius radius of the circle
+ * @param outer true: calculate the table of an inverted mask
+ * @return true: success; false: out of memory
+ */
+static bool circle_calc(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t radius, bool outer)
+{
+    /*The circumference crosses about `2 * radius` pixels on a 1/4 circle. Grow the buffer if more are required.*/
+    uint32_t head_size = sizeof(uint16_t) * (2 * radius + 1);
+    uint32_t opa_size = 3 * radius;
+    circle_cache_mem -= c->buf_size;
+    c->buf_size = 0;
+    uint8_t * buf = lv_mem_realloc(c->buf, head_size + opa_size);
+    if(buf == NULL) {
+        lv_mem_free(c->buf);
+        c->buf = NULL;
+        return false;
+    }
+
+    lv_draw_mask_radius_param_t p;
+    lv_area_t rect;
+    lv_area_set(&rect, 0, 0, 2 * radius - 1, 2 * radius - 1);
+    radius_param_init(&p, &rect, radius, outer);
+
+    /*The value of the pixels before and after the circumference*/
+    lv_opa_t opa_before = outer ? LV_OPA_COVER : LV_OPA_TRANSP;
+    lv_opa_t opa_after = outer ? LV_OPA_TRANSP : LV_OPA_COVER;
+
+    lv_opa_t * line = lv_mem_buf_get(radius);
+    uint32_t opa_cnt = 0;
+    int32_t y;
+    for(y = 1; y <= radius; y++) {
+        /*Calculate the left half of the top corner's row*/
+        lv_memset_ff(line, radius);
+        lv_draw_mask_res_t res = lv_draw_mask_radius(line, 0, radius - y, radius, &p);
+        if(res == LV_DRAW_MASK_RES_TRANSP) lv_memset_00(line, radius);
+
+        int32_t start = 0;
+        while(start < radius && line[start] == opa_before) start++;
+        int32_t end = radius;
+        while(end > start && line[end - 1] == opa_after) end--;
+
+        if(opa_cnt + (end - start) > opa_size) {
+            opa_size = opa_cnt + (end - start) + radius;
+            uint8_t * new_buf = lv_mem_realloc(buf, head_size + opa_size);
+            if(new_buf == NULL) {
+                lv_mem_buf_release(line);
+                lv_mem_free(buf);
+                c->buf = NULL;
+                return false;
+            }
+            buf = new_buf;
+        }
+
+        uint16_t * x_start_on_y = (uint16_t *)buf;
+        uint16_t * opa_start_on_y = x_start_on_y + radius;
+        x_start_on_y[y - 1] = start;
+        opa_start_on_y[y - 1] = opa_cnt;
+        lv_memcpy_small(buf + head_size + opa_cnt, &line[start], end - start);
+        opa_cnt += end - start;
+        opa_start_on_y[y] = opa_cnt;
+    }
+    lv_mem_buf_release(line);
+
+    c->buf = buf;
+    c->buf_size = head_size + opa_size;
+    circle_cache_mem += c->buf_size;
+    c->x_start_on_y = (uint16_t *)buf;
+    c->opa_start_on_y = c->x_start_on_y + radius;
+    c->cir_opa = buf + head_size;
+    c->radius = radius;
+    c->outer = outer ? 1 : 0;
+    return true;
+}
+
+/**
+ * Apply a row of a cached circle on a mask buffer. Gives the same result as the corner handling of `lv_draw_mask_radius`.
+ * @param mask_buf the mask buffer
+ * @param k the position of the rectangle's left side in `mask_buf`
+ * @param len length of `mask_buf`
+ * @param w width of the rectangle
+ * @param c the cached circle
+ * @param y the row of the circle. 1: the row next to the straight edge
+ * @return LV_DRAW_MASK_RES_TRANSP or LV_DRAW_MASK_RES_CHANGED
+ */
+LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t circle_apply(lv_opa_t * mask_buf, int32_t k, int32_t len, int32_t w,
+                                                             const _lv_draw_mask_radius_circle_dsc_t * c, int32_t y)
+{
+    int32_t opa_start = c->opa_start_on_y[y - 1];
+    int32_t cnt = c->opa_start_on_y[y] - opa_start;
+    const lv_opa_t * opa = &c->cir_opa[opa_start];
+
+    /*Mix the pixels on the circumference from the outside*/
+    int32_t kl = k + c->x_start_on_y[y - 1];
+    int32_t kr = k + w - c->x_start_on_y[y - 1] - 1;
+    int32_t i;
+    for(i = 0; i < cnt; i++) {
+        if(kl + i >= 0 && kl + i < len) mask_buf[kl + i] = mask_mix(mask_buf[kl + i], opa[i]);
+        if(kr - i >= 0 && kr - i < len) mask_buf[kr - i] = mask_mix(mask_buf[kr - i], opa[i]);
+    }
+
+    if(c->outer == 0) {
+        /*Clear the pixels outside of the circle*/
+        if(kl > len) return LV_DRAW_MASK_RES_TRANSP;
+        if(kl >= 0) lv_memset_00(&mask_buf[0], kl);
+
+        kr++;
+        if(kr < 0) return LV_DRAW_MASK_RES_TRANSP;
+        if(kr < len) lv_memset_00(&mask_buf[kr], len - kr);
+    }
+    else {
+        /*Clear the pixels inside of the circle*/
+        int32_t first = kl + cnt;
+        int32_t last = kr - cnt;
+        if(first < 0) first = 0;
+        if(last >= len) last = len - 1;
+        if(first <= last) lv_memset_00(&mask_buf[first], last - first + 1);
+    }
+
+    return LV_DRAW_MASK_RES_CHANGED;
+}
+#endif /*LV_CIRCLE_CACHE_SIZE*/
+
+/**
+ * Make the covered part of a span smaller to not include the `x1..x2` range.
+ * If `x1..x2` is in the middle of the covered part there will be no covered part at all.
+ */
+static inline void span_exclude_cover(lv_draw_mask_span_t * span, lv_coord_t x1, lv_coord_t x2)
+{
+    if(x2 < span->cover_x1 || x1 > span->cover_x2) return;
+
+    if(x1 <= span->cover_x1) span->cover_x1 = x2 + 1;
+    else if(x2 >= span->cover_x2) span->cover_x2 = x1 - 1;
+    else span->cover_x2 = span->cover_x1 - 1;
+}
+
 LV_ATTRIBUTE_FAST_MEM static inline lv_opa_t mask_mix(lv_opa_t mask_act, lv_opa_t mask_new)
 {
     if(mask_new >= LV_OPA_MAX) return mask_act;
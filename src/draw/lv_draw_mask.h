@@ -89,8 +89,28 @@ typedef lv_draw_mask_res_t (*lv_draw_mask_xcb_t)(lv_opa_t * mask_buf, lv_coord_t
 
 typedef uint8_t lv_draw_mask_line_side_t;
 
+/**
+ * Describes how the masks cover a row:
+ * - the pixels out of `x1..x2` are fully transparent
+ * - the pixels in `cover_x1..cover_x2` are fully covered (the masks don't change them)
+ * - the other pixels in `x1..x2` need to be calculated by `lv_draw_mask_apply`
+ */
+typedef struct {
+    lv_coord_t x1;
+    lv_coord_t x2;
+    lv_coord_t cover_x1;
+    lv_coord_t cover_x2;
+} lv_draw_mask_span_t;
+
+/**
+ * Optional callback of the masks to make `span` smaller if the mask makes a part of the row transparent
+ * or not fully covered. Used internally by the library.
+ */
+typedef void (*lv_draw_mask_span_xcb_t)(lv_coord_t abs_y, lv_draw_mask_span_t * span, void * p);
+
 typedef struct {
     lv_draw_mask_xcb_t cb;
+    lv_draw_mask_span_xcb_t span_cb;    /*If `NULL` the mask can make any pixel of the row partially covered*/
     lv_draw_mask_type_t type;
 } _lv_draw_mask_common_dsc_t;
 
@@ -147,6 +167,26 @@ typedef struct {
     uint16_t delta_deg;
 } lv_draw_mask_angle_param_t;
 
+/*Pre-calculated coverage of a 1/4 circle with a given radius.
+ *Row `y` (0: the row next to the straight edge) starts with `x_start_on_y[y]` pixels which are
+ *cleared by the mask (kept by an outer mask), followed by the `cir_opa` values from `opa_start_on_y[y]`
+ *to `opa_start_on_y[y + 1]`. The rest of the row is kept (cleared by an outer mask).*/
+typedef struct {
+    uint16_t * x_start_on_y;
+    uint16_t * opa_start_on_y;
+    lv_opa_t * cir_opa;
+    void * buf;                 /*The allocated memory of the arrays above*/
+    uint32_t buf_size;          /*Size of `buf` in bytes*/
+    uint32_t life;              /*When the entry was used last time*/
+    uint32_t id;                /*Changes when the entry is recalculated for an other radius*/
+    lv_coord_t radius;
+    uint8_t outer : 1;
+} _lv_draw_mask_radius_circle_dsc_t;
+
+#if LV_CIRCLE_CACHE_SIZE
+typedef _lv_draw_mask_radius_circle_dsc_t _lv_draw_mask_radius_circle_dsc_arr_t[LV_CIRCLE_CACHE_SIZE];
+#endif
+
 typedef struct {
     /*The first element must be the common descriptor*/
     _lv_draw_mask_common_dsc_t dsc;
@@ -159,6 +199,8 @@ typedef struct {
     } cfg;
     int32_t y_prev;
     lv_sqrt_res_t y_prev_x;
+    _lv_draw_mask_radius_circle_dsc_t * circle;   /*The cached coverage of the corners or NULL*/
+    uint32_t circle_id;
 
 } lv_draw_mask_radius_param_t;
 
@@ -217,6 +259,22 @@ int16_t lv_draw_mask_add(void * param, void * custom_id);
 LV_ATTRIBUTE_FAST_MEM lv_draw_mask_res_t lv_draw_mask_apply(lv_opa_t * mask_buf, lv_coord_t abs_x, lv_coord_t abs_y,
                                                             lv_coord_t len);
 
+/**
+ * Get which parts of a line are transparent, fully covered or need to be calculated by the added masks.
+ * Used internally by the library's drawing routines.
+ * @param abs_x absolute X coordinate where the line to calculate start
+ * @param abs_y absolute Y coordinate where the line to calculate start
+ * @param len length of the line to calculate (in pixel count)
+ * @param span store the result here. If there is no fully covered part `cover_x1` will be `x2 + 1`
+ *             and `cover_x2` will be `x2`.
+ * @return One of these values:
+ * - `LV_DRAW_MASK_RES_FULL_TRANSP`: the whole line is transparent
+ * - `LV_DRAW_MASK_RES_FULL_COVER`: the whole line is fully visible
+ * - `LV_DRAW_MASK_RES_CHANGED`: `span` describes the parts of the line
+ */
+LV_ATTRIBUTE_FAST_MEM lv_draw_mask_res_t lv_draw_mask_get_span(lv_coord_t abs_x, lv_coord_t abs_y, lv_coord_t len,
+                                                               lv_draw_mask_span_t * span);
+
 //! @endcond
 
 /**
@@ -313,6 +371,11 @@ void lv_draw_mask_fade_init(lv_draw_mask_fade_param_t * param, const lv_area_t *
  */
 void lv_draw_mask_map_init(lv_draw_mask_map_param_t * param, const lv_area_t * coords, const lv_opa_t * map);
 
+/**
+ * Free the cached circle coverage tables. Called by `lv_deinit()`.
+ */
+void _lv_draw_mask_cleanup(void);
+
 #endif /*LV_DRAW_COMPLEX*/
 
 /**********************
@@ -9,9 +9,12 @@
 #include "lv_draw_rect.h"
 #include "lv_draw_blend.h"
 #include "lv_draw_mask.h"
+#include "lv_draw_blur.h"
+#include "lv_draw_grad.h"
+#include "lv_draw_backend.h"
+#include "lv_draw_target.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_txt_ap.h"
-#include "../core/lv_refr.h"
 #include "../misc/lv_assert.h"
 
 /*********************
@@ -51,10 +54,6 @@ static void draw_simple_border(const lv_area_t * clip, const lv_area_t * area_in
         lv_color_t color, lv_opa_t opa, lv_border_side_t side);
 #endif
 
-#if LV_DRAW_COMPLEX
-LV_ATTRIBUTE_FAST_MEM static inline lv_color_t grad_get(const lv_draw_rect_dsc_t * dsc, lv_coord_t s, lv_coord_t i);
-#endif
-
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -98,6 +97,14 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_rect_dsc_init(lv_draw_rect_dsc_t * dsc)
 void lv_draw_rect(const lv_area_t * coords, const lv_area_t * clip, const lv_draw_rect_dsc_t * dsc)
 {
     if(lv_area_get_height(coords) < 1 || lv_area_get_width(coords) < 1) return;
+
+    /*Offer the whole rectangle to the draw backend first*/
+    lv_draw_target_t * target = _lv_draw_target_get();
+    const lv_draw_backend_t * backend = target->drv ? target->drv->draw_backend : NULL;
+    if(backend && backend->draw_rect && dsc->blend_mode == LV_BLEND_MODE_NORMAL && _lv_draw_target_is_direct(target)) {
+        if(backend->draw_rect(target->drv, coords, clip, dsc) == LV_RES_OK) return;
+    }
+
 #if LV_DRAW_COMPLEX
     draw_shadow(coords, clip, dsc);
 #endif
@@ -136,9 +143,6 @@ LV_ATTRIBUTE_FAST_MEM static void draw_bg(const lv_area_t * coords, const lv_are
 
     if(opa > LV_OPA_MAX) opa = LV_OPA_COVER;
 
-    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
-    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp);
-
     /*Get clipped fill area which is the real draw area.
      *It is always the same or inside `fill_area`*/
     lv_area_t draw_area;
@@ -146,7 +150,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_bg(const lv_area_t * coords, const lv_are
     is_common = _lv_area_intersect(&draw_area, &coords_bg, clip);
     if(is_common == false) return;
 
-    const lv_area_t * disp_area = &draw_buf->area;
+    const lv_area_t * disp_area = &_lv_draw_target_get()->area;
 
     /*Now `draw_area` has absolute coordinates.
      *Make it relative to `disp_area` to simplify draw to `disp_buf`*/
@@ -159,10 +163,16 @@ LV_ATTRIBUTE_FAST_MEM static void draw_bg(const lv_area_t * coords, const lv_are
     lv_grad_dir_t grad_dir = dsc->bg_grad_dir;
     if(dsc->bg_color.full == dsc->bg_grad_color.full) grad_dir = LV_GRAD_DIR_NONE;
 
+    /*Horizontal gradients (and dithered vertical ones) are blended as a color map row by row*/
+    bool grad_map_mode = grad_dir == LV_GRAD_DIR_HOR;
+#if _LV_GRAD_DITHER
+    if(grad_dir != LV_GRAD_DIR_NONE) grad_map_mode = true;
+#endif
+
     uint16_t other_mask_cnt = lv_draw_mask_get_cnt();
     bool simple_mode = true;
     if(other_mask_cnt) simple_mode = false;
-    else if(grad_dir == LV_GRAD_DIR_HOR) simple_mode = false;
+    else if(grad_map_mode) simple_mode = false;
 
 
     int32_t coords_w = lv_area_get_width(&coords_bg);
@@ -197,29 +207,56 @@ LV_ATTRIBUTE_FAST_MEM static void draw_bg(const lv_area_t * coords, const lv_are
         lv_draw_mask_res_t mask_res = LV_DRAW_MASK_RES_FULL_COVER;
         lv_color_t grad_color = dsc->bg_color;
 
-        /*In case of horizontal gradient pre-compute a line with a gradient*/
-        lv_color_t * grad_map = NULL;
-        if(grad_dir == LV_GRAD_DIR_HOR) {
-            grad_map = lv_mem_buf_get(coords_w * sizeof(lv_color_t));
-
-            int32_t i;
-            for(i = 0; i < coords_w; i++) {
-                grad_map[i] = grad_get(dsc, coords_w, i);
+        /*Get the colors of the gradient. Probably they are already calculated in the cache.*/
+        _lv_grad_t * grad = NULL;
+        if(grad_dir != LV_GRAD_DIR_NONE) {
+            grad = _lv_grad_get(dsc->bg_color, dsc->bg_grad_color, dsc->bg_main_color_stop, dsc->bg_grad_color_stop,
+                                grad_dir == LV_GRAD_DIR_HOR ? coords_w : coords_h);
+            if(grad == NULL) {
+                grad_dir = LV_GRAD_DIR_NONE;
+                grad_map_mode = false;
             }
         }
 
+        /*The colors of a row to blend in map mode*/
+        lv_color_t * grad_map = NULL;
+#if _LV_GRAD_DITHER
+        if(grad_map_mode) grad_map = lv_mem_buf_get(coords_w * sizeof(lv_color_t));
+#else
+        if(grad_map_mode) grad_map = grad->map;
+#endif
+
         bool split = false;
         if(lv_area_get_width(&coords_bg) - 2 * rout > SPLIT_LIMIT) split = true;
 
         lv_opa_t opa2;
 
+        /*With other masks calculate the masks only where the rows are partially covered.
+         *Without gradient the whole area can be filled at once, with vertical gradient row by row.*/
+        bool span_mode = simple_mode == false && grad_map_mode == false;
+        bool fill_done = false;
+        if(span_mode && grad_dir == LV_GRAD_DIR_NONE) {
+            _lv_blend_fill_masked(clip, &coords_bg, dsc->bg_color, opa, dsc->blend_mode);
+            fill_done = true;
+        }
+
         lv_area_t fill_area;
         fill_area.x1 = coords_bg.x1;
         fill_area.x2 = coords_bg.x2;
         fill_area.y1 = disp_area->y1 + draw_area.y1;
         fill_area.y2 = fill_area.y1;
-        for(h = draw_area.y1; h <= draw_area.y2; h++) {
-            int32_t y = h + draw_buf->area.y1;
+        for(h = draw_area.y1; h <= draw_area.y2 && !fill_done; h++) {
+            int32_t y = h + disp_area->y1;
+
+            if(span_mode) {
+#if _LV_GRAD_DITHER == 0
+                grad_color = grad->map[y - coords_bg.y1];
+#endif
+                _lv_blend_fill_masked(clip, &fill_area, grad_color, opa, dsc->blend_mode);
+                fill_area.y1++;
+                fill_area.y2++;
+                continue;
+            }
 
             opa2 = opa;
 
@@ -229,13 +266,13 @@ LV_ATTRIBUTE_FAST_MEM static void draw_bg(const lv_area_t * coords, const lv_are
                 mask_res = LV_DRAW_MASK_RES_FULL_COVER;
                 if(simple_mode == false) {
                     lv_memset(mask_buf, opa, draw_area_w);
-                    mask_res = lv_draw_mask_apply(mask_buf, draw_buf->area.x1 + draw_area.x1, draw_buf->area.y1 + h, draw_area_w);
+                    mask_res = lv_draw_mask_apply(mask_buf, disp_area->x1 + draw_area.x1, disp_area->y1 + h, draw_area_w);
                 }
             }
             /*In corner areas apply the mask anyway*/
             else {
                 lv_memset(mask_buf, opa, draw_area_w);
-                mask_res = lv_draw_mask_apply(mask_buf, draw_buf->area.x1 + draw_area.x1, draw_buf->area.y1 + h, draw_area_w);
+                mask_res = lv_draw_mask_apply(mask_buf, disp_area->x1 + draw_area.x1, disp_area->y1 + h, draw_area_w);
             }
 
             /*If mask will taken into account its base opacity was already set by memset above*/
@@ -244,9 +281,17 @@ LV_ATTRIBUTE_FAST_MEM static void draw_bg(const lv_area_t * coords, const lv_are
             }
 
             /*Get the current line color*/
+#if _LV_GRAD_DITHER
+            if(grad_map_mode) {
+                bool hor = grad_dir == LV_GRAD_DIR_HOR;
+                _lv_grad_dither(hor ? grad->hmap : &grad->hmap[y - coords_bg.y1], hor ? 1 : 0,
+                                coords_bg.x1, y, coords_w, grad_map);
+            }
+#else
             if(grad_dir == LV_GRAD_DIR_VER) {
-                grad_color = grad_get(dsc, lv_area_get_height(&coords_bg), y - coords_bg.y1);
+                grad_color = grad->map[y - coords_bg.y1];
             }
+#endif
 
             /*If there is not other mask and drawing the corner area split the drawing to corner and middle areas
              *because it the middle mask shouldn't be taken into account (therefore its faster)*/
@@ -276,14 +321,14 @@ LV_ATTRIBUTE_FAST_MEM static void draw_bg(const lv_area_t * coords, const lv_are
                 fill_area2.x1 = coords_bg.x2 - rout + 1;
                 fill_area2.x2 = coords_bg.x2;
 
-                int32_t mask_ofs = (coords_bg.x2 - rout + 1) - (draw_buf->area.x1 + draw_area.x1);
+                int32_t mask_ofs = (coords_bg.x2 - rout + 1) - (disp_area->x1 + draw_area.x1);
                 if(mask_ofs < 0) mask_ofs = 0;
                 _lv_blend_fill(clip, &fill_area2,
                                grad_color, mask_buf + mask_ofs, mask_res, opa2, dsc->blend_mode);
 
             }
             else {
-                if(grad_dir == LV_GRAD_DIR_HOR) {
+                if(grad_map_mode) {
                     _lv_blend_map(clip, &fill_area, grad_map, mask_buf, mask_res, opa2, dsc->blend_mode);
                 }
                 else if(grad_dir == LV_GRAD_DIR_VER) {
@@ -326,7 +371,10 @@ LV_ATTRIBUTE_FAST_MEM static void draw_bg(const lv_area_t * coords, const lv_are
 
         }
 
+#if _LV_GRAD_DITHER
         if(grad_map) lv_mem_buf_release(grad_map);
+#endif
+        _lv_grad_release(grad);
         if(mask_buf) lv_mem_buf_release(mask_buf);
         lv_draw_mask_remove_id(mask_rout_id);
     }
@@ -431,9 +479,6 @@ LV_ATTRIBUTE_FAST_MEM static void draw_border(const lv_area_t * coords, const lv
         lv_opa_t opa = dsc->border_opa;
         if(opa > LV_OPA_MAX) opa = LV_OPA_COVER;
 
-        lv_disp_t * disp = _lv_refr_get_disp_refreshing();
-        lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp);
-
         /*Get clipped fill area which is the real draw area.
          *It is always the same or inside `fill_area`*/
         lv_area_t draw_area;
@@ -441,7 +486,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_border(const lv_area_t * coords, const lv
         is_common = _lv_area_intersect(&draw_area, coords, clip);
         if(is_common == false) return;
 
-        const lv_area_t * disp_area = &draw_buf->area;
+        const lv_area_t * disp_area = &_lv_draw_target_get()->area;
 
         /*Now `draw_area` has absolute coordinates.
          *Make it relative to `disp_area` to simplify draw to `disp_buf`*/
@@ -502,7 +547,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_border(const lv_area_t * coords, const lv
                (top_only && fill_area.y1 <= coords->y1 + corner_size) ||
                (bottom_only && fill_area.y1 >= coords->y2 - corner_size)) {
                 lv_memset_ff(mask_buf, draw_area_w);
-                mask_res = lv_draw_mask_apply(mask_buf, draw_buf->area.x1 + draw_area.x1, draw_buf->area.y1 + h, draw_area_w);
+                mask_res = lv_draw_mask_apply(mask_buf, disp_area->x1 + draw_area.x1, disp_area->y1 + h, draw_area_w);
                 _lv_blend_fill(clip, &fill_area, color, mask_buf, mask_res, opa, blend_mode);
             }
             fill_area.y1++;
@@ -519,21 +564,6 @@ LV_ATTRIBUTE_FAST_MEM static void draw_border(const lv_area_t * coords, const lv
 }
 
 #if LV_DRAW_COMPLEX
-LV_ATTRIBUTE_FAST_MEM static inline lv_color_t grad_get(const lv_draw_rect_dsc_t * dsc, lv_coord_t s, lv_coord_t i)
-{
-    int32_t min = (dsc->bg_main_color_stop * s) >> 8;
-    if(i <= min) return dsc->bg_color;
-
-    int32_t max = (dsc->bg_grad_color_stop * s) >> 8;
-    if(i >= max) return dsc->bg_grad_color;
-
-    int32_t d = dsc->bg_grad_color_stop - dsc->bg_main_color_stop;
-    d = (s * d) >> 8;
-    i -= min;
-    lv_opa_t mix = (i * 255) / d;
-    return lv_color_mix(dsc->bg_grad_color, dsc->bg_color, mix);
-}
-
 LV_ATTRIBUTE_FAST_MEM static void draw_shadow(const lv_area_t * coords, const lv_area_t * clip,
                                               const lv_draw_rect_dsc_t * dsc)
 {
@@ -564,9 +594,6 @@ LV_ATTRIBUTE_FAST_MEM static void draw_shadow(const lv_area_t * coords, const lv
 
     if(opa > LV_OPA_MAX) opa = LV_OPA_COVER;
 
-    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
-    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp);
-
     /*Get clipped fill area which is the real draw area.
      *It is always the same or inside `fill_area`*/
     lv_area_t draw_area;
@@ -574,7 +601,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_shadow(const lv_area_t * coords, const lv
     is_common = _lv_area_intersect(&draw_area, &sh_area, clip);
     if(is_common == false) return;
 
-    const lv_area_t * disp_area = &draw_buf->area;
+    const lv_area_t * disp_area = &_lv_draw_target_get()->area;
 
     /*Now `draw_area` has absolute coordinates.
      *Make it relative to `disp_area` to simplify draw to `disp_buf`*/
@@ -1109,32 +1136,14 @@ LV_ATTRIBUTE_FAST_MEM static void shadow_blur_corner(lv_coord_t size, lv_coord_t
     int32_t s_right = (sw >> 1);
     if((sw & 1) == 0) s_left--;
 
-    /*Horizontal blur*/
     uint16_t * sh_ups_blur_buf = lv_mem_buf_get(size * sizeof(uint16_t));
 
     int32_t x;
     int32_t y;
 
-    uint16_t * sh_ups_tmp_buf = sh_ups_buf;
-
+    /*Horizontal blur. The values are already divided by `sw` so keep the sums*/
     for(y = 0; y < size; y++) {
-        int32_t v = sh_ups_tmp_buf[size - 1] * sw;
-        for(x = size - 1; x >= 0; x--) {
-            sh_ups_blur_buf[x] = v;
-
-            /*Forget the right pixel*/
-            uint32_t right_val = 0;
-            if(x + s_right < size) right_val = sh_ups_tmp_buf[x + s_right];
-            v -= right_val;
-
-            /*Add the left pixel*/
-            uint32_t left_val;
-            if(x - s_left - 1 < 0) left_val = sh_ups_tmp_buf[0];
-            else left_val = sh_ups_tmp_buf[x - s_left - 1];
-            v += left_val;
-        }
-        lv_memcpy(sh_ups_tmp_buf, sh_ups_blur_buf, size * sizeof(uint16_t));
-        sh_ups_tmp_buf += size;
+        lv_draw_blur_box(&sh_ups_buf[y * size], size, 1, s_left, s_right, 1, sh_ups_blur_buf);
     }
 
     /*Vertical blur*/
@@ -1146,29 +1155,7 @@ LV_ATTRIBUTE_FAST_MEM static void shadow_blur_corner(lv_coord_t size, lv_coord_t
     }
 
     for(x = 0; x < size; x++) {
-        sh_ups_tmp_buf = &sh_ups_buf[x];
-        int32_t v = sh_ups_tmp_buf[0] * sw;
-        for(y = 0; y < size ; y++, sh_ups_tmp_buf += size) {
-            sh_ups_blur_buf[y] = v < 0 ? 0 : (v >> SHADOW_UPSCALE_SHIFT);
-
-            /*Forget the top pixel*/
-            uint32_t top_val;
-            if(y - s_right <= 0) top_val = sh_ups_tmp_buf[0];
-            else top_val = sh_ups_buf[(y - s_right) * size + x];
-            v -= top_val;
-
-            /*Add the bottom pixel*/
-            uint32_t bottom_val;
-            if(y + s_left + 1 < size) bottom_val = sh_ups_buf[(y + s_left + 1) * size + x];
-            else bottom_val = sh_ups_buf[(size - 1) * size + x];
-            v += bottom_val;
-        }
-
-        /*Write back the result into `sh_ups_buf`*/
-        sh_ups_tmp_buf = &sh_ups_buf[x];
-        for(y = 0; y < size; y++, sh_ups_tmp_buf += size) {
-            (*sh_ups_tmp_buf) = sh_ups_blur_buf[y];
-        }
+        lv_draw_blur_box(&sh_ups_buf[x], size, size, s_right, s_left, 1 << SHADOW_UPSCALE_SHIFT, sh_ups_blur_buf);
     }
 
     lv_mem_buf_release(sh_ups_blur_buf);
@@ -1249,9 +1236,6 @@ static void draw_full_border(const lv_area_t * area_inner, const lv_area_t * are
 
     }
 
-    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
-    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp);
-
     /*Get clipped fill area which is the real draw area.
      *It is always the same or inside `fill_area`*/
     lv_area_t draw_area;
@@ -1259,7 +1243,7 @@ static void draw_full_border(const lv_area_t * area_inner, const lv_area_t * are
     is_common = _lv_area_intersect(&draw_area, area_outer, clip);
     if(is_common == false) return;
 
-    const lv_area_t * disp_area = &draw_buf->area;
+    const lv_area_t * disp_area = &_lv_draw_target_get()->area;
 
     /*Now `draw_area` has absolute coordinates.
      *Make it relative to `disp_area` to simplify draw to `disp_buf`*/
@@ -1298,7 +1282,7 @@ static void draw_full_border(const lv_area_t * area_inner, const lv_area_t * are
         fill_area.y2 = fill_area.y1;
         for(h = draw_area.y1; h <= upper_corner_end; h++) {
             lv_memset_ff(mask_buf, draw_area_w);
-            mask_res = lv_draw_mask_apply(mask_buf, draw_buf->area.x1 + draw_area.x1, draw_buf->area.y1 + h, draw_area_w);
+            mask_res = lv_draw_mask_apply(mask_buf, disp_area->x1 + draw_area.x1, disp_area->y1 + h, draw_area_w);
 
             lv_area_t fill_area2;
             fill_area2.y1 = fill_area.y1;
@@ -1320,7 +1304,7 @@ static void draw_full_border(const lv_area_t * area_inner, const lv_area_t * are
             fill_area2.x1 = area_outer->x2 - rout + 1;
             fill_area2.x2 = area_outer->x2;
 
-            int32_t mask_ofs = (area_outer->x2 - rout + 1) - (draw_buf->area.x1 + draw_area.x1);
+            int32_t mask_ofs = (area_outer->x2 - rout + 1) - (disp_area->x1 + draw_area.x1);
             if(mask_ofs < 0) mask_ofs = 0;
             _lv_blend_fill(clip, &fill_area2, color, mask_buf + mask_ofs, mask_res, opa, blend_mode);
 
@@ -1335,7 +1319,7 @@ static void draw_full_border(const lv_area_t * area_inner, const lv_area_t * are
         fill_area.y2 = fill_area.y1;
         for(h = lower_corner_end; h <= draw_area.y2; h++) {
             lv_memset_ff(mask_buf, draw_area_w);
-            mask_res = lv_draw_mask_apply(mask_buf, draw_buf->area.x1 + draw_area.x1, draw_buf->area.y1 + h, draw_area_w);
+            mask_res = lv_draw_mask_apply(mask_buf, disp_area->x1 + draw_area.x1, disp_area->y1 + h, draw_area_w);
 
             lv_area_t fill_area2;
             fill_area2.x1 = area_outer->x1;
@@ -1355,7 +1339,7 @@ static void draw_full_border(const lv_area_t * area_inner, const lv_area_t * are
             fill_area2.x1 = area_outer->x2 - rout + 1;
             fill_area2.x2 = area_outer->x2;
 
-            int32_t mask_ofs = (area_outer->x2 - rout + 1) - (draw_buf->area.x1 + draw_area.x1);
+            int32_t mask_ofs = (area_outer->x2 - rout + 1) - (disp_area->x1 + draw_area.x1);
             if(mask_ofs < 0) mask_ofs = 0;
             _lv_blend_fill(clip, &fill_area2, color, mask_buf + mask_ofs, mask_res, opa, blend_mode);
 
@@ -1386,7 +1370,7 @@ static void draw_full_border(const lv_area_t * area_inner, const lv_area_t * are
 
         for(h = draw_area.y1; h <= draw_area.y2; h++) {
             lv_memset_ff(mask_buf, draw_area_w);
-            mask_res = lv_draw_mask_apply(mask_buf, draw_buf->area.x1 + draw_area.x1, draw_buf->area.y1 + h, draw_area_w);
+            mask_res = lv_draw_mask_apply(mask_buf, disp_area->x1 + draw_area.x1, disp_area->y1 + h, draw_area_w);
 
             _lv_blend_fill(clip, &fill_area, color, mask_buf, mask_res, opa, blend_mode);
             fill_area.y1++;
@@ -0,0 +1,80 @@
+/**
+ * @file lv_draw_target.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_target.h"
+#include "../misc/lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_draw_target_t * target_act;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_target_init(lv_draw_target_t * target, void * buf, const lv_area_t * area, lv_img_cf_t cf)
+{
+    lv_memset_00(target, sizeof(lv_draw_target_t));
+    target->buf = buf;
+    lv_area_copy(&target->area, area);
+    target->cf = cf;
+    target->antialiasing = LV_COLOR_DEPTH > 8 ? 1 : 0;
+}
+
+lv_draw_target_t * _lv_draw_target_set(lv_draw_target_t * target)
+{
+    lv_draw_target_t * target_ori = target_act;
+    target_act = target;
+    return target_ori;
+}
+
+lv_draw_target_t * _lv_draw_target_get(void)
+{
+    return target_act;
+}
+
+bool _lv_draw_target_is_direct(const lv_draw_target_t * target)
+{
+    if(target->cf != LV_IMG_CF_TRUE_COLOR && target->cf != LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED) return false;
+    if(target->drv && target->drv->set_px_cb) return false;
+    return true;
+}
+
+lv_coord_t _lv_draw_target_get_hor_res(const lv_draw_target_t * target)
+{
+    if(target->drv == NULL) return lv_area_get_width(&target->area);
+
+    switch(target->drv->rotated) {
+        case LV_DISP_ROT_90:
+        case LV_DISP_ROT_270:
+            return target->drv->ver_res;
+        default:
+            return target->drv->hor_res;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
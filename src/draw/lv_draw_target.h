@@ -0,0 +1,92 @@
+/**
+ * @file lv_draw_target.h
+ *
+ */
+
+#ifndef LV_DRAW_TARGET_H
+#define LV_DRAW_TARGET_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "../misc/lv_color.h"
+#include "../misc/lv_area.h"
+#include "../hal/lv_hal_disp.h"
+#include "lv_img_buf.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * A buffer the draw functions render into.
+ * While a display is refreshed it's the display's draw buffer.
+ * Other buffers (e.g. a canvas) can be rendered directly by setting them with `_lv_draw_target_set()`.
+ */
+typedef struct _lv_draw_target_t {
+    void * buf;                     /**< The pixels in `cf` format. A row is as wide as `area`*/
+    lv_area_t area;                 /**< Area of `buf` in absolute coordinates*/
+    lv_img_cf_t cf;                 /**< Color format of `buf`. TRUE_COLOR(_CHROMA_KEYED), TRUE_COLOR_ALPHA and ALPHA_1/2/4/8BIT are supported*/
+    struct _lv_disp_drv_t * drv;    /**< The display driver if `buf` is its draw buffer, else `NULL`.
+                                         Its `set_px_cb`, GPU callbacks and draw backend are used only in this case.*/
+    uint8_t antialiasing : 1;       /**< 1: anti-alias the edges*/
+} lv_draw_target_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize a draw target to render into a buffer which doesn't belong to a display
+ * @param target    pointer to a target to initialize
+ * @param buf       the buffer to render into
+ * @param area      area of the buffer in absolute coordinates
+ * @param cf        color format of `buf`
+ */
+void lv_draw_target_init(lv_draw_target_t * target, void * buf, const lv_area_t * area, lv_img_cf_t cf);
+
+/**
+ * Make the draw functions render to a target
+ * @param target    pointer to an initialized target
+ * @return          the previous target to restore it when drawing is finished
+ */
+lv_draw_target_t * _lv_draw_target_set(lv_draw_target_t * target);
+
+/**
+ * Get the target the draw functions render to
+ * @return          pointer to the current target
+ */
+lv_draw_target_t * _lv_draw_target_get(void);
+
+/**
+ * Tell whether the pixels of a target are `lv_color_t`s which can be written directly (without `set_px_cb`)
+ * @param target    pointer to a target
+ * @return          true: `buf` can be written as an `lv_color_t` array
+ */
+bool _lv_draw_target_is_direct(const lv_draw_target_t * target);
+
+/**
+ * Get the horizontal resolution of the target to size the line buffers of the draw functions
+ * @param target    pointer to a target
+ * @return          the horizontal resolution of the display or the width of the buffer if it's not a display's
+ */
+lv_coord_t _lv_draw_target_get_hor_res(const lv_draw_target_t * target);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_TARGET_H*/
@@ -16,6 +16,8 @@
 /*********************
  *      DEFINES
  *********************/
+#undef LV_MEM_FILE_TAG
+#define LV_MEM_FILE_TAG LV_MEM_TAG_IMG_CACHE
 /*Decrement life with this value on every open*/
 #define LV_IMG_CACHE_AGING 1
 
@@ -120,7 +122,10 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
 #endif
     /*Open the image and measure the time to open*/
     uint32_t t_start  = lv_tick_get();
+    /*The decoders allocate the cached data*/
+    LV_MEM_TAG_PUSH(LV_MEM_TAG_IMG_CACHE);
     lv_res_t open_res = lv_img_decoder_open(&cached_src->dec_dsc, src, color, frame_id);
+    LV_MEM_TAG_POP();
     if(open_res == LV_RES_INV) {
         LV_LOG_WARN("Image draw cannot open the image resource");
         lv_memset_00(cached_src, sizeof(_lv_img_cache_entry_t));
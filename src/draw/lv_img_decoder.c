@@ -11,10 +11,13 @@
 #include "../draw/lv_draw_img.h"
 #include "../misc/lv_ll.h"
 #include "../misc/lv_gc.h"
+#include "../misc/lv_trace.h"
 
 /*********************
  *      DEFINES
  *********************/
+#undef LV_MEM_FILE_TAG
+#define LV_MEM_FILE_TAG LV_MEM_TAG_IMG_CACHE
 #define CF_BUILT_IN_FIRST LV_IMG_CF_TRUE_COLOR
 #define CF_BUILT_IN_LAST LV_IMG_CF_ALPHA_8BIT
 
@@ -129,7 +132,9 @@ lv_res_t lv_img_decoder_open(lv_img_decoder_dsc_t * dsc, const void * src, lv_co
         if(res != LV_RES_OK) continue;
 
         dsc->decoder = decoder;
+        LV_TRACE_BEGIN("img_decode");
         res = decoder->open_cb(decoder, dsc);
+        LV_TRACE_END("img_decode");
 
         /*Opened successfully. It is a good decoder to for this image source*/
         if(res == LV_RES_OK) return res;
@@ -391,10 +391,11 @@ static void calc(lv_obj_t * cont, _lv_grid_calc_t * calc_out)
  */
 static void calc_free(_lv_grid_calc_t * calc)
 {
-    lv_mem_buf_release(calc->x);
-    lv_mem_buf_release(calc->y);
+    /*Release in the reverse order of `calc_rows` and `calc_cols`*/
     lv_mem_buf_release(calc->w);
+    lv_mem_buf_release(calc->x);
     lv_mem_buf_release(calc->h);
+    lv_mem_buf_release(calc->y);
 }
 
 static void calc_cols(lv_obj_t * cont, _lv_grid_calc_t * c)
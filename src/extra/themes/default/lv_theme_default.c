@@ -160,6 +160,11 @@ typedef enum {
  **********************/
 static void theme_apply(lv_theme_t * th, lv_obj_t * obj);
 static void style_init_reset(lv_style_t * style);
+static lv_color_t dark_color_filter_cb(const lv_color_filter_dsc_t * f, lv_color_t c, lv_opa_t opa);
+static lv_color_t grey_filter_cb(const lv_color_filter_dsc_t * f, lv_color_t color, lv_opa_t opa);
+#if LV_THEME_DEFAULT_CONST
+static void style_set_const(lv_style_t * style, const lv_style_t * const_style);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -173,6 +178,30 @@ static lv_color_t color_text;
 static lv_color_t color_card;
 static lv_color_t color_grey;
 
+static const lv_style_prop_t trans_props[] = {
+        LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR,
+        LV_STYLE_TRANSFORM_WIDTH, LV_STYLE_TRANSFORM_HEIGHT,
+        LV_STYLE_TRANSLATE_Y, LV_STYLE_TRANSLATE_X,
+        LV_STYLE_TRANSFORM_ZOOM, LV_STYLE_TRANSFORM_ANGLE,
+        LV_STYLE_COLOR_FILTER_OPA, LV_STYLE_COLOR_FILTER_DSC,
+        0
+};
+
+static const lv_style_transition_dsc_t trans_delayed = {
+    .props = trans_props, .path_xcb = lv_anim_path_linear, .time = TRANSITION_TIME, .delay = 70
+};
+
+static const lv_style_transition_dsc_t trans_normal = {
+    .props = trans_props, .path_xcb = lv_anim_path_linear, .time = TRANSITION_TIME, .delay = 0
+};
+
+static const lv_color_filter_dsc_t dark_filter = { .filter_cb = dark_color_filter_cb };
+static const lv_color_filter_dsc_t grey_filter = { .filter_cb = grey_filter_cb };
+
+#if LV_THEME_DEFAULT_CONST
+/*The constant styles and `style_init_const()`*/
+#include "lv_theme_default_styles.h"
+#endif
 
 /**********************
  *      MACROS
@@ -196,27 +225,101 @@ static lv_color_t grey_filter_cb(const lv_color_filter_dsc_t * f, lv_color_t col
     else return lv_color_mix(lv_palette_lighten(LV_PALETTE_GREY, 2), color, opa);
 }
 
-static void style_init(void)
+static void style_init_color(void)
 {
-    static const lv_style_prop_t trans_props[] = {
-            LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR,
-            LV_STYLE_TRANSFORM_WIDTH, LV_STYLE_TRANSFORM_HEIGHT,
-            LV_STYLE_TRANSLATE_Y, LV_STYLE_TRANSLATE_X,
-            LV_STYLE_TRANSFORM_ZOOM, LV_STYLE_TRANSFORM_ANGLE,
-            LV_STYLE_COLOR_FILTER_OPA, LV_STYLE_COLOR_FILTER_DSC,
-            0
-    };
+    style_init_reset(&styles->outline_primary);
+    lv_style_set_outline_color(&styles->outline_primary, theme.color_primary);
+    lv_style_set_outline_width(&styles->outline_primary, OUTLINE_WIDTH);
+    lv_style_set_outline_pad(&styles->outline_primary, OUTLINE_WIDTH);
+    lv_style_set_outline_opa(&styles->outline_primary, LV_OPA_50);
+
+    style_init_reset(&styles->outline_secondary);
+    lv_style_set_outline_color(&styles->outline_secondary, theme.color_secondary);
+    lv_style_set_outline_width(&styles->outline_secondary, OUTLINE_WIDTH);
+    lv_style_set_outline_opa(&styles->outline_secondary, LV_OPA_50);
+
+    style_init_reset(&styles->bg_color_primary);
+    lv_style_set_bg_color(&styles->bg_color_primary, theme.color_primary);
+    lv_style_set_text_color(&styles->bg_color_primary, lv_color_white());
+    lv_style_set_bg_opa(&styles->bg_color_primary, LV_OPA_COVER);
+
+    style_init_reset(&styles->bg_color_primary_muted);
+    lv_style_set_bg_color(&styles->bg_color_primary_muted, theme.color_primary);
+    lv_style_set_text_color(&styles->bg_color_primary_muted, theme.color_primary);
+    lv_style_set_bg_opa(&styles->bg_color_primary_muted, LV_OPA_20);
+
+    style_init_reset(&styles->bg_color_secondary);
+    lv_style_set_bg_color(&styles->bg_color_secondary, theme.color_secondary);
+    lv_style_set_text_color(&styles->bg_color_secondary, lv_color_white());
+    lv_style_set_bg_opa(&styles->bg_color_secondary, LV_OPA_COVER);
+
+    style_init_reset(&styles->bg_color_secondary_muted);
+    lv_style_set_bg_color(&styles->bg_color_secondary_muted, theme.color_secondary);
+    lv_style_set_text_color(&styles->bg_color_secondary_muted, theme.color_secondary);
+    lv_style_set_bg_opa(&styles->bg_color_secondary_muted, LV_OPA_20);
+
+    style_init_reset(&styles->knob);
+    lv_style_set_bg_color(&styles->knob, theme.color_primary);
+    lv_style_set_bg_opa(&styles->knob, LV_OPA_COVER);
+    lv_style_set_pad_all(&styles->knob, lv_disp_dpx(theme.disp, 6));
+    lv_style_set_radius(&styles->knob, LV_RADIUS_CIRCLE);
+
+#if LV_USE_ARC
+    style_init_reset(&styles->arc_indic_primary);
+    lv_style_set_arc_color(&styles->arc_indic_primary, theme.color_primary);
+#endif
+
+#if LV_USE_CHECKBOX
+    style_init_reset(&styles->cb_marker);
+    lv_style_set_pad_all(&styles->cb_marker, lv_disp_dpx(theme.disp, 3));
+    lv_style_set_border_width(&styles->cb_marker, BORDER_WIDTH);
+    lv_style_set_border_color(&styles->cb_marker, theme.color_primary);
+    lv_style_set_bg_color(&styles->cb_marker, color_card);
+    lv_style_set_bg_opa(&styles->cb_marker, LV_OPA_COVER);
+    lv_style_set_radius(&styles->cb_marker, RADIUS_DEFAULT / 2);
 
+    style_init_reset(&styles->cb_marker_checked);
+    lv_style_set_bg_img_src(&styles->cb_marker_checked, LV_SYMBOL_OK);
+    lv_style_set_text_color(&styles->cb_marker_checked, lv_color_white());
+    lv_style_set_text_font(&styles->cb_marker_checked, theme.font_small);
+#endif
+
+#if LV_USE_CHART
+    style_init_reset(&styles->chart_indic);
+    lv_style_set_radius(&styles->chart_indic,LV_RADIUS_CIRCLE);
+    lv_style_set_size(&styles->chart_indic, lv_disp_dpx(theme.disp, 8));
+    lv_style_set_bg_color(&styles->chart_indic, theme.color_primary);
+    lv_style_set_bg_opa(&styles->chart_indic, LV_OPA_COVER);
+#endif
+
+#if LV_USE_TABVIEW
+    style_init_reset(&styles->tab_btn);
+    lv_style_set_border_color(&styles->tab_btn, theme.color_primary);
+    lv_style_set_border_width(&styles->tab_btn, BORDER_WIDTH * 2);
+    lv_style_set_border_side(&styles->tab_btn, LV_BORDER_SIDE_BOTTOM);
+#endif
+}
+
+static void style_init(void)
+{
     color_scr = theme.flags & MODE_DARK ? DARK_COLOR_SCR : LIGHT_COLOR_SCR;
     color_text = theme.flags & MODE_DARK ? DARK_COLOR_TEXT : LIGHT_COLOR_TEXT;
     color_card = theme.flags & MODE_DARK ? DARK_COLOR_CARD : LIGHT_COLOR_CARD;
     color_grey = theme.flags & MODE_DARK ? DARK_COLOR_GREY : LIGHT_COLOR_GREY;
 
-    static lv_style_transition_dsc_t trans_delayed;
-    lv_style_transition_dsc_init(&trans_delayed, trans_props, lv_anim_path_linear, TRANSITION_TIME, 70, NULL);
+    /*The styles using the primary and secondary colors and the fonts of the theme can't be constant*/
+    style_init_color();
 
-    static lv_style_transition_dsc_t trans_normal;
-    lv_style_transition_dsc_init(&trans_normal, trans_props, lv_anim_path_linear, TRANSITION_TIME, 0, NULL);
+#if LV_THEME_DEFAULT_CONST
+    /*The constant styles are generated for LV_DPI_DEF*/
+    if(lv_disp_get_dpi(theme.disp) == LV_DPI_DEF) {
+        uint32_t mode = (theme.flags & MODE_DARK) ? CONST_STYLE_MODE_DARK : CONST_STYLE_MODE_LIGHT;
+        uint32_t size = disp_size == DISP_LARGE ? CONST_STYLE_SIZE_LARGE :
+                        disp_size == DISP_MEDIUM ? CONST_STYLE_SIZE_MEDIUM : CONST_STYLE_SIZE_SMALL;
+        style_init_const(CONST_STYLE_VARIANT(mode, size));
+        return;
+    }
+#endif
 
     style_init_reset(&styles->transition_delayed);
     lv_style_set_transition(&styles->transition_delayed, &trans_delayed); /*Go back to default state with delay*/
@@ -257,17 +360,6 @@ static void style_init(void)
     lv_style_set_line_color(&styles->card, lv_palette_main(LV_PALETTE_GREY));
     lv_style_set_line_width(&styles->card, lv_disp_dpx(theme.disp, 1));
 
-    style_init_reset(&styles->outline_primary);
-    lv_style_set_outline_color(&styles->outline_primary, theme.color_primary);
-    lv_style_set_outline_width(&styles->outline_primary, OUTLINE_WIDTH);
-    lv_style_set_outline_pad(&styles->outline_primary, OUTLINE_WIDTH);
-    lv_style_set_outline_opa(&styles->outline_primary, LV_OPA_50);
-
-    style_init_reset(&styles->outline_secondary);
-    lv_style_set_outline_color(&styles->outline_secondary, theme.color_secondary);
-    lv_style_set_outline_width(&styles->outline_secondary, OUTLINE_WIDTH);
-    lv_style_set_outline_opa(&styles->outline_secondary, LV_OPA_50);
-
     style_init_reset(&styles->btn);
     lv_style_set_radius(&styles->btn, (disp_size == DISP_LARGE ? lv_disp_dpx(theme.disp, 16) : disp_size == DISP_MEDIUM ? lv_disp_dpx(theme.disp, 12) : lv_disp_dpx(theme.disp, 8)));
     lv_style_set_bg_opa(&styles->btn, LV_OPA_COVER);
@@ -283,12 +375,6 @@ static void style_init(void)
     lv_style_set_pad_column(&styles->btn, lv_disp_dpx(theme.disp, 5));
     lv_style_set_pad_row(&styles->btn, lv_disp_dpx(theme.disp, 5));
 
-    static lv_color_filter_dsc_t dark_filter;
-    lv_color_filter_dsc_init(&dark_filter, dark_color_filter_cb);
-
-    static lv_color_filter_dsc_t grey_filter;
-    lv_color_filter_dsc_init(&grey_filter, grey_filter_cb);
-
     style_init_reset(&styles->pressed);
     lv_style_set_color_filter_dsc(&styles->pressed, &dark_filter);
     lv_style_set_color_filter_opa(&styles->pressed, 35);
@@ -329,26 +415,6 @@ static void style_init(void)
     lv_style_set_pad_row(&styles->pad_tiny, PAD_TINY);
     lv_style_set_pad_column(&styles->pad_tiny, PAD_TINY);
 
-    style_init_reset(&styles->bg_color_primary);
-    lv_style_set_bg_color(&styles->bg_color_primary, theme.color_primary);
-    lv_style_set_text_color(&styles->bg_color_primary, lv_color_white());
-    lv_style_set_bg_opa(&styles->bg_color_primary, LV_OPA_COVER);
-
-    style_init_reset(&styles->bg_color_primary_muted);
-    lv_style_set_bg_color(&styles->bg_color_primary_muted, theme.color_primary);
-    lv_style_set_text_color(&styles->bg_color_primary_muted, theme.color_primary);
-    lv_style_set_bg_opa(&styles->bg_color_primary_muted, LV_OPA_20);
-
-    style_init_reset(&styles->bg_color_secondary);
-    lv_style_set_bg_color(&styles->bg_color_secondary, theme.color_secondary);
-    lv_style_set_text_color(&styles->bg_color_secondary, lv_color_white());
-    lv_style_set_bg_opa(&styles->bg_color_secondary, LV_OPA_COVER);
-
-    style_init_reset(&styles->bg_color_secondary_muted);
-    lv_style_set_bg_color(&styles->bg_color_secondary_muted, theme.color_secondary);
-    lv_style_set_text_color(&styles->bg_color_secondary_muted, theme.color_secondary);
-    lv_style_set_bg_opa(&styles->bg_color_secondary_muted, LV_OPA_20);
-
     style_init_reset(&styles->bg_color_grey);
     lv_style_set_bg_color(&styles->bg_color_grey, color_grey);
     lv_style_set_bg_opa(&styles->bg_color_grey, LV_OPA_COVER);
@@ -371,12 +437,6 @@ static void style_init(void)
     lv_style_set_transform_height(&styles->grow, lv_disp_dpx(theme.disp, 3));
 #endif
 
-    style_init_reset(&styles->knob);
-    lv_style_set_bg_color(&styles->knob, theme.color_primary);
-    lv_style_set_bg_opa(&styles->knob, LV_OPA_COVER);
-    lv_style_set_pad_all(&styles->knob, lv_disp_dpx(theme.disp, 6));
-    lv_style_set_radius(&styles->knob, LV_RADIUS_CIRCLE);
-
     style_init_reset(&styles->anim);
     lv_style_set_anim_time(&styles->anim, 200);
 
@@ -385,29 +445,12 @@ static void style_init(void)
     lv_style_set_arc_color(&styles->arc_indic, color_grey);
     lv_style_set_arc_width(&styles->arc_indic, lv_disp_dpx(theme.disp, 15));
     lv_style_set_arc_rounded(&styles->arc_indic, true);
-
-    style_init_reset(&styles->arc_indic_primary);
-    lv_style_set_arc_color(&styles->arc_indic_primary, theme.color_primary);
 #endif
 
 #if LV_USE_DROPDOWN
     style_init_reset(&styles->dropdown_list);
     lv_style_set_max_height(&styles->dropdown_list, LV_DPI_DEF * 2);
 #endif
-#if LV_USE_CHECKBOX
-    style_init_reset(&styles->cb_marker);
-    lv_style_set_pad_all(&styles->cb_marker, lv_disp_dpx(theme.disp, 3));
-    lv_style_set_border_width(&styles->cb_marker, BORDER_WIDTH);
-    lv_style_set_border_color(&styles->cb_marker, theme.color_primary);
-    lv_style_set_bg_color(&styles->cb_marker, color_card);
-    lv_style_set_bg_opa(&styles->cb_marker, LV_OPA_COVER);
-    lv_style_set_radius(&styles->cb_marker, RADIUS_DEFAULT / 2);
-
-    style_init_reset(&styles->cb_marker_checked);
-    lv_style_set_bg_img_src(&styles->cb_marker_checked, LV_SYMBOL_OK);
-    lv_style_set_text_color(&styles->cb_marker_checked, lv_color_white());
-    lv_style_set_text_font(&styles->cb_marker_checked, theme.font_small);
-#endif
 
 #if LV_USE_SWITCH
     style_init_reset(&styles->switch_knob);
@@ -433,12 +476,6 @@ static void style_init(void)
     lv_style_set_size(&styles->chart_series, lv_disp_dpx(theme.disp, 8));
     lv_style_set_pad_column(&styles->chart_series, lv_disp_dpx(theme.disp, 2));
 
-    style_init_reset(&styles->chart_indic);
-    lv_style_set_radius(&styles->chart_indic,LV_RADIUS_CIRCLE);
-    lv_style_set_size(&styles->chart_indic, lv_disp_dpx(theme.disp, 8));
-    lv_style_set_bg_color(&styles->chart_indic, theme.color_primary);
-    lv_style_set_bg_opa(&styles->chart_indic, LV_OPA_COVER);
-
     style_init_reset(&styles->chart_ticks);
     lv_style_set_line_width(&styles->chart_ticks, lv_disp_dpx(theme.disp, 1));
     lv_style_set_line_color(&styles->chart_ticks, color_text);
@@ -512,11 +549,6 @@ static void style_init(void)
 #endif
 
 #if LV_USE_TABVIEW
-    style_init_reset(&styles->tab_btn);
-    lv_style_set_border_color(&styles->tab_btn, theme.color_primary);
-    lv_style_set_border_width(&styles->tab_btn, BORDER_WIDTH * 2);
-    lv_style_set_border_side(&styles->tab_btn, LV_BORDER_SIDE_BOTTOM);
-
     style_init_reset(&styles->tab_bg_focus);
     lv_style_set_outline_pad(&styles->tab_bg_focus, -BORDER_WIDTH);
 #endif
@@ -995,8 +1027,22 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj)
 
 static void style_init_reset(lv_style_t * style)
 {
-    if(inited) lv_style_reset(style);
+    if(inited && !style->is_const) lv_style_reset(style);
     else lv_style_init(style);
 }
 
+#if LV_THEME_DEFAULT_CONST
+static void style_set_const(lv_style_t * style, const lv_style_t * const_style)
+{
+    /*Free the properties if the style was built in runtime earlier*/
+    if(inited && !style->is_const) lv_style_reset(style);
+    *style = *const_style;
+
+    /*The properties might be different than in the previous variant*/
+    style->is_const_copy = 1;
+    style->changed_flags = LV_STYLE_PROP_ANY;
+    _lv_style_mark_inherit_changed();
+}
+#endif
+
 #endif
@@ -0,0 +1,1442 @@
+/**
+ * @file lv_theme_default_styles.h
+ * Constant style tables generated by scripts/style_const_gen.py. Don't edit.
+ */
+
+#define DPX(n) _LV_DPX_CALC(LV_DPI_DEF, n)
+
+#define CONST_STYLE_MODE_LIGHT 0
+#define CONST_STYLE_MODE_DARK 1
+#define CONST_STYLE_SIZE_SMALL 0
+#define CONST_STYLE_SIZE_MEDIUM 1
+#define CONST_STYLE_SIZE_LARGE 2
+#define CONST_STYLE_VARIANT_CNT 6
+#define CONST_STYLE_VARIANT(mode, size) ((mode) * 3 + (size))
+
+static const lv_style_const_prop_t const_style_transition_delayed_props_0[] = {
+    LV_STYLE_CONST_TRANSITION((&trans_delayed)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_transition_delayed[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_transition_delayed_props_0, 0x40), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_transition_delayed_props_0, 0x40), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_transition_delayed_props_0, 0x40), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_transition_delayed_props_0, 0x40), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_transition_delayed_props_0, 0x40), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_transition_delayed_props_0, 0x40), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_transition_normal_props_0[] = {
+    LV_STYLE_CONST_TRANSITION((&trans_normal)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_transition_normal[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_transition_normal_props_0, 0x40), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_transition_normal_props_0, 0x40), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_transition_normal_props_0, 0x40), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_transition_normal_props_0, 0x40), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_transition_normal_props_0, 0x40), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_transition_normal_props_0, 0x40), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_scrollbar_props_0[] = {
+    LV_STYLE_CONST_WIDTH(DPX(5)),
+    LV_STYLE_CONST_HEIGHT(DPX(5)),
+    LV_STYLE_CONST_PAD_TOP(DPX(7)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(7)),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x9E, 0x9E, 0x9E)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_40),
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_TRANSITION((&trans_normal)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_scrollbar_props_1[] = {
+    LV_STYLE_CONST_WIDTH(DPX(5)),
+    LV_STYLE_CONST_HEIGHT(DPX(5)),
+    LV_STYLE_CONST_PAD_TOP(DPX(7)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(7)),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x61, 0x61, 0x61)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_40),
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_TRANSITION((&trans_normal)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_scrollbar[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_scrollbar_props_0, 0x47), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_scrollbar_props_0, 0x47), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_scrollbar_props_0, 0x47), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_scrollbar_props_1, 0x47), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_scrollbar_props_1, 0x47), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_scrollbar_props_1, 0x47), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_scrollbar_scrolled_props_0[] = {
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_scrollbar_scrolled[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_scrollbar_scrolled_props_0, 0x04), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_scrollbar_scrolled_props_0, 0x04), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_scrollbar_scrolled_props_0, 0x04), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_scrollbar_scrolled_props_0, 0x04), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_scrollbar_scrolled_props_0, 0x04), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_scrollbar_scrolled_props_0, 0x04), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_scr_props_0[] = {
+    LV_STYLE_CONST_PAD_ROW(((DPX(10)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(10)))),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xF5, 0xF5, 0xF5)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x21, 0x21, 0x21)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_scr_props_1[] = {
+    LV_STYLE_CONST_PAD_ROW(((DPX(12)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(12)))),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xF5, 0xF5, 0xF5)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x21, 0x21, 0x21)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_scr_props_2[] = {
+    LV_STYLE_CONST_PAD_ROW(((DPX(14)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(14)))),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xF5, 0xF5, 0xF5)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x21, 0x21, 0x21)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_scr_props_3[] = {
+    LV_STYLE_CONST_PAD_ROW(((DPX(10)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(10)))),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x15, 0x17, 0x1A)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xFA, 0xFA, 0xFA)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_scr_props_4[] = {
+    LV_STYLE_CONST_PAD_ROW(((DPX(12)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(12)))),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x15, 0x17, 0x1A)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xFA, 0xFA, 0xFA)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_scr_props_5[] = {
+    LV_STYLE_CONST_PAD_ROW(((DPX(14)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(14)))),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x15, 0x17, 0x1A)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xFA, 0xFA, 0xFA)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_scr[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_scr_props_0, 0x26), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_scr_props_1, 0x26), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_scr_props_2, 0x26), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_scr_props_3, 0x26), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_scr_props_4, 0x26), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_scr_props_5, 0x26), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_card_props_0[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(16)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(16)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(16)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(16)))),
+    LV_STYLE_CONST_PAD_ROW(((DPX(10)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(10)))),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0xE0, 0xE0, 0xE0)),
+    LV_STYLE_CONST_BORDER_WIDTH(((DPX(2)))),
+    LV_STYLE_CONST_BORDER_POST(true),
+    LV_STYLE_CONST_LINE_WIDTH(DPX(1)),
+    LV_STYLE_CONST_LINE_COLOR(LV_COLOR_MAKE(0x9E, 0x9E, 0x9E)),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x21, 0x21, 0x21)),
+    LV_STYLE_CONST_RADIUS(((DPX(8)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_card_props_1[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(20)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(20)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(20)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(20)))),
+    LV_STYLE_CONST_PAD_ROW(((DPX(12)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(12)))),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0xE0, 0xE0, 0xE0)),
+    LV_STYLE_CONST_BORDER_WIDTH(((DPX(2)))),
+    LV_STYLE_CONST_BORDER_POST(true),
+    LV_STYLE_CONST_LINE_WIDTH(DPX(1)),
+    LV_STYLE_CONST_LINE_COLOR(LV_COLOR_MAKE(0x9E, 0x9E, 0x9E)),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x21, 0x21, 0x21)),
+    LV_STYLE_CONST_RADIUS(((DPX(8)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_card_props_2[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(24)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(24)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(24)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(24)))),
+    LV_STYLE_CONST_PAD_ROW(((DPX(14)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(14)))),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0xE0, 0xE0, 0xE0)),
+    LV_STYLE_CONST_BORDER_WIDTH(((DPX(2)))),
+    LV_STYLE_CONST_BORDER_POST(true),
+    LV_STYLE_CONST_LINE_WIDTH(DPX(1)),
+    LV_STYLE_CONST_LINE_COLOR(LV_COLOR_MAKE(0x9E, 0x9E, 0x9E)),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x21, 0x21, 0x21)),
+    LV_STYLE_CONST_RADIUS(((DPX(12)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_card_props_3[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(16)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(16)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(16)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(16)))),
+    LV_STYLE_CONST_PAD_ROW(((DPX(10)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(10)))),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x28, 0x2B, 0x30)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x2F, 0x32, 0x37)),
+    LV_STYLE_CONST_BORDER_WIDTH(((DPX(2)))),
+    LV_STYLE_CONST_BORDER_POST(true),
+    LV_STYLE_CONST_LINE_WIDTH(DPX(1)),
+    LV_STYLE_CONST_LINE_COLOR(LV_COLOR_MAKE(0x9E, 0x9E, 0x9E)),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xFA, 0xFA, 0xFA)),
+    LV_STYLE_CONST_RADIUS(((DPX(8)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_card_props_4[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(20)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(20)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(20)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(20)))),
+    LV_STYLE_CONST_PAD_ROW(((DPX(12)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(12)))),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x28, 0x2B, 0x30)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x2F, 0x32, 0x37)),
+    LV_STYLE_CONST_BORDER_WIDTH(((DPX(2)))),
+    LV_STYLE_CONST_BORDER_POST(true),
+    LV_STYLE_CONST_LINE_WIDTH(DPX(1)),
+    LV_STYLE_CONST_LINE_COLOR(LV_COLOR_MAKE(0x9E, 0x9E, 0x9E)),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xFA, 0xFA, 0xFA)),
+    LV_STYLE_CONST_RADIUS(((DPX(8)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_card_props_5[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(24)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(24)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(24)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(24)))),
+    LV_STYLE_CONST_PAD_ROW(((DPX(14)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(14)))),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x28, 0x2B, 0x30)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x2F, 0x32, 0x37)),
+    LV_STYLE_CONST_BORDER_WIDTH(((DPX(2)))),
+    LV_STYLE_CONST_BORDER_POST(true),
+    LV_STYLE_CONST_LINE_WIDTH(DPX(1)),
+    LV_STYLE_CONST_LINE_COLOR(LV_COLOR_MAKE(0x9E, 0x9E, 0x9E)),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xFA, 0xFA, 0xFA)),
+    LV_STYLE_CONST_RADIUS(((DPX(12)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_card[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_card_props_0, 0x7E), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_card_props_1, 0x7E), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_card_props_2, 0x7E), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_card_props_3, 0x7E), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_card_props_4, 0x7E), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_card_props_5, 0x7E), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_btn_props_0[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(10)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(10)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(16)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(16)))),
+    LV_STYLE_CONST_PAD_ROW(DPX(5)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(5)),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xE0, 0xE0, 0xE0)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_SHADOW_WIDTH(1),
+    LV_STYLE_CONST_SHADOW_OFS_Y(DPX(4)),
+    LV_STYLE_CONST_SHADOW_COLOR(LV_COLOR_MAKE(0xEE, 0xEE, 0xEE)),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x21, 0x21, 0x21)),
+    LV_STYLE_CONST_RADIUS(DPX(8)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_btn_props_1[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(12)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(12)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(20)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(20)))),
+    LV_STYLE_CONST_PAD_ROW(DPX(5)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(5)),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xE0, 0xE0, 0xE0)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_SHADOW_WIDTH(1),
+    LV_STYLE_CONST_SHADOW_OFS_Y(DPX(4)),
+    LV_STYLE_CONST_SHADOW_COLOR(LV_COLOR_MAKE(0xEE, 0xEE, 0xEE)),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x21, 0x21, 0x21)),
+    LV_STYLE_CONST_RADIUS(DPX(12)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_btn_props_2[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(14)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(14)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(24)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(24)))),
+    LV_STYLE_CONST_PAD_ROW(DPX(5)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(5)),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xE0, 0xE0, 0xE0)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_SHADOW_WIDTH(1),
+    LV_STYLE_CONST_SHADOW_OFS_Y(DPX(4)),
+    LV_STYLE_CONST_SHADOW_COLOR(LV_COLOR_MAKE(0xEE, 0xEE, 0xEE)),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x21, 0x21, 0x21)),
+    LV_STYLE_CONST_RADIUS(DPX(16)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_btn_props_3[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(10)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(10)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(16)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(16)))),
+    LV_STYLE_CONST_PAD_ROW(DPX(5)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(5)),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x2F, 0x32, 0x37)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xFA, 0xFA, 0xFA)),
+    LV_STYLE_CONST_RADIUS(DPX(8)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_btn_props_4[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(12)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(12)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(20)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(20)))),
+    LV_STYLE_CONST_PAD_ROW(DPX(5)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(5)),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x2F, 0x32, 0x37)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xFA, 0xFA, 0xFA)),
+    LV_STYLE_CONST_RADIUS(DPX(12)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_btn_props_5[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(14)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(14)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(24)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(24)))),
+    LV_STYLE_CONST_PAD_ROW(DPX(5)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(5)),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x2F, 0x32, 0x37)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xFA, 0xFA, 0xFA)),
+    LV_STYLE_CONST_RADIUS(DPX(16)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_btn[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_btn_props_0, 0x76), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_btn_props_1, 0x76), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_btn_props_2, 0x76), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_btn_props_3, 0x66), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_btn_props_4, 0x66), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_btn_props_5, 0x66), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_pressed_props_0[] = {
+    LV_STYLE_CONST_COLOR_FILTER_DSC((&dark_filter)),
+    LV_STYLE_CONST_COLOR_FILTER_OPA(35),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_pressed[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_pressed_props_0, 0x40), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pressed_props_0, 0x40), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pressed_props_0, 0x40), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pressed_props_0, 0x40), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pressed_props_0, 0x40), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pressed_props_0, 0x40), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_disabled_props_0[] = {
+    LV_STYLE_CONST_COLOR_FILTER_DSC((&grey_filter)),
+    LV_STYLE_CONST_COLOR_FILTER_OPA(LV_OPA_50),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_disabled[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_disabled_props_0, 0x40), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_disabled_props_0, 0x40), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_disabled_props_0, 0x40), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_disabled_props_0, 0x40), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_disabled_props_0, 0x40), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_disabled_props_0, 0x40), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_clip_corner_props_0[] = {
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_clip_corner[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_clip_corner_props_0, 0x40), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_clip_corner_props_0, 0x40), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_clip_corner_props_0, 0x40), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_clip_corner_props_0, 0x40), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_clip_corner_props_0, 0x40), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_clip_corner_props_0, 0x40), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_pad_normal_props_0[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(16)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(16)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(16)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(16)))),
+    LV_STYLE_CONST_PAD_ROW(((DPX(16)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(16)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_pad_normal_props_1[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(20)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(20)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(20)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(20)))),
+    LV_STYLE_CONST_PAD_ROW(((DPX(20)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(20)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_pad_normal_props_2[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(24)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(24)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(24)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(24)))),
+    LV_STYLE_CONST_PAD_ROW(((DPX(24)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(24)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_pad_normal[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_normal_props_0, 0x02), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_normal_props_1, 0x02), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_normal_props_2, 0x02), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_normal_props_0, 0x02), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_normal_props_1, 0x02), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_normal_props_2, 0x02), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_pad_small_props_0[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(10)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(10)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(10)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(10)))),
+    LV_STYLE_CONST_PAD_ROW(((DPX(10)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(10)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_pad_small_props_1[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(12)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(12)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(12)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(12)))),
+    LV_STYLE_CONST_PAD_ROW(((DPX(12)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(12)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_pad_small_props_2[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(14)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(14)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(14)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(14)))),
+    LV_STYLE_CONST_PAD_ROW(((DPX(14)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(14)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_pad_small[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_small_props_0, 0x02), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_small_props_1, 0x02), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_small_props_2, 0x02), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_small_props_0, 0x02), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_small_props_1, 0x02), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_small_props_2, 0x02), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_pad_gap_props_0[] = {
+    LV_STYLE_CONST_PAD_ROW(DPX(10)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(10)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_pad_gap[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_gap_props_0, 0x02), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_gap_props_0, 0x02), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_gap_props_0, 0x02), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_gap_props_0, 0x02), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_gap_props_0, 0x02), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_gap_props_0, 0x02), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_line_space_large_props_0[] = {
+    LV_STYLE_CONST_TEXT_LINE_SPACE(DPX(20)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_line_space_large[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_line_space_large_props_0, 0x20), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_line_space_large_props_0, 0x20), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_line_space_large_props_0, 0x20), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_line_space_large_props_0, 0x20), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_line_space_large_props_0, 0x20), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_line_space_large_props_0, 0x20), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_text_align_center_props_0[] = {
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_text_align_center[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_text_align_center_props_0, 0x20), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_text_align_center_props_0, 0x20), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_text_align_center_props_0, 0x20), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_text_align_center_props_0, 0x20), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_text_align_center_props_0, 0x20), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_text_align_center_props_0, 0x20), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_pad_zero_props_0[] = {
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_pad_zero[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_zero_props_0, 0x02), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_zero_props_0, 0x02), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_zero_props_0, 0x02), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_zero_props_0, 0x02), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_zero_props_0, 0x02), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_zero_props_0, 0x02), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_pad_tiny_props_0[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(2)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(2)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(2)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(2)))),
+    LV_STYLE_CONST_PAD_ROW(((DPX(2)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(2)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_pad_tiny_props_1[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(6)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(6)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(6)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(6)))),
+    LV_STYLE_CONST_PAD_ROW(((DPX(6)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(6)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_pad_tiny_props_2[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(8)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(8)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(8)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(8)))),
+    LV_STYLE_CONST_PAD_ROW(((DPX(8)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(8)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_pad_tiny[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_tiny_props_0, 0x02), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_tiny_props_1, 0x02), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_tiny_props_2, 0x02), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_tiny_props_0, 0x02), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_tiny_props_1, 0x02), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_pad_tiny_props_2, 0x02), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_bg_color_grey_props_0[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xE0, 0xE0, 0xE0)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x21, 0x21, 0x21)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_bg_color_grey_props_1[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x2F, 0x32, 0x37)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xFA, 0xFA, 0xFA)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_bg_color_grey[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_bg_color_grey_props_0, 0x24), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_bg_color_grey_props_0, 0x24), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_bg_color_grey_props_0, 0x24), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_bg_color_grey_props_1, 0x24), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_bg_color_grey_props_1, 0x24), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_bg_color_grey_props_1, 0x24), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_bg_color_white_props_0[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x21, 0x21, 0x21)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_bg_color_white_props_1[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x28, 0x2B, 0x30)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xFA, 0xFA, 0xFA)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_bg_color_white[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_bg_color_white_props_0, 0x24), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_bg_color_white_props_0, 0x24), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_bg_color_white_props_0, 0x24), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_bg_color_white_props_1, 0x24), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_bg_color_white_props_1, 0x24), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_bg_color_white_props_1, 0x24), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_circle_props_0[] = {
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_circle[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_circle_props_0, 0x40), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_circle_props_0, 0x40), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_circle_props_0, 0x40), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_circle_props_0, 0x40), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_circle_props_0, 0x40), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_circle_props_0, 0x40), /*dark, large*/
+};
+
+static const lv_style_const_prop_t const_style_no_radius_props_0[] = {
+    LV_STYLE_CONST_RADIUS(0),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_no_radius[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_no_radius_props_0, 0x40), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_no_radius_props_0, 0x40), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_no_radius_props_0, 0x40), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_no_radius_props_0, 0x40), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_no_radius_props_0, 0x40), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_no_radius_props_0, 0x40), /*dark, large*/
+};
+
+#if LV_THEME_DEFAULT_GROW
+static const lv_style_const_prop_t const_style_grow_props_0[] = {
+    LV_STYLE_CONST_TRANSFORM_WIDTH(DPX(3)),
+    LV_STYLE_CONST_TRANSFORM_HEIGHT(DPX(3)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_grow[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_grow_props_0, 0x01), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_grow_props_0, 0x01), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_grow_props_0, 0x01), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_grow_props_0, 0x01), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_grow_props_0, 0x01), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_grow_props_0, 0x01), /*dark, large*/
+};
+#endif
+
+static const lv_style_const_prop_t const_style_anim_props_0[] = {
+    LV_STYLE_CONST_ANIM_TIME(200),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_anim[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_anim_props_0, 0x40), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_anim_props_0, 0x40), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_anim_props_0, 0x40), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_anim_props_0, 0x40), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_anim_props_0, 0x40), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_anim_props_0, 0x40), /*dark, large*/
+};
+
+#if LV_USE_ARC
+static const lv_style_const_prop_t const_style_arc_indic_props_0[] = {
+    LV_STYLE_CONST_ARC_WIDTH(DPX(15)),
+    LV_STYLE_CONST_ARC_ROUNDED(true),
+    LV_STYLE_CONST_ARC_COLOR(LV_COLOR_MAKE(0xE0, 0xE0, 0xE0)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_arc_indic_props_1[] = {
+    LV_STYLE_CONST_ARC_WIDTH(DPX(15)),
+    LV_STYLE_CONST_ARC_ROUNDED(true),
+    LV_STYLE_CONST_ARC_COLOR(LV_COLOR_MAKE(0x2F, 0x32, 0x37)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_arc_indic[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_arc_indic_props_0, 0x20), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_arc_indic_props_0, 0x20), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_arc_indic_props_0, 0x20), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_arc_indic_props_1, 0x20), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_arc_indic_props_1, 0x20), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_arc_indic_props_1, 0x20), /*dark, large*/
+};
+#endif
+
+#if LV_USE_DROPDOWN
+static const lv_style_const_prop_t const_style_dropdown_list_props_0[] = {
+    LV_STYLE_CONST_MAX_HEIGHT((LV_DPI_DEF * 2)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_dropdown_list[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_dropdown_list_props_0, 0x01), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_dropdown_list_props_0, 0x01), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_dropdown_list_props_0, 0x01), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_dropdown_list_props_0, 0x01), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_dropdown_list_props_0, 0x01), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_dropdown_list_props_0, 0x01), /*dark, large*/
+};
+#endif
+
+#if LV_USE_SWITCH
+static const lv_style_const_prop_t const_style_switch_knob_props_0[] = {
+    LV_STYLE_CONST_PAD_TOP((-DPX(4))),
+    LV_STYLE_CONST_PAD_BOTTOM((-DPX(4))),
+    LV_STYLE_CONST_PAD_LEFT((-DPX(4))),
+    LV_STYLE_CONST_PAD_RIGHT((-DPX(4))),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_switch_knob[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_switch_knob_props_0, 0x06), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_switch_knob_props_0, 0x06), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_switch_knob_props_0, 0x06), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_switch_knob_props_0, 0x06), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_switch_knob_props_0, 0x06), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_switch_knob_props_0, 0x06), /*dark, large*/
+};
+#endif
+
+#if LV_USE_LINE
+static const lv_style_const_prop_t const_style_line_props_0[] = {
+    LV_STYLE_CONST_LINE_WIDTH(1),
+    LV_STYLE_CONST_LINE_COLOR(LV_COLOR_MAKE(0x21, 0x21, 0x21)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_line_props_1[] = {
+    LV_STYLE_CONST_LINE_WIDTH(1),
+    LV_STYLE_CONST_LINE_COLOR(LV_COLOR_MAKE(0xFA, 0xFA, 0xFA)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_line[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_line_props_0, 0x10), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_line_props_0, 0x10), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_line_props_0, 0x10), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_line_props_1, 0x10), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_line_props_1, 0x10), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_line_props_1, 0x10), /*dark, large*/
+};
+#endif
+
+#if LV_USE_CHART
+static const lv_style_const_prop_t const_style_chart_bg_props_0[] = {
+    LV_STYLE_CONST_PAD_COLUMN(DPX(10)),
+    LV_STYLE_CONST_BORDER_POST(false),
+    LV_STYLE_CONST_LINE_COLOR(LV_COLOR_MAKE(0xE0, 0xE0, 0xE0)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_chart_bg_props_1[] = {
+    LV_STYLE_CONST_PAD_COLUMN(DPX(10)),
+    LV_STYLE_CONST_BORDER_POST(false),
+    LV_STYLE_CONST_LINE_COLOR(LV_COLOR_MAKE(0x2F, 0x32, 0x37)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_chart_bg[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_chart_bg_props_0, 0x1A), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_chart_bg_props_0, 0x1A), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_chart_bg_props_0, 0x1A), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_chart_bg_props_1, 0x1A), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_chart_bg_props_1, 0x1A), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_chart_bg_props_1, 0x1A), /*dark, large*/
+};
+#endif
+
+#if LV_USE_CHART
+static const lv_style_const_prop_t const_style_chart_series_props_0[] = {
+    LV_STYLE_CONST_WIDTH(DPX(8)),
+    LV_STYLE_CONST_HEIGHT(DPX(8)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(2)),
+    LV_STYLE_CONST_LINE_WIDTH(DPX(3)),
+    LV_STYLE_CONST_RADIUS(DPX(3)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_chart_series[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_chart_series_props_0, 0x53), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_chart_series_props_0, 0x53), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_chart_series_props_0, 0x53), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_chart_series_props_0, 0x53), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_chart_series_props_0, 0x53), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_chart_series_props_0, 0x53), /*dark, large*/
+};
+#endif
+
+#if LV_USE_CHART
+static const lv_style_const_prop_t const_style_chart_ticks_props_0[] = {
+    LV_STYLE_CONST_PAD_TOP(DPX(2)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(2)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(2)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(2)),
+    LV_STYLE_CONST_LINE_WIDTH(DPX(1)),
+    LV_STYLE_CONST_LINE_COLOR(LV_COLOR_MAKE(0x21, 0x21, 0x21)),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x9E, 0x9E, 0x9E)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_chart_ticks_props_1[] = {
+    LV_STYLE_CONST_PAD_TOP(DPX(2)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(2)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(2)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(2)),
+    LV_STYLE_CONST_LINE_WIDTH(DPX(1)),
+    LV_STYLE_CONST_LINE_COLOR(LV_COLOR_MAKE(0xFA, 0xFA, 0xFA)),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x9E, 0x9E, 0x9E)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_chart_ticks[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_chart_ticks_props_0, 0x32), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_chart_ticks_props_0, 0x32), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_chart_ticks_props_0, 0x32), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_chart_ticks_props_1, 0x32), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_chart_ticks_props_1, 0x32), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_chart_ticks_props_1, 0x32), /*dark, large*/
+};
+#endif
+
+#if LV_USE_METER
+static const lv_style_const_prop_t const_style_meter_marker_props_0[] = {
+    LV_STYLE_CONST_WIDTH(DPX(20)),
+    LV_STYLE_CONST_HEIGHT(DPX(20)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(15)),
+    LV_STYLE_CONST_LINE_WIDTH(DPX(5)),
+    LV_STYLE_CONST_LINE_COLOR(LV_COLOR_MAKE(0x21, 0x21, 0x21)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_meter_marker_props_1[] = {
+    LV_STYLE_CONST_WIDTH(DPX(20)),
+    LV_STYLE_CONST_HEIGHT(DPX(20)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(15)),
+    LV_STYLE_CONST_LINE_WIDTH(DPX(5)),
+    LV_STYLE_CONST_LINE_COLOR(LV_COLOR_MAKE(0xFA, 0xFA, 0xFA)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_meter_marker[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_meter_marker_props_0, 0x13), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_meter_marker_props_0, 0x13), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_meter_marker_props_0, 0x13), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_meter_marker_props_1, 0x13), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_meter_marker_props_1, 0x13), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_meter_marker_props_1, 0x13), /*dark, large*/
+};
+#endif
+
+#if LV_USE_METER
+static const lv_style_const_prop_t const_style_meter_indic_props_0[] = {
+    LV_STYLE_CONST_WIDTH(DPX(15)),
+    LV_STYLE_CONST_HEIGHT(DPX(15)),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x21, 0x21, 0x21)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_meter_indic_props_1[] = {
+    LV_STYLE_CONST_WIDTH(DPX(15)),
+    LV_STYLE_CONST_HEIGHT(DPX(15)),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xFA, 0xFA, 0xFA)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_meter_indic[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_meter_indic_props_0, 0x45), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_meter_indic_props_0, 0x45), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_meter_indic_props_0, 0x45), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_meter_indic_props_1, 0x45), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_meter_indic_props_1, 0x45), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_meter_indic_props_1, 0x45), /*dark, large*/
+};
+#endif
+
+#if LV_USE_TABLE
+static const lv_style_const_prop_t const_style_table_cell_props_0[] = {
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0xE0, 0xE0, 0xE0)),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(1)),
+    LV_STYLE_CONST_BORDER_SIDE((LV_BORDER_SIDE_TOP | LV_BORDER_SIDE_BOTTOM)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_table_cell_props_1[] = {
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x2F, 0x32, 0x37)),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(1)),
+    LV_STYLE_CONST_BORDER_SIDE((LV_BORDER_SIDE_TOP | LV_BORDER_SIDE_BOTTOM)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_table_cell[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_table_cell_props_0, 0x08), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_table_cell_props_0, 0x08), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_table_cell_props_0, 0x08), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_table_cell_props_1, 0x08), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_table_cell_props_1, 0x08), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_table_cell_props_1, 0x08), /*dark, large*/
+};
+#endif
+
+#if LV_USE_TEXTAREA
+static const lv_style_const_prop_t const_style_ta_cursor_props_0[] = {
+    LV_STYLE_CONST_PAD_LEFT(DPX(1)),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x21, 0x21, 0x21)),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(2)),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_LEFT),
+    LV_STYLE_CONST_ANIM_TIME(400),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_ta_cursor_props_1[] = {
+    LV_STYLE_CONST_PAD_LEFT(DPX(1)),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0xFA, 0xFA, 0xFA)),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(2)),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_LEFT),
+    LV_STYLE_CONST_ANIM_TIME(400),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_ta_cursor[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_ta_cursor_props_0, 0x4A), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_ta_cursor_props_0, 0x4A), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_ta_cursor_props_0, 0x4A), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_ta_cursor_props_1, 0x4A), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_ta_cursor_props_1, 0x4A), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_ta_cursor_props_1, 0x4A), /*dark, large*/
+};
+#endif
+
+#if LV_USE_TEXTAREA
+static const lv_style_const_prop_t const_style_ta_placeholder_props_0[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xBD, 0xBD, 0xBD)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_ta_placeholder_props_1[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x61, 0x61, 0x61)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_ta_placeholder[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_ta_placeholder_props_0, 0x20), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_ta_placeholder_props_0, 0x20), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_ta_placeholder_props_0, 0x20), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_ta_placeholder_props_1, 0x20), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_ta_placeholder_props_1, 0x20), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_ta_placeholder_props_1, 0x20), /*dark, large*/
+};
+#endif
+
+#if LV_USE_CALENDAR
+static const lv_style_const_prop_t const_style_calendar_bg_props_0[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(10)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(10)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(10)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(10)))),
+    LV_STYLE_CONST_PAD_ROW(((DPX(10)) / 2)),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(10)) / 2)),
+    LV_STYLE_CONST_RADIUS(0),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_calendar_bg_props_1[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(12)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(12)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(12)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(12)))),
+    LV_STYLE_CONST_PAD_ROW(((DPX(12)) / 2)),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(12)) / 2)),
+    LV_STYLE_CONST_RADIUS(0),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_calendar_bg_props_2[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(14)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(14)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(14)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(14)))),
+    LV_STYLE_CONST_PAD_ROW(((DPX(14)) / 2)),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(14)) / 2)),
+    LV_STYLE_CONST_RADIUS(0),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_calendar_bg[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_calendar_bg_props_0, 0x42), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_calendar_bg_props_1, 0x42), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_calendar_bg_props_2, 0x42), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_calendar_bg_props_0, 0x42), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_calendar_bg_props_1, 0x42), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_calendar_bg_props_2, 0x42), /*dark, large*/
+};
+#endif
+
+#if LV_USE_CALENDAR
+static const lv_style_const_prop_t const_style_calendar_day_props_0[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_20),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0xE0, 0xE0, 0xE0)),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(1)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_calendar_day_props_1[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x28, 0x2B, 0x30)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_20),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x2F, 0x32, 0x37)),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(1)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_calendar_day[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_calendar_day_props_0, 0x0C), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_calendar_day_props_0, 0x0C), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_calendar_day_props_0, 0x0C), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_calendar_day_props_1, 0x0C), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_calendar_day_props_1, 0x0C), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_calendar_day_props_1, 0x0C), /*dark, large*/
+};
+#endif
+
+#if LV_USE_COLORWHEEL
+static const lv_style_const_prop_t const_style_colorwheel_main_props_0[] = {
+    LV_STYLE_CONST_ARC_WIDTH(DPX(10)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_colorwheel_main[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_colorwheel_main_props_0, 0x20), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_colorwheel_main_props_0, 0x20), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_colorwheel_main_props_0, 0x20), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_colorwheel_main_props_0, 0x20), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_colorwheel_main_props_0, 0x20), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_colorwheel_main_props_0, 0x20), /*dark, large*/
+};
+#endif
+
+#if LV_USE_MSGBOX
+static const lv_style_const_prop_t const_style_msgbox_btn_bg_props_0[] = {
+    LV_STYLE_CONST_PAD_TOP(DPX(4)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(4)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(4)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(4)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_msgbox_btn_bg[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_msgbox_btn_bg_props_0, 0x02), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_msgbox_btn_bg_props_0, 0x02), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_msgbox_btn_bg_props_0, 0x02), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_msgbox_btn_bg_props_0, 0x02), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_msgbox_btn_bg_props_0, 0x02), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_msgbox_btn_bg_props_0, 0x02), /*dark, large*/
+};
+#endif
+
+#if LV_USE_MSGBOX
+static const lv_style_const_prop_t const_style_msgbox_bg_props_0[] = {
+    LV_STYLE_CONST_MAX_WIDTH(LV_PCT(100)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_msgbox_bg[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_msgbox_bg_props_0, 0x01), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_msgbox_bg_props_0, 0x01), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_msgbox_bg_props_0, 0x01), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_msgbox_bg_props_0, 0x01), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_msgbox_bg_props_0, 0x01), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_msgbox_bg_props_0, 0x01), /*dark, large*/
+};
+#endif
+
+#if LV_USE_KEYBOARD
+static const lv_style_const_prop_t const_style_keyboard_btn_bg_props_0[] = {
+    LV_STYLE_CONST_SHADOW_WIDTH(0),
+    LV_STYLE_CONST_RADIUS(((DPX(8)) / 2)),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_keyboard_btn_bg_props_1[] = {
+    LV_STYLE_CONST_SHADOW_WIDTH(0),
+    LV_STYLE_CONST_RADIUS(((DPX(8)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_keyboard_btn_bg_props_2[] = {
+    LV_STYLE_CONST_SHADOW_WIDTH(0),
+    LV_STYLE_CONST_RADIUS(((DPX(12)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_keyboard_btn_bg[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_keyboard_btn_bg_props_0, 0x50), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_keyboard_btn_bg_props_1, 0x50), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_keyboard_btn_bg_props_2, 0x50), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_keyboard_btn_bg_props_0, 0x50), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_keyboard_btn_bg_props_1, 0x50), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_keyboard_btn_bg_props_2, 0x50), /*dark, large*/
+};
+#endif
+
+#if LV_USE_TABVIEW
+static const lv_style_const_prop_t const_style_tab_bg_focus_props_0[] = {
+    LV_STYLE_CONST_OUTLINE_PAD((-(DPX(2)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_tab_bg_focus[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_tab_bg_focus_props_0, 0x08), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_tab_bg_focus_props_0, 0x08), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_tab_bg_focus_props_0, 0x08), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_tab_bg_focus_props_0, 0x08), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_tab_bg_focus_props_0, 0x08), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_tab_bg_focus_props_0, 0x08), /*dark, large*/
+};
+#endif
+
+#if LV_USE_LIST
+static const lv_style_const_prop_t const_style_list_bg_props_0[] = {
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(16)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(16)))),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_list_bg_props_1[] = {
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(20)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(20)))),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_list_bg_props_2[] = {
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(24)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(24)))),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_list_bg[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_list_bg_props_0, 0x42), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_list_bg_props_1, 0x42), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_list_bg_props_2, 0x42), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_list_bg_props_0, 0x42), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_list_bg_props_1, 0x42), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_list_bg_props_2, 0x42), /*dark, large*/
+};
+#endif
+
+#if LV_USE_LIST
+static const lv_style_const_prop_t const_style_list_btn_props_0[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(10)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(10)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(10)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(10)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(10)))),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0xE0, 0xE0, 0xE0)),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(1)),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_BOTTOM),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_list_btn_props_1[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(12)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(12)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(12)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(12)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(12)))),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0xE0, 0xE0, 0xE0)),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(1)),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_BOTTOM),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_list_btn_props_2[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(14)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(14)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(14)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(14)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(14)))),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0xE0, 0xE0, 0xE0)),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(1)),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_BOTTOM),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_list_btn_props_3[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(10)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(10)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(10)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(10)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(10)))),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x2F, 0x32, 0x37)),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(1)),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_BOTTOM),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_list_btn_props_4[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(12)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(12)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(12)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(12)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(12)))),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x2F, 0x32, 0x37)),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(1)),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_BOTTOM),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_list_btn_props_5[] = {
+    LV_STYLE_CONST_PAD_TOP(((DPX(14)))),
+    LV_STYLE_CONST_PAD_BOTTOM(((DPX(14)))),
+    LV_STYLE_CONST_PAD_LEFT(((DPX(14)))),
+    LV_STYLE_CONST_PAD_RIGHT(((DPX(14)))),
+    LV_STYLE_CONST_PAD_COLUMN(((DPX(14)))),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x2F, 0x32, 0x37)),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(1)),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_BOTTOM),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_list_btn[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_list_btn_props_0, 0x0A), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_list_btn_props_1, 0x0A), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_list_btn_props_2, 0x0A), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_list_btn_props_3, 0x0A), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_list_btn_props_4, 0x0A), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_list_btn_props_5, 0x0A), /*dark, large*/
+};
+#endif
+
+#if LV_USE_LIST
+static const lv_style_const_prop_t const_style_list_item_grow_props_0[] = {
+    LV_STYLE_CONST_TRANSFORM_WIDTH(((DPX(16)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_list_item_grow_props_1[] = {
+    LV_STYLE_CONST_TRANSFORM_WIDTH(((DPX(20)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_const_prop_t const_style_list_item_grow_props_2[] = {
+    LV_STYLE_CONST_TRANSFORM_WIDTH(((DPX(24)))),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_list_item_grow[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_list_item_grow_props_0, 0x01), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_list_item_grow_props_1, 0x01), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_list_item_grow_props_2, 0x01), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_list_item_grow_props_0, 0x01), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_list_item_grow_props_1, 0x01), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_list_item_grow_props_2, 0x01), /*dark, large*/
+};
+#endif
+
+#if LV_USE_LED
+static const lv_style_const_prop_t const_style_led_props_0[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BG_GRAD_COLOR(LV_COLOR_MAKE(0x9E, 0x9E, 0x9E)),
+    LV_STYLE_CONST_SHADOW_WIDTH(DPX(15)),
+    LV_STYLE_CONST_SHADOW_SPREAD(DPX(5)),
+    LV_STYLE_CONST_SHADOW_COLOR(LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)),
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    { .prop = LV_STYLE_PROP_INV }
+};
+
+static const lv_style_t const_style_led[CONST_STYLE_VARIANT_CNT] = {
+    LV_STYLE_CONST_INITIALIZER(const_style_led_props_0, 0x54), /*light, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_led_props_0, 0x54), /*light, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_led_props_0, 0x54), /*light, large*/
+    LV_STYLE_CONST_INITIALIZER(const_style_led_props_0, 0x54), /*dark, small*/
+    LV_STYLE_CONST_INITIALIZER(const_style_led_props_0, 0x54), /*dark, medium*/
+    LV_STYLE_CONST_INITIALIZER(const_style_led_props_0, 0x54), /*dark, large*/
+};
+#endif
+
+static void style_init_const(uint32_t variant)
+{
+    style_set_const(&styles->transition_delayed, &const_style_transition_delayed[variant]);
+    style_set_const(&styles->transition_normal, &const_style_transition_normal[variant]);
+    style_set_const(&styles->scrollbar, &const_style_scrollbar[variant]);
+    style_set_const(&styles->scrollbar_scrolled, &const_style_scrollbar_scrolled[variant]);
+    style_set_const(&styles->scr, &const_style_scr[variant]);
+    style_set_const(&styles->card, &const_style_card[variant]);
+    style_set_const(&styles->btn, &const_style_btn[variant]);
+    style_set_const(&styles->pressed, &const_style_pressed[variant]);
+    style_set_const(&styles->disabled, &const_style_disabled[variant]);
+    style_set_const(&styles->clip_corner, &const_style_clip_corner[variant]);
+    style_set_const(&styles->pad_normal, &const_style_pad_normal[variant]);
+    style_set_const(&styles->pad_small, &const_style_pad_small[variant]);
+    style_set_const(&styles->pad_gap, &const_style_pad_gap[variant]);
+    style_set_const(&styles->line_space_large, &const_style_line_space_large[variant]);
+    style_set_const(&styles->text_align_center, &const_style_text_align_center[variant]);
+    style_set_const(&styles->pad_zero, &const_style_pad_zero[variant]);
+    style_set_const(&styles->pad_tiny, &const_style_pad_tiny[variant]);
+    style_set_const(&styles->bg_color_grey, &const_style_bg_color_grey[variant]);
+    style_set_const(&styles->bg_color_white, &const_style_bg_color_white[variant]);
+    style_set_const(&styles->circle, &const_style_circle[variant]);
+    style_set_const(&styles->no_radius, &const_style_no_radius[variant]);
+#if LV_THEME_DEFAULT_GROW
+    style_set_const(&styles->grow, &const_style_grow[variant]);
+#endif
+    style_set_const(&styles->anim, &const_style_anim[variant]);
+#if LV_USE_ARC
+    style_set_const(&styles->arc_indic, &const_style_arc_indic[variant]);
+#endif
+#if LV_USE_DROPDOWN
+    style_set_const(&styles->dropdown_list, &const_style_dropdown_list[variant]);
+#endif
+#if LV_USE_SWITCH
+    style_set_const(&styles->switch_knob, &const_style_switch_knob[variant]);
+#endif
+#if LV_USE_LINE
+    style_set_const(&styles->line, &const_style_line[variant]);
+#endif
+#if LV_USE_CHART
+    style_set_const(&styles->chart_bg, &const_style_chart_bg[variant]);
+#endif
+#if LV_USE_CHART
+    style_set_const(&styles->chart_series, &const_style_chart_series[variant]);
+#endif
+#if LV_USE_CHART
+    style_set_const(&styles->chart_ticks, &const_style_chart_ticks[variant]);
+#endif
+#if LV_USE_METER
+    style_set_const(&styles->meter_marker, &const_style_meter_marker[variant]);
+#endif
+#if LV_USE_METER
+    style_set_const(&styles->meter_indic, &const_style_meter_indic[variant]);
+#endif
+#if LV_USE_TABLE
+    style_set_const(&styles->table_cell, &const_style_table_cell[variant]);
+#endif
+#if LV_USE_TEXTAREA
+    style_set_const(&styles->ta_cursor, &const_style_ta_cursor[variant]);
+#endif
+#if LV_USE_TEXTAREA
+    style_set_const(&styles->ta_placeholder, &const_style_ta_placeholder[variant]);
+#endif
+#if LV_USE_CALENDAR
+    style_set_const(&styles->calendar_bg, &const_style_calendar_bg[variant]);
+#endif
+#if LV_USE_CALENDAR
+    style_set_const(&styles->calendar_day, &const_style_calendar_day[variant]);
+#endif
+#if LV_USE_COLORWHEEL
+    style_set_const(&styles->colorwheel_main, &const_style_colorwheel_main[variant]);
+#endif
+#if LV_USE_MSGBOX
+    style_set_const(&styles->msgbox_btn_bg, &const_style_msgbox_btn_bg[variant]);
+#endif
+#if LV_USE_MSGBOX
+    style_set_const(&styles->msgbox_bg, &const_style_msgbox_bg[variant]);
+#endif
+#if LV_USE_KEYBOARD
+    style_set_const(&styles->keyboard_btn_bg, &const_style_keyboard_btn_bg[variant]);
+#endif
+#if LV_USE_TABVIEW
+    style_set_const(&styles->tab_bg_focus, &const_style_tab_bg_focus[variant]);
+#endif
+#if LV_USE_LIST
+    style_set_const(&styles->list_bg, &const_style_list_bg[variant]);
+#endif
+#if LV_USE_LIST
+    style_set_const(&styles->list_btn, &const_style_list_btn[variant]);
+#endif
+#if LV_USE_LIST
+    style_set_const(&styles->list_item_grow, &const_style_list_item_grow[variant]);
+#endif
+#if LV_USE_LED
+    style_set_const(&styles->led, &const_style_led[variant]);
+#endif
+}
+
+#undef DPX
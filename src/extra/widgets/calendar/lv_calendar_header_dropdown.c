@@ -32,6 +32,7 @@ static void month_event_cb(lv_event_t * e);
  *  STATIC VARIABLES
  **********************/
 const lv_obj_class_t lv_calendar_header_dropdown_class = {
+    .name = "calendar_header_dropdown",
      .base_class = &lv_obj_class,
      .constructor_cb = my_constructor
  };
@@ -31,12 +31,18 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e);
 
 static void draw_div_lines(lv_obj_t * obj , const lv_area_t * mask);
 static void draw_series_line(lv_obj_t * obj, const lv_area_t * clip_area);
+static void draw_series_line_crowded(lv_obj_t * obj, lv_chart_series_t * ser, const lv_area_t * series_mask,
+                                     const lv_draw_line_dsc_t * line_dsc, lv_coord_t x_ofs, lv_coord_t y_ofs,
+                                     lv_coord_t w, lv_coord_t h);
+static bool line_dsc_equal(const lv_draw_line_dsc_t * a, const lv_draw_line_dsc_t * b);
+static bool has_event_cb(lv_obj_t * obj);
 static void draw_series_bar(lv_obj_t * obj, const lv_area_t * clip_area);
 static void draw_series_scatter(lv_obj_t * obj, const lv_area_t * clip_area);
 static void draw_cursors(lv_obj_t * obj, const lv_area_t * clip_area);
 static void draw_axes(lv_obj_t * obj, const lv_area_t * mask);
 static uint32_t get_index_from_x(lv_obj_t * obj, lv_coord_t x);
 static void invalidate_point(lv_obj_t * obj, uint16_t i);
+static void invalidate_point_range(lv_obj_t * obj, uint16_t first, uint16_t last);
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, lv_coord_t ** a);
 lv_chart_tick_dsc_t * get_tick_gsc(lv_obj_t * obj, lv_chart_axis_t axis);
 
@@ -44,6 +50,7 @@ lv_chart_tick_dsc_t * get_tick_gsc(lv_obj_t * obj, lv_chart_axis_t axis);
  *  STATIC VARIABLES
  **********************/
 const lv_obj_class_t lv_chart_class = {
+    .name = "chart",
     .constructor_cb = lv_chart_constructor,
     .destructor_cb = lv_chart_destructor,
     .event_cb = lv_chart_event,
@@ -529,6 +536,41 @@ void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t
     invalidate_point(obj, ser->start_point);
 }
 
+void lv_chart_set_next_values(lv_obj_t * obj, lv_chart_series_t * ser, const lv_coord_t values[], uint32_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(ser);
+    LV_ASSERT_NULL(values);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(cnt == 0) return;
+
+    /*The older values would be overwritten anyway. Skip them but keep their place.*/
+    uint32_t first = ser->start_point;
+    if(cnt > chart->point_cnt) {
+        first = (first + cnt - chart->point_cnt) % chart->point_cnt;
+        values += cnt - chart->point_cnt;
+        cnt = chart->point_cnt;
+    }
+
+    /*Copy in 2 blocks: until the end of the array and the remaining ones to the beginning*/
+    uint32_t cnt1 = LV_MIN(cnt, chart->point_cnt - first);
+    lv_memcpy(&ser->y_points[first], values, cnt1 * sizeof(lv_coord_t));
+    if(cnt > cnt1) lv_memcpy(ser->y_points, &values[cnt1], (cnt - cnt1) * sizeof(lv_coord_t));
+
+    ser->start_point = (first + cnt) % chart->point_cnt;
+
+    /*Invalidate the changed points and the next one as `lv_chart_set_next_value()` does*/
+    uint32_t last = first + cnt;
+    if(last < chart->point_cnt) {
+        invalidate_point_range(obj, first, last);
+    }
+    else {
+        invalidate_point_range(obj, first, chart->point_cnt - 1);
+        invalidate_point_range(obj, 0, LV_MIN(last - chart->point_cnt, chart->point_cnt - 1U));
+    }
+}
+
 void lv_chart_set_next_value2(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t x_value, lv_coord_t y_value)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -873,12 +915,31 @@ static void draw_series_line(lv_obj_t * obj, const lv_area_t * clip_area)
     /*If there are mire points than pixels draw only vertical lines*/
     bool crowded_mode = chart->point_cnt >= w ? true : false;
 
+    /*Collect the connected lines with the same style and draw them as one polyline.
+     *If there is no buffer for the points draw the lines one by one.*/
+    lv_point_t * poly = NULL;
+    if(!crowded_mode) {
+        poly = lv_mem_buf_get(sizeof(lv_point_t) * chart->point_cnt);
+        LV_ASSERT_MALLOC(poly);
+    }
+    uint32_t poly_cnt = 0;
+    lv_draw_line_dsc_t poly_dsc;
+
+    /*The event handlers might draw on the lines in DRAW_PART_END so the lines should be drawn by then*/
+    bool flush_on_part_end = has_event_cb(obj);
+
     /*Go through all data lines*/
     _LV_LL_READ_BACK(&chart->series_ll, ser) {
         if (ser->hidden) continue;
         line_dsc_default.color = ser->color;
         point_dsc_default.bg_color = ser->color;
 
+        /*Draw only one vertical line per pixel column between the min. and max. values*/
+        if(crowded_mode) {
+            draw_series_line_crowded(obj, ser, &series_mask, &line_dsc_default, x_ofs, y_ofs, w, h);
+            continue;
+        }
+
         lv_coord_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
 
         p1.x = x_ofs;
@@ -899,9 +960,6 @@ static void draw_series_line(lv_obj_t * obj, const lv_area_t * clip_area)
         part_draw_dsc.rect_dsc = &point_dsc_default;
         part_draw_dsc.sub_part_ptr = ser;
 
-        lv_coord_t y_min = p2.y;
-        lv_coord_t y_max = p2.y;
-
         for(i = 0; i < chart->point_cnt; i++) {
             p1.x = p2.x;
             p1.y = p2.y;
@@ -922,56 +980,62 @@ static void draw_series_line(lv_obj_t * obj, const lv_area_t * clip_area)
 
             /*Don't draw the first point. A second point is also required to draw the line*/
             if(i != 0) {
-                if(crowded_mode) {
-                    if(ser->y_points[p_prev] != LV_CHART_POINT_NONE && ser->y_points[p_act] != LV_CHART_POINT_NONE) {
-                        /*Draw only one vertical line between the min an max y values on the same x value*/
-                        y_max = LV_MAX(y_max, p2.y);
-                        y_min = LV_MIN(y_min, p2.y);
-                        if(p1.x != p2.x) {
-                            lv_coord_t y_cur = p2.y;
-                            p2.x--;         /*It's already on the next x value*/
-                            p1.x = p2.x;
-                            p1.y = y_min;
-                            p2.y = y_max;
-                            if(p1.y == p2.y) p2.y++;    /*If they are the same no line will be drawn*/
-                            lv_draw_line(&p1, &p2, &series_mask, &line_dsc_default);
-                            p2.x++;         /*Compensate the previous x--*/
-                            y_min = y_cur;  /*Start the line of the next x from the current last y*/
-                            y_max = y_cur;
-                        }
-                    }
-                } else {
-                    lv_area_t point_area;
-                    point_area.x1 = p1.x - point_w;
-                    point_area.x2 = p1.x + point_w;
-                    point_area.y1 = p1.y - point_h;
-                    point_area.y2 = p1.y + point_h;
-
-                    part_draw_dsc.id = i - 1;
-                    part_draw_dsc.p1 = ser->y_points[p_prev] != LV_CHART_POINT_NONE ? &p1 : NULL;
-                    part_draw_dsc.p2 = ser->y_points[p_act] != LV_CHART_POINT_NONE ? &p2 : NULL;
-                    part_draw_dsc.draw_area = &point_area;
-                    part_draw_dsc.value = ser->y_points[p_prev];
-
-                    lv_event_send(obj, LV_EVENT_DRAW_PART_BEGIN, &part_draw_dsc);
-
-                    if(ser->y_points[p_prev] != LV_CHART_POINT_NONE && ser->y_points[p_act] != LV_CHART_POINT_NONE) {
+                lv_area_t point_area;
+                point_area.x1 = p1.x - point_w;
+                point_area.x2 = p1.x + point_w;
+                point_area.y1 = p1.y - point_h;
+                point_area.y2 = p1.y + point_h;
+
+                part_draw_dsc.id = i - 1;
+                part_draw_dsc.p1 = ser->y_points[p_prev] != LV_CHART_POINT_NONE ? &p1 : NULL;
+                part_draw_dsc.p2 = ser->y_points[p_act] != LV_CHART_POINT_NONE ? &p2 : NULL;
+                part_draw_dsc.draw_area = &point_area;
+                part_draw_dsc.value = ser->y_points[p_prev];
+
+                lv_event_send(obj, LV_EVENT_DRAW_PART_BEGIN, &part_draw_dsc);
+
+                /*Draw the collected lines if the polyline is broken or the style was changed in the event*/
+                bool line_visible = ser->y_points[p_prev] != LV_CHART_POINT_NONE &&
+                                    ser->y_points[p_act] != LV_CHART_POINT_NONE ? true : false;
+                if(poly_cnt && (!line_visible || !line_dsc_equal(&poly_dsc, &line_dsc_default))) {
+                    lv_draw_polyline(poly, poly_cnt, &series_mask, &poly_dsc);
+                    poly_cnt = 0;
+                }
+
+                if(line_visible) {
+                    if(poly == NULL) {
                         lv_draw_line(&p1, &p2, &series_mask, &line_dsc_default);
                     }
-
-                    if(point_w && point_h && ser->y_points[p_act] != LV_CHART_POINT_NONE) {
-                        lv_draw_rect(&point_area, &series_mask, &point_dsc_default);
+                    else {
+                        if(poly_cnt == 0) {
+                            lv_memcpy(&poly_dsc, &line_dsc_default, sizeof(lv_draw_line_dsc_t));
+                            poly[poly_cnt++] = p1;
+                        }
+                        poly[poly_cnt++] = p2;
                     }
+                }
 
-                    lv_event_send(obj, LV_EVENT_DRAW_PART_END, &part_draw_dsc);
+                /*The points should be above the lines*/
+                bool point_visible = point_w && point_h && ser->y_points[p_act] != LV_CHART_POINT_NONE;
+                if(poly_cnt && (point_visible || flush_on_part_end)) {
+                    lv_draw_polyline(poly, poly_cnt, &series_mask, &poly_dsc);
+                    poly_cnt = 0;
                 }
 
+                if(point_visible) lv_draw_rect(&point_area, &series_mask, &point_dsc_default);
+
+                lv_event_send(obj, LV_EVENT_DRAW_PART_END, &part_draw_dsc);
             }
             p_prev = p_act;
         }
 
+        if(poly_cnt) {
+            lv_draw_polyline(poly, poly_cnt, &series_mask, &poly_dsc);
+            poly_cnt = 0;
+        }
+
         /*Draw the last point*/
-        if(!crowded_mode && i == chart->point_cnt) {
+        if(i == chart->point_cnt) {
 
             if(ser->y_points[p_act] != LV_CHART_POINT_NONE) {
                 lv_area_t point_area;
@@ -991,6 +1055,121 @@ static void draw_series_line(lv_obj_t * obj, const lv_area_t * clip_area)
             }
         }
     }
+
+    if(poly) lv_mem_buf_release(poly);
+}
+
+/**
+ * Draw a line series which has more points than pixel columns.
+ * The points are decimated to their minimum and maximum in each pixel column
+ * and only the points in the clip area are processed.
+ */
+static void draw_series_line_crowded(lv_obj_t * obj, lv_chart_series_t * ser, const lv_area_t * series_mask,
+                                     const lv_draw_line_dsc_t * line_dsc, lv_coord_t x_ofs, lv_coord_t y_ofs,
+                                     lv_coord_t w, lv_coord_t h)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(w <= 0) return;
+
+    int32_t point_cnt = chart->point_cnt;
+    int32_t y_min_val = chart->ymin[ser->y_axis_sec];
+    int32_t y_range = chart->ymax[ser->y_axis_sec] - y_min_val;
+
+    /*Get the range of points which are on the clip area*/
+    int32_t x_start = series_mask->x1 - x_ofs - line_dsc->width;
+    int32_t x_end = series_mask->x2 - x_ofs + line_dsc->width;
+    if(x_end < 0 || x_start > w) return;
+
+    int32_t i_start = x_start <= 0 ? 0 : (x_start * (point_cnt - 1)) / w;
+    int32_t i_end = x_end >= w ? point_cnt - 1 : ((x_end + 1) * (point_cnt - 1)) / w + 1;
+    if(i_end > point_cnt - 1) i_end = point_cnt - 1;
+
+    int32_t p_act = (chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0) + i_start;
+    if(p_act >= point_cnt) p_act -= point_cnt;
+
+    lv_point_t p1;
+    lv_point_t p2;
+    lv_coord_t col_x = 0;
+    lv_coord_t col_min = 0;
+    lv_coord_t col_max = 0;
+    bool col_valid = false;
+    int32_t i;
+    for(i = i_start; i <= i_end; i++) {
+        lv_coord_t v = ser->y_points[p_act];
+        p_act++;
+        if(p_act == point_cnt) p_act = 0;
+
+        lv_coord_t x = (w * i) / (point_cnt - 1) + x_ofs;
+
+        /*The column ends on a missing point or when the next column starts*/
+        if(v == LV_CHART_POINT_NONE || x != col_x) {
+            if(col_valid) {
+                lv_coord_t y_next = v == LV_CHART_POINT_NONE ? col_min : h - ((v - y_min_val) * h) / y_range + y_ofs;
+
+                /*Connect the column to the first point of the next column*/
+                p1.x = col_x;
+                p1.y = LV_MIN(col_min, y_next);
+                p2.x = col_x;
+                p2.y = LV_MAX(col_max, y_next);
+                if(p1.y == p2.y) p2.y++;    /*If they are the same no line will be drawn*/
+                lv_draw_line(&p1, &p2, series_mask, line_dsc);
+            }
+            col_valid = false;
+        }
+
+        if(v == LV_CHART_POINT_NONE) continue;
+
+        lv_coord_t y = h - ((v - y_min_val) * h) / y_range + y_ofs;
+        if(col_valid) {
+            col_min = LV_MIN(col_min, y);
+            col_max = LV_MAX(col_max, y);
+        }
+        else {
+            col_x = x;
+            col_min = y;
+            col_max = y;
+            col_valid = true;
+        }
+    }
+
+    if(col_valid) {
+        p1.x = col_x;
+        p1.y = col_min;
+        p2.x = col_x;
+        p2.y = col_max;
+        if(p1.y == p2.y) p2.y++;
+        lv_draw_line(&p1, &p2, series_mask, line_dsc);
+    }
+}
+
+/**
+ * Tell if the events of the chart can be handled by anything else than the chart's class
+ * @param obj pointer to a chart object
+ * @return true: there are event callbacks on the chart or its events bubble to the parent
+ */
+static bool has_event_cb(lv_obj_t * obj)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_EVENT_BUBBLE)) return true;
+    return obj->spec_attr && obj->spec_attr->event_dsc_cnt > 0;
+}
+
+/**
+ * Tell if two line descriptors draw the same way. (Not `memcmp` to skip the padding and unused bits.)
+ * @param a pointer to a line descriptor
+ * @param b pointer to an other line descriptor
+ * @return true: the descriptors are the same
+ */
+static bool line_dsc_equal(const lv_draw_line_dsc_t * a, const lv_draw_line_dsc_t * b)
+{
+    return a->color.full == b->color.full &&
+           a->width == b->width &&
+           a->dash_width == b->dash_width &&
+           a->dash_gap == b->dash_gap &&
+           a->opa == b->opa &&
+           a->blend_mode == b->blend_mode &&
+           a->round_start == b->round_start &&
+           a->round_end == b->round_end &&
+           a->raw_end == b->raw_end;
 }
 
 static void draw_series_scatter(lv_obj_t * obj, const lv_area_t * clip_area)
@@ -1604,9 +1783,21 @@ static uint32_t get_index_from_x(lv_obj_t * obj, lv_coord_t x)
 }
 
 static void invalidate_point(lv_obj_t * obj, uint16_t i)
+{
+    invalidate_point_range(obj, i, i);
+}
+
+/**
+ * Invalidate the area of the points from `first` to `last` (inclusive) with the lines going to their neighbors
+ * @param obj       pointer to a chart object
+ * @param first     index of the first point
+ * @param last      index of the last point
+ */
+static void invalidate_point_range(lv_obj_t * obj, uint16_t first, uint16_t last)
 {
     lv_chart_t * chart  = (lv_chart_t *)obj;
-    if(i >= chart->point_cnt) return;
+    if(first >= chart->point_cnt) return;
+    if(last >= chart->point_cnt) last = chart->point_cnt - 1;
 
     lv_coord_t w  = (lv_obj_get_content_width(obj) * chart->zoom_x) >> 8;
     lv_coord_t scroll_left = lv_obj_get_scroll_left(obj);
@@ -1618,28 +1809,28 @@ static void invalidate_point(lv_obj_t * obj, uint16_t i)
     }
 
     if(chart->type == LV_CHART_TYPE_LINE) {
+        if(chart->point_cnt < 2) {
+            lv_obj_invalidate(obj);
+            return;
+        }
+
         lv_coord_t bwidth = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
         lv_coord_t pleft = lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
         lv_coord_t x_ofs = obj->coords.x1 + pleft + bwidth - scroll_left;
         lv_coord_t line_width = lv_obj_get_style_line_width(obj, LV_PART_ITEMS);
         lv_coord_t point_w = lv_obj_get_style_width(obj, LV_PART_INDICATOR);
 
+        /*The lines from the previous point and to the next point are also changed*/
+        uint32_t i_start = first > 0 ? first - 1 : 0;
+        uint32_t i_end = last < chart->point_cnt - 1 ? last + 1 : last;
+
         lv_area_t coords;
         lv_area_copy(&coords, &obj->coords);
         coords.y1 -= line_width + point_w;
         coords.y2 += line_width + point_w;
-
-        if(i < chart->point_cnt - 1) {
-            coords.x1 = ((w * i) / (chart->point_cnt - 1)) + x_ofs - line_width - point_w;
-            coords.x2 = ((w * (i + 1)) / (chart->point_cnt - 1)) + x_ofs + line_width + point_w;
-            lv_obj_invalidate_area(obj, &coords);
-        }
-
-        if(i > 0) {
-            coords.x1 = ((w * (i - 1)) / (chart->point_cnt - 1)) + x_ofs - line_width - point_w;
-            coords.x2 = ((w * i) / (chart->point_cnt - 1)) + x_ofs + line_width + point_w;
-            lv_obj_invalidate_area(obj, &coords);
-        }
+        coords.x1 = ((w * i_start) / (chart->point_cnt - 1)) + x_ofs - line_width - point_w;
+        coords.x2 = ((w * i_end) / (chart->point_cnt - 1)) + x_ofs + line_width + point_w;
+        lv_obj_invalidate_area(obj, &coords);
     }
     else if(chart->type == LV_CHART_TYPE_BAR) {
         lv_area_t col_a;
@@ -1647,12 +1838,12 @@ static void invalidate_point(lv_obj_t * obj, uint16_t i)
         lv_coord_t block_w = (w + block_gap) / chart->point_cnt;
 
         lv_coord_t x_act;
-        x_act = (int32_t)((int32_t)(block_w) * i) ;
+        x_act = (int32_t)((int32_t)(block_w) * first) ;
         x_act += obj->coords.x1 + lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
 
         lv_obj_get_coords(obj, &col_a);
         col_a.x1 = x_act - scroll_left;
-        col_a.x2 = col_a.x1 + block_w;
+        col_a.x2 = col_a.x1 + block_w * (last - first + 1);
         col_a.x1 -= block_gap;
 
         lv_obj_invalidate_area(obj, &col_a);
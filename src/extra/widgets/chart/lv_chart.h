@@ -370,6 +370,17 @@ void lv_chart_set_all_value(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t
  */
 void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t value);
 
+/**
+ * Add several values to the series at once according to the update mode policy.
+ * It's much faster than calling `lv_chart_set_next_value()` for each value because the
+ * values are copied in at most two blocks and the chart is invalidated only once.
+ * @param obj       pointer to chart object
+ * @param ser       pointer to a data series on 'chart'
+ * @param values    array of the new values
+ * @param cnt       number of values in `values`. If it's larger than the point count only the last values are used.
+ */
+void lv_chart_set_next_values(lv_obj_t * obj, lv_chart_series_t * ser, const lv_coord_t values[], uint32_t cnt);
+
 /**
  * Set the next point's X and Y value according to the update mode policy.
  * @param obj       pointer to chart object
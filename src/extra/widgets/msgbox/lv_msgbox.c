@@ -27,7 +27,7 @@ static void msgbox_close_click_event_cb(lv_event_t * e);
 /**********************
  *  STATIC VARIABLES
  **********************/
-const lv_obj_class_t lv_msgbox_class = {.base_class = &lv_obj_class};
+const lv_obj_class_t lv_msgbox_class = {.name = "msgbox", .base_class = &lv_obj_class};
 
 /**********************
  *      MACROS
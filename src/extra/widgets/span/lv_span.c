@@ -13,6 +13,8 @@
 /*********************
  *      DEFINES
  *********************/
+#undef LV_MEM_FILE_TAG
+#define LV_MEM_FILE_TAG LV_MEM_TAG_TEXT
 #define MY_CLASS &lv_spangroup_class
 
 /**********************
@@ -67,6 +69,7 @@ static lv_snippet_t * lv_get_snippet(uint16_t index);
 static struct _snippet_stack snippet_stack;
 
 const lv_obj_class_t lv_spangroup_class  = {
+    .name = "spangroup",
     .base_class = &lv_obj_class,
     .constructor_cb = lv_spangroup_constructor,
     .destructor_cb = lv_spangroup_destructor,
@@ -30,6 +30,7 @@ static void lv_spinbox_updatevalue(lv_obj_t * obj);
  *  STATIC VARIABLES
  **********************/
 const lv_obj_class_t lv_spinbox_class = {
+    .name = "spinbox",
     .constructor_cb = lv_spinbox_constructor,
     .event_cb = lv_spinbox_event,
     .instance_size = sizeof(lv_spinbox_t),
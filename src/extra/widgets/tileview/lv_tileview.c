@@ -28,11 +28,11 @@ static void tileview_event_cb(lv_event_t * e);
  *  STATIC VARIABLES
  **********************/
 
-const lv_obj_class_t lv_tileview_class = {.constructor_cb = lv_tileview_constructor,
+const lv_obj_class_t lv_tileview_class = {.name = "tileview", .constructor_cb = lv_tileview_constructor,
                                     .base_class = &lv_obj_class,
                                     .instance_size = sizeof(lv_tileview_t)};
 
-const lv_obj_class_t lv_tileview_tile_class = {.constructor_cb = lv_tileview_tile_constructor,
+const lv_obj_class_t lv_tileview_tile_class = {.name = "tileview_tile", .constructor_cb = lv_tileview_tile_constructor,
                                          .base_class = &lv_obj_class,
                                          .instance_size = sizeof(lv_tileview_tile_t)};
 
@@ -14,6 +14,12 @@
 #include "../misc/lv_fs.h"
 #include "lv_font_loader.h"
 
+/*********************
+ *      DEFINES
+ *********************/
+#undef LV_MEM_FILE_TAG
+#define LV_MEM_FILE_TAG LV_MEM_TAG_FONT
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -71,6 +71,12 @@ static void lv_gpu_nxp_pxp_run(void);
 static void lv_gpu_nxp_pxp_blit_recolor(lv_color_t * dest, lv_coord_t dest_width, const lv_color_t * src,
                                         lv_coord_t src_width,
                                         lv_coord_t copy_width, lv_coord_t copy_height, lv_opa_t opa, lv_color_t recolor, lv_opa_t recolorOpa);
+static lv_res_t backend_fill(lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, const lv_area_t * dest_area,
+                             const lv_area_t * fill_area, lv_color_t color, lv_opa_t opa);
+static lv_res_t backend_blend_map(lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, const lv_area_t * dest_area,
+                                  const lv_area_t * draw_area, const lv_color_t * src_buf, const lv_area_t * src_area, lv_opa_t opa);
+static lv_res_t backend_draw_img(lv_disp_drv_t * disp_drv, const lv_area_t * coords, const lv_area_t * clip,
+                                 const uint8_t * map_p, const lv_draw_img_dsc_t * dsc, bool chroma_key, bool alpha_byte);
 
 /**********************
  *  STATIC VARIABLES
@@ -85,6 +91,16 @@ static lv_opa_t recolorOpa = 0x0;
 
 static lv_nxp_pxp_cfg_t pxp_cfg;
 
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+const lv_draw_backend_t lv_gpu_nxp_pxp_backend = {
+    .fill = backend_fill,
+    .blend_map = backend_blend_map,
+    .draw_img = backend_draw_img,
+};
+
 /**********************
  *      MACROS
  **********************/
@@ -445,4 +461,61 @@ static void lv_gpu_nxp_pxp_blit_recolor(lv_color_t * dest, lv_coord_t dest_width
     }
 }
 
+static lv_res_t backend_fill(lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, const lv_area_t * dest_area,
+                             const lv_area_t * fill_area, lv_color_t color, lv_opa_t opa)
+{
+    LV_UNUSED(disp_drv);
+
+    uint32_t size_limit = opa > LV_OPA_MAX ? LV_GPU_NXP_PXP_FILL_SIZE_LIMIT : LV_GPU_NXP_PXP_FILL_OPA_SIZE_LIMIT;
+    if(lv_area_get_size(fill_area) < size_limit) return LV_RES_INV;
+
+    lv_gpu_nxp_pxp_fill(dest_buf, lv_area_get_width(dest_area), fill_area, color, opa);
+    return LV_RES_OK;
+}
+
+static lv_res_t backend_blend_map(lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, const lv_area_t * dest_area,
+                                  const lv_area_t * draw_area, const lv_color_t * src_buf, const lv_area_t * src_area, lv_opa_t opa)
+{
+    LV_UNUSED(disp_drv);
+
+    uint32_t size_limit = opa > LV_OPA_MAX ? LV_GPU_NXP_PXP_BLIT_SIZE_LIMIT : LV_GPU_NXP_PXP_BLIT_OPA_SIZE_LIMIT;
+    if(lv_area_get_size(draw_area) < size_limit) return LV_RES_INV;
+
+    lv_coord_t dest_w = lv_area_get_width(dest_area);
+    lv_coord_t src_w = lv_area_get_width(src_area);
+    lv_color_t * dest_first = dest_buf + dest_w * draw_area->y1 + draw_area->x1;
+    const lv_color_t * src_first = src_buf + src_w * (draw_area->y1 - (src_area->y1 - dest_area->y1)) +
+                                   (draw_area->x1 - (src_area->x1 - dest_area->x1));
+
+    lv_gpu_nxp_pxp_blit(dest_first, dest_w, src_first, src_w, lv_area_get_width(draw_area),
+                        lv_area_get_height(draw_area), opa);
+    return LV_RES_OK;
+}
+
+/**
+ * Blit the not transformed, color keyed or recolored images with the PXP
+ */
+static lv_res_t backend_draw_img(lv_disp_drv_t * disp_drv, const lv_area_t * coords, const lv_area_t * clip,
+                                 const uint8_t * map_p, const lv_draw_img_dsc_t * dsc, bool chroma_key, bool alpha_byte)
+{
+    LV_UNUSED(disp_drv);
+
+    if(lv_draw_mask_get_cnt() != 0 || dsc->angle != 0 || dsc->zoom != LV_IMG_ZOOM_NONE || alpha_byte) return LV_RES_INV;
+
+    if(chroma_key && dsc->recolor_opa == LV_OPA_TRANSP) { /*copy with color keying (+ alpha)*/
+        lv_gpu_nxp_pxp_enable_color_key();
+        _lv_blend_map(clip, coords, (lv_color_t *)map_p, NULL, LV_DRAW_MASK_RES_FULL_COVER, dsc->opa, dsc->blend_mode);
+        lv_gpu_nxp_pxp_disable_color_key();
+        return LV_RES_OK;
+    }
+    else if(!chroma_key && dsc->recolor_opa != LV_OPA_TRANSP) { /*copy with recolor (+ alpha)*/
+        lv_gpu_nxp_pxp_enable_recolor(dsc->recolor, dsc->recolor_opa);
+        _lv_blend_map(clip, coords, (lv_color_t *)map_p, NULL, LV_DRAW_MASK_RES_FULL_COVER, dsc->opa, dsc->blend_mode);
+        lv_gpu_nxp_pxp_disable_recolor();
+        return LV_RES_OK;
+    }
+
+    return LV_RES_INV;
+}
+
 #endif /* LV_USE_GPU_NXP_PXP */
@@ -40,6 +40,7 @@ extern "C" {
 
 #include "../misc/lv_area.h"
 #include "../misc/lv_color.h"
+#include "../draw/lv_draw_backend.h"
 
 /*********************
  *      DEFINES
@@ -176,6 +177,13 @@ void lv_gpu_nxp_pxp_enable_recolor(lv_color_t color, lv_opa_t opa);
  */
 void lv_gpu_nxp_pxp_disable_recolor(void);
 
+/**********************
+ * GLOBAL VARIABLES
+ **********************/
+
+/*Draw backend using the PXP for fills, blits, color keyed and recolored images*/
+extern const lv_draw_backend_t lv_gpu_nxp_pxp_backend;
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
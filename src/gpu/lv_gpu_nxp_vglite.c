@@ -102,6 +102,10 @@ static lv_res_t _init_vg_buf(vg_lite_buffer_t * dst, uint32_t width, uint32_t he
                              const lv_color_t * ptr, bool source);
 
 static lv_res_t _lv_gpu_nxp_vglite_blit_single(lv_gpu_nxp_vglite_blit_info_t * blit);
+static lv_res_t _backend_fill(lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, const lv_area_t * dest_area,
+                              const lv_area_t * fill_area, lv_color_t color, lv_opa_t opa);
+static lv_res_t _backend_blend_map(lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, const lv_area_t * dest_area,
+                                   const lv_area_t * draw_area, const lv_color_t * src_buf, const lv_area_t * src_area, lv_opa_t opa);
 #if _BLIT_SPLIT_ENABLED
 static void _align_x(lv_area_t * area, lv_color_t ** buf);
 static void _align_y(lv_area_t * area, lv_color_t ** buf, uint32_t stridePx);
@@ -113,6 +117,15 @@ static void _draw_rectangle(lv_color_t * dest_buf, lv_coord_t dest_width, lv_coo
 static lv_res_t _lv_gpu_nxp_vglite_check_blit(lv_gpu_nxp_vglite_blit_info_t * blit);
 #endif
 
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+const lv_draw_backend_t lv_gpu_nxp_vglite_backend = {
+    .fill = _backend_fill,
+    .blend_map = _backend_blend_map,
+};
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -435,6 +448,66 @@ lv_res_t lv_gpu_nxp_vglite_blit(lv_gpu_nxp_vglite_blit_info_t * blit)
  *   STATIC FUNCTIONS
  **********************/
 
+/***
+ * Fill callback of the draw backend. Falls back to software rendering in case of error.
+ */
+static lv_res_t _backend_fill(lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, const lv_area_t * dest_area,
+                              const lv_area_t * fill_area, lv_color_t color, lv_opa_t opa)
+{
+    LV_UNUSED(disp_drv);
+
+    uint32_t size_limit = opa > LV_OPA_MAX ? LV_GPU_NXP_VG_LITE_FILL_SIZE_LIMIT : LV_GPU_NXP_VG_LITE_FILL_OPA_SIZE_LIMIT;
+    if(lv_area_get_size(fill_area) < size_limit) return LV_RES_INV;
+
+    return lv_gpu_nxp_vglite_fill(dest_buf, lv_area_get_width(dest_area), lv_area_get_height(dest_area), fill_area,
+                                  color, opa);
+}
+
+/***
+ * Blend map callback of the draw backend. Falls back to software rendering in case of error.
+ */
+static lv_res_t _backend_blend_map(lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, const lv_area_t * dest_area,
+                                   const lv_area_t * draw_area, const lv_color_t * src_buf, const lv_area_t * src_area, lv_opa_t opa)
+{
+    LV_UNUSED(disp_drv);
+
+    uint32_t size_limit = opa > LV_OPA_MAX ? LV_GPU_NXP_VG_LITE_BLIT_SIZE_LIMIT : LV_GPU_NXP_VG_LITE_BLIT_OPA_SIZE_LIMIT;
+    if(lv_area_get_size(draw_area) < size_limit) return LV_RES_INV;
+
+    lv_coord_t draw_area_w = lv_area_get_width(draw_area);
+    lv_coord_t draw_area_h = lv_area_get_height(draw_area);
+
+    lv_gpu_nxp_vglite_blit_info_t blit;
+
+    blit.src = src_buf;
+    if(opa > LV_OPA_MAX) {
+        blit.src_width = draw_area_w;
+        blit.src_height = draw_area_h;
+    }
+    else {
+        blit.src_width = lv_area_get_width(src_area);
+        blit.src_height = lv_area_get_height(src_area);
+    }
+    blit.src_stride = lv_area_get_width(src_area) * sizeof(lv_color_t);
+    blit.src_area.x1 = (draw_area->x1 - (src_area->x1 - dest_area->x1));
+    blit.src_area.y1 = (draw_area->y1 - (src_area->y1 - dest_area->y1));
+    blit.src_area.x2 = blit.src_area.x1 + draw_area_w - 1;
+    blit.src_area.y2 = blit.src_area.y1 + draw_area_h - 1;
+
+    blit.dst = dest_buf;
+    blit.dst_width = lv_area_get_width(dest_area);
+    blit.dst_height = lv_area_get_height(dest_area);
+    blit.dst_stride = lv_area_get_width(dest_area) * sizeof(lv_color_t);
+    blit.dst_area.x1 = draw_area->x1;
+    blit.dst_area.y1 = draw_area->y1;
+    blit.dst_area.x2 = blit.dst_area.x1 + draw_area_w - 1;
+    blit.dst_area.y2 = blit.dst_area.y1 + draw_area_h - 1;
+
+    blit.opa = opa;
+
+    return lv_gpu_nxp_vglite_blit(&blit);
+}
+
 /***
  * BLock Image Transfer - single direct BLIT.
  * @param[in] blit Description of the transfer
@@ -38,6 +38,7 @@ extern "C" {
  *      INCLUDES
  *********************/
 #include "misc/lv_area.h"
+#include "draw/lv_draw_backend.h"
 
 /*********************
  *      DEFINES
@@ -134,6 +135,13 @@ lv_res_t lv_gpu_nxp_vglite_fill(lv_color_t * dest_buf, lv_coord_t dest_width, lv
  */
 lv_res_t lv_gpu_nxp_vglite_blit(lv_gpu_nxp_vglite_blit_info_t * blit);
 
+/**********************
+ * GLOBAL VARIABLES
+ **********************/
+
+/*Draw backend using VG-Lite for fills and blits*/
+extern const lv_draw_backend_t lv_gpu_nxp_vglite_backend;
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
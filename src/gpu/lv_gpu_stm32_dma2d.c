@@ -44,6 +44,27 @@
  **********************/
 static void invalidate_cache(void);
 static void wait_finish(void);
+static lv_res_t backend_fill(lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, const lv_area_t * dest_area,
+                             const lv_area_t * fill_area, lv_color_t color, lv_opa_t opa);
+static lv_res_t backend_blend_map(lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, const lv_area_t * dest_area,
+                                  const lv_area_t * draw_area, const lv_color_t * src_buf, const lv_area_t * src_area, lv_opa_t opa);
+#if LV_COLOR_DEPTH == 32
+static lv_res_t backend_draw_img(lv_disp_drv_t * disp_drv, const lv_area_t * coords, const lv_area_t * clip,
+                                 const uint8_t * map_p, const lv_draw_img_dsc_t * dsc, bool chroma_key, bool alpha_byte);
+#endif
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+const lv_draw_backend_t lv_gpu_stm32_dma2d_backend = {
+    .fill = backend_fill,
+    .blend_map = backend_blend_map,
+#if LV_COLOR_DEPTH == 32
+    .draw_img = backend_draw_img,
+#endif
+    .wait = lv_gpu_stm32_dma2d_wait_cb,
+};
 
 /**********************
  *  STATIC VARIABLES
@@ -236,6 +257,72 @@ void lv_gpu_stm32_dma2d_wait_cb(lv_disp_drv_t * drv)
  *   STATIC FUNCTIONS
  **********************/
 
+static lv_res_t backend_fill(lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, const lv_area_t * dest_area,
+                             const lv_area_t * fill_area, lv_color_t color, lv_opa_t opa)
+{
+    LV_UNUSED(disp_drv);
+
+    if(opa <= LV_OPA_MAX || lv_area_get_size(fill_area) < 240) return LV_RES_INV;
+
+    lv_coord_t dest_w = lv_area_get_width(dest_area);
+    lv_color_t * dest_first = dest_buf + dest_w * fill_area->y1 + fill_area->x1;
+    lv_gpu_stm32_dma2d_fill(dest_first, dest_w, color, lv_area_get_width(fill_area), lv_area_get_height(fill_area));
+    return LV_RES_OK;
+}
+
+static lv_res_t backend_blend_map(lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, const lv_area_t * dest_area,
+                                  const lv_area_t * draw_area, const lv_color_t * src_buf, const lv_area_t * src_area, lv_opa_t opa)
+{
+    LV_UNUSED(disp_drv);
+
+    if(lv_area_get_size(draw_area) < 240) return LV_RES_INV;
+
+    lv_coord_t dest_w = lv_area_get_width(dest_area);
+    lv_coord_t src_w = lv_area_get_width(src_area);
+    lv_color_t * dest_first = dest_buf + dest_w * draw_area->y1 + draw_area->x1;
+    const lv_color_t * src_first = src_buf + src_w * (draw_area->y1 - (src_area->y1 - dest_area->y1)) +
+                                   (draw_area->x1 - (src_area->x1 - dest_area->x1));
+
+    if(opa > LV_OPA_MAX) {
+        lv_gpu_stm32_dma2d_copy(dest_first, dest_w, src_first, src_w, lv_area_get_width(draw_area),
+                                lv_area_get_height(draw_area));
+    }
+    else {
+        lv_gpu_stm32_dma2d_blend(dest_first, dest_w, src_first, opa, src_w, lv_area_get_width(draw_area),
+                                 lv_area_get_height(draw_area));
+    }
+    return LV_RES_OK;
+}
+
+#if LV_COLOR_DEPTH == 32
+/**
+ * Blend the simple ARGB images directly
+ */
+static lv_res_t backend_draw_img(lv_disp_drv_t * disp_drv, const lv_area_t * coords, const lv_area_t * clip,
+                                 const uint8_t * map_p, const lv_draw_img_dsc_t * dsc, bool chroma_key, bool alpha_byte)
+{
+    if(!alpha_byte || chroma_key || dsc->angle != 0 || dsc->zoom != LV_IMG_ZOOM_NONE ||
+       dsc->recolor_opa != LV_OPA_TRANSP || lv_draw_mask_get_cnt() != 0) {
+        return LV_RES_INV;
+    }
+
+    if(lv_area_get_size(clip) <= 240) return LV_RES_INV;
+
+    lv_disp_draw_buf_t * draw_buf = disp_drv->draw_buf;
+    lv_coord_t dest_w = lv_area_get_width(&draw_buf->area);
+    lv_color_t * dest_first = draw_buf->buf_act;
+    dest_first += dest_w * (clip->y1 - draw_buf->area.y1) + (clip->x1 - draw_buf->area.x1);
+
+    lv_coord_t map_w = lv_area_get_width(coords);
+    const uint8_t * map_first = map_p;
+    map_first += (map_w * (clip->y1 - coords->y1) + (clip->x1 - coords->x1)) * LV_IMG_PX_SIZE_ALPHA_BYTE;
+
+    lv_gpu_stm32_dma2d_blend(dest_first, dest_w, (const lv_color_t *)map_first, dsc->opa, map_w, lv_area_get_width(clip),
+                             lv_area_get_height(clip));
+    return LV_RES_OK;
+}
+#endif
+
 static void invalidate_cache(void)
 {
     lv_disp_t * disp = _lv_refr_get_disp_refreshing();
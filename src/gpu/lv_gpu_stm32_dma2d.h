@@ -16,6 +16,7 @@ extern "C" {
 #include "../misc/lv_area.h"
 #include "../misc/lv_color.h"
 #include "../hal/lv_hal_disp.h"
+#include "../draw/lv_draw_backend.h"
 
 /*********************
  *      DEFINES
@@ -98,6 +99,13 @@ void lv_gpu_stm32_dma2d_blend(lv_color_t * buf, lv_coord_t buf_w, const lv_color
  */
 void lv_gpu_stm32_dma2d_wait_cb(lv_disp_drv_t * drv);
 
+/**********************
+ * GLOBAL VARIABLES
+ **********************/
+
+/*Draw backend using DMA2D for fills, blits and ARGB images*/
+extern const lv_draw_backend_t lv_gpu_stm32_dma2d_backend;
+
 /**********************
  *      MACROS
  **********************/
@@ -17,6 +17,7 @@
 #include "../core/lv_obj.h"
 #include "../core/lv_refr.h"
 #include "../core/lv_theme.h"
+#include "../draw/lv_draw_backend.h"
 #if LV_USE_THEME_DEFAULT
 #include "../extra/themes/default/lv_theme_default.h"
 #endif
@@ -33,6 +34,13 @@
  *  STATIC PROTOTYPES
  **********************/
 static lv_obj_tree_walk_res_t invalidate_layout_cb(lv_obj_t * obj, void * user_data);
+static void color_format_convert_generic(lv_color_t * buf, uint32_t px_cnt, lv_disp_color_format_t cf);
+#if LV_USE_PERF_MONITOR
+    static lv_disp_perf_data_t * perf_data_get(lv_disp_t * disp);
+    static uint32_t perf_get_deadline(lv_disp_t * disp);
+    static void perf_hist_eval(const uint32_t hist[], uint32_t cnt, lv_disp_perf_time_t * res);
+    static uint32_t perf_hist_get_percentile(const uint32_t hist[], uint32_t cnt, uint32_t pct);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -63,6 +71,7 @@ void lv_disp_drv_init(lv_disp_drv_t * driver)
     driver->screen_transp    = LV_COLOR_SCREEN_TRANSP;
     driver->dpi              = LV_DPI_DEF;
     driver->color_chroma_key = LV_COLOR_CHROMA_KEY;
+    driver->draw_backend     = lv_draw_backend_get_default();
 }
 
 /**
@@ -88,6 +97,27 @@ void lv_disp_draw_buf_init(lv_disp_draw_buf_t * draw_buf, void * buf1, void * bu
     draw_buf->buf2    = buf2;
     draw_buf->buf_act = draw_buf->buf1;
     draw_buf->size    = size_in_px_cnt;
+    draw_buf->buf_cnt = buf2 ? 2 : 1;
+}
+
+/**
+ * Initialize a display buffer with a chain of buffers to render ahead while the previous buffers are being flushed.
+ * With more than 2 buffers `flush_cb` can be called again before `lv_disp_flush_ready` is called for the previous
+ * buffers. The driver should queue the flushes (e.g. in a flush thread) and call `lv_disp_flush_ready` in order
+ * for each of them. `lv_disp_flush_ready` can be called from any thread.
+ * @param draw_buf pointer `lv_disp_draw_buf_t` variable to initialize
+ * @param bufs array of buffers. Only its pointer is saved so it can't be a local variable.
+ * @param buf_cnt number of buffers in `bufs` (at least 1)
+ * @param size_in_px_cnt size of the each buffer in pixel count.
+ */
+void lv_disp_draw_buf_init_chain(lv_disp_draw_buf_t * draw_buf, void ** bufs, uint8_t buf_cnt,
+                                 uint32_t size_in_px_cnt)
+{
+    LV_ASSERT(buf_cnt > 0);
+
+    lv_disp_draw_buf_init(draw_buf, bufs[0], buf_cnt > 1 ? bufs[1] : NULL, size_in_px_cnt);
+    draw_buf->buf_chain = bufs;
+    draw_buf->buf_cnt = buf_cnt;
 }
 
 /**
@@ -124,6 +154,12 @@ lv_disp_t * lv_disp_drv_register(lv_disp_drv_t * driver)
         LV_LOG_WARN("full_refresh requires at least screen sized draw buffer(s)")
     }
 
+    if(lv_disp_color_format_get_size(driver->color_format) > sizeof(lv_color_t) &&
+       (driver->full_refresh || driver->sw_rotate)) {
+        driver->color_format = LV_DISP_COLOR_FORMAT_NATIVE;
+        LV_LOG_WARN("color formats larger than lv_color_t can't be used with full_refresh and sw_rotate")
+    }
+
     disp->bg_color = lv_color_white();
 #if LV_COLOR_SCREEN_TRANSP
     disp->bg_opa = LV_OPA_TRANSP;
@@ -172,6 +208,12 @@ void lv_disp_drv_update(lv_disp_t * disp, lv_disp_drv_t * new_drv)
         LV_LOG_WARN("full_refresh requires at least screen sized draw buffer(s)")
     }
 
+    if(lv_disp_color_format_get_size(disp->driver->color_format) > sizeof(lv_color_t) &&
+       (disp->driver->full_refresh || disp->driver->sw_rotate)) {
+        disp->driver->color_format = LV_DISP_COLOR_FORMAT_NATIVE;
+        LV_LOG_WARN("color formats larger than lv_color_t can't be used with full_refresh and sw_rotate")
+    }
+
     lv_coord_t w = lv_disp_get_hor_res(disp);
     lv_coord_t h = lv_disp_get_ver_res(disp);
     uint32_t i;
@@ -218,9 +260,6 @@ void lv_disp_remove(lv_disp_t * disp)
         indev = lv_indev_get_next(indev);
     }
 
-    _lv_ll_remove(&LV_GC_ROOT(_lv_disp_ll), disp);
-    lv_timer_del(disp->refr_timer);
-
     /** delete screen and other obj */
     if (disp->sys_layer) {
         lv_obj_del(disp->sys_layer);
@@ -234,6 +273,13 @@ void lv_disp_remove(lv_disp_t * disp)
         /*Delete the screenst*/
         lv_obj_del(disp->screens[0]);
     }
+
+    /*Remove the display only after the screens as they look up their display in the list*/
+    _lv_ll_remove(&LV_GC_ROOT(_lv_disp_ll), disp);
+    lv_timer_del(disp->refr_timer);
+#if LV_USE_PERF_MONITOR
+    if(disp->perf_data) lv_mem_free(disp->perf_data);
+#endif
     lv_mem_free(disp);
 
     if(was_default) lv_disp_set_default(_lv_ll_get_head(&LV_GC_ROOT(_lv_disp_ll)));
@@ -339,19 +385,270 @@ LV_ATTRIBUTE_FLUSH_READY void lv_disp_flush_ready(lv_disp_drv_t * disp_drv)
     }
 #endif
 
-    disp_drv->draw_buf->flushing = 0;
-    disp_drv->draw_buf->flushing_last = 0;
+    /*Only this counter is written here. Other buffers might be still in the queue of the driver.*/
+    disp_drv->draw_buf->flush_ready_cnt++;
 }
 
 /**
  * Tell if it's the last area of the refreshing process.
  * Can be called from `flush_cb` to execute some special display refreshing if needed when all areas area flushed.
+ * With a chain of buffers it tells about the oldest unfinished flush, i.e. the one the next `lv_disp_flush_ready` finishes.
  * @param disp_drv pointer to display driver
  * @return true: it's the last area to flush; false: there are other areas too which will be refreshed soon
  */
 LV_ATTRIBUTE_FLUSH_READY bool lv_disp_flush_is_last(lv_disp_drv_t * disp_drv)
 {
-    return disp_drv->draw_buf->flushing_last;
+    /*The last flush is the `flush_last_cnt`th one. `flush_ready_cnt` flushes are finished before the current one.*/
+    lv_disp_draw_buf_t * draw_buf = disp_drv->draw_buf;
+    return draw_buf->flush_ready_cnt + 1 == draw_buf->flush_last_cnt;
+}
+
+/**
+ * Tell if a flush is in progress, i.e. `lv_disp_flush_ready` wasn't called yet for every started flush.
+ * Can be called from any thread or interrupt.
+ * @param disp_drv pointer to display driver
+ * @return true: at least one buffer is being flushed; false: all the flushes are finished
+ */
+LV_ATTRIBUTE_FLUSH_READY bool lv_disp_flush_is_pending(lv_disp_drv_t * disp_drv)
+{
+    lv_disp_draw_buf_t * draw_buf = disp_drv->draw_buf;
+    return draw_buf->flush_start_cnt != draw_buf->flush_ready_cnt;
+}
+
+/**
+ * Get the frame pacing statistics of a display
+ * @param disp pointer to a display (NULL to use the default display)
+ * @param stats store the statistics here
+ */
+void lv_disp_get_frame_stats(lv_disp_t * disp, lv_disp_frame_stats_t * stats)
+{
+    if(disp == NULL) disp = lv_disp_get_default();
+    if(disp == NULL) {
+        lv_memset_00(stats, sizeof(lv_disp_frame_stats_t));
+        return;
+    }
+
+    *stats = disp->frame_stats;
+}
+
+/**
+ * Clear the frame pacing statistics of a display
+ * @param disp pointer to a display (NULL to use the default display)
+ */
+void lv_disp_reset_frame_stats(lv_disp_t * disp)
+{
+    if(disp == NULL) disp = lv_disp_get_default();
+    if(disp == NULL) return;
+
+    lv_memset_00(&disp->frame_stats, sizeof(lv_disp_frame_stats_t));
+}
+
+#if LV_USE_PERF_MONITOR
+/**
+ * Get the frame time percentiles and other performance statistics of a display
+ * @param disp pointer to a display (NULL to use the default display)
+ * @param stats store the statistics here
+ */
+void lv_disp_get_perf_stats(lv_disp_t * disp, lv_disp_perf_stats_t * stats)
+{
+    lv_memset_00(stats, sizeof(lv_disp_perf_stats_t));
+    stats->cpu_idle = lv_timer_get_idle();
+
+    if(disp == NULL) disp = lv_disp_get_default();
+    if(disp == NULL) return;
+
+    stats->deadline = perf_get_deadline(disp);
+
+    const lv_disp_perf_data_t * d = disp->perf_data;
+    if(d == NULL) return;
+
+    perf_hist_eval(d->frame, d->frame_cnt, &stats->frame);
+    perf_hist_eval(d->layout, d->frame_cnt, &stats->layout);
+    perf_hist_eval(d->render, d->frame_cnt, &stats->render);
+    perf_hist_eval(d->flush_wait, d->frame_cnt, &stats->flush_wait);
+    stats->frame_cnt = d->frame_cnt;
+    stats->jank_cnt = d->jank_cnt;
+    stats->inv_px_last = d->inv_px_last;
+    stats->inv_px_max = d->inv_px_max;
+    stats->inv_px_avg = d->frame_cnt ? (uint32_t)(d->inv_px_sum / d->frame_cnt) : 0;
+}
+
+/**
+ * Get the frame time histograms of a display
+ * @param disp pointer to a display (NULL to use the default display)
+ * @return pointer to the histograms or NULL if there is no display or out of memory
+ */
+const lv_disp_perf_data_t * lv_disp_get_perf_data(lv_disp_t * disp)
+{
+    if(disp == NULL) disp = lv_disp_get_default();
+    if(disp == NULL) return NULL;
+
+    return perf_data_get(disp);
+}
+
+/**
+ * Clear the performance statistics of a display. The deadline is kept.
+ * @param disp pointer to a display (NULL to use the default display)
+ */
+void lv_disp_reset_perf_stats(lv_disp_t * disp)
+{
+    if(disp == NULL) disp = lv_disp_get_default();
+    if(disp == NULL || disp->perf_data == NULL) return;
+
+    uint32_t deadline = disp->perf_data->deadline;
+    lv_memset_00(disp->perf_data, sizeof(lv_disp_perf_data_t));
+    disp->perf_data->deadline = deadline;
+}
+
+/**
+ * Set the time limit of a frame. Longer frames are counted as jank.
+ * @param disp pointer to a display (NULL to use the default display)
+ * @param deadline the time limit in milliseconds or 0 to use the refresh period
+ */
+void lv_disp_set_frame_deadline(lv_disp_t * disp, uint32_t deadline)
+{
+    if(disp == NULL) disp = lv_disp_get_default();
+    if(disp == NULL) return;
+
+    lv_disp_perf_data_t * d = perf_data_get(disp);
+    if(d) d->deadline = deadline;
+}
+
+/**
+ * Add the times of a refresh to the performance statistics. Used by the rendering.
+ * @param disp pointer to a display
+ * @param layout_time time of updating the layouts [ms]
+ * @param render_time time of rendering without layout and waiting for the flushing [ms]
+ * @param flush_wait_time time spent with waiting for the flushing [ms]
+ * @param px number of redrawn pixels
+ */
+void _lv_disp_perf_add_frame(lv_disp_t * disp, uint32_t layout_time, uint32_t render_time,
+                             uint32_t flush_wait_time, uint32_t px)
+{
+    lv_disp_perf_data_t * d = perf_data_get(disp);
+    if(d == NULL) return;
+
+    uint32_t frame_time = layout_time + render_time + flush_wait_time;
+
+    d->frame[LV_MIN(frame_time, LV_PERF_MONITOR_HIST_SIZE - 1)]++;
+    d->layout[LV_MIN(layout_time, LV_PERF_MONITOR_HIST_SIZE - 1)]++;
+    d->render[LV_MIN(render_time, LV_PERF_MONITOR_HIST_SIZE - 1)]++;
+    d->flush_wait[LV_MIN(flush_wait_time, LV_PERF_MONITOR_HIST_SIZE - 1)]++;
+    d->frame_cnt++;
+
+    if(frame_time > perf_get_deadline(disp)) d->jank_cnt++;
+
+    d->inv_px_last = px;
+    d->inv_px_max = LV_MAX(d->inv_px_max, px);
+    d->inv_px_sum += px;
+}
+#endif
+
+/**
+ * Get the size of a pixel in a color format
+ * @param cf a color format
+ * @return the size of a pixel in bytes
+ */
+uint8_t lv_disp_color_format_get_size(lv_disp_color_format_t cf)
+{
+    switch(cf) {
+        case LV_DISP_COLOR_FORMAT_RGB565:
+        case LV_DISP_COLOR_FORMAT_RGB565_SWAP:
+            return 2;
+        case LV_DISP_COLOR_FORMAT_RGB888:
+            return 3;
+        case LV_DISP_COLOR_FORMAT_XRGB8888:
+            return 4;
+        case LV_DISP_COLOR_FORMAT_L8:
+        case LV_DISP_COLOR_FORMAT_A8:
+            return 1;
+        default:
+            return sizeof(lv_color_t);
+    }
+}
+
+/**
+ * Tell whether a color format is the same as `lv_color_t`
+ * @param cf a color format
+ * @return true: no conversion is required
+ */
+bool lv_disp_color_format_is_native(lv_disp_color_format_t cf)
+{
+    if(cf == LV_DISP_COLOR_FORMAT_NATIVE) return true;
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+    return cf == LV_DISP_COLOR_FORMAT_RGB565;
+#elif LV_COLOR_DEPTH == 16
+    return cf == LV_DISP_COLOR_FORMAT_RGB565_SWAP;
+#elif LV_COLOR_DEPTH == 32
+    return cf == LV_DISP_COLOR_FORMAT_XRGB8888;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Convert rendered pixels to a color format in place.
+ * The buffer needs to be large enough to store the converted pixels.
+ * @param buf the pixels to convert. The result is written here too.
+ * @param px_cnt number of pixels
+ * @param cf the new color format
+ */
+LV_ATTRIBUTE_FAST_MEM void lv_disp_color_format_convert(lv_color_t * buf, uint32_t px_cnt, lv_disp_color_format_t cf)
+{
+    if(px_cnt == 0 || lv_disp_color_format_is_native(cf)) return;
+
+    uint8_t * out = (uint8_t *)buf;
+    uint32_t i;
+    switch(cf) {
+#if LV_COLOR_DEPTH == 16
+        case LV_DISP_COLOR_FORMAT_RGB565:
+        case LV_DISP_COLOR_FORMAT_RGB565_SWAP:
+            /*Only the byte order is different*/
+            for(i = 0; i < px_cnt; i++) {
+                buf[i].full = (uint16_t)((buf[i].full >> 8) | (buf[i].full << 8));
+            }
+            break;
+#endif
+#if LV_COLOR_DEPTH == 32
+        case LV_DISP_COLOR_FORMAT_RGB888: {
+                /*Just drop the alpha byte from blue, green, red, alpha*/
+                const uint8_t * in = (const uint8_t *)buf;
+                for(i = 0; i < px_cnt; i++) {
+                    out[0] = in[0];
+                    out[1] = in[1];
+                    out[2] = in[2];
+                    out += 3;
+                    in += 4;
+                }
+                break;
+            }
+#endif
+        case LV_DISP_COLOR_FORMAT_L8: {
+                /*Typically there are large areas with the same color so cache the last result*/
+                lv_color_t last_color = buf[0];
+                uint8_t last_l = lv_color_brightness(last_color);
+                for(i = 0; i < px_cnt; i++) {
+                    if(buf[i].full != last_color.full) {
+                        last_color = buf[i];
+                        last_l = lv_color_brightness(last_color);
+                    }
+                    out[i] = last_l;
+                }
+                break;
+            }
+        case LV_DISP_COLOR_FORMAT_A8:
+#if LV_COLOR_DEPTH == 32
+            for(i = 0; i < px_cnt; i++) {
+                out[i] = buf[i].ch.alpha;
+            }
+#else
+            lv_memset_ff(out, px_cnt);
+#endif
+            break;
+        default:
+            color_format_convert_generic(buf, px_cnt, cf);
+            break;
+    }
 }
 
 /**
@@ -407,9 +704,107 @@ lv_disp_rot_t lv_disp_get_rotation(lv_disp_t * disp)
  *   STATIC FUNCTIONS
  **********************/
 
+#if LV_USE_PERF_MONITOR
+/**
+ * Get the performance data of a display and allocate it on the first call
+ * @param disp  pointer to a display
+ * @return      the performance data or NULL if out of memory
+ */
+static lv_disp_perf_data_t * perf_data_get(lv_disp_t * disp)
+{
+    if(disp->perf_data == NULL) {
+        disp->perf_data = lv_mem_alloc(sizeof(lv_disp_perf_data_t));
+        LV_ASSERT_MALLOC(disp->perf_data);
+        if(disp->perf_data) lv_memset_00(disp->perf_data, sizeof(lv_disp_perf_data_t));
+    }
+
+    return disp->perf_data;
+}
+
+static uint32_t perf_get_deadline(lv_disp_t * disp)
+{
+    if(disp->perf_data && disp->perf_data->deadline) return disp->perf_data->deadline;
+    return disp->refr_timer ? disp->refr_timer->period : LV_DISP_DEF_REFR_PERIOD;
+}
+
+/**
+ * Get the percentiles and the maximum of a histogram
+ * @param hist  the histogram with `LV_PERF_MONITOR_HIST_SIZE` bins
+ * @param cnt   sum of the bins
+ * @param res   store the result here
+ */
+static void perf_hist_eval(const uint32_t hist[], uint32_t cnt, lv_disp_perf_time_t * res)
+{
+    res->p50 = perf_hist_get_percentile(hist, cnt, 50);
+    res->p95 = perf_hist_get_percentile(hist, cnt, 95);
+    res->p99 = perf_hist_get_percentile(hist, cnt, 99);
+
+    res->max = 0;
+    int32_t i;
+    for(i = LV_PERF_MONITOR_HIST_SIZE - 1; i >= 0; i--) {
+        if(hist[i]) {
+            res->max = i;
+            break;
+        }
+    }
+}
+
+/**
+ * Find the smallest time which is not exceeded by `pct` percent of the frames
+ * @param hist  the histogram with `LV_PERF_MONITOR_HIST_SIZE` bins
+ * @param cnt   sum of the bins
+ * @param pct   the percentile [0..100]
+ * @return      the time in milliseconds
+ */
+static uint32_t perf_hist_get_percentile(const uint32_t hist[], uint32_t cnt, uint32_t pct)
+{
+    if(cnt == 0) return 0;
+
+    uint64_t limit = (uint64_t)cnt * pct;
+    uint64_t sum = 0;
+    uint32_t i;
+    for(i = 0; i < LV_PERF_MONITOR_HIST_SIZE - 1; i++) {
+        sum += hist[i];
+        if(sum * 100 >= limit) break;
+    }
+
+    return i;
+}
+#endif
+
 static lv_obj_tree_walk_res_t invalidate_layout_cb(lv_obj_t * obj, void * user_data)
 {
     LV_UNUSED(user_data);
     lv_obj_mark_layout_as_dirty(obj);
     return LV_OBJ_TREE_WALK_NEXT;
 }
+
+/**
+ * Convert the pixels to RGB565, RGB888 or XRGB8888 through `lv_color_to32`
+ */
+static void color_format_convert_generic(lv_color_t * buf, uint32_t px_cnt, lv_disp_color_format_t cf)
+{
+    uint8_t px_size = lv_disp_color_format_get_size(cf);
+    uint8_t * out = (uint8_t *)buf;
+
+    /*If the pixels get larger go backward to not overwrite the not converted pixels*/
+    bool backward = px_size > sizeof(lv_color_t);
+    uint32_t n;
+    for(n = 0; n < px_cnt; n++) {
+        uint32_t i = backward ? px_cnt - 1 - n : n;
+        lv_color32_t c32;
+        c32.full = lv_color_to32(buf[i]);
+        uint8_t * px = &out[i * px_size];
+        if(px_size == 2) {
+            uint16_t c16 = (uint16_t)(((c32.ch.red >> 3) << 11) | ((c32.ch.green >> 2) << 5) | (c32.ch.blue >> 3));
+            if(cf == LV_DISP_COLOR_FORMAT_RGB565_SWAP) c16 = (uint16_t)((c16 >> 8) | (c16 << 8));
+            lv_memcpy_small(px, &c16, 2);
+        }
+        else {
+            px[0] = c32.ch.blue;
+            px[1] = c32.ch.green;
+            px[2] = c32.ch.red;
+            if(px_size == 4) px[3] = 0xFF;
+        }
+    }
+}
@@ -30,6 +30,10 @@ extern "C" {
 #define LV_INV_BUF_SIZE 32 /*Buffer size for invalid areas*/
 #endif
 
+#ifndef LV_DISP_DAMAGE_HISTORY
+#define LV_DISP_DAMAGE_HISTORY 3 /*Number of frames to remember the changed areas of. (Max. number of buffers - 1 for `buffer_age`)*/
+#endif
+
 #ifndef LV_ATTRIBUTE_FLUSH_READY
 #define LV_ATTRIBUTE_FLUSH_READY
 #endif
@@ -41,6 +45,7 @@ extern "C" {
 struct _lv_obj_t;
 struct _lv_disp_t;
 struct _lv_disp_drv_t;
+struct _lv_draw_backend_t;
 struct _lv_theme_t;
 
 /**
@@ -54,12 +59,21 @@ typedef struct _lv_disp_draw_buf_t{
     void * buf_act;
     uint32_t size; /*In pixel count*/
     lv_area_t area;
-    /*1: flushing is in progress. (It can't be a bit field because when it's cleared from IRQ Read-Modify-Write issue might occur)*/
+    /*1: flushing is in progress. Kept for the drivers reading it. Read-only: it's written only by the rendering,
+     *when a flush starts and when the rendering waits for the flushes. Use `lv_disp_flush_is_pending()` to poll it.*/
     volatile int flushing;
-    /*1: It was the last chunk to flush. (It can't be a bit field because when it's cleared from IRQ Read-Modify-Write issue might occur)*/
+    /*1: the last chunk of the refresh is being flushed. Read-only, written like `flushing`.*/
     volatile int flushing_last;
     volatile uint32_t last_area         : 1; /*1: the last area is being rendered*/
     volatile uint32_t last_part         : 1; /*1: the last part of the current area is being rendered*/
+    void ** buf_chain;  /*All the buffers if initialized with `lv_disp_draw_buf_init_chain`*/
+    uint8_t buf_cnt;    /*Number of buffers*/
+    uint8_t buf_act_id; /*Index of `buf_act` in `buf_chain`*/
+    /*Number of started and finished flushes. (Separate counters because they are written from different threads)*/
+    volatile uint32_t flush_start_cnt;  /*Written only by the rendering*/
+    volatile uint32_t flush_ready_cnt;  /*Written only by `lv_disp_flush_ready`*/
+    /*`flush_start_cnt` after starting the last flush of a refresh. 0: no such flush yet. Written only by the rendering*/
+    volatile uint32_t flush_last_cnt;
 } lv_disp_draw_buf_t;
 
 typedef enum {
@@ -69,6 +83,20 @@ typedef enum {
     LV_DISP_ROT_270
 } lv_disp_rot_t;
 
+/**
+ * Color format of the buffers passed to `flush_cb`.
+ * LVGL renders with `lv_color_t` and converts the rendered pixels to this format just before flushing.
+ */
+typedef enum {
+    LV_DISP_COLOR_FORMAT_NATIVE = 0,    /**< `lv_color_t` as set by `LV_COLOR_DEPTH`. No conversion.*/
+    LV_DISP_COLOR_FORMAT_RGB565,        /**< 16 bit RGB565 in the CPU's byte order*/
+    LV_DISP_COLOR_FORMAT_RGB565_SWAP,   /**< 16 bit RGB565 with swapped bytes (e.g. for SPI displays)*/
+    LV_DISP_COLOR_FORMAT_RGB888,        /**< 3 bytes per pixel in blue, green, red order*/
+    LV_DISP_COLOR_FORMAT_XRGB8888,      /**< 32 bit, the X byte is not used*/
+    LV_DISP_COLOR_FORMAT_L8,            /**< 8 bit luminance (grayscale)*/
+    LV_DISP_COLOR_FORMAT_A8,            /**< 8 bit alpha (only the alpha channel of `LV_COLOR_DEPTH 32`, else 0xFF)*/
+} lv_disp_color_format_t;
+
 /**
  * Display Driver structure to be registered by HAL.
  * Only its pointer will be saved in `lv_disp_t` so it should be declared as
@@ -84,6 +112,8 @@ typedef struct _lv_disp_drv_t {
     lv_disp_draw_buf_t * draw_buf;
 
     uint32_t full_refresh : 1;       /**< 1: Always make the whole screen redrawn*/
+    uint32_t buffer_age : 1;         /**< 1: With `full_refresh` redraw only the changed areas and copy the earlier changes
+                                       * from the previous buffer. `flush_cb` still gets complete frames.*/
     uint32_t sw_rotate : 1;          /**< 1: use software rotation (slower)*/
     uint32_t antialiasing : 1;       /**< 1: anti-aliasing is enabled on this display.*/
     uint32_t rotated : 2;            /**< 1: turn the display by 90 degree. @warning Does not update coordinates for you!*/
@@ -92,6 +122,9 @@ typedef struct _lv_disp_drv_t {
 
     uint32_t dpi : 10;              /** DPI (dot per inch) of the display. Default value is `LV_DPI_DEF`.*/
 
+    uint32_t color_format : 3;      /**< Color format of the buffers passed to `flush_cb`. See `lv_disp_color_format_t`.
+                                      * Formats larger than `lv_color_t` can't be used with `full_refresh` and `sw_rotate`.*/
+
     /** MANDATORY: Write the internal buffer (draw_buf) to the display. 'lv_disp_flush_ready()' has to be
      * called when finished*/
     void (*flush_cb)(struct _lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
@@ -128,6 +161,10 @@ typedef struct _lv_disp_drv_t {
     void (*gpu_fill_cb)(struct _lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, lv_coord_t dest_width,
                         const lv_area_t * fill_area, lv_color_t color);
 
+    /** Draw operations to offload, e.g. to a GPU. `lv_draw_backend_get_default()` by default.
+     * `NULL` or `&lv_draw_backend_sw` to render everything by software.*/
+    const struct _lv_draw_backend_t * draw_backend;
+
     /** On CHROMA_KEYED images this color will be transparent.
      * `LV_COLOR_CHROMA_KEY` by default. (lv_conf.h)*/
     lv_color_t color_chroma_key;
@@ -138,6 +175,55 @@ typedef struct _lv_disp_drv_t {
 
 } lv_disp_drv_t;
 
+/*Frame pacing statistics of a display*/
+typedef struct {
+    uint32_t frame_cnt;             /**< Number of refreshes which redrew something*/
+    uint32_t dropped_cnt;           /**< Number of refresh periods missed because a refresh took longer*/
+    uint32_t render_time;           /**< Time of the last refresh without waiting for the flushing [ms]*/
+    uint32_t flush_wait_time;       /**< Time spent with waiting for the flushing in the last refresh [ms]*/
+    uint32_t render_time_sum;       /**< Sum of `render_time` of all frames [ms]*/
+    uint32_t flush_wait_time_sum;   /**< Sum of `flush_wait_time` of all frames [ms]*/
+} lv_disp_frame_stats_t;
+
+#if LV_USE_PERF_MONITOR
+/*Frame time histograms of a display. Bin `i` counts the frames which took `i` ms*/
+typedef struct {
+    uint32_t frame[LV_PERF_MONITOR_HIST_SIZE];      /**< Whole time of the refreshes*/
+    uint32_t layout[LV_PERF_MONITOR_HIST_SIZE];     /**< Time of updating the layouts*/
+    uint32_t render[LV_PERF_MONITOR_HIST_SIZE];     /**< Time of rendering without layout and waiting for the flushing*/
+    uint32_t flush_wait[LV_PERF_MONITOR_HIST_SIZE]; /**< Time spent with waiting for the flushing*/
+    uint32_t frame_cnt;                             /**< Number of refreshes which redrew something*/
+    uint32_t jank_cnt;                              /**< Number of frames which took longer than the deadline*/
+    uint32_t deadline;                              /**< Time limit of a frame [ms]. 0: the refresh period*/
+    uint32_t inv_px_last;                           /**< Number of redrawn pixels in the last frame*/
+    uint32_t inv_px_max;                            /**< Largest number of redrawn pixels in a frame*/
+    uint64_t inv_px_sum;                            /**< Number of redrawn pixels in all frames*/
+} lv_disp_perf_data_t;
+
+/*Percentiles of a frame time histogram [ms]*/
+typedef struct {
+    uint32_t p50;
+    uint32_t p95;
+    uint32_t p99;
+    uint32_t max;
+} lv_disp_perf_time_t;
+
+/*Summary of the frame time statistics of a display*/
+typedef struct {
+    lv_disp_perf_time_t frame;
+    lv_disp_perf_time_t layout;
+    lv_disp_perf_time_t render;
+    lv_disp_perf_time_t flush_wait;
+    uint32_t frame_cnt;             /**< Number of refreshes which redrew something*/
+    uint32_t jank_cnt;              /**< Number of frames which took longer than the deadline*/
+    uint32_t deadline;              /**< The applied deadline [ms]*/
+    uint32_t inv_px_last;           /**< Number of redrawn pixels in the last frame*/
+    uint32_t inv_px_avg;            /**< Average number of redrawn pixels per frame*/
+    uint32_t inv_px_max;            /**< Largest number of redrawn pixels in a frame*/
+    uint8_t cpu_idle;               /**< CPU idle from `lv_timer_get_idle()` [%]*/
+} lv_disp_perf_stats_t;
+#endif
+
 /**
  * Display structure.
  * @note `lv_disp_drv_t` should be the first member of the structure.
@@ -171,8 +257,16 @@ typedef struct _lv_disp_t {
     uint8_t inv_area_joined[LV_INV_BUF_SIZE];
     uint16_t inv_p;
 
+    /** Bounding box of the changed areas of the last frames. Used with `buffer_age`*/
+    lv_area_t damage_history[LV_DISP_DAMAGE_HISTORY];
+    uint32_t damage_frame_cnt;      /**< Number of frames rendered in `buffer_age` mode*/
+
     /*Miscellaneous data*/
     uint32_t last_activity_time;        /**< Last time when there was activity on this display*/
+    lv_disp_frame_stats_t frame_stats;  /**< @see lv_disp_get_frame_stats*/
+#if LV_USE_PERF_MONITOR
+    lv_disp_perf_data_t * perf_data;    /**< Allocated on the first use. @see lv_disp_get_perf_stats*/
+#endif
 } lv_disp_t;
 
 /**********************
@@ -204,6 +298,19 @@ void lv_disp_drv_init(lv_disp_drv_t * driver);
  */
 void lv_disp_draw_buf_init(lv_disp_draw_buf_t * draw_buf, void * buf1, void * buf2, uint32_t size_in_px_cnt);
 
+/**
+ * Initialize a display buffer with a chain of buffers to render ahead while the previous buffers are being flushed.
+ * With more than 2 buffers `flush_cb` can be called again before `lv_disp_flush_ready` is called for the previous
+ * buffers. The driver should queue the flushes (e.g. in a flush thread) and call `lv_disp_flush_ready` in order
+ * for each of them. `lv_disp_flush_ready` can be called from any thread.
+ * @param draw_buf pointer `lv_disp_draw_buf_t` variable to initialize
+ * @param bufs array of buffers. Only its pointer is saved so it can't be a local variable.
+ * @param buf_cnt number of buffers in `bufs` (at least 1)
+ * @param size_in_px_cnt size of the each buffer in pixel count.
+ */
+void lv_disp_draw_buf_init_chain(lv_disp_draw_buf_t * draw_buf, void ** bufs, uint8_t buf_cnt,
+                                 uint32_t size_in_px_cnt);
+
 /**
  * Register an initialized display driver.
  * Automatically set the first display as active.
@@ -291,11 +398,96 @@ LV_ATTRIBUTE_FLUSH_READY void lv_disp_flush_ready(lv_disp_drv_t * disp_drv);
 /**
  * Tell if it's the last area of the refreshing process.
  * Can be called from `flush_cb` to execute some special display refreshing if needed when all areas area flushed.
+ * With a chain of buffers it tells about the oldest unfinished flush, i.e. the one the next `lv_disp_flush_ready` finishes.
  * @param disp_drv pointer to display driver
  * @return true: it's the last area to flush; false: there are other areas too which will be refreshed soon
  */
 LV_ATTRIBUTE_FLUSH_READY bool lv_disp_flush_is_last(lv_disp_drv_t * disp_drv);
 
+/**
+ * Tell if a flush is in progress, i.e. `lv_disp_flush_ready` wasn't called yet for every started flush.
+ * Can be called from any thread or interrupt.
+ * @param disp_drv pointer to display driver
+ * @return true: at least one buffer is being flushed; false: all the flushes are finished
+ */
+LV_ATTRIBUTE_FLUSH_READY bool lv_disp_flush_is_pending(lv_disp_drv_t * disp_drv);
+
+/**
+ * Get the frame pacing statistics of a display
+ * @param disp pointer to a display (NULL to use the default display)
+ * @param stats store the statistics here
+ */
+void lv_disp_get_frame_stats(lv_disp_t * disp, lv_disp_frame_stats_t * stats);
+
+/**
+ * Clear the frame pacing statistics of a display
+ * @param disp pointer to a display (NULL to use the default display)
+ */
+void lv_disp_reset_frame_stats(lv_disp_t * disp);
+
+#if LV_USE_PERF_MONITOR
+/**
+ * Get the frame time percentiles and other performance statistics of a display
+ * @param disp pointer to a display (NULL to use the default display)
+ * @param stats store the statistics here
+ */
+void lv_disp_get_perf_stats(lv_disp_t * disp, lv_disp_perf_stats_t * stats);
+
+/**
+ * Get the frame time histograms of a display
+ * @param disp pointer to a display (NULL to use the default display)
+ * @return pointer to the histograms or NULL if there is no display or out of memory
+ */
+const lv_disp_perf_data_t * lv_disp_get_perf_data(lv_disp_t * disp);
+
+/**
+ * Clear the performance statistics of a display. The deadline is kept.
+ * @param disp pointer to a display (NULL to use the default display)
+ */
+void lv_disp_reset_perf_stats(lv_disp_t * disp);
+
+/**
+ * Set the time limit of a frame. Longer frames are counted as jank.
+ * @param disp pointer to a display (NULL to use the default display)
+ * @param deadline the time limit in milliseconds or 0 to use the refresh period
+ */
+void lv_disp_set_frame_deadline(lv_disp_t * disp, uint32_t deadline);
+
+/**
+ * Add the times of a refresh to the performance statistics. Used by the rendering.
+ * @param disp pointer to a display
+ * @param layout_time time of updating the layouts [ms]
+ * @param render_time time of rendering without layout and waiting for the flushing [ms]
+ * @param flush_wait_time time spent with waiting for the flushing [ms]
+ * @param px number of redrawn pixels
+ */
+void _lv_disp_perf_add_frame(lv_disp_t * disp, uint32_t layout_time, uint32_t render_time,
+                             uint32_t flush_wait_time, uint32_t px);
+#endif
+
+/**
+ * Get the size of a pixel in a color format
+ * @param cf a color format
+ * @return the size of a pixel in bytes
+ */
+uint8_t lv_disp_color_format_get_size(lv_disp_color_format_t cf);
+
+/**
+ * Tell whether a color format is the same as `lv_color_t`
+ * @param cf a color format
+ * @return true: no conversion is required
+ */
+bool lv_disp_color_format_is_native(lv_disp_color_format_t cf);
+
+/**
+ * Convert rendered pixels to a color format in place.
+ * The buffer needs to be large enough to store the converted pixels.
+ * @param buf the pixels to convert. The result is written here too.
+ * @param px_cnt number of pixels
+ * @param cf the new color format
+ */
+LV_ATTRIBUTE_FAST_MEM void lv_disp_color_format_convert(lv_color_t * buf, uint32_t px_cnt, lv_disp_color_format_t cf);
+
 //! @endcond
 
 /**
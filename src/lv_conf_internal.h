@@ -123,6 +123,46 @@
 #    define  LV_MEM_ADR          0     /*0: unused*/
 #  endif
 #endif
+
+/*Add a new memory pool of at least this size when `LV_MEM_SIZE` is exhausted. 0: don't add pools*/
+#ifndef LV_MEM_POOL_EXPAND_SIZE
+#  ifdef CONFIG_LV_MEM_POOL_EXPAND_SIZE
+#    define LV_MEM_POOL_EXPAND_SIZE CONFIG_LV_MEM_POOL_EXPAND_SIZE
+#  else
+#    define  LV_MEM_POOL_EXPAND_SIZE   0     /*[bytes]*/
+#  endif
+#endif
+#if LV_MEM_POOL_EXPAND_SIZE
+/*Max. total size of the memory pools including `LV_MEM_SIZE`*/
+#ifndef LV_MEM_POOL_MAX_SIZE
+#  ifdef CONFIG_LV_MEM_POOL_MAX_SIZE
+#    define LV_MEM_POOL_MAX_SIZE CONFIG_LV_MEM_POOL_MAX_SIZE
+#  else
+#    define  LV_MEM_POOL_MAX_SIZE    (64U * 1024U * 1024U)  /*[bytes]*/
+#  endif
+#endif
+#ifndef LV_MEM_POOL_INCLUDE
+#  ifdef CONFIG_LV_MEM_POOL_INCLUDE
+#    define LV_MEM_POOL_INCLUDE CONFIG_LV_MEM_POOL_INCLUDE
+#  else
+#    define  LV_MEM_POOL_INCLUDE     <stdlib.h>   /*Header for the functions providing the memory of the pools*/
+#  endif
+#endif
+#ifndef LV_MEM_POOL_ALLOC
+#  ifdef CONFIG_LV_MEM_POOL_ALLOC
+#    define LV_MEM_POOL_ALLOC CONFIG_LV_MEM_POOL_ALLOC
+#  else
+#    define  LV_MEM_POOL_ALLOC       malloc
+#  endif
+#endif
+#ifndef LV_MEM_POOL_FREE
+#  ifdef CONFIG_LV_MEM_POOL_FREE
+#    define LV_MEM_POOL_FREE CONFIG_LV_MEM_POOL_FREE
+#  else
+#    define  LV_MEM_POOL_FREE        free
+#  endif
+#endif
+#endif  /*LV_MEM_POOL_EXPAND_SIZE*/
 #else       /*LV_MEM_CUSTOM*/
 #ifndef LV_MEM_CUSTOM_INCLUDE
 #  ifdef CONFIG_LV_MEM_CUSTOM_INCLUDE
@@ -163,6 +203,37 @@
 #  endif
 #endif
 
+/*Max. size of the arena of `lv_mem_buf_get()`. It grows to the need of the frames up to this size
+ *and shrinks if it's much larger than needed for a while. Larger needs are allocated from the heap.*/
+#ifndef LV_MEM_BUF_ARENA_MAX_SIZE
+#  ifdef CONFIG_LV_MEM_BUF_ARENA_MAX_SIZE
+#    define LV_MEM_BUF_ARENA_MAX_SIZE CONFIG_LV_MEM_BUF_ARENA_MAX_SIZE
+#  else
+#    define  LV_MEM_BUF_ARENA_MAX_SIZE   (16U * 1024U)   /*[bytes]*/
+#  endif
+#endif
+
+/*1: Attribute every allocation to a subsystem (object, style, timer, etc.) and its call site
+ *to find what fills the heap. See `lv_mem_tag_monitor()` and `lv_mem_tag_dump()`.
+ *Adds a small header to every allocation*/
+#ifndef LV_USE_MEM_TAG
+#  ifdef CONFIG_LV_USE_MEM_TAG
+#    define LV_USE_MEM_TAG CONFIG_LV_USE_MEM_TAG
+#  else
+#    define  LV_USE_MEM_TAG          0
+#  endif
+#endif
+#if LV_USE_MEM_TAG
+/*Number of call sites to track. The allocations of further call sites are counted only for their tag*/
+#ifndef LV_MEM_TAG_SITE_CNT
+#  ifdef CONFIG_LV_MEM_TAG_SITE_CNT
+#    define LV_MEM_TAG_SITE_CNT CONFIG_LV_MEM_TAG_SITE_CNT
+#  else
+#    define  LV_MEM_TAG_SITE_CNT   64
+#  endif
+#endif
+#endif  /*LV_USE_MEM_TAG*/
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -250,8 +321,59 @@
 #    define  LV_SHADOW_CACHE_SIZE    0
 #  endif
 #endif
+
+/*Number of circle (rounded corner) coverage tables to cache.
+ *Radius masks with a cached radius don't need to calculate the coverage of the corners again.
+ *A table takes about `radius * 7` bytes. 0: to disable caching*/
+#ifndef LV_CIRCLE_CACHE_SIZE
+#  ifdef CONFIG_LV_CIRCLE_CACHE_SIZE
+#    define LV_CIRCLE_CACHE_SIZE CONFIG_LV_CIRCLE_CACHE_SIZE
+#  else
+#    define  LV_CIRCLE_CACHE_SIZE    4
+#  endif
+#endif
+
+/*Max. memory of the cached circle coverage tables. Larger circles are not cached*/
+#ifndef LV_CIRCLE_CACHE_MEM_SIZE
+#  ifdef CONFIG_LV_CIRCLE_CACHE_MEM_SIZE
+#    define LV_CIRCLE_CACHE_MEM_SIZE CONFIG_LV_CIRCLE_CACHE_MEM_SIZE
+#  else
+#    define  LV_CIRCLE_CACHE_MEM_SIZE    (8U * 1024U)    /*[bytes]*/
+#  endif
+#endif
+
+/*Max. memory (in bytes) to cache the colors of gradients.
+ *Gradients with the same colors, stops and size are calculated only once.
+ *0: to disable caching and calculate the colors for every draw*/
+#ifndef LV_GRAD_CACHE_DEF_SIZE
+#  ifdef CONFIG_LV_GRAD_CACHE_DEF_SIZE
+#    define LV_GRAD_CACHE_DEF_SIZE CONFIG_LV_GRAD_CACHE_DEF_SIZE
+#  else
+#    define  LV_GRAD_CACHE_DEF_SIZE  0
+#  endif
+#endif
+
+/*Dither the gradients with an ordered (4x4 Bayer) pattern to avoid color banding.
+ *Used only with LV_COLOR_DEPTH 16. Requires 3 times more memory in the gradient cache and a line buffer while drawing*/
+#ifndef LV_DITHER_GRADIENT
+#  ifdef CONFIG_LV_DITHER_GRADIENT
+#    define LV_DITHER_GRADIENT CONFIG_LV_DITHER_GRADIENT
+#  else
+#    define  LV_DITHER_GRADIENT      0
+#  endif
+#endif
 #endif /*LV_DRAW_COMPLEX*/
 
+/*1: Don't draw the parts of the objects which are covered by opaque objects drawn later.
+ *Relies on `LV_EVENT_COVER_CHECK`, so custom widgets should report the covered areas correctly.*/
+#ifndef LV_USE_OCCLUSION_CULLING
+#  ifdef CONFIG_LV_USE_OCCLUSION_CULLING
+#    define LV_USE_OCCLUSION_CULLING CONFIG_LV_USE_OCCLUSION_CULLING
+#  else
+#    define  LV_USE_OCCLUSION_CULLING    0
+#  endif
+#endif
+
 /*Default image cache size. Image caching keeps the images opened.
  *If only the built-in image formats are used there is no real advantage of caching. (I.e. if no new image decoder is added)
  *With complex image decoders (e.g. PNG or JPG) caching can save the continuous open/decode of images.
@@ -265,7 +387,8 @@
 #  endif
 #endif
 
-/*Maximum buffer size to allocate for rotation. Only used if software rotation is enabled in the display driver.*/
+/*Maximum buffer size to allocate for rotation. Only used if software rotation is enabled in the display driver.
+ *Two buffers of this size are used to rotate the next part of the image while the previous part is being flushed.*/
 #ifndef LV_DISP_ROT_MAX_BUF
 #  ifdef CONFIG_LV_DISP_ROT_MAX_BUF
 #    define LV_DISP_ROT_MAX_BUF CONFIG_LV_DISP_ROT_MAX_BUF
@@ -428,6 +551,30 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 
 #endif  /*LV_USE_LOG*/
 
+/*-------------
+ * Tracing
+ *-----------*/
+
+/*1: Record the time spent in the timers, layout update, rendering, drawing and flushing into a ring buffer.
+ *It can be dumped in Chrome's trace event format with `lv_trace_dump()`*/
+#ifndef LV_USE_TRACE
+#  ifdef CONFIG_LV_USE_TRACE
+#    define LV_USE_TRACE CONFIG_LV_USE_TRACE
+#  else
+#    define  LV_USE_TRACE        0
+#  endif
+#endif
+#if LV_USE_TRACE
+/*Number of events to store. The oldest events are overwritten*/
+#ifndef LV_TRACE_BUF_SIZE
+#  ifdef CONFIG_LV_TRACE_BUF_SIZE
+#    define LV_TRACE_BUF_SIZE CONFIG_LV_TRACE_BUF_SIZE
+#  else
+#    define  LV_TRACE_BUF_SIZE 4096
+#  endif
+#endif
+#endif  /*LV_USE_TRACE*/
+
 /*-------------
  * Asserts
  *-----------*/
@@ -490,7 +637,7 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
  * Others
  *-----------*/
 
-/*1: Show CPU usage and FPS count in the right bottom corner*/
+/*1: Collect frame time statistics of the displays (see `lv_disp_get_perf_stats()`)*/
 #ifndef LV_USE_PERF_MONITOR
 #  ifdef CONFIG_LV_USE_PERF_MONITOR
 #    define LV_USE_PERF_MONITOR CONFIG_LV_USE_PERF_MONITOR
@@ -498,6 +645,25 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 #    define  LV_USE_PERF_MONITOR     0
 #  endif
 #endif
+#if LV_USE_PERF_MONITOR
+    /*1: Show FPS, CPU usage and frame time percentiles in the right bottom corner*/
+#ifndef LV_PERF_MONITOR_SHOW_LABEL
+#  ifdef CONFIG_LV_PERF_MONITOR_SHOW_LABEL
+#    define LV_PERF_MONITOR_SHOW_LABEL CONFIG_LV_PERF_MONITOR_SHOW_LABEL
+#  else
+#    define  LV_PERF_MONITOR_SHOW_LABEL  1
+#  endif
+#endif
+
+    /*Number of 1 ms wide bins of the frame time histograms. Longer times are counted in the last bin*/
+#ifndef LV_PERF_MONITOR_HIST_SIZE
+#  ifdef CONFIG_LV_PERF_MONITOR_HIST_SIZE
+#    define LV_PERF_MONITOR_HIST_SIZE CONFIG_LV_PERF_MONITOR_HIST_SIZE
+#  else
+#    define  LV_PERF_MONITOR_HIST_SIZE   64
+#  endif
+#endif
+#endif
 
 /*1: Show the used memory and the memory fragmentation  in the left bottom corner
  * Requires LV_MEM_CUSTOM = 0*/
@@ -518,6 +684,26 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 #  endif
 #endif
 
+/*1: Measure the time and pixels spent drawing each object and each widget class.
+ *See `lv_refr_profiler.h` for the API to get the most expensive ones*/
+#ifndef LV_USE_REFR_PROFILER
+#  ifdef CONFIG_LV_USE_REFR_PROFILER
+#    define LV_USE_REFR_PROFILER CONFIG_LV_USE_REFR_PROFILER
+#  else
+#    define  LV_USE_REFR_PROFILER    0
+#  endif
+#endif
+#if LV_USE_REFR_PROFILER
+    /*Number of objects to keep statistics about. If the table is full the cheapest objects are dropped*/
+#ifndef LV_REFR_PROFILER_OBJ_CNT
+#  ifdef CONFIG_LV_REFR_PROFILER_OBJ_CNT
+#    define LV_REFR_PROFILER_OBJ_CNT CONFIG_LV_REFR_PROFILER_OBJ_CNT
+#  else
+#    define  LV_REFR_PROFILER_OBJ_CNT    64
+#  endif
+#endif
+#endif
+
 /*Change the built in (v)snprintf functions*/
 #ifndef LV_SPRINTF_CUSTOM
 #  ifdef CONFIG_LV_SPRINTF_CUSTOM
@@ -558,6 +744,17 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 #endif
 #endif  /*LV_SPRINTF_CUSTOM*/
 
+/*Number of inherited style property values (e.g. text font and color) to cache.
+ *The cached values are not searched in the parents again until a style, state or parent changes.
+ *A list of ~20 labels needs ~64 to keep the hit rate around 90%. 0: to disable caching*/
+#ifndef LV_STYLE_INHERIT_CACHE_SIZE
+#  ifdef CONFIG_LV_STYLE_INHERIT_CACHE_SIZE
+#    define LV_STYLE_INHERIT_CACHE_SIZE CONFIG_LV_STYLE_INHERIT_CACHE_SIZE
+#  else
+#    define  LV_STYLE_INHERIT_CACHE_SIZE 64
+#  endif
+#endif
+
 #ifndef LV_USE_USER_DATA
 #  ifdef CONFIG_LV_USE_USER_DATA
 #    define LV_USE_USER_DATA CONFIG_LV_USE_USER_DATA
@@ -1451,6 +1648,16 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 #    define  LV_THEME_DEFAULT_TRANSITON_TIME    80
 #  endif
 #endif
+
+/*1: Use constant styles generated by scripts/style_const_gen.py if the display has LV_DPI_DEF.
+ *   Saves RAM and the time of building the styles*/
+#ifndef LV_THEME_DEFAULT_CONST
+#  ifdef CONFIG_LV_THEME_DEFAULT_CONST
+#    define LV_THEME_DEFAULT_CONST CONFIG_LV_THEME_DEFAULT_CONST
+#  else
+#    define  LV_THEME_DEFAULT_CONST             0
+#  endif
+#endif
 #endif /*LV_USE_THEME_DEFAULT*/
 
 /*An very simple them that is a good starting point for a custom theme*/
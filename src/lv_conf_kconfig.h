@@ -32,6 +32,18 @@ extern "C" {
 #endif
 #endif
 
+#ifndef LV_MEM_POOL_EXPAND_SIZE
+#if defined (CONFIG_LV_MEM_POOL_EXPAND_SIZE_KILOBYTES)
+#define CONFIG_LV_MEM_POOL_EXPAND_SIZE    (CONFIG_LV_MEM_POOL_EXPAND_SIZE_KILOBYTES * 1024U)
+#endif
+#endif
+
+#ifndef LV_MEM_POOL_MAX_SIZE
+#if defined (CONFIG_LV_MEM_POOL_MAX_SIZE_KILOBYTES)
+#define CONFIG_LV_MEM_POOL_MAX_SIZE    (CONFIG_LV_MEM_POOL_MAX_SIZE_KILOBYTES * 1024U)
+#endif
+#endif
+
 /*******************
  * LV COLOR CHROMA KEY
  *******************/
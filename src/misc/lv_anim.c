@@ -88,7 +88,9 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
     }
 
     /*Add the new animation to the animation linked list*/
+    LV_MEM_TAG_PUSH(LV_MEM_TAG_ANIM);
     lv_anim_t * new_anim = _lv_ll_ins_head(&LV_GC_ROOT(_lv_anim_ll));
+    LV_MEM_TAG_POP();
     LV_ASSERT_MALLOC(new_anim);
     if(new_anim == NULL) return NULL;
 
@@ -20,7 +20,9 @@ extern "C" {
 #include "lv_timer.h"
 #include "../draw/lv_img_cache.h"
 #include "../draw/lv_draw_mask.h"
+#include "../draw/lv_draw_grad.h"
 #include "../core/lv_obj_pos.h"
+#include "../core/lv_obj.h"
 
 /*********************
  *      DEFINES
@@ -31,6 +33,18 @@ extern "C" {
 #    define LV_IMG_CACHE_DEF            0
 #endif
 
+#if LV_DRAW_COMPLEX && LV_CIRCLE_CACHE_SIZE
+#    define LV_CIRCLE_CACHE_DEF         1
+#else
+#    define LV_CIRCLE_CACHE_DEF         0
+#endif
+
+#if LV_DRAW_COMPLEX && LV_GRAD_CACHE_DEF_SIZE
+#    define LV_GRAD_CACHE_DEF           1
+#else
+#    define LV_GRAD_CACHE_DEF           0
+#endif
+
 #define LV_DISPATCH(f, t, n)            f(t, n)
 #define LV_DISPATCH_COND(f, t, n, m, v) LV_CONCAT3(LV_DISPATCH, m, v)(f, t, n)
 
@@ -49,11 +63,14 @@ extern "C" {
     LV_DISPATCH(f, lv_ll_t, _lv_img_decoder_ll)                                             \
     LV_DISPATCH(f, lv_ll_t, _lv_obj_style_trans_ll)                                         \
     LV_DISPATCH(f, lv_layout_dsc_t *, _lv_layout_list)      \
+    LV_DISPATCH(f, _lv_obj_style_users_t *, _lv_obj_style_users)                            \
     LV_DISPATCH_COND(f, _lv_img_cache_entry_t*, _lv_img_cache_array, LV_IMG_CACHE_DEF, 1)    \
     LV_DISPATCH_COND(f, _lv_img_cache_entry_t, _lv_img_cache_single, LV_IMG_CACHE_DEF, 0)    \
     LV_DISPATCH(f, lv_timer_t*, _lv_timer_act)                                              \
-    LV_DISPATCH(f, lv_mem_buf_arr_t , lv_mem_buf)                                           \
+    LV_DISPATCH(f, lv_mem_buf_arena_t , lv_mem_buf_arena)                                   \
     LV_DISPATCH_COND(f, _lv_draw_mask_saved_arr_t , _lv_draw_mask_list, LV_DRAW_COMPLEX, 1) \
+    LV_DISPATCH_COND(f, _lv_draw_mask_radius_circle_dsc_arr_t , _lv_circle_cache, LV_CIRCLE_CACHE_DEF, 1) \
+    LV_DISPATCH_COND(f, _lv_grad_cache_arr_t , _lv_grad_cache, LV_GRAD_CACHE_DEF, 1) \
     LV_DISPATCH(f, void * , _lv_theme_default_styles)                                       \
     LV_DISPATCH_COND(f, uint8_t *, _lv_font_decompr_buf, LV_USE_FONT_COMPRESSED, 1)
 
@@ -15,8 +15,15 @@
 
 #if LV_MEM_CUSTOM != 0
     #include LV_MEM_CUSTOM_INCLUDE
+#elif LV_MEM_POOL_EXPAND_SIZE
+    #include LV_MEM_POOL_INCLUDE
 #endif
 
+#if LV_USE_MEM_TAG
+    /*lv_mem.h redirects them to the tagging functions but they are normal functions here*/
+    #undef lv_mem_alloc
+    #undef lv_mem_realloc
+#endif
 
 /*********************
  *      DEFINES
@@ -36,15 +43,74 @@
 
 #define ZERO_MEM_SENTINEL  0xa1b2c3d4
 
+#define BUF_HEADER_SIZE    ((sizeof(buf_header_t) + ALIGN_MASK) & ~ALIGN_MASK)
+#define BUF_FULL_SIZE(size) (BUF_HEADER_SIZE + (((size) + ALIGN_MASK) & ~ALIGN_MASK))
+
+/*Shrink the arena if it was more than twice as large as needed in this many frames in a row*/
+#define ARENA_SHRINK_FRAMES 32
+
+#if LV_MEM_CUSTOM == 0
+#  define POOL_HEADER_SIZE ((sizeof(pool_header_t) + ALIGN_MASK) & ~ALIGN_MASK)
+#  define POOL_GET_TLSF_POOL(header) ((lv_pool_t)((uint8_t *)(header) + POOL_HEADER_SIZE))
+#endif
+
+#if LV_USE_MEM_TAG
+#  define TAG_HEADER_SIZE  ((sizeof(tag_header_t) + ALIGN_MASK) & ~ALIGN_MASK)
+#  define SITE_NONE        0xFFFF
+#  define SITE_HASH_SIZE   (LV_MEM_TAG_SITE_CNT * 2)
+#  define DUMP_SITE_CNT    10
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
+/*Stored before every temporal buffer*/
+typedef struct _buf_header_t {
+    struct _buf_header_t * next;    /*Next buffer allocated from the heap. Used only if `heap == 1`*/
+    uint32_t prev;      /*Offset of the previous buffer's header in the arena*/
+    uint32_t gen;       /*`gen` of the arena when the buffer was got*/
+    uint32_t size : 30; /*Size of the buffer with the header*/
+    uint32_t used : 1;
+    uint32_t heap : 1;  /*1: allocated from the heap because the arena was full*/
+} buf_header_t;
+
+#if LV_MEM_CUSTOM == 0
+/*Stored at the beginning of the pools added after the first one*/
+typedef struct _pool_header_t {
+    struct _pool_header_t * next;
+    size_t size;        /*Size of the pool with the header*/
+    uint8_t allocated;  /*1: allocated by `LV_MEM_POOL_ALLOC`*/
+} pool_header_t;
+#endif
+
+#if LV_USE_MEM_TAG
+/*Stored before every allocated memory if `LV_USE_MEM_TAG` is enabled*/
+typedef struct {
+    uint32_t size;      /*Size of the memory without the header*/
+    uint16_t site;      /*Index of the call site or `SITE_NONE`*/
+    lv_mem_tag_t tag;
+} tag_header_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void arena_resize(lv_mem_buf_arena_t * arena, uint32_t size);
 #if LV_MEM_CUSTOM == 0
     static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
+    static void monitor_pool(lv_pool_t pool, size_t size, lv_mem_monitor_t * mon_p);
+    static void monitor_calc_pct(lv_mem_monitor_t * mon_p);
+    static bool add_pool(void * mem, size_t size, bool allocated);
+#endif
+#if LV_MEM_CUSTOM == 0 && LV_MEM_POOL_EXPAND_SIZE
+    static bool expand(size_t size);
+#endif
+static void * alloc_core(size_t size);
+static void * realloc_core(void * data_p, size_t new_size);
+#if LV_USE_MEM_TAG
+    static uint16_t tag_get_site(const char * file, uint32_t line, lv_mem_tag_t tag);
+    static void tag_add(tag_header_t * header, size_t size, lv_mem_tag_t tag, const char * file, uint32_t line);
+    static void tag_remove(tag_header_t * header);
 #endif
 
 /**********************
@@ -52,10 +118,31 @@
  **********************/
 #if LV_MEM_CUSTOM == 0
     static lv_tlsf_t tlsf;
+    static pool_header_t * pool_ll;     /*The pools added after the first one*/
+    static size_t pool_added_size;      /*Total size of the added pools*/
 #endif
 
 static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variable if 0 byte should be allocated*/
 
+#if LV_USE_MEM_TAG
+    static lv_mem_tag_monitor_t tag_mon[_LV_MEM_TAG_LAST];
+    static lv_mem_tag_site_t sites[LV_MEM_TAG_SITE_CNT];
+    static uint16_t site_cnt;
+    static uint16_t site_hash[SITE_HASH_SIZE];  /*Index of the site + 1 or 0 if the slot is empty*/
+    static lv_mem_tag_t tag_act;                /*Set by `LV_MEM_TAG_PUSH()`*/
+
+    static const char * const tag_names[_LV_MEM_TAG_LAST] = {
+        [LV_MEM_TAG_OTHER] = "other",
+        [LV_MEM_TAG_OBJ] = "obj",
+        [LV_MEM_TAG_STYLE] = "style",
+        [LV_MEM_TAG_TIMER] = "timer",
+        [LV_MEM_TAG_ANIM] = "anim",
+        [LV_MEM_TAG_IMG_CACHE] = "img_cache",
+        [LV_MEM_TAG_FONT] = "font",
+        [LV_MEM_TAG_TEXT] = "text",
+    };
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -104,6 +191,22 @@ void lv_mem_deinit(void)
 {
 #if LV_MEM_CUSTOM == 0
     lv_tlsf_destroy(tlsf);
+    while(pool_ll) {
+        pool_header_t * next = pool_ll->next;
+#if LV_MEM_POOL_EXPAND_SIZE
+        if(pool_ll->allocated) LV_MEM_POOL_FREE(pool_ll);
+#endif
+        pool_ll = next;
+    }
+    pool_added_size = 0;
+    lv_memset_00(&LV_GC_ROOT(lv_mem_buf_arena), sizeof(lv_mem_buf_arena_t));
+#if LV_USE_MEM_TAG
+    lv_memset_00(tag_mon, sizeof(tag_mon));
+    lv_memset_00(sites, sizeof(sites));
+    lv_memset_00(site_hash, sizeof(site_hash));
+    site_cnt = 0;
+    tag_act = LV_MEM_TAG_OTHER;
+#endif
     lv_mem_init();
 #endif
 }
@@ -115,34 +218,34 @@ void lv_mem_deinit(void)
  */
 void * lv_mem_alloc(size_t size)
 {
-    MEM_TRACE("allocating %d bytes", size);
-    if(size == 0) {
-        MEM_TRACE("using zero_mem");
-        return &zero_mem;
-    }
-
-#if LV_MEM_CUSTOM == 0
-    void * alloc = lv_tlsf_malloc(tlsf, size);
+#if LV_USE_MEM_TAG
+    return _lv_mem_alloc_tag(size, LV_MEM_TAG_OTHER, NULL, 0);
 #else
-    void * alloc = LV_MEM_CUSTOM_ALLOC(size);
+    return alloc_core(size);
 #endif
+}
 
-#if LV_MEM_ADD_JUNK
-    if(alloc != NULL) lv_memset(alloc, 0xaa, size);
-#endif
+#if LV_USE_MEM_TAG
+/**
+ * Allocate a memory and attribute it to a tag and a call site.
+ * Called by `lv_mem_alloc()` if `LV_USE_MEM_TAG` is enabled.
+ * @param size size of the memory to allocate in bytes
+ * @param tag the default tag of the allocation. Overwritten by the tag set by `LV_MEM_TAG_PUSH()`.
+ * @param file the file of the call site (`__FILE__`)
+ * @param line the line of the call site (`__LINE__`)
+ * @return pointer to the allocated memory
+ */
+void * _lv_mem_alloc_tag(size_t size, lv_mem_tag_t tag, const char * file, uint32_t line)
+{
+    if(size == 0) return alloc_core(0);
 
-    if(alloc == NULL) {
-        LV_LOG_ERROR("couldn't allocate memory (%d bytes)", size);
-        lv_mem_monitor_t mon;
-        lv_mem_monitor(&mon);
-        LV_LOG_ERROR("used: %6d (%3d %%), frag: %3d %%, biggest free: %6d",
-               (int)mon.total_size - mon.free_size, mon.used_pct, mon.frag_pct,
-               (int)mon.free_biggest_size);
-    }
+    tag_header_t * header = alloc_core(size + TAG_HEADER_SIZE);
+    if(header == NULL) return NULL;
 
-    MEM_TRACE("allocated at %p", alloc);
-    return alloc;
+    tag_add(header, size, tag, file, line);
+    return (uint8_t *)header + TAG_HEADER_SIZE;
 }
+#endif
 
 /**
  * Free an allocated data
@@ -154,6 +257,11 @@ void lv_mem_free(void * data)
     if(data == &zero_mem) return;
     if(data == NULL) return;
 
+#if LV_USE_MEM_TAG
+    data = (uint8_t *)data - TAG_HEADER_SIZE;
+    tag_remove(data);
+#endif
+
 #if LV_MEM_CUSTOM == 0
 #  if LV_MEM_ADD_JUNK
     lv_memset(data, 0xbb, lv_tlsf_block_size(data));
@@ -173,28 +281,134 @@ void lv_mem_free(void * data)
  */
 void * lv_mem_realloc(void * data_p, size_t new_size)
 {
-    MEM_TRACE("reallocating %p with %d size", data_p, new_size);
-    if(new_size == 0) {
-        MEM_TRACE("using zero_mem");
-        lv_mem_free(data_p);
-        return &zero_mem;
+#if LV_USE_MEM_TAG
+    return _lv_mem_realloc_tag(data_p, new_size, LV_MEM_TAG_OTHER, NULL, 0);
+#else
+    return realloc_core(data_p, new_size);
+#endif
+}
+
+#if LV_USE_MEM_TAG
+/**
+ * Reallocate a memory and attribute it to a tag and a call site.
+ * Called by `lv_mem_realloc()` if `LV_USE_MEM_TAG` is enabled.
+ * @param data_p pointer to an allocated memory.
+ * @param new_size the desired new size in byte
+ * @param tag the default tag of the allocation. Overwritten by the tag set by `LV_MEM_TAG_PUSH()`.
+ * @param file the file of the call site (`__FILE__`)
+ * @param line the line of the call site (`__LINE__`)
+ * @return pointer to the new memory
+ */
+void * _lv_mem_realloc_tag(void * data_p, size_t new_size, lv_mem_tag_t tag, const char * file, uint32_t line)
+{
+    if(new_size == 0) return realloc_core(data_p, 0);
+    if(data_p == &zero_mem || data_p == NULL) return _lv_mem_alloc_tag(new_size, tag, file, line);
+
+    tag_header_t * header = realloc_core((uint8_t *)data_p - TAG_HEADER_SIZE, new_size + TAG_HEADER_SIZE);
+    if(header == NULL) return NULL;
+
+    /*The header is copied too so the old size and site can be removed from the new memory*/
+    tag_remove(header);
+    tag_add(header, new_size, tag, file, line);
+    return (uint8_t *)header + TAG_HEADER_SIZE;
+}
+
+/**
+ * Set the tag of the next allocations regardless of the tag of the allocating file.
+ * @param tag the new tag or `LV_MEM_TAG_OTHER` to use the file's tag again
+ * @return the previous tag
+ */
+lv_mem_tag_t _lv_mem_tag_set(lv_mem_tag_t tag)
+{
+    lv_mem_tag_t prev = tag_act;
+    tag_act = tag;
+    return prev;
+}
+
+/**
+ * Get the statistics of the allocations of a tag
+ * @param tag a tag, e.g. `LV_MEM_TAG_OBJ`
+ * @param mon_p pointer to a `lv_mem_tag_monitor_t` variable,
+ *              the result will be stored here
+ */
+void lv_mem_tag_monitor(lv_mem_tag_t tag, lv_mem_tag_monitor_t * mon_p)
+{
+    if(tag >= _LV_MEM_TAG_LAST) {
+        lv_memset_00(mon_p, sizeof(lv_mem_tag_monitor_t));
+        return;
     }
 
-    if(data_p == &zero_mem) return lv_mem_alloc(new_size);
+    *mon_p = tag_mon[tag];
+}
 
-#if LV_MEM_CUSTOM == 0
-    void * new_p = lv_tlsf_realloc(tlsf, data_p, new_size);
-#else
-    void * new_p = LV_MEM_CUSTOM_REALLOC(data_p, new_size);
-#endif
-    if(new_p == NULL) {
-        LV_LOG_ERROR("couldn't allocate memory");
-        return NULL;
+/**
+ * Get the number of tracked call sites
+ * @return number of call sites, at most `LV_MEM_TAG_SITE_CNT`
+ */
+uint32_t lv_mem_tag_get_site_cnt(void)
+{
+    return site_cnt;
+}
+
+/**
+ * Get a tracked call site
+ * @param idx index of the call site `[0..lv_mem_tag_get_site_cnt() - 1]`
+ * @return pointer to the call site or NULL if `idx` is invalid
+ */
+const lv_mem_tag_site_t * lv_mem_tag_get_site(uint32_t idx)
+{
+    if(idx >= site_cnt) return NULL;
+    return &sites[idx];
+}
+
+/**
+ * Get the name of a tag
+ * @param tag a tag, e.g. `LV_MEM_TAG_OBJ`
+ * @return the name of the tag, e.g. "obj"
+ */
+const char * lv_mem_tag_get_name(lv_mem_tag_t tag)
+{
+    if(tag >= _LV_MEM_TAG_LAST) return "invalid";
+    return tag_names[tag];
+}
+
+/**
+ * Log the statistics of the tags and the call sites with the most allocated memory with `LV_LOG_USER`
+ */
+void lv_mem_tag_dump(void)
+{
+    LV_LOG_USER("%-10s %10s %10s %8s %10s", "tag", "live", "peak", "live cnt", "alloc cnt");
+    uint32_t i;
+    for(i = 0; i < _LV_MEM_TAG_LAST; i++) {
+        LV_LOG_USER("%-10s %10d %10d %8d %10d", tag_names[i], (int)tag_mon[i].live_size, (int)tag_mon[i].peak_size,
+                    (int)tag_mon[i].live_cnt, (int)tag_mon[i].alloc_cnt);
     }
 
-    MEM_TRACE("allocated at %p", new_p);
-    return new_p;
+    /*Select the sites with the largest live size without sorting the sites*/
+    uint16_t top[DUMP_SITE_CNT];
+    uint32_t top_cnt = 0;
+    for(i = 0; i < site_cnt; i++) {
+        uint32_t live = sites[i].mon.live_size;
+        if(live == 0) continue;
+        if(top_cnt == DUMP_SITE_CNT && sites[top[top_cnt - 1]].mon.live_size >= live) continue;
+
+        uint32_t j = top_cnt < DUMP_SITE_CNT ? top_cnt++ : DUMP_SITE_CNT - 1;
+        while(j > 0 && sites[top[j - 1]].mon.live_size < live) {
+            top[j] = top[j - 1];
+            j--;
+        }
+        top[j] = i;
+    }
+
+    LV_LOG_USER("%d call sites are tracked, the largest ones:", (int)site_cnt);
+    for(i = 0; i < top_cnt; i++) {
+        const lv_mem_tag_site_t * site = &sites[top[i]];
+        LV_LOG_USER("%s:%d (%s) live: %d, peak: %d, live cnt: %d, alloc cnt: %d", site->file, (int)site->line,
+                    tag_names[site->tag], (int)site->mon.live_size, (int)site->mon.peak_size,
+                    (int)site->mon.live_cnt, (int)site->mon.alloc_cnt);
+    }
 }
+#endif /*LV_USE_MEM_TAG*/
 
 lv_res_t lv_mem_test(void)
 {
@@ -213,6 +427,14 @@ lv_res_t lv_mem_test(void)
         LV_LOG_WARN("pool failed");
         return LV_RES_INV;
     }
+
+    pool_header_t * pool;
+    for(pool = pool_ll; pool; pool = pool->next) {
+        if(lv_tlsf_check_pool(POOL_GET_TLSF_POOL(pool))) {
+            LV_LOG_WARN("added pool failed");
+            return LV_RES_INV;
+        }
+    }
 #endif
     MEM_TRACE("passed");
     return LV_RES_OK;
@@ -230,25 +452,92 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 #if LV_MEM_CUSTOM == 0
     MEM_TRACE("begin");
 
-    lv_tlsf_walk_pool(lv_tlsf_get_pool(tlsf), lv_mem_walker, mon_p);
+    monitor_pool(lv_tlsf_get_pool(tlsf), LV_MEM_SIZE, mon_p);
 
-    mon_p->total_size = LV_MEM_SIZE;
-    mon_p->used_pct = 100 - (100U * mon_p->free_size) / mon_p->total_size;
-    if(mon_p->free_size > 0) {
-        mon_p->frag_pct = mon_p->free_biggest_size * 100U / mon_p->free_size;
-        mon_p->frag_pct = 100 - mon_p->frag_pct;
+    pool_header_t * pool;
+    for(pool = pool_ll; pool; pool = pool->next) {
+        monitor_pool(POOL_GET_TLSF_POOL(pool), pool->size, mon_p);
+    }
+
+    monitor_calc_pct(mon_p);
+
+    MEM_TRACE("finished");
+#endif
+}
+
+/**
+ * Get the number of memory pools of the built-in allocator.
+ * The first pool is `LV_MEM_SIZE` large, the others are added by `lv_mem_add_pool()`
+ * or when the memory is exhausted (see `LV_MEM_POOL_EXPAND_SIZE`).
+ * @return number of pools, 0 if `LV_MEM_CUSTOM` is enabled
+ */
+uint32_t lv_mem_get_pool_cnt(void)
+{
+#if LV_MEM_CUSTOM == 0
+    uint32_t cnt = 1;
+    pool_header_t * pool;
+    for(pool = pool_ll; pool; pool = pool->next) cnt++;
+    return cnt;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * Give information about a memory pool of the built-in allocator
+ * @param idx index of the pool `[0..lv_mem_get_pool_cnt() - 1]`
+ * @param mon_p pointer to a `lv_mem_monitor_t` variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_monitor_pool(uint32_t idx, lv_mem_monitor_t * mon_p)
+{
+    lv_memset_00(mon_p, sizeof(lv_mem_monitor_t));
+#if LV_MEM_CUSTOM == 0
+    if(idx == 0) {
+        monitor_pool(lv_tlsf_get_pool(tlsf), LV_MEM_SIZE, mon_p);
     }
     else {
-        mon_p->frag_pct = 0; /*no fragmentation if all the RAM is used*/
+        pool_header_t * pool = pool_ll;
+        while(pool && idx > 1) {
+            pool = pool->next;
+            idx--;
+        }
+        if(pool == NULL) return;
+        monitor_pool(POOL_GET_TLSF_POOL(pool), pool->size, mon_p);
     }
 
-    MEM_TRACE("finished");
+    monitor_calc_pct(mon_p);
+#else
+    LV_UNUSED(idx);
 #endif
 }
 
+#if LV_MEM_CUSTOM == 0
+/**
+ * Add a memory pool to the built-in allocator.
+ * @param mem pointer to the memory of the pool. Should be 8 byte aligned and
+ *            remain valid until `lv_mem_deinit()`
+ * @param size size of the memory in bytes. Can't be larger than `LV_MEM_SIZE`
+ *             (or `LV_MEM_POOL_MAX_SIZE` if `LV_MEM_POOL_EXPAND_SIZE` is enabled)
+ * @return LV_RES_OK: the pool is added; LV_RES_INV: `mem` is not aligned or `size` is invalid
+ */
+lv_res_t lv_mem_add_pool(void * mem, size_t size)
+{
+    if(((lv_uintptr_t)mem & ALIGN_MASK) || size <= POOL_HEADER_SIZE) {
+        LV_LOG_WARN("invalid pool");
+        return LV_RES_INV;
+    }
+
+    return add_pool(mem, size, false) ? LV_RES_OK : LV_RES_INV;
+}
+#endif
+
 
 /**
  * Get a temporal buffer with the given size.
+ * The buffers are allocated from an arena and should be released in reverse order of getting them.
+ * If the arena is full the buffer is allocated from the heap.
+ * The buffers are valid only until the end of the current frame.
  * @param size the required size
  */
 void * lv_mem_buf_get(uint32_t size)
@@ -257,49 +546,43 @@ void * lv_mem_buf_get(uint32_t size)
 
     MEM_TRACE("begin, getting %d bytes", size);
 
-    /*Try to find a free buffer with suitable size*/
-    int8_t i_guess = -1;
-    for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).used == 0 && LV_GC_ROOT(lv_mem_buf[i]).size >= size) {
-            if(LV_GC_ROOT(lv_mem_buf[i]).size == size) {
-                LV_GC_ROOT(lv_mem_buf[i]).used = 1;
-                return LV_GC_ROOT(lv_mem_buf[i]).p;
-            }
-            else if(i_guess < 0) {
-                i_guess = i;
-            }
-            /*If size of `i` is closer to `size` prefer it*/
-            else if(LV_GC_ROOT(lv_mem_buf[i]).size < LV_GC_ROOT(lv_mem_buf[i_guess]).size) {
-                i_guess = i;
-            }
-        }
+    lv_mem_buf_arena_t * arena = &LV_GC_ROOT(lv_mem_buf_arena);
+    arena->mon.get_cnt++;
+
+    uint32_t full_size = BUF_FULL_SIZE(size);
+    buf_header_t * header;
+    if(arena->top + full_size <= arena->size) {
+        /*Put the buffer on the top of the arena*/
+        header = (buf_header_t *)&arena->buf[arena->top];
+        header->prev = arena->last;
+        header->heap = 0;
+        arena->last = arena->top;
+        arena->top += full_size;
+        MEM_TRACE("allocated from the arena (offset: %d)", arena->last);
     }
-
-    if(i_guess >= 0) {
-        LV_GC_ROOT(lv_mem_buf[i_guess]).used = 1;
-        MEM_TRACE("returning already allocated buffer (buffer id: %d, address: %p)", i_guess, LV_GC_ROOT(lv_mem_buf[i_guess]).p);
-        return LV_GC_ROOT(lv_mem_buf[i_guess]).p;
+    else {
+        /*The arena is full. The arena will be larger from the next frame.*/
+        header = lv_mem_alloc(full_size);
+        LV_ASSERT_MSG(header != NULL, "Out of memory, can't allocate a new buffer (increase your LV_MEM_SIZE/heap size)");
+        if(header == NULL) return NULL;
+
+        /*Keep track of the heap buffers to free only the known ones*/
+        header->next = arena->fallback_ll;
+        header->heap = 1;
+        arena->fallback_ll = header;
+        arena->fallback_used += full_size;
+        arena->mon.fallback_cnt++;
+        MEM_TRACE("allocated from the heap (address: %p)", header);
     }
 
-    /*Reallocate a free buffer*/
-    for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).used == 0) {
-            /*if this fails you probably need to increase your LV_MEM_SIZE/heap size*/
-            void * buf = lv_mem_realloc(LV_GC_ROOT(lv_mem_buf[i]).p, size);
-            LV_ASSERT_MSG(buf != NULL, "Out of memory, can't allocate a new buffer (increase your LV_MEM_SIZE/heap size)");
-            if(buf == NULL) return NULL;
+    header->gen = arena->gen;
+    header->size = full_size;
+    header->used = 1;
 
-            LV_GC_ROOT(lv_mem_buf[i]).used = 1;
-            LV_GC_ROOT(lv_mem_buf[i]).size = size;
-            LV_GC_ROOT(lv_mem_buf[i]).p    = buf;
-            MEM_TRACE("allocated (buffer id: %d, address: %p)", i, LV_GC_ROOT(lv_mem_buf[i]).p);
-            return LV_GC_ROOT(lv_mem_buf[i]).p;
-        }
-    }
+    uint32_t used = arena->top + arena->fallback_used;
+    if(used > arena->frame_max_used) arena->frame_max_used = used;
 
-    LV_LOG_ERROR("no more buffers. (increase LV_MEM_BUF_MAX_NUM)");
-    LV_ASSERT_MSG(false, "No more buffers. Increase LV_MEM_BUF_MAX_NUM.");
-    return NULL;
+    return (uint8_t *)header + BUF_HEADER_SIZE;
 }
 
 /**
@@ -309,30 +592,159 @@ void * lv_mem_buf_get(uint32_t size)
 void lv_mem_buf_release(void * p)
 {
     MEM_TRACE("begin (address: %p)", p);
+    if(p == NULL) return;
+
+    lv_mem_buf_arena_t * arena = &LV_GC_ROOT(lv_mem_buf_arena);
+    buf_header_t * header = (buf_header_t *)((uint8_t *)p - BUF_HEADER_SIZE);
+
+    /*Not a buffer of the arena in this frame?*/
+    if(arena->buf == NULL || (uint8_t *)header < arena->buf || (uint8_t *)header >= arena->buf + arena->top) {
+        /*Free it only if it's surely allocated from the heap. A stale arena buffer can point anywhere.*/
+        buf_header_t ** link = (buf_header_t **)&arena->fallback_ll;
+        while(*link && *link != header) link = &(*link)->next;
 
-    for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).p == p) {
-            LV_GC_ROOT(lv_mem_buf[i]).used = 0;
+        if(*link == NULL) {
+            LV_LOG_ERROR("p is not a known buffer (already released or got in an earlier frame)");
+            arena->mon.invalid_release_cnt++;
             return;
         }
+
+        *link = header->next;
+        arena->fallback_used -= header->size;
+        header->used = 0;
+        header->heap = 0;
+        lv_mem_free(header);
+        return;
+    }
+
+    if(header->used == 0 || header->heap || header->gen != arena->gen) {
+        LV_LOG_ERROR("p is already released or got in an earlier frame");
+        arena->mon.invalid_release_cnt++;
+        return;
+    }
+
+    header->used = 0;
+
+    /*If not the last buffer is released it can be reused only when the buffers after it are released too*/
+    if((uint8_t *)header != &arena->buf[arena->last]) {
+        arena->mon.ooo_release_cnt++;
+        return;
     }
 
-    LV_LOG_ERROR("p is not a known buffer")
+    /*Remove the released buffers from the top*/
+    while(arena->top) {
+        header = (buf_header_t *)&arena->buf[arena->last];
+        if(header->used) break;
+        arena->top = arena->last;
+        arena->last = header->prev;
+    }
 }
 
 /**
- * Free all memory buffers
+ * Change the size of a temporal buffer. If it's the last buffer got from the arena it's resized in place.
+ * @param p buffer to resize or NULL to get a new one
+ * @param size the new size
+ * @return pointer to the resized buffer with the original content or NULL on error (`p` remains valid)
+ */
+void * lv_mem_buf_realloc(void * p, uint32_t size)
+{
+    if(p == NULL) return lv_mem_buf_get(size);
+
+    lv_mem_buf_arena_t * arena = &LV_GC_ROOT(lv_mem_buf_arena);
+    buf_header_t * header = (buf_header_t *)((uint8_t *)p - BUF_HEADER_SIZE);
+    uint32_t full_size = BUF_FULL_SIZE(size);
+
+    bool last = arena->top && (uint8_t *)header == &arena->buf[arena->last];
+    if(last && header->used && header->heap == 0 && header->gen == arena->gen &&
+       arena->last + full_size <= arena->size) {
+        header->size = full_size;
+        arena->top = arena->last + full_size;
+
+        uint32_t used = arena->top + arena->fallback_used;
+        if(used > arena->frame_max_used) arena->frame_max_used = used;
+        return p;
+    }
+
+    void * new_p = lv_mem_buf_get(size);
+    if(new_p == NULL) return NULL;
+
+    uint32_t old_size = header->size - BUF_HEADER_SIZE;
+    lv_memcpy(new_p, p, LV_MIN(size, old_size));
+    lv_mem_buf_release(p);
+
+    return new_p;
+}
+
+/**
+ * Free all memory buffers and the arena. The arena will be allocated again at the end of the next frame.
  */
 void lv_mem_buf_free_all(void)
 {
-    for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).p) {
-            lv_mem_free(LV_GC_ROOT(lv_mem_buf[i]).p);
-            LV_GC_ROOT(lv_mem_buf[i]).p = NULL;
-            LV_GC_ROOT(lv_mem_buf[i]).used = 0;
-            LV_GC_ROOT(lv_mem_buf[i]).size = 0;
+    lv_mem_buf_arena_t * arena = &LV_GC_ROOT(lv_mem_buf_arena);
+    if(arena->buf) lv_mem_free(arena->buf);
+    arena->buf = NULL;
+    arena->size = 0;
+    arena->top = 0;
+    arena->last = 0;
+    arena->gen++;
+    arena->frame_max_used = 0;
+    arena->light_max_used = 0;
+    arena->light_frame_cnt = 0;
+}
+
+/**
+ * Give information about the usage of the temporal buffers
+ * @param mon_p pointer to a `lv_mem_buf_monitor_t` variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_buf_monitor(lv_mem_buf_monitor_t * mon_p)
+{
+    lv_mem_buf_arena_t * arena = &LV_GC_ROOT(lv_mem_buf_arena);
+    *mon_p = arena->mon;
+    mon_p->arena_size = arena->size;
+    mon_p->used = arena->top + arena->fallback_used;
+    if(arena->frame_max_used > mon_p->max_used) mon_p->max_used = arena->frame_max_used;
+}
+
+/**
+ * Release all temporal buffers at the end of a frame and
+ * grow the arena if more memory was required in the frame than its size
+ * or shrink it if it was much larger than needed for a while.
+ */
+void _lv_mem_buf_frame_end(void)
+{
+    lv_mem_buf_arena_t * arena = &LV_GC_ROOT(lv_mem_buf_arena);
+
+    if(arena->top || arena->fallback_used) {
+        LV_LOG_WARN("%d bytes of buffers are not released", (int)(arena->top + arena->fallback_used));
+    }
+
+    /*The buffers of the arena become invalid. The heap buffers can be still released.*/
+    arena->top = 0;
+    arena->last = 0;
+    arena->gen++;
+
+    if(arena->frame_max_used > arena->mon.max_used) arena->mon.max_used = arena->frame_max_used;
+
+    /*Larger needs are served from the heap*/
+    uint32_t need = LV_MIN(arena->frame_max_used, LV_MEM_BUF_ARENA_MAX_SIZE);
+    arena->frame_max_used = 0;
+
+    if(need > arena->size) {
+        arena_resize(arena, need);
+    }
+    else if(need < arena->size / 2) {
+        /*Give back the memory if the arena was much larger than needed for a while*/
+        arena->light_frame_cnt++;
+        if(need > arena->light_max_used) arena->light_max_used = need;
+        if(arena->light_frame_cnt >= ARENA_SHRINK_FRAMES) {
+            arena_resize(arena, arena->light_max_used);
         }
     }
+    else {
+        arena->light_frame_cnt = 0;
+        arena->light_max_used = 0;
+    }
 }
 
 #if LV_MEMCPY_MEMSET_STD == 0
@@ -524,6 +936,22 @@ LV_ATTRIBUTE_FAST_MEM void lv_memset_ff(void * dst, size_t len)
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Replace the arena of the temporal buffers with a new one. The buffers in the arena should be already released.
+ * @param arena     pointer to the arena
+ * @param size      the new size. 0: free the arena
+ */
+static void arena_resize(lv_mem_buf_arena_t * arena, uint32_t size)
+{
+    /*The content of the arena is not needed so allocate a new one instead of reallocating*/
+    if(arena->buf) lv_mem_free(arena->buf);
+    arena->buf = size ? lv_mem_alloc(size) : NULL;
+    arena->size = arena->buf ? size : 0;
+    arena->light_frame_cnt = 0;
+    arena->light_max_used = 0;
+    MEM_TRACE("arena resized to %d bytes", arena->size);
+}
+
 #if LV_MEM_CUSTOM == 0
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
 {
@@ -540,4 +968,195 @@ static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
             mon_p->free_biggest_size = size;
     }
 }
+
+static void monitor_pool(lv_pool_t pool, size_t size, lv_mem_monitor_t * mon_p)
+{
+    lv_tlsf_walk_pool(pool, lv_mem_walker, mon_p);
+    mon_p->total_size += size;
+}
+
+static void monitor_calc_pct(lv_mem_monitor_t * mon_p)
+{
+    if(mon_p->total_size == 0) return;
+
+    mon_p->used_pct = 100 - (100U * mon_p->free_size) / mon_p->total_size;
+    if(mon_p->free_size > 0) {
+        mon_p->frag_pct = mon_p->free_biggest_size * 100U / mon_p->free_size;
+        mon_p->frag_pct = 100 - mon_p->frag_pct;
+    }
+    else {
+        mon_p->frag_pct = 0; /*no fragmentation if all the RAM is used*/
+    }
+}
+
+static bool add_pool(void * mem, size_t size, bool allocated)
+{
+    if(lv_tlsf_add_pool(tlsf, (uint8_t *)mem + POOL_HEADER_SIZE, size - POOL_HEADER_SIZE) == NULL) return false;
+
+    pool_header_t * header = mem;
+    header->next = NULL;
+    header->size = size;
+    header->allocated = allocated;
+
+    /*Append to keep the pools in the order of adding*/
+    pool_header_t ** next_p = &pool_ll;
+    while(*next_p) next_p = &(*next_p)->next;
+    *next_p = header;
+
+    pool_added_size += size;
+    MEM_TRACE("pool added (address: %p, size: %d)", mem, (int)size);
+    return true;
+}
 #endif
+
+#if LV_MEM_CUSTOM == 0 && LV_MEM_POOL_EXPAND_SIZE
+/**
+ * Add a new pool which is large enough for `size` bytes
+ * @param size the size of the allocation which failed
+ * @return true: a pool was added
+ */
+static bool expand(size_t size)
+{
+    /*TLSF takes the free blocks from the next size class (larger by 1/32 of the size) so add some spare space*/
+    size_t pool_size = POOL_HEADER_SIZE + lv_tlsf_pool_overhead() + lv_tlsf_alloc_overhead() +
+                       lv_tlsf_block_size_min() + ((size + ALIGN_MASK) & ~ALIGN_MASK) + size / 16;
+    if(pool_size < LV_MEM_POOL_EXPAND_SIZE) pool_size = LV_MEM_POOL_EXPAND_SIZE;
+
+    if(LV_MEM_SIZE + pool_added_size + pool_size > LV_MEM_POOL_MAX_SIZE) {
+        LV_LOG_WARN("can't add a %d bytes pool, LV_MEM_POOL_MAX_SIZE is reached", (int)pool_size);
+        return false;
+    }
+
+    void * mem = LV_MEM_POOL_ALLOC(pool_size);
+    if(mem == NULL) {
+        LV_LOG_WARN("couldn't get %d bytes for a new pool", (int)pool_size);
+        return false;
+    }
+
+    if(!add_pool(mem, pool_size, true)) {
+        LV_MEM_POOL_FREE(mem);
+        return false;
+    }
+
+    return true;
+}
+#endif
+
+static void * alloc_core(size_t size)
+{
+    MEM_TRACE("allocating %d bytes", size);
+    if(size == 0) {
+        MEM_TRACE("using zero_mem");
+        return &zero_mem;
+    }
+
+#if LV_MEM_CUSTOM == 0
+    void * alloc = lv_tlsf_malloc(tlsf, size);
+#  if LV_MEM_POOL_EXPAND_SIZE
+    if(alloc == NULL && expand(size)) alloc = lv_tlsf_malloc(tlsf, size);
+#  endif
+#else
+    void * alloc = LV_MEM_CUSTOM_ALLOC(size);
+#endif
+
+#if LV_MEM_ADD_JUNK
+    if(alloc != NULL) lv_memset(alloc, 0xaa, size);
+#endif
+
+    if(alloc == NULL) {
+        LV_LOG_ERROR("couldn't allocate memory (%d bytes)", size);
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        LV_LOG_ERROR("used: %6d (%3d %%), frag: %3d %%, biggest free: %6d",
+               (int)mon.total_size - mon.free_size, mon.used_pct, mon.frag_pct,
+               (int)mon.free_biggest_size);
+    }
+
+    MEM_TRACE("allocated at %p", alloc);
+    return alloc;
+}
+
+static void * realloc_core(void * data_p, size_t new_size)
+{
+    MEM_TRACE("reallocating %p with %d size", data_p, new_size);
+    if(new_size == 0) {
+        MEM_TRACE("using zero_mem");
+        lv_mem_free(data_p);
+        return &zero_mem;
+    }
+
+    if(data_p == &zero_mem) return lv_mem_alloc(new_size);
+
+#if LV_MEM_CUSTOM == 0
+    void * new_p = lv_tlsf_realloc(tlsf, data_p, new_size);
+#  if LV_MEM_POOL_EXPAND_SIZE
+    /*If the memory can't be reallocated in place it's copied to a new memory from the new pool*/
+    if(new_p == NULL && expand(new_size)) new_p = lv_tlsf_realloc(tlsf, data_p, new_size);
+#  endif
+#else
+    void * new_p = LV_MEM_CUSTOM_REALLOC(data_p, new_size);
+#endif
+    if(new_p == NULL) {
+        LV_LOG_ERROR("couldn't allocate memory");
+        return NULL;
+    }
+
+    MEM_TRACE("allocated at %p", new_p);
+    return new_p;
+}
+
+#if LV_USE_MEM_TAG
+static uint16_t tag_get_site(const char * file, uint32_t line, lv_mem_tag_t tag)
+{
+    if(file == NULL) return SITE_NONE;
+
+    /*`__FILE__` of a call site is always the same string so it's enough to compare the pointers*/
+    uint32_t h = (((uint32_t)(uintptr_t)file) ^ (line * 2654435761U)) % SITE_HASH_SIZE;
+    while(site_hash[h]) {
+        lv_mem_tag_site_t * site = &sites[site_hash[h] - 1];
+        if(site->file == file && site->line == line && site->tag == tag) return site_hash[h] - 1;
+        h++;
+        if(h == SITE_HASH_SIZE) h = 0;
+    }
+
+    /*Not found. Add it as a new site if there is space for it*/
+    if(site_cnt >= LV_MEM_TAG_SITE_CNT) return SITE_NONE;
+
+    lv_mem_tag_site_t * site = &sites[site_cnt];
+    site->file = file;
+    site->line = line;
+    site->tag = tag;
+    site_cnt++;
+    site_hash[h] = site_cnt;
+    return site_cnt - 1;
+}
+
+static void tag_add(tag_header_t * header, size_t size, lv_mem_tag_t tag, const char * file, uint32_t line)
+{
+    if(tag_act != LV_MEM_TAG_OTHER) tag = tag_act;
+    if(tag >= _LV_MEM_TAG_LAST) tag = LV_MEM_TAG_OTHER;
+
+    header->size = size;
+    header->tag = tag;
+    header->site = tag_get_site(file, line, tag);
+
+    lv_mem_tag_monitor_t * mon[2] = {&tag_mon[tag], header->site != SITE_NONE ? &sites[header->site].mon : NULL};
+    uint32_t i;
+    for(i = 0; i < 2 && mon[i]; i++) {
+        mon[i]->live_size += size;
+        mon[i]->live_cnt++;
+        mon[i]->alloc_cnt++;
+        if(mon[i]->live_size > mon[i]->peak_size) mon[i]->peak_size = mon[i]->live_size;
+    }
+}
+
+static void tag_remove(tag_header_t * header)
+{
+    lv_mem_tag_monitor_t * mon[2] = {&tag_mon[header->tag], header->site != SITE_NONE ? &sites[header->site].mon : NULL};
+    uint32_t i;
+    for(i = 0; i < 2 && mon[i]; i++) {
+        mon[i]->live_size -= header->size;
+        mon[i]->live_cnt--;
+    }
+}
+#endif /*LV_USE_MEM_TAG*/
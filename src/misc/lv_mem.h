@@ -28,14 +28,30 @@ extern "C" {
  *      DEFINES
  *********************/
 
-#ifndef LV_MEM_BUF_MAX_NUM
-#define LV_MEM_BUF_MAX_NUM    16
-#endif
+/*The tag of the allocations of a file. Redefine it in a .c file to tag its allocations (see `LV_USE_MEM_TAG`)*/
+#define LV_MEM_FILE_TAG     LV_MEM_TAG_OTHER
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * The subsystems the allocations are attributed to if `LV_USE_MEM_TAG` is enabled
+ */
+enum {
+    LV_MEM_TAG_OTHER,
+    LV_MEM_TAG_OBJ,
+    LV_MEM_TAG_STYLE,
+    LV_MEM_TAG_TIMER,
+    LV_MEM_TAG_ANIM,
+    LV_MEM_TAG_IMG_CACHE,
+    LV_MEM_TAG_FONT,
+    LV_MEM_TAG_TEXT,
+    _LV_MEM_TAG_LAST,
+};
+
+typedef uint8_t lv_mem_tag_t;
+
 /**
  * Heap information structure.
  */
@@ -50,13 +66,55 @@ typedef struct {
     uint8_t frag_pct; /**< Amount of fragmentation*/
 } lv_mem_monitor_t;
 
+/**
+ * Information about the temporal buffers (`lv_mem_buf_get()`)
+ */
+typedef struct {
+    uint32_t arena_size;        /**< Size of the arena the buffers are allocated from*/
+    uint32_t used;              /**< Size of the buffers in use now (with the headers)*/
+    uint32_t max_used;          /**< The largest size of the buffers used in a frame*/
+    uint32_t get_cnt;           /**< Number of `lv_mem_buf_get()` calls*/
+    uint32_t fallback_cnt;      /**< Number of buffers allocated from the heap because the arena was full*/
+    uint32_t ooo_release_cnt;   /**< Number of buffers not released in reverse order of getting them*/
+    uint32_t invalid_release_cnt;   /**< Number of releases of unknown, stale or already released buffers*/
+} lv_mem_buf_monitor_t;
+
+/**
+ * The temporal buffers are allocated from an arena like from a stack.
+ */
+typedef struct {
+    uint8_t * buf;              /**< The arena*/
+    uint32_t size;              /**< Size of `buf`*/
+    uint32_t top;               /**< Offset of the first free byte in `buf`*/
+    uint32_t last;              /**< Offset of the last buffer's header in `buf`*/
+    uint32_t fallback_used;     /**< Size of the buffers allocated from the heap*/
+    void * fallback_ll;         /**< Linked list of the buffers allocated from the heap*/
+    uint32_t gen;               /**< Incremented when the buffers of the arena become invalid*/
+    uint32_t frame_max_used;    /**< The largest size of the used buffers in the current frame*/
+    uint32_t light_max_used;    /**< The largest `frame_max_used` of the recent frames using much less than `size`*/
+    uint32_t light_frame_cnt;   /**< Number of the recent frames using much less than `size`*/
+    lv_mem_buf_monitor_t mon;
+} lv_mem_buf_arena_t;
+
+/**
+ * Statistics of the allocations of a tag or a call site
+ */
 typedef struct {
-    void * p;
-    uint16_t size;
-    uint8_t used : 1;
-} lv_mem_buf_t;
+    uint32_t live_size;     /**< Size of the allocated and not freed memories*/
+    uint32_t peak_size;     /**< The largest `live_size` so far*/
+    uint32_t live_cnt;      /**< Number of the allocated and not freed memories*/
+    uint32_t alloc_cnt;     /**< Number of allocations and reallocations so far*/
+} lv_mem_tag_monitor_t;
 
-typedef lv_mem_buf_t lv_mem_buf_arr_t[LV_MEM_BUF_MAX_NUM];
+/**
+ * A call site of `lv_mem_alloc()` or `lv_mem_realloc()`
+ */
+typedef struct {
+    const char * file;
+    uint32_t line;
+    lv_mem_tag_t tag;
+    lv_mem_tag_monitor_t mon;
+} lv_mem_tag_site_t;
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -108,9 +166,40 @@ lv_res_t lv_mem_test(void);
  */
 void lv_mem_monitor(lv_mem_monitor_t * mon_p);
 
+/**
+ * Get the number of memory pools of the built-in allocator.
+ * The first pool is `LV_MEM_SIZE` large, the others are added by `lv_mem_add_pool()`
+ * or when the memory is exhausted (see `LV_MEM_POOL_EXPAND_SIZE`).
+ * @return number of pools, 0 if `LV_MEM_CUSTOM` is enabled
+ */
+uint32_t lv_mem_get_pool_cnt(void);
+
+/**
+ * Give information about a memory pool of the built-in allocator
+ * @param idx index of the pool `[0..lv_mem_get_pool_cnt() - 1]`
+ * @param mon_p pointer to a `lv_mem_monitor_t` variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_monitor_pool(uint32_t idx, lv_mem_monitor_t * mon_p);
+
+#if LV_MEM_CUSTOM == 0
+/**
+ * Add a memory pool to the built-in allocator.
+ * @param mem pointer to the memory of the pool. Should be 8 byte aligned and
+ *            remain valid until `lv_mem_deinit()`
+ * @param size size of the memory in bytes. Can't be larger than `LV_MEM_SIZE`
+ *             (or `LV_MEM_POOL_MAX_SIZE` if `LV_MEM_POOL_EXPAND_SIZE` is enabled)
+ * @return LV_RES_OK: the pool is added; LV_RES_INV: `mem` is not aligned or `size` is invalid
+ */
+lv_res_t lv_mem_add_pool(void * mem, size_t size);
+#endif
+
 
 /**
  * Get a temporal buffer with the given size.
+ * The buffers are allocated from an arena and should be released in reverse order of getting them.
+ * If the arena is full the buffer is allocated from the heap.
+ * The buffers are valid only until the end of the current frame.
  * @param size the required size
  */
 void * lv_mem_buf_get(uint32_t size);
@@ -122,10 +211,99 @@ void * lv_mem_buf_get(uint32_t size);
 void lv_mem_buf_release(void * p);
 
 /**
- * Free all memory buffers
+ * Change the size of a temporal buffer. If it's the last buffer got from the arena it's resized in place.
+ * @param p buffer to resize or NULL to get a new one
+ * @param size the new size
+ * @return pointer to the resized buffer with the original content or NULL on error (`p` remains valid)
+ */
+void * lv_mem_buf_realloc(void * p, uint32_t size);
+
+/**
+ * Free all memory buffers and the arena. The arena will be allocated again at the end of the next frame.
  */
 void lv_mem_buf_free_all(void);
 
+/**
+ * Give information about the usage of the temporal buffers
+ * @param mon_p pointer to a `lv_mem_buf_monitor_t` variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_buf_monitor(lv_mem_buf_monitor_t * mon_p);
+
+/**
+ * Release all temporal buffers at the end of a frame and
+ * grow the arena if more memory was required in the frame than its size
+ * or shrink it if it was much larger than needed for a while.
+ */
+void _lv_mem_buf_frame_end(void);
+
+#if LV_USE_MEM_TAG
+
+/**
+ * Allocate a memory and attribute it to a tag and a call site.
+ * Called by `lv_mem_alloc()` if `LV_USE_MEM_TAG` is enabled.
+ * @param size size of the memory to allocate in bytes
+ * @param tag the default tag of the allocation. Overwritten by the tag set by `LV_MEM_TAG_PUSH()`.
+ * @param file the file of the call site (`__FILE__`)
+ * @param line the line of the call site (`__LINE__`)
+ * @return pointer to the allocated memory
+ */
+void * _lv_mem_alloc_tag(size_t size, lv_mem_tag_t tag, const char * file, uint32_t line);
+
+/**
+ * Reallocate a memory and attribute it to a tag and a call site.
+ * Called by `lv_mem_realloc()` if `LV_USE_MEM_TAG` is enabled.
+ * @param data_p pointer to an allocated memory.
+ * @param new_size the desired new size in byte
+ * @param tag the default tag of the allocation. Overwritten by the tag set by `LV_MEM_TAG_PUSH()`.
+ * @param file the file of the call site (`__FILE__`)
+ * @param line the line of the call site (`__LINE__`)
+ * @return pointer to the new memory
+ */
+void * _lv_mem_realloc_tag(void * data_p, size_t new_size, lv_mem_tag_t tag, const char * file, uint32_t line);
+
+/**
+ * Set the tag of the next allocations regardless of the tag of the allocating file.
+ * @param tag the new tag or `LV_MEM_TAG_OTHER` to use the file's tag again
+ * @return the previous tag
+ */
+lv_mem_tag_t _lv_mem_tag_set(lv_mem_tag_t tag);
+
+/**
+ * Get the statistics of the allocations of a tag
+ * @param tag a tag, e.g. `LV_MEM_TAG_OBJ`
+ * @param mon_p pointer to a `lv_mem_tag_monitor_t` variable,
+ *              the result will be stored here
+ */
+void lv_mem_tag_monitor(lv_mem_tag_t tag, lv_mem_tag_monitor_t * mon_p);
+
+/**
+ * Get the number of tracked call sites
+ * @return number of call sites, at most `LV_MEM_TAG_SITE_CNT`
+ */
+uint32_t lv_mem_tag_get_site_cnt(void);
+
+/**
+ * Get a tracked call site
+ * @param idx index of the call site `[0..lv_mem_tag_get_site_cnt() - 1]`
+ * @return pointer to the call site or NULL if `idx` is invalid
+ */
+const lv_mem_tag_site_t * lv_mem_tag_get_site(uint32_t idx);
+
+/**
+ * Get the name of a tag
+ * @param tag a tag, e.g. `LV_MEM_TAG_OBJ`
+ * @return the name of the tag, e.g. "obj"
+ */
+const char * lv_mem_tag_get_name(lv_mem_tag_t tag);
+
+/**
+ * Log the statistics of the tags and the call sites with the most allocated memory with `LV_LOG_USER`
+ */
+void lv_mem_tag_dump(void);
+
+#endif /*LV_USE_MEM_TAG*/
+
 //! @cond Doxygen_Suppress
 
 #if LV_MEMCPY_MEMSET_STD
@@ -243,6 +421,18 @@ LV_ATTRIBUTE_FAST_MEM void lv_memset_ff(void * dst, size_t len);
  *      MACROS
  **********************/
 
+#if LV_USE_MEM_TAG
+#  define lv_mem_alloc(size)            _lv_mem_alloc_tag(size, LV_MEM_FILE_TAG, __FILE__, __LINE__)
+#  define lv_mem_realloc(data_p, size)  _lv_mem_realloc_tag(data_p, size, LV_MEM_FILE_TAG, __FILE__, __LINE__)
+
+/*Attribute all allocations to `tag` until `LV_MEM_TAG_POP()` in the same block*/
+#  define LV_MEM_TAG_PUSH(tag)          lv_mem_tag_t _lv_mem_tag_prev = _lv_mem_tag_set(tag)
+#  define LV_MEM_TAG_POP()              _lv_mem_tag_set(_lv_mem_tag_prev)
+#else
+#  define LV_MEM_TAG_PUSH(tag)
+#  define LV_MEM_TAG_POP()
+#endif
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
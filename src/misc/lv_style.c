@@ -12,6 +12,8 @@
 /*********************
  *      DEFINES
  *********************/
+#undef LV_MEM_FILE_TAG
+#define LV_MEM_FILE_TAG LV_MEM_TAG_STYLE
 
 /**********************
  *      TYPEDEFS
@@ -20,6 +22,7 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void inherit_changed(void);
 
 /**********************
  *  GLOBAL VARIABLES
@@ -28,6 +31,8 @@
 /**********************
  *  STATIC VARIABLES
  **********************/
+static uint32_t inherit_gen;
+static bool style_of_obj;   /*The style being modified is the local or transition style of an object*/
 
 /**********************
  *      MACROS
@@ -49,6 +54,9 @@ void lv_style_init(lv_style_t * style)
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
 #endif
+    /*The style might be re-initialized while in use so anything could have changed*/
+    style->changed_flags = LV_STYLE_PROP_ANY;
+    inherit_changed();
 }
 
 void lv_style_reset(lv_style_t * style)
@@ -60,11 +68,25 @@ void lv_style_reset(lv_style_t * style)
         return;
     }
 
-    if(style->prop_cnt > 1) lv_mem_free(style->v_p.values_and_props);
+    /*Remember the flags of the removed properties*/
+    uint16_t changed_flags = style->changed_flags;
+    if(style->prop_cnt > 1) {
+        uint8_t * tmp = style->v_p.values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
+        uint16_t * props = (uint16_t *)tmp;
+        uint32_t i;
+        for(i = 0; i < style->prop_cnt; i++) changed_flags |= props[i] & _LV_STYLE_PROP_FLAGS;
+        lv_mem_free(style->v_p.values_and_props);
+    }
+    else if(style->prop_cnt == 1) {
+        changed_flags |= style->prop1 & _LV_STYLE_PROP_FLAGS;
+    }
+
     lv_memset_00(style, sizeof(lv_style_t));
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
 #endif
+    style->changed_flags = changed_flags;
+    if(changed_flags & LV_STYLE_PROP_INHERIT) inherit_changed();
 
 }
 
@@ -90,6 +112,8 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
         if(style->prop1 == prop) {
             style->prop1 = LV_STYLE_PROP_INV;
             style->prop_cnt = 0;
+            style->changed_flags |= prop & _LV_STYLE_PROP_FLAGS;
+            if(prop & LV_STYLE_PROP_INHERIT) inherit_changed();
             return true;
         }
         return false;
@@ -127,6 +151,8 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
             }
 
             lv_mem_free(old_values);
+            style->changed_flags |= prop & _LV_STYLE_PROP_FLAGS;
+            if(prop & LV_STYLE_PROP_INHERIT) inherit_changed();
             return true;
         }
     }
@@ -143,6 +169,9 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
         return;
     }
 
+    style->changed_flags |= prop & _LV_STYLE_PROP_FLAGS;
+    if(prop & LV_STYLE_PROP_INHERIT) inherit_changed();
+
     if(style->prop_cnt > 1) {
         uint8_t * tmp = style->v_p.values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
         uint16_t * props = (uint16_t *)tmp;
@@ -280,6 +309,55 @@ uint8_t _lv_style_get_prop_group(lv_style_prop_t prop)
     if(group > 7) group = 7;    /*The MSB marks all the custom properties*/
     return (uint8_t)group;
 }
+
+uint32_t _lv_style_get_inherit_gen(void)
+{
+    return inherit_gen;
+}
+
+void _lv_style_mark_inherit_changed(void)
+{
+    inherit_gen++;
+}
+
+void _lv_style_init_of_obj(lv_style_t * style)
+{
+    style_of_obj = true;
+    lv_style_init(style);
+    style_of_obj = false;
+}
+
+void _lv_style_reset_of_obj(lv_style_t * style)
+{
+    style_of_obj = true;
+    lv_style_reset(style);
+    style_of_obj = false;
+}
+
+bool _lv_style_remove_prop_of_obj(lv_style_t * style, lv_style_prop_t prop)
+{
+    style_of_obj = true;
+    bool res = lv_style_remove_prop(style, prop);
+    style_of_obj = false;
+    return res;
+}
+
+void _lv_style_set_prop_of_obj(lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value)
+{
+    style_of_obj = true;
+    lv_style_set_prop(style, prop, value);
+    style_of_obj = false;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+/**
+ * Invalidate the cached inherited values of all objects.
+ * The styles of one object are skipped because their users invalidate only their own subtree.
+ */
+static void inherit_changed(void)
+{
+    if(!style_of_obj) inherit_gen++;
+}
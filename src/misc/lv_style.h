@@ -37,6 +37,8 @@ extern "C" {
 #define LV_STYLE_PROP_LAYOUT_REFR           (1 << 12)  /*Requires layout update when changed*/
 #define LV_STYLE_PROP_PARENT_LAYOUT_REFR    (1 << 13)  /*Requires layout update on parent when changed*/
 #define LV_STYLE_PROP_FILTER                (1 << 14)  /*Apply color filter*/
+#define _LV_STYLE_PROP_FLAGS                (LV_STYLE_PROP_INHERIT | LV_STYLE_PROP_EXT_DRAW | LV_STYLE_PROP_LAYOUT_REFR | \
+                                             LV_STYLE_PROP_PARENT_LAYOUT_REFR | LV_STYLE_PROP_FILTER)
 
 /**
  * Other constants
@@ -44,12 +46,15 @@ extern "C" {
 #define LV_IMG_ZOOM_NONE            256        /*Value for not zooming the image*/
 LV_EXPORT_CONST_INT(LV_IMG_ZOOM_NONE);
 
+/*Initializer of a constant style. `groups` is the `has_group` bit field of the properties (0xFF if unknown)*/
 #if LV_USE_ASSERT_STYLE
-#define LV_STYLE_CONST_INIT(var_name, prop_array) const lv_style_t var_name = { .sentinel = LV_STYLE_SENTINEL_VALUE, .v_p = { .const_props = prop_array }, .has_group = 0xFF, .is_const = 1 }
+#define LV_STYLE_CONST_INITIALIZER(prop_array, groups) { .sentinel = LV_STYLE_SENTINEL_VALUE, .v_p = { .const_props = prop_array }, .has_group = groups, .is_const = 1 }
 #else
-#define LV_STYLE_CONST_INIT(var_name, prop_array) const lv_style_t var_name = { .v_p = { .const_props = prop_array }, .has_group = 0xFF, .is_const = 1 }
+#define LV_STYLE_CONST_INITIALIZER(prop_array, groups) { .v_p = { .const_props = prop_array }, .has_group = groups, .is_const = 1 }
 #endif
 
+#define LV_STYLE_CONST_INIT(var_name, prop_array) const lv_style_t var_name = LV_STYLE_CONST_INITIALIZER(prop_array, 0xFF)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -273,6 +278,13 @@ typedef struct {
     uint16_t is_const :1;
     uint8_t has_group;
     uint8_t prop_cnt;
+
+    /*OR-ed flags of the properties changed since the last `lv_obj_report_style_change`.
+     *`LV_STYLE_PROP_ANY` if not known*/
+    uint16_t changed_flags;
+
+    /*1: a constant style copied to RAM. Unlike constant styles its changes are tracked in `changed_flags`*/
+    uint8_t is_const_copy :1;
 } lv_style_t;
 
 /**********************
@@ -420,6 +432,55 @@ bool lv_style_is_empty(const lv_style_t * style);
  */
 uint8_t _lv_style_get_prop_group(lv_style_prop_t prop);
 
+/**
+ * Get a counter which is changed whenever the inherited style properties might resolve to a different value.
+ * Used to check whether the cached inherited values are still valid.
+ * @return the current value of the counter
+ */
+uint32_t _lv_style_get_inherit_gen(void);
+
+/**
+ * Tell that the inherited style properties of any object might resolve to a different value.
+ * E.g. the theme has changed. Changes affecting only an object and its children are handled by
+ * `_lv_obj_style_inherit_invalidate()`.
+ */
+void _lv_style_mark_inherit_changed(void);
+
+/**
+ * Initialize a style which is used only by one object (a local or transition style).
+ * Unlike `lv_style_init()` it doesn't invalidate the cached inherited values of all objects.
+ * @param style pointer to a style
+ */
+void _lv_style_init_of_obj(lv_style_t * style);
+
+/**
+ * Clear all properties from a style which is used only by one object (a local or transition style).
+ * Unlike `lv_style_reset()` it doesn't invalidate the cached inherited values of all objects,
+ * the caller needs to invalidate only the subtree of the object.
+ * @param style pointer to a style
+ */
+void _lv_style_reset_of_obj(lv_style_t * style);
+
+/**
+ * Remove a property from a style which is used only by one object (a local or transition style).
+ * Unlike `lv_style_remove_prop()` it doesn't invalidate the cached inherited values of all objects,
+ * the caller needs to invalidate only the subtree of the object.
+ * @param style pointer to a style
+ * @param prop  a style property
+ * @return true: the property was found and removed; false: the property wasn't found
+ */
+bool _lv_style_remove_prop_of_obj(lv_style_t * style, lv_style_prop_t prop);
+
+/**
+ * Set a property in a style which is used only by one object (a local or transition style).
+ * Unlike `lv_style_set_prop()` it doesn't invalidate the cached inherited values of all objects,
+ * the caller needs to invalidate only the subtree of the object.
+ * @param style pointer to a style
+ * @param prop  the ID of a property
+ * @param value the new value
+ */
+void _lv_style_set_prop_of_obj(lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value);
+
 #include "lv_style_gen.h"
 
 static inline void lv_style_set_pad_all(lv_style_t * style, lv_coord_t value) {
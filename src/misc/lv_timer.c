@@ -8,6 +8,7 @@
 #include "lv_timer.h"
 #include <stddef.h>
 #include "../misc/lv_assert.h"
+#include "../misc/lv_trace.h"
 #include "../hal/lv_hal_tick.h"
 #include "lv_gc.h"
 
@@ -132,6 +133,7 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
     if(idle_period_time >= IDLE_MEAS_PERIOD) {
         idle_last         = (busy_time * 100) / idle_period_time;  /*Calculate the busy percentage*/
         idle_last         = idle_last > 100 ? 0 : 100 - idle_last; /*But we need idle time*/
+        LV_TRACE_COUNTER("idle", idle_last);
         busy_time         = 0;
         idle_period_start = lv_tick_get();
     }
@@ -164,7 +166,9 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
 {
     lv_timer_t * new_timer = NULL;
 
+    LV_MEM_TAG_PUSH(LV_MEM_TAG_TIMER);
     new_timer = _lv_ll_ins_head(&LV_GC_ROOT(_lv_timer_ll));
+    LV_MEM_TAG_POP();
     LV_ASSERT_MALLOC(new_timer);
     if(new_timer == NULL) return NULL;
 
@@ -312,7 +316,9 @@ static bool lv_timer_exec(lv_timer_t * timer)
         if(timer->repeat_count > 0) timer->repeat_count--;
         timer->last_run = lv_tick_get();
         TIMER_TRACE("calling timer callback: %p", timer->timer_cb);
+        LV_TRACE_BEGIN("timer");
         if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
+        LV_TRACE_END("timer");
         TIMER_TRACE("timer callback %p finished", timer->timer_cb);
         LV_ASSERT_MEM_INTEGRITY();
 
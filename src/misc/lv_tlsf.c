@@ -9,7 +9,12 @@
 #include "lv_assert.h"
 #define printf LV_LOG_ERROR
 
+#if LV_MEM_POOL_EXPAND_SIZE
+/*The pools added later can be larger than LV_MEM_SIZE*/
+#define TLSF_MAX_POOL_SIZE LV_MEM_POOL_MAX_SIZE
+#else
 #define TLSF_MAX_POOL_SIZE LV_MEM_SIZE
+#endif
 
 #if !defined(_DEBUG)
 #define _DEBUG 0
@@ -0,0 +1,169 @@
+/**
+ * @file lv_trace.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_trace.h"
+#if LV_USE_TRACE
+
+#include <string.h>
+#include "lv_printf.h"
+#include "../hal/lv_hal_tick.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_trace_event_t events[LV_TRACE_BUF_SIZE];
+static volatile uint32_t event_cnt;     /*Number of events added since the last clear*/
+static lv_trace_time_cb_t custom_time_cb;
+static bool enabled = true;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Register a function to get the time stamps of the events.
+ * Without it `lv_tick_get() * 1000` is used which has only millisecond resolution.
+ * @param time_cb a function returning the current time in microseconds, or NULL to use `lv_tick_get()`
+ */
+void lv_trace_register_time_cb(lv_trace_time_cb_t time_cb)
+{
+    custom_time_cb = time_cb;
+}
+
+/**
+ * Enable or disable recording the events. Recording is enabled by default.
+ * @param en true: enable, false: disable
+ */
+void lv_trace_set_enabled(bool en)
+{
+    enabled = en;
+}
+
+/**
+ * Remove all events from the trace buffer
+ */
+void lv_trace_clear(void)
+{
+    event_cnt = 0;
+}
+
+/**
+ * Get the number of events in the trace buffer
+ * @return number of events, at most `LV_TRACE_BUF_SIZE`
+ */
+uint32_t lv_trace_get_event_cnt(void)
+{
+    uint32_t cnt = event_cnt;
+    return cnt < LV_TRACE_BUF_SIZE ? cnt : LV_TRACE_BUF_SIZE;
+}
+
+/**
+ * Get an event from the trace buffer
+ * @param idx index of the event, 0 is the oldest one
+ * @return pointer to the event or NULL if `idx` is invalid
+ */
+const lv_trace_event_t * lv_trace_get_event(uint32_t idx)
+{
+    uint32_t cnt = event_cnt;
+    if(cnt <= LV_TRACE_BUF_SIZE) {
+        if(idx >= cnt) return NULL;
+        return &events[idx];
+    }
+
+    /*The buffer is wrapped around, the oldest event is the next to overwrite*/
+    if(idx >= LV_TRACE_BUF_SIZE) return NULL;
+    return &events[(cnt + idx) % LV_TRACE_BUF_SIZE];
+}
+
+/**
+ * Dump the events of the trace buffer in Chrome's trace event JSON format.
+ * The result can be opened in `chrome://tracing` or https://ui.perfetto.dev
+ * @param write_cb called with the parts of the JSON text
+ * @param user_data passed to `write_cb`
+ */
+void lv_trace_dump(lv_trace_write_cb_t write_cb, void * user_data)
+{
+    static const char * const ph[] = {
+        [LV_TRACE_TYPE_BEGIN] = "B",
+        [LV_TRACE_TYPE_END] = "E",
+        [LV_TRACE_TYPE_COUNTER] = "C",
+    };
+
+    /*Don't record the events while dumping to keep the buffer consistent*/
+    bool en_prev = enabled;
+    enabled = false;
+
+    char buf[128];
+    const char * head = "{\"traceEvents\":[\n";
+    write_cb(head, (uint32_t)strlen(head), user_data);
+
+    uint32_t cnt = lv_trace_get_event_cnt();
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        const lv_trace_event_t * e = lv_trace_get_event(i);
+        int len = lv_snprintf(buf, sizeof(buf),
+                              "%s{\"name\":\"%s\",\"ph\":\"%s\",\"ts\":%u,\"pid\":0,\"tid\":0,\"args\":{\"value\":%d}}\n",
+                              i == 0 ? "" : ",", e->name, ph[e->type], (unsigned int)e->time, (int)e->value);
+        if(len >= (int)sizeof(buf)) len = sizeof(buf) - 1;
+        if(len > 0) write_cb(buf, len, user_data);
+    }
+
+    const char * tail = "]}\n";
+    write_cb(tail, (uint32_t)strlen(tail), user_data);
+
+    enabled = en_prev;
+}
+
+/**
+ * Add an event to the trace buffer. Use the `LV_TRACE_...` macros instead.
+ * If the buffer is full the oldest event is overwritten.
+ * @param type type of the event, e.g. `LV_TRACE_TYPE_BEGIN`
+ * @param name name of the span or counter. Should be a static string.
+ * @param value value of a counter or an argument of a span
+ */
+void _lv_trace_add(lv_trace_type_t type, const char * name, int32_t value)
+{
+    if(!enabled) return;
+
+    uint32_t time = custom_time_cb ? custom_time_cb() : lv_tick_get() * 1000;
+
+    /*Reserve a slot atomically if possible to allow adding events from interrupts too*/
+#if defined(__GNUC__)
+    uint32_t id = __atomic_fetch_add(&event_cnt, 1, __ATOMIC_RELAXED);
+#else
+    uint32_t id = event_cnt++;
+#endif
+
+    lv_trace_event_t * e = &events[id % LV_TRACE_BUF_SIZE];
+    e->time = time;
+    e->name = name;
+    e->value = value;
+    e->type = type;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#endif /*LV_USE_TRACE*/
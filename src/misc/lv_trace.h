@@ -0,0 +1,133 @@
+/**
+ * @file lv_trace.h
+ *
+ */
+
+#ifndef LV_TRACE_H
+#define LV_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#if LV_USE_TRACE
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+enum {
+    LV_TRACE_TYPE_BEGIN,    /**< Begin of a span*/
+    LV_TRACE_TYPE_END,      /**< End of the last span with the same name*/
+    LV_TRACE_TYPE_COUNTER,  /**< A new value of a counter*/
+};
+
+typedef uint8_t lv_trace_type_t;
+
+/**
+ * An event stored in the trace buffer
+ */
+typedef struct {
+    uint32_t time;          /**< Time stamp in microseconds*/
+    const char * name;      /**< Name of the span or counter. Should be a static string*/
+    int32_t value;          /**< Value of a counter or an argument of a span*/
+    lv_trace_type_t type;
+} lv_trace_event_t;
+
+/**
+ * Get the current time in microseconds
+ */
+typedef uint32_t (*lv_trace_time_cb_t)(void);
+
+/**
+ * Write a part of the dumped trace, e.g. to a file
+ */
+typedef void (*lv_trace_write_cb_t)(const char * buf, uint32_t len, void * user_data);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Register a function to get the time stamps of the events.
+ * Without it `lv_tick_get() * 1000` is used which has only millisecond resolution.
+ * @param time_cb a function returning the current time in microseconds, or NULL to use `lv_tick_get()`
+ */
+void lv_trace_register_time_cb(lv_trace_time_cb_t time_cb);
+
+/**
+ * Enable or disable recording the events. Recording is enabled by default.
+ * @param en true: enable, false: disable
+ */
+void lv_trace_set_enabled(bool en);
+
+/**
+ * Remove all events from the trace buffer
+ */
+void lv_trace_clear(void);
+
+/**
+ * Get the number of events in the trace buffer
+ * @return number of events, at most `LV_TRACE_BUF_SIZE`
+ */
+uint32_t lv_trace_get_event_cnt(void);
+
+/**
+ * Get an event from the trace buffer
+ * @param idx index of the event, 0 is the oldest one
+ * @return pointer to the event or NULL if `idx` is invalid
+ */
+const lv_trace_event_t * lv_trace_get_event(uint32_t idx);
+
+/**
+ * Dump the events of the trace buffer in Chrome's trace event JSON format.
+ * The result can be opened in `chrome://tracing` or https://ui.perfetto.dev
+ * @param write_cb called with the parts of the JSON text
+ * @param user_data passed to `write_cb`
+ */
+void lv_trace_dump(lv_trace_write_cb_t write_cb, void * user_data);
+
+/**
+ * Add an event to the trace buffer. Use the `LV_TRACE_...` macros instead.
+ * If the buffer is full the oldest event is overwritten.
+ * @param type type of the event, e.g. `LV_TRACE_TYPE_BEGIN`
+ * @param name name of the span or counter. Should be a static string.
+ * @param value value of a counter or an argument of a span
+ */
+void _lv_trace_add(lv_trace_type_t type, const char * name, int32_t value);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define LV_TRACE_BEGIN(name)                _lv_trace_add(LV_TRACE_TYPE_BEGIN, name, 0)
+#define LV_TRACE_BEGIN_ARG(name, value)     _lv_trace_add(LV_TRACE_TYPE_BEGIN, name, value)
+#define LV_TRACE_END(name)                  _lv_trace_add(LV_TRACE_TYPE_END, name, 0)
+#define LV_TRACE_COUNTER(name, value)       _lv_trace_add(LV_TRACE_TYPE_COUNTER, name, value)
+
+#else /*LV_USE_TRACE*/
+
+/*Do nothing if `LV_USE_TRACE 0`*/
+#define LV_TRACE_BEGIN(name)
+#define LV_TRACE_BEGIN_ARG(name, value)
+#define LV_TRACE_END(name)
+#define LV_TRACE_COUNTER(name, value)
+
+#endif /*LV_USE_TRACE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_TRACE_H*/
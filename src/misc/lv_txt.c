@@ -17,6 +17,8 @@
 /*********************
  *      DEFINES
  *********************/
+#undef LV_MEM_FILE_TAG
+#define LV_MEM_FILE_TAG LV_MEM_TAG_TEXT
 #define NO_BREAK_FOUND UINT32_MAX
 
 /**********************
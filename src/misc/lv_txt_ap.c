@@ -16,6 +16,8 @@
 /*********************
  *      DEFINES
  *********************/
+#undef LV_MEM_FILE_TAG
+#define LV_MEM_FILE_TAG LV_MEM_TAG_TEXT
 
 /**********************
  *      TYPEDEFS
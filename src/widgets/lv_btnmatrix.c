@@ -58,6 +58,7 @@ static void make_one_button_checked(lv_obj_t * obj, uint16_t btn_idx);
 static const char * lv_btnmatrix_def_map[] = {"Btn1", "Btn2", "Btn3", "\n", "Btn4", "Btn5", ""};
 
 const lv_obj_class_t lv_btnmatrix_class = {
+    .name = "btnmatrix",
         .constructor_cb = lv_btnmatrix_constructor,
         .destructor_cb = lv_btnmatrix_destructor,
         .event_cb = lv_btnmatrix_event,
@@ -10,7 +10,6 @@
 #include "../misc/lv_assert.h"
 #include "../misc/lv_math.h"
 #include "../draw/lv_draw.h"
-#include "../core/lv_refr.h"
 
 #if LV_USE_CANVAS != 0
 
@@ -23,35 +22,31 @@
  *      TYPEDEFS
  **********************/
 
+/*The draw functions render directly into the canvas's buffer through a draw target*/
+typedef struct _lv_canvas_target_t {
+    lv_draw_target_t draw_target;
+    lv_area_t clip;
+    lv_draw_target_t * draw_target_ori;
+    uint8_t antialiasing : 1;
+} lv_canvas_target_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void lv_canvas_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
-static void set_set_px_cb(lv_disp_drv_t * disp_drv, lv_img_cf_t cf);
-
-static void set_px_true_color_alpha(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x,
-                                    lv_coord_t y,
-                                    lv_color_t color, lv_opa_t opa);
-
-static void set_px_cb_alpha1(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
-                             lv_color_t color, lv_opa_t opa);
-
-static void set_px_cb_alpha2(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
-                             lv_color_t color, lv_opa_t opa);
-
-static void set_px_cb_alpha4(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
-                             lv_color_t color, lv_opa_t opa);
-
-static void set_px_cb_alpha8(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
-                             lv_color_t color, lv_opa_t opa);
-
-static void set_px_alpha_generic(lv_img_dsc_t * d, lv_coord_t x, lv_coord_t y, lv_color_t color, lv_opa_t opa);
+static void lv_canvas_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void target_init(lv_obj_t * canvas, lv_canvas_target_t * target);
+static lv_canvas_target_t * target_open(lv_obj_t * canvas, lv_canvas_target_t * target_tmp);
+static void target_close(lv_obj_t * canvas, lv_canvas_target_t * target);
+static void blur_area(lv_obj_t * obj, const lv_area_t * area, uint16_t r, bool ver);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 const lv_obj_class_t lv_canvas_class = {
+    .name = "canvas",
     .constructor_cb = lv_canvas_constructor,
+    .destructor_cb = lv_canvas_destructor,
     .instance_size = sizeof(lv_canvas_t),
     .base_class = &lv_img_class
 };
@@ -89,6 +84,9 @@ void lv_canvas_set_buffer(lv_obj_t * obj, void * buf, lv_coord_t w, lv_coord_t h
     canvas->dsc.data      = buf;
 
     lv_img_set_src(obj, &canvas->dsc);
+
+    /*Render to the new buffer if drawing is in progress*/
+    if(canvas->target) target_init(obj, canvas->target);
 }
 
 void lv_canvas_set_px(lv_obj_t * obj, lv_coord_t x, lv_coord_t y, lv_color_t c)
@@ -98,7 +96,7 @@ void lv_canvas_set_px(lv_obj_t * obj, lv_coord_t x, lv_coord_t y, lv_color_t c)
     lv_canvas_t * canvas = (lv_canvas_t *)obj;
 
     lv_img_buf_set_px_color(&canvas->dsc, x, y, c);
-    lv_obj_invalidate(obj);
+    if(canvas->target == NULL) lv_obj_invalidate(obj);
 }
 
 void lv_canvas_set_palette(lv_obj_t * obj, uint8_t id, lv_color_t c)
@@ -267,261 +265,14 @@ void lv_canvas_blur_hor(lv_obj_t * obj, const lv_area_t * area, uint16_t r)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
-    if(r == 0) return;
-
-    lv_canvas_t * canvas = (lv_canvas_t *)obj;
-
-    lv_area_t a;
-    if(area) {
-        lv_area_copy(&a, area);
-        if(a.x1 < 0) a.x1 = 0;
-        if(a.y1 < 0) a.y1 = 0;
-        if(a.x2 > canvas->dsc.header.w - 1) a.x2 = canvas->dsc.header.w - 1;
-        if(a.y2 > canvas->dsc.header.h - 1) a.y2 = canvas->dsc.header.h - 1;
-    }
-    else {
-        a.x1 = 0;
-        a.y1 = 0;
-        a.x2 = canvas->dsc.header.w - 1;
-        a.y2 = canvas->dsc.header.h - 1;
-    }
-
-    lv_color_t color = lv_obj_get_style_img_recolor(obj, LV_PART_MAIN);
-
-    uint16_t r_back = r / 2;
-    uint16_t r_front = r / 2;
-
-    if((r & 0x1) == 0) r_back--;
-
-    bool has_alpha = lv_img_cf_has_alpha(canvas->dsc.header.cf);
-
-    lv_coord_t line_w = lv_img_buf_get_img_size(canvas->dsc.header.w, 1, canvas->dsc.header.cf);
-    uint8_t * line_buf = lv_mem_buf_get(line_w);
-
-    lv_img_dsc_t line_img;
-    line_img.data = line_buf;
-    line_img.header.always_zero = 0;
-    line_img.header.w = canvas->dsc.header.w;
-    line_img.header.h = 1;
-    line_img.header.cf = canvas->dsc.header.cf;
-
-    lv_coord_t x;
-    lv_coord_t y;
-    lv_coord_t x_safe;
-
-    for(y = a.y1; y <= a.y2; y++) {
-        uint32_t asum = 0;
-        uint32_t rsum = 0;
-        uint32_t gsum = 0;
-        uint32_t bsum = 0;
-
-        lv_color_t c;
-        lv_opa_t opa = LV_OPA_TRANSP;
-        lv_memcpy(line_buf, &canvas->dsc.data[y * line_w], line_w);
-
-        for(x = a.x1 - r_back; x <= a.x1 + r_front; x++) {
-            x_safe = x < 0 ? 0 : x;
-            x_safe = x_safe > canvas->dsc.header.w - 1 ? canvas->dsc.header.w - 1 : x_safe;
-
-            c = lv_img_buf_get_px_color(&line_img, x_safe, 0, color);
-            if(has_alpha) opa = lv_img_buf_get_px_alpha(&line_img, x_safe, 0);
-
-            rsum += c.ch.red;
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
-            gsum += (c.ch.green_h << 3) + c.ch.green_l;
-#else
-            gsum += c.ch.green;
-#endif
-            bsum += c.ch.blue;
-            if(has_alpha) asum += opa;
-        }
-
-        /*Just to indicate that the px is visible*/
-        if(has_alpha == false) asum = LV_OPA_COVER;
-
-        for(x = a.x1; x <= a.x2; x++) {
-
-            if(asum) {
-                c.ch.red = rsum / r;
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
-                uint8_t gtmp = gsum / r;
-                c.ch.green_h = gtmp >> 3;
-                c.ch.green_l = gtmp & 0x7;
-#else
-                c.ch.green = gsum / r;
-#endif
-                c.ch.blue = bsum / r;
-                if(has_alpha) opa = asum / r;
-
-                lv_img_buf_set_px_color(&canvas->dsc, x, y, c);
-            }
-            if(has_alpha) lv_img_buf_set_px_alpha(&canvas->dsc, x, y, opa);
-
-            x_safe = x - r_back;
-            x_safe = x_safe < 0 ? 0 : x_safe;
-            c = lv_img_buf_get_px_color(&line_img, x_safe, 0, color);
-            if(has_alpha) opa = lv_img_buf_get_px_alpha(&line_img, x_safe, 0);
-
-            rsum -= c.ch.red;
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
-            gsum -= (c.ch.green_h << 3) + c.ch.green_l;
-#else
-            gsum -= c.ch.green;
-#endif
-            bsum -= c.ch.blue;
-            if(has_alpha) asum -= opa;
-
-            x_safe = x + 1 + r_front;
-            x_safe = x_safe > canvas->dsc.header.w - 1 ? canvas->dsc.header.w - 1 : x_safe;
-            c = lv_img_buf_get_px_color(&line_img, x_safe, 0, lv_color_white());
-            if(has_alpha) opa = lv_img_buf_get_px_alpha(&line_img, x_safe, 0);
-
-            rsum += c.ch.red;
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
-            gsum += (c.ch.green_h << 3) + c.ch.green_l;
-#else
-            gsum += c.ch.green;
-#endif
-            bsum += c.ch.blue;
-            if(has_alpha) asum += opa;
-        }
-    }
-    lv_obj_invalidate(obj);
-
-    lv_mem_buf_release(line_buf);
+    blur_area(obj, area, r, false);
 }
 
 void lv_canvas_blur_ver(lv_obj_t * obj, const lv_area_t * area, uint16_t r)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
-    if(r == 0) return;
-
-    lv_canvas_t * canvas = (lv_canvas_t *)obj;
-
-    lv_area_t a;
-    if(area) {
-        lv_area_copy(&a, area);
-        if(a.x1 < 0) a.x1 = 0;
-        if(a.y1 < 0) a.y1 = 0;
-        if(a.x2 > canvas->dsc.header.w - 1) a.x2 = canvas->dsc.header.w - 1;
-        if(a.y2 > canvas->dsc.header.h - 1) a.y2 = canvas->dsc.header.h - 1;
-    }
-    else {
-        a.x1 = 0;
-        a.y1 = 0;
-        a.x2 = canvas->dsc.header.w - 1;
-        a.y2 = canvas->dsc.header.h - 1;
-    }
-
-    lv_color_t color = lv_obj_get_style_img_recolor(obj, LV_PART_MAIN);
-
-    uint16_t r_back = r / 2;
-    uint16_t r_front = r / 2;
-
-    if((r & 0x1) == 0) r_back--;
-
-    bool has_alpha = lv_img_cf_has_alpha(canvas->dsc.header.cf);
-    lv_coord_t col_w = lv_img_buf_get_img_size(1, canvas->dsc.header.h, canvas->dsc.header.cf);
-    uint8_t * col_buf = lv_mem_buf_get(col_w);
-    lv_img_dsc_t line_img;
-
-    line_img.data = col_buf;
-    line_img.header.always_zero = 0;
-    line_img.header.w = 1;
-    line_img.header.h = canvas->dsc.header.h;
-    line_img.header.cf = canvas->dsc.header.cf;
-
-    lv_coord_t x;
-    lv_coord_t y;
-    lv_coord_t y_safe;
-
-    for(x = a.x1; x <= a.x2; x++) {
-        uint32_t asum = 0;
-        uint32_t rsum = 0;
-        uint32_t gsum = 0;
-        uint32_t bsum = 0;
-
-        lv_color_t c;
-        lv_opa_t opa = LV_OPA_COVER;
-
-        for(y = a.y1 - r_back; y <= a.y1 + r_front; y++) {
-            y_safe = y < 0 ? 0 : y;
-            y_safe = y_safe > canvas->dsc.header.h - 1 ? canvas->dsc.header.h - 1 : y_safe;
-
-            c = lv_img_buf_get_px_color(&canvas->dsc, x, y_safe, color);
-            if(has_alpha) opa = lv_img_buf_get_px_alpha(&canvas->dsc, x, y_safe);
-
-            lv_img_buf_set_px_color(&line_img, 0, y_safe, c);
-            if(has_alpha) lv_img_buf_set_px_alpha(&line_img, 0, y_safe, opa);
-
-            rsum += c.ch.red;
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
-            gsum += (c.ch.green_h << 3) + c.ch.green_l;
-#else
-            gsum += c.ch.green;
-#endif
-            bsum += c.ch.blue;
-            if(has_alpha) asum += opa;
-        }
-
-        /*Just to indicate that the px is visible*/
-        if(has_alpha == false) asum = LV_OPA_COVER;
-
-        for(y = a.y1; y <= a.y2; y++) {
-            if(asum) {
-                c.ch.red = rsum / r;
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
-                uint8_t gtmp = gsum / r;
-                c.ch.green_h = gtmp >> 3;
-                c.ch.green_l = gtmp & 0x7;
-#else
-                c.ch.green = gsum / r;
-#endif
-                c.ch.blue = bsum / r;
-                if(has_alpha) opa = asum / r;
-
-                lv_img_buf_set_px_color(&canvas->dsc, x, y, c);
-            }
-            if(has_alpha) lv_img_buf_set_px_alpha(&canvas->dsc, x, y, opa);
-
-            y_safe = y - r_back;
-            y_safe = y_safe < 0 ? 0 : y_safe;
-            c = lv_img_buf_get_px_color(&line_img, 0, y_safe, color);
-            if(has_alpha) opa = lv_img_buf_get_px_alpha(&line_img, 0, y_safe);
-
-            rsum -= c.ch.red;
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
-            gsum -= (c.ch.green_h << 3) + c.ch.green_l;
-#else
-            gsum -= c.ch.green;
-#endif
-            bsum -= c.ch.blue;
-            if(has_alpha) asum -= opa;
-
-            y_safe = y + 1 + r_front;
-            y_safe = y_safe > canvas->dsc.header.h - 1 ? canvas->dsc.header.h - 1 : y_safe;
-
-            c = lv_img_buf_get_px_color(&canvas->dsc, x, y_safe, color);
-            if(has_alpha) opa = lv_img_buf_get_px_alpha(&canvas->dsc, x, y_safe);
-
-            lv_img_buf_set_px_color(&line_img, 0, y_safe, c);
-            if(has_alpha) lv_img_buf_set_px_alpha(&line_img, 0, y_safe, opa);
-
-            rsum += c.ch.red;
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
-            gsum += (c.ch.green_h << 3) + c.ch.green_l;
-#else
-            gsum += c.ch.green;
-#endif
-            bsum += c.ch.blue;
-            if(has_alpha) asum += opa;
-        }
-    }
-
-    lv_obj_invalidate(obj);
-
-    lv_mem_buf_release(col_buf);
+    blur_area(obj, area, r, true);
 }
 
 void lv_canvas_fill_bg(lv_obj_t * canvas, lv_color_t color, lv_opa_t opa)
@@ -553,6 +304,36 @@ void lv_canvas_fill_bg(lv_obj_t * canvas, lv_color_t color, lv_opa_t opa)
     lv_obj_invalidate(canvas);
 }
 
+void lv_canvas_draw_begin(lv_obj_t * canvas)
+{
+    LV_ASSERT_OBJ(canvas, MY_CLASS);
+
+    lv_canvas_t * c = (lv_canvas_t *)canvas;
+    if(c->target) {
+        LV_LOG_WARN("lv_canvas_draw_begin: drawing is already started");
+        return;
+    }
+
+    c->target = lv_mem_alloc(sizeof(lv_canvas_target_t));
+    LV_ASSERT_MALLOC(c->target);
+    if(c->target == NULL) return;
+
+    target_init(canvas, c->target);
+}
+
+void lv_canvas_draw_end(lv_obj_t * canvas)
+{
+    LV_ASSERT_OBJ(canvas, MY_CLASS);
+
+    lv_canvas_t * c = (lv_canvas_t *)canvas;
+    if(c->target == NULL) return;
+
+    lv_mem_free(c->target);
+    c->target = NULL;
+
+    lv_obj_invalidate(canvas);
+}
+
 void lv_canvas_draw_rect(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h,
                          const lv_draw_rect_dsc_t * draw_dsc)
 {
@@ -565,53 +346,25 @@ void lv_canvas_draw_rect(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord
         return;
     }
 
-    /*Create a dummy display to fool the lv_draw function.
-     *It will think it draws to real screen.*/
-    lv_area_t mask;
-    mask.x1 = 0;
-    mask.x2 = dsc->header.w - 1;
-    mask.y1 = 0;
-    mask.y2 = dsc->header.h - 1;
-
     lv_area_t coords;
     coords.x1 = x;
     coords.y1 = y;
     coords.x2 = x + w - 1;
     coords.y2 = y + h - 1;
 
-    lv_disp_t disp;
-    /*Allocate the fake driver on the stack as the entire display doesn't outlive this function*/
-    lv_disp_drv_t driver;
-    lv_memset_00(&disp, sizeof(lv_disp_t));
-    disp.driver = &driver;
-
-    lv_disp_draw_buf_t draw_buf;
-    lv_disp_draw_buf_init(&draw_buf, (void *)dsc->data, NULL, dsc->header.w * dsc->header.h);
-    lv_area_copy(&draw_buf.area, &mask);
-
-    lv_disp_drv_init(disp.driver);
-
-    disp.driver->draw_buf = &draw_buf;
-    disp.driver->hor_res = dsc->header.w;
-    disp.driver->ver_res = dsc->header.h;
-
-    set_set_px_cb(disp.driver, dsc->header.cf);
+    lv_canvas_target_t target_tmp;
+    lv_canvas_target_t * target = target_open(canvas, &target_tmp);
 
     /*Disable anti-aliasing if drawing with transparent color to chroma keyed canvas*/
     lv_color_t ctransp = LV_COLOR_CHROMA_KEY;
     if(dsc->header.cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED &&
        draw_dsc->bg_color.full == ctransp.full) {
-        disp.driver->antialiasing = 0;
+        target->draw_target.antialiasing = 0;
     }
 
-    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
-    _lv_refr_set_disp_refreshing(&disp);
+    lv_draw_rect(&coords, &target->clip, draw_dsc);
 
-    lv_draw_rect(&coords, &mask, draw_dsc);
-
-    _lv_refr_set_disp_refreshing(refr_ori);
-
-    lv_obj_invalidate(canvas);
+    target_close(canvas, target);
 }
 
 void lv_canvas_draw_text(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord_t max_w,
@@ -626,46 +379,18 @@ void lv_canvas_draw_text(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord
         return;
     }
 
-    /*Create a dummy display to fool the lv_draw function.
-     *It will think it draws to real screen.*/
-    lv_area_t mask;
-    mask.x1 = 0;
-    mask.x2 = dsc->header.w - 1;
-    mask.y1 = 0;
-    mask.y2 = dsc->header.h - 1;
-
     lv_area_t coords;
     coords.x1 = x;
     coords.y1 = y;
     coords.x2 = x + max_w - 1;
     coords.y2 = dsc->header.h - 1;
 
-    lv_disp_t disp;
-    /*Allocate the fake driver on the stack as the entire display doesn't outlive this function*/
-    lv_disp_drv_t driver;
-    lv_memset_00(&disp, sizeof(lv_disp_t));
-    disp.driver = &driver;
-
-    lv_disp_draw_buf_t draw_buf;
-    lv_disp_draw_buf_init(&draw_buf, (void *)dsc->data, NULL, dsc->header.w * dsc->header.h);
-    lv_area_copy(&draw_buf.area, &mask);
-
-    lv_disp_drv_init(disp.driver);
-
-    disp.driver->draw_buf = &draw_buf;
-    disp.driver->hor_res = dsc->header.w;
-    disp.driver->ver_res = dsc->header.h;
+    lv_canvas_target_t target_tmp;
+    lv_canvas_target_t * target = target_open(canvas, &target_tmp);
 
-    set_set_px_cb(disp.driver, dsc->header.cf);
+    lv_draw_label(&coords, &target->clip, draw_dsc, txt, NULL);
 
-    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
-    _lv_refr_set_disp_refreshing(&disp);
-
-    lv_draw_label(&coords, &mask, draw_dsc, txt, NULL);
-
-    _lv_refr_set_disp_refreshing(refr_ori);
-
-    lv_obj_invalidate(canvas);
+    target_close(canvas, target);
 }
 
 void lv_canvas_draw_img(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, const void * src,
@@ -680,14 +405,6 @@ void lv_canvas_draw_img(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, const voi
         return;
     }
 
-    /*Create a dummy display to fool the lv_draw function.
-     *It will think it draws to real screen.*/
-    lv_area_t mask;
-    mask.x1 = 0;
-    mask.x2 = dsc->header.w - 1;
-    mask.y1 = 0;
-    mask.y2 = dsc->header.h - 1;
-
     lv_img_header_t header;
     lv_res_t res = lv_img_decoder_get_info(src, &header);
     if(res != LV_RES_OK) {
@@ -701,32 +418,12 @@ void lv_canvas_draw_img(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, const voi
     coords.x2 = x + header.w - 1;
     coords.y2 = y + header.h - 1;
 
-    lv_disp_t disp;
-    /*Allocate the fake driver on the stack as the entire display doesn't outlive this function*/
-    lv_disp_drv_t driver;
-    lv_memset_00(&disp, sizeof(lv_disp_t));
-    disp.driver = &driver;
-
-    lv_disp_draw_buf_t draw_buf;
-    lv_disp_draw_buf_init(&draw_buf, (void *)dsc->data, NULL, dsc->header.w * dsc->header.h);
-    lv_area_copy(&draw_buf.area, &mask);
-
-    lv_disp_drv_init(disp.driver);
-
-    disp.driver->draw_buf = &draw_buf;
-    disp.driver->hor_res = dsc->header.w;
-    disp.driver->ver_res = dsc->header.h;
+    lv_canvas_target_t target_tmp;
+    lv_canvas_target_t * target = target_open(canvas, &target_tmp);
 
-    set_set_px_cb(disp.driver, dsc->header.cf);
+    lv_draw_img(&coords, &target->clip, src, draw_dsc);
 
-    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
-    _lv_refr_set_disp_refreshing(&disp);
-
-    lv_draw_img(&coords, &mask, src, draw_dsc);
-
-    _lv_refr_set_disp_refreshing(refr_ori);
-
-    lv_obj_invalidate(canvas);
+    target_close(canvas, target);
 }
 
 void lv_canvas_draw_line(lv_obj_t * canvas, const lv_point_t points[], uint32_t point_cnt,
@@ -740,50 +437,19 @@ void lv_canvas_draw_line(lv_obj_t * canvas, const lv_point_t points[], uint32_t
         LV_LOG_WARN("lv_canvas_draw_line: can't draw to LV_IMG_CF_INDEXED canvas");
         return;
     }
-    /*Create a dummy display to fool the lv_draw function.
-     *It will think it draws to real screen.*/
-    lv_area_t mask;
-    mask.x1 = 0;
-    mask.x2 = dsc->header.w - 1;
-    mask.y1 = 0;
-    mask.y2 = dsc->header.h - 1;
-
-    lv_disp_t disp;
-    /*Allocate the fake driver on the stack as the entire display doesn't outlive this function*/
-    lv_disp_drv_t driver;
-    lv_memset_00(&disp, sizeof(lv_disp_t));
-    disp.driver = &driver;
-
-    lv_disp_draw_buf_t draw_buf;
-    lv_disp_draw_buf_init(&draw_buf, (void *)dsc->data, NULL, dsc->header.w * dsc->header.h);
-    lv_area_copy(&draw_buf.area, &mask);
-
-    lv_disp_drv_init(disp.driver);
-
-    disp.driver->draw_buf = &draw_buf;
-    disp.driver->hor_res = dsc->header.w;
-    disp.driver->ver_res = dsc->header.h;
-
-    set_set_px_cb(disp.driver, dsc->header.cf);
+    lv_canvas_target_t target_tmp;
+    lv_canvas_target_t * target = target_open(canvas, &target_tmp);
 
     /*Disable anti-aliasing if drawing with transparent color to chroma keyed canvas*/
     lv_color_t ctransp = LV_COLOR_CHROMA_KEY;
     if(dsc->header.cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED &&
        draw_dsc->color.full == ctransp.full) {
-        disp.driver->antialiasing = 0;
+        target->draw_target.antialiasing = 0;
     }
 
-    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
-    _lv_refr_set_disp_refreshing(&disp);
-
-    uint32_t i;
-    for(i = 0; i < point_cnt - 1; i++) {
-        lv_draw_line(&points[i], &points[i + 1], &mask, draw_dsc);
-    }
+    lv_draw_polyline(points, point_cnt, &target->clip, draw_dsc);
 
-    _lv_refr_set_disp_refreshing(refr_ori);
-
-    lv_obj_invalidate(canvas);
+    target_close(canvas, target);
 }
 
 void lv_canvas_draw_polygon(lv_obj_t * canvas, const lv_point_t points[], uint32_t point_cnt,
@@ -798,47 +464,19 @@ void lv_canvas_draw_polygon(lv_obj_t * canvas, const lv_point_t points[], uint32
         return;
     }
 
-    /*Create a dummy display to fool the lv_draw function.
-     *It will think it draws to real screen.*/
-    lv_area_t mask;
-    mask.x1 = 0;
-    mask.x2 = dsc->header.w - 1;
-    mask.y1 = 0;
-    mask.y2 = dsc->header.h - 1;
-
-    lv_disp_t disp;
-    /*Allocate the fake driver on the stack as the entire display doesn't outlive this function*/
-    lv_disp_drv_t driver;
-    lv_memset_00(&disp, sizeof(lv_disp_t));
-    disp.driver = &driver;
-
-    lv_disp_draw_buf_t draw_buf;
-    lv_disp_draw_buf_init(&draw_buf, (void *)dsc->data, NULL, dsc->header.w * dsc->header.h);
-    lv_area_copy(&draw_buf.area, &mask);
-
-    lv_disp_drv_init(disp.driver);
-
-    disp.driver->draw_buf = &draw_buf;
-    disp.driver->hor_res = dsc->header.w;
-    disp.driver->ver_res = dsc->header.h;
-
-    set_set_px_cb(disp.driver, dsc->header.cf);
+    lv_canvas_target_t target_tmp;
+    lv_canvas_target_t * target = target_open(canvas, &target_tmp);
 
     /*Disable anti-aliasing if drawing with transparent color to chroma keyed canvas*/
     lv_color_t ctransp = LV_COLOR_CHROMA_KEY;
     if(dsc->header.cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED &&
        draw_dsc->bg_color.full == ctransp.full) {
-        disp.driver->antialiasing = 0;
+        target->draw_target.antialiasing = 0;
     }
 
-    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
-    _lv_refr_set_disp_refreshing(&disp);
+    lv_draw_polygon(points, point_cnt, &target->clip, draw_dsc);
 
-    lv_draw_polygon(points, point_cnt, &mask, draw_dsc);
-
-    _lv_refr_set_disp_refreshing(refr_ori);
-
-    lv_obj_invalidate(canvas);
+    target_close(canvas, target);
 }
 
 void lv_canvas_draw_arc(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord_t r, int32_t start_angle,
@@ -854,47 +492,19 @@ void lv_canvas_draw_arc(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord_
         return;
     }
 
-    /*Create a dummy display to fool the lv_draw function.
-     *It will think it draws to real screen.*/
-    lv_area_t mask;
-    mask.x1 = 0;
-    mask.x2 = dsc->header.w - 1;
-    mask.y1 = 0;
-    mask.y2 = dsc->header.h - 1;
-
-    lv_disp_t disp;
-    /*Allocate the fake driver on the stack as the entire display doesn't outlive this function*/
-    lv_disp_drv_t driver;
-    lv_memset_00(&disp, sizeof(lv_disp_t));
-    disp.driver = &driver;
-
-    lv_disp_draw_buf_t draw_buf;
-    lv_disp_draw_buf_init(&draw_buf, (void *)dsc->data, NULL, dsc->header.w * dsc->header.h);
-    lv_area_copy(&draw_buf.area, &mask);
-
-    lv_disp_drv_init(disp.driver);
-
-    disp.driver->draw_buf = &draw_buf;
-    disp.driver->hor_res = dsc->header.w;
-    disp.driver->ver_res = dsc->header.h;
-
-    set_set_px_cb(disp.driver, dsc->header.cf);
+    lv_canvas_target_t target_tmp;
+    lv_canvas_target_t * target = target_open(canvas, &target_tmp);
 
     /*Disable anti-aliasing if drawing with transparent color to chroma keyed canvas*/
     lv_color_t ctransp = LV_COLOR_CHROMA_KEY;
     if(dsc->header.cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED &&
        draw_dsc->color.full == ctransp.full) {
-        disp.driver->antialiasing = 0;
+        target->draw_target.antialiasing = 0;
     }
 
-    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
-    _lv_refr_set_disp_refreshing(&disp);
-
-    lv_draw_arc(x, y, r,  start_angle, end_angle, &mask, draw_dsc);
+    lv_draw_arc(x, y, r,  start_angle, end_angle, &target->clip, draw_dsc);
 
-    _lv_refr_set_disp_refreshing(refr_ori);
-
-    lv_obj_invalidate(canvas);
+    target_close(canvas, target);
 #else
     LV_UNUSED(canvas);
     LV_UNUSED(x);
@@ -924,129 +534,209 @@ static void lv_canvas_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj
     canvas->dsc.header.w           = 0;
     canvas->dsc.data_size          = 0;
     canvas->dsc.data               = NULL;
+    canvas->target                 = NULL;
 
     lv_img_set_src(obj, &canvas->dsc);
 
     LV_TRACE_OBJ_CREATE("finished");
 }
 
-static void set_set_px_cb(lv_disp_drv_t * disp_drv, lv_img_cf_t cf)
+static void lv_canvas_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 {
-    switch(cf) {
-        case LV_IMG_CF_TRUE_COLOR_ALPHA:
-            disp_drv->set_px_cb = set_px_true_color_alpha;
-            break;
-        case LV_IMG_CF_ALPHA_1BIT:
-            disp_drv->set_px_cb = set_px_cb_alpha1;
-            break;
-        case LV_IMG_CF_ALPHA_2BIT:
-            disp_drv->set_px_cb = set_px_cb_alpha2;
-            break;
-        case LV_IMG_CF_ALPHA_4BIT:
-            disp_drv->set_px_cb = set_px_cb_alpha4;
-            break;
-        case LV_IMG_CF_ALPHA_8BIT:
-            disp_drv->set_px_cb = set_px_cb_alpha8;
-            break;
-        default:
-            disp_drv->set_px_cb = NULL;
+    LV_UNUSED(class_p);
+
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+    if(canvas->target) {
+        lv_mem_free(canvas->target);
+        canvas->target = NULL;
     }
 }
 
-static void set_px_cb_alpha1(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
-                             lv_color_t color, lv_opa_t opa)
+/**
+ * Set up a draw target which renders directly into the buffer of a canvas
+ * @param canvas    pointer to a canvas object
+ * @param target    pointer to a target to initialize
+ */
+static void target_init(lv_obj_t * canvas, lv_canvas_target_t * target)
 {
-    (void) disp_drv; /*Unused*/
+    lv_img_dsc_t * dsc = lv_canvas_get_img(canvas);
 
-    if(opa <= LV_OPA_MIN) return;
-    lv_img_dsc_t d;
-    d.data = buf;
-    d.header.w = buf_w;
-    d.header.cf = LV_IMG_CF_ALPHA_1BIT;
+    target->clip.x1 = 0;
+    target->clip.x2 = dsc->header.w - 1;
+    target->clip.y1 = 0;
+    target->clip.y2 = dsc->header.h - 1;
 
-    set_px_alpha_generic(&d, x, y, color, opa);
+    lv_draw_target_init(&target->draw_target, (void *)dsc->data, &target->clip, dsc->header.cf);
+    target->antialiasing = target->draw_target.antialiasing;
 }
 
-static void set_px_cb_alpha2(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
-                             lv_color_t color, lv_opa_t opa)
+/**
+ * Get the target of the canvas and make the draw functions render to it
+ * @param canvas        pointer to a canvas object
+ * @param target_tmp    a target to initialize and use if drawing wasn't started with `lv_canvas_draw_begin()`
+ * @return              the target to use
+ */
+static lv_canvas_target_t * target_open(lv_obj_t * canvas, lv_canvas_target_t * target_tmp)
 {
-    (void) disp_drv; /*Unused*/
+    lv_canvas_t * c = (lv_canvas_t *)canvas;
+    lv_canvas_target_t * target = c->target;
+    if(target == NULL) {
+        target = target_tmp;
+        target_init(canvas, target);
+    }
 
-    if(opa <= LV_OPA_MIN) return;
-    lv_img_dsc_t d;
-    d.data = buf;
-    d.header.w = buf_w;
-    d.header.cf = LV_IMG_CF_ALPHA_2BIT;
+    target->draw_target.antialiasing = target->antialiasing;
+    target->draw_target_ori = _lv_draw_target_set(&target->draw_target);
 
-    set_px_alpha_generic(&d, x, y, color, opa);
+    return target;
 }
 
-static void set_px_cb_alpha4(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
-                             lv_color_t color, lv_opa_t opa)
+/**
+ * Finish drawing to a target opened by `target_open()`
+ * @param canvas    pointer to a canvas object
+ * @param target    the target returned by `target_open()`
+ */
+static void target_close(lv_obj_t * canvas, lv_canvas_target_t * target)
 {
-    (void) disp_drv; /*Unused*/
+    lv_canvas_t * c = (lv_canvas_t *)canvas;
 
-    if(opa <= LV_OPA_MIN) return;
-    lv_img_dsc_t d;
-    d.data = buf;
-    d.header.w = buf_w;
-    d.header.cf = LV_IMG_CF_ALPHA_4BIT;
+    _lv_draw_target_set(target->draw_target_ori);
 
-    set_px_alpha_generic(&d, x, y, color, opa);
+    /*If drawing was started by `lv_canvas_draw_begin()` `lv_canvas_draw_end()` will invalidate the canvas*/
+    if(target != c->target) lv_obj_invalidate(canvas);
 }
 
-static void set_px_cb_alpha8(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
-                             lv_color_t color, lv_opa_t opa)
+/**
+ * Blur the rows or the columns of an area of the canvas with a box filter
+ * @param obj       pointer to a canvas object
+ * @param area      the area to blur. If `NULL` the whole canvas will be blurred.
+ * @param r         radius of the blur
+ * @param ver       true: blur the columns; false: blur the rows
+ */
+static void blur_area(lv_obj_t * obj, const lv_area_t * area, uint16_t r, bool ver)
 {
-    (void) disp_drv; /*Unused*/
+    if(r == 0) return;
 
-    if(opa <= LV_OPA_MIN) return;
-    lv_img_dsc_t d;
-    d.data = buf;
-    d.header.w = buf_w;
-    d.header.cf = LV_IMG_CF_ALPHA_8BIT;
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+    lv_img_dsc_t * dsc = &canvas->dsc;
 
-    set_px_alpha_generic(&d, x, y, color, opa);
-}
+    lv_area_t a;
+    if(area) {
+        lv_area_copy(&a, area);
+        if(a.x1 < 0) a.x1 = 0;
+        if(a.y1 < 0) a.y1 = 0;
+        if(a.x2 > dsc->header.w - 1) a.x2 = dsc->header.w - 1;
+        if(a.y2 > dsc->header.h - 1) a.y2 = dsc->header.h - 1;
+    }
+    else {
+        a.x1 = 0;
+        a.y1 = 0;
+        a.x2 = dsc->header.w - 1;
+        a.y2 = dsc->header.h - 1;
+    }
+    if(a.x1 > a.x2 || a.y1 > a.y2) return;
 
-static void set_px_alpha_generic(lv_img_dsc_t * d, lv_coord_t x, lv_coord_t y, lv_color_t color, lv_opa_t opa)
-{
-    d->header.always_zero = 0;
-    d->header.h = 1;    /*Doesn't matter*/
+    lv_color_t color = lv_obj_get_style_img_recolor(obj, LV_PART_MAIN);
 
-    uint8_t br = lv_color_brightness(color);
-    if(opa < LV_OPA_MAX) {
-        uint8_t bg = lv_img_buf_get_px_alpha(d, x, y);
-        br = (uint16_t)((uint16_t)br * opa + (bg * (255 - opa))) >> 8;
-    }
+    uint32_t r_back = r / 2;
+    uint32_t r_front = r / 2;
 
-    lv_img_buf_set_px_alpha(d, x, y, br);
-}
+    if((r & 0x1) == 0) r_back--;
 
-static void set_px_true_color_alpha(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x,
-                                    lv_coord_t y,
-                                    lv_color_t color, lv_opa_t opa)
-{
-    (void) disp_drv; /*Unused*/
+    bool has_alpha = lv_img_cf_has_alpha(dsc->header.cf);
+    bool true_color = dsc->header.cf == LV_IMG_CF_TRUE_COLOR || dsc->header.cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED;
+    bool true_color_alpha = dsc->header.cf == LV_IMG_CF_TRUE_COLOR_ALPHA;
+
+    /*The pixels out of the area but in the radius of the blur are used too*/
+    int32_t max = (ver ? dsc->header.h : dsc->header.w) - 1;
+    int32_t start = (ver ? a.y1 : a.x1) - (int32_t)r_back;
+    int32_t end = (ver ? a.y2 : a.x2) + (int32_t)r_front;
+    if(start < 0) start = 0;
+    if(end > max) end = max;
+    uint32_t len = end - start + 1;
+    uint32_t ofs = (ver ? a.y1 : a.x1) - start;
+    uint32_t area_len = ver ? lv_area_get_height(&a) : lv_area_get_width(&a);
+
+    /*Blur the color channels separately*/
+    uint16_t * rbuf = lv_mem_buf_get(len * 5 * sizeof(uint16_t));
+    uint16_t * gbuf = rbuf + len;
+    uint16_t * bbuf = gbuf + len;
+    uint16_t * abuf = bbuf + len;
+    uint16_t * tmp = abuf + len;
+
+    int32_t line;
+    int32_t line_end = ver ? a.x2 : a.y2;
+    for(line = ver ? a.x1 : a.y1; line <= line_end; line++) {
+        uint32_t i;
+        for(i = 0; i < len; i++) {
+            lv_coord_t x = ver ? line : start + (int32_t)i;
+            lv_coord_t y = ver ? start + (int32_t)i : line;
+            uint32_t px = (uint32_t)dsc->header.w * y + x;
+
+            lv_color_t c;
+            lv_opa_t opa = LV_OPA_COVER;
+            if(true_color) {
+                c = ((lv_color_t *)dsc->data)[px];
+            }
+            else if(true_color_alpha) {
+                const uint8_t * px_p = &dsc->data[px * LV_IMG_PX_SIZE_ALPHA_BYTE];
+                c = lv_color_black();
+                lv_memcpy_small(&c, px_p, LV_IMG_PX_SIZE_ALPHA_BYTE - 1);
+                opa = px_p[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+            }
+            else {
+                c = lv_img_buf_get_px_color(dsc, x, y, color);
+                if(has_alpha) opa = lv_img_buf_get_px_alpha(dsc, x, y);
+            }
 
-    if(opa <= LV_OPA_MIN) return;
-    lv_img_dsc_t d;
-    d.data = buf;
-    d.header.always_zero = 0;
-    d.header.h = 1;    /*Doesn't matter*/;
-    d.header.w = buf_w;
-    d.header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+            rbuf[i] = c.ch.red;
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
+            gbuf[i] = (c.ch.green_h << 3) + c.ch.green_l;
+#else
+            gbuf[i] = c.ch.green;
+#endif
+            bbuf[i] = c.ch.blue;
+            abuf[i] = opa;
+        }
+
+        lv_draw_blur_box(rbuf, len, 1, r_back, r_front, r, tmp);
+        lv_draw_blur_box(gbuf, len, 1, r_back, r_front, r, tmp);
+        lv_draw_blur_box(bbuf, len, 1, r_back, r_front, r, tmp);
+        if(has_alpha) lv_draw_blur_box(abuf, len, 1, r_back, r_front, r, tmp);
 
-    lv_color_t bg_color = lv_img_buf_get_px_color(&d, x, y, lv_color_black());
-    lv_opa_t bg_opa = lv_img_buf_get_px_alpha(&d, x, y);
+        for(i = ofs; i < ofs + area_len; i++) {
+            lv_coord_t x = ver ? line : start + (int32_t)i;
+            lv_coord_t y = ver ? start + (int32_t)i : line;
+            uint32_t px = (uint32_t)dsc->header.w * y + x;
+
+            lv_color_t c = lv_color_black();
+            c.ch.red = rbuf[i];
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
+            c.ch.green_h = gbuf[i] >> 3;
+            c.ch.green_l = gbuf[i] & 0x7;
+#else
+            c.ch.green = gbuf[i];
+#endif
+            c.ch.blue = bbuf[i];
 
-    lv_opa_t res_opa;
-    lv_color_t res_color;
+            if(true_color) {
+                ((lv_color_t *)dsc->data)[px] = c;
+            }
+            else if(true_color_alpha) {
+                uint8_t * px_p = (uint8_t *)&dsc->data[px * LV_IMG_PX_SIZE_ALPHA_BYTE];
+                if(abuf[i]) lv_memcpy_small(px_p, &c, LV_IMG_PX_SIZE_ALPHA_BYTE - 1);
+                px_p[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = abuf[i];
+            }
+            else {
+                if(abuf[i]) lv_img_buf_set_px_color(dsc, x, y, c);
+                if(has_alpha) lv_img_buf_set_px_alpha(dsc, x, y, abuf[i]);
+            }
+        }
+    }
 
-    lv_color_mix_with_alpha(bg_color, bg_opa, color, opa, &res_color, &res_opa);
+    lv_mem_buf_release(rbuf);
 
-    lv_img_buf_set_px_alpha(&d, x, y, res_opa);
-    lv_img_buf_set_px_color(&d, x, y, res_color);
+    lv_obj_invalidate(obj);
 }
 
 #endif
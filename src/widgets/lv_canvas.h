@@ -30,10 +30,13 @@ extern "C" {
  **********************/
 extern const lv_obj_class_t lv_canvas_class;
 
+struct _lv_canvas_target_t;
+
 /*Data of canvas*/
 typedef struct {
     lv_img_t img;
     lv_img_dsc_t dsc;
+    struct _lv_canvas_target_t * target;    /*Set between `lv_canvas_draw_begin/end()`*/
 } lv_canvas_t;
 
 /**********************
@@ -166,6 +169,19 @@ void lv_canvas_blur_ver(lv_obj_t * canvas, const lv_area_t * area, uint16_t r);
  */
 void lv_canvas_fill_bg(lv_obj_t * canvas, lv_color_t color, lv_opa_t opa);
 
+/**
+ * Start drawing to the canvas with several `lv_canvas_draw_...()` and `lv_canvas_set_px()` calls.
+ * The canvas will be prepared for rendering only once and invalidated only in `lv_canvas_draw_end()`.
+ * @param canvas pointer to a canvas object
+ */
+void lv_canvas_draw_begin(lv_obj_t * canvas);
+
+/**
+ * Finish drawing started with `lv_canvas_draw_begin()` and invalidate the canvas
+ * @param canvas pointer to a canvas object
+ */
+void lv_canvas_draw_end(lv_obj_t * canvas);
+
 /**
  * Draw a rectangle on the canvas
  * @param canvas   pointer to a canvas object
@@ -35,6 +35,7 @@ static void lv_checkbox_draw(lv_event_t * e);
  *  STATIC VARIABLES
  **********************/
 const lv_obj_class_t lv_checkbox_class = {
+    .name = "checkbox",
     .constructor_cb = lv_checkbox_constructor,
     .destructor_cb = lv_checkbox_destructor,
     .event_cb = lv_checkbox_event,
@@ -37,6 +37,7 @@ static void draw_img(lv_event_t * e);
  *  STATIC VARIABLES
  **********************/
 const lv_obj_class_t lv_img_class = {
+    .name = "img",
          .constructor_cb = lv_img_constructor,
          .destructor_cb = lv_img_destructor,
          .event_cb = lv_img_event,
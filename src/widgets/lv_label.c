@@ -21,6 +21,8 @@
 /*********************
  *      DEFINES
  *********************/
+#undef LV_MEM_FILE_TAG
+#define LV_MEM_FILE_TAG LV_MEM_TAG_TEXT
 #define MY_CLASS &lv_label_class
 
 #define LV_LABEL_DEF_SCROLL_SPEED   (lv_disp_get_dpi(lv_obj_get_disp(obj)) / 3)
@@ -53,6 +55,7 @@ static void set_ofs_y_anim(void * obj, int32_t v);
  *  STATIC VARIABLES
  **********************/
 const lv_obj_class_t lv_label_class = {
+    .name = "label",
     .constructor_cb = lv_label_constructor,
     .destructor_cb = lv_label_destructor,
     .event_cb = lv_label_event,
@@ -904,6 +907,9 @@ static void lv_label_refr_text(lv_obj_t * obj)
     label->hint.line_start = -1; /*The hint is invalid if the text changes*/
 #endif
 
+    /*The labels created in a batch are refreshed with their final style at the end of the batch*/
+    if(obj->batch_pending && lv_obj_is_batch_active()) return;
+
     lv_area_t txt_coords;
     lv_obj_get_content_coords(obj, &txt_coords);
     lv_coord_t max_w         = lv_area_get_width(&txt_coords);
@@ -40,6 +40,7 @@ static void draw_knob(lv_event_t * e);
  *  STATIC VARIABLES
  **********************/
 const lv_obj_class_t lv_slider_class = {
+    .name = "slider",
     .constructor_cb = lv_slider_constructor,
     .event_cb = lv_slider_event,
     .editable = LV_OBJ_CLASS_EDITABLE_TRUE,
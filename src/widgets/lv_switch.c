@@ -41,6 +41,7 @@ static void draw_main(lv_event_t * e);
  *  STATIC VARIABLES
  **********************/
 const lv_obj_class_t lv_switch_class = {
+    .name = "switch",
     .constructor_cb = lv_switch_constructor,
     .event_cb = lv_switch_event,
     .width_def =  (4 * LV_DPI_DEF) / 10,
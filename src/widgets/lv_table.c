@@ -36,13 +36,17 @@ static void draw_main(lv_event_t * e);
 static lv_coord_t get_row_height(lv_obj_t * obj, uint16_t row_id, const lv_font_t * font,
                                  lv_coord_t letter_space, lv_coord_t line_space,
                                  lv_coord_t cell_left, lv_coord_t cell_right, lv_coord_t cell_top, lv_coord_t cell_bottom);
-static void refr_size(lv_obj_t * obj, uint32_t strat_row);
+static void refr_size(lv_obj_t * obj, uint32_t start_row, uint32_t end_row);
+static void update_row_y(lv_obj_t * obj);
+static uint16_t get_row_at(lv_obj_t * obj, lv_coord_t y);
+static const char * get_cell_txt(lv_obj_t * obj, uint32_t cell);
 static lv_res_t get_pressed_cell(lv_obj_t * obj, uint16_t * row, uint16_t * col);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 const lv_obj_class_t lv_table_class  = {
+    .name = "table",
     .constructor_cb = lv_table_constructor,
     .destructor_cb = lv_table_destructor,
     .event_cb = lv_table_event,
@@ -106,7 +110,7 @@ void lv_table_set_cell_value(lv_obj_t * obj, uint16_t row, uint16_t col, const c
 #endif
 
     table->cell_data[cell][0] = ctrl;
-    refr_size(obj, row);
+    refr_size(obj, row, row + 1);
 
     lv_obj_invalidate(obj);
 }
@@ -180,24 +184,8 @@ void lv_table_set_cell_value_fmt(lv_obj_t * obj, uint16_t row, uint16_t col, con
 
     table->cell_data[cell][0] = ctrl;
 
-    /*Refresh the row height*/
-    lv_coord_t cell_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
-    lv_coord_t cell_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
-    lv_coord_t cell_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
-    lv_coord_t cell_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_ITEMS);
-
-    lv_coord_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_ITEMS);
-    lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_ITEMS);
-    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_ITEMS);
-
-    lv_coord_t h = get_row_height(obj, row, font, letter_space, line_space,
-                                       cell_left, cell_right, cell_top, cell_bottom);
-
-
-    lv_coord_t minh = lv_obj_get_style_min_height(obj, LV_PART_ITEMS);
-    lv_coord_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
-
-    table->row_h[row] = LV_CLAMP(minh, h, maxh);
+    /*Refresh only the height of the changed row*/
+    refr_size(obj, row, row + 1);
 
     lv_obj_invalidate(obj);
 }
@@ -214,9 +202,16 @@ void lv_table_set_row_cnt(lv_obj_t * obj, uint16_t row_cnt)
     LV_ASSERT_MALLOC(table->row_h);
     if(table->row_h == NULL) return;
 
+    table->row_y = lv_mem_realloc(table->row_y, (table->row_cnt + 1) * sizeof(table->row_y[0]));
+    LV_ASSERT_MALLOC(table->row_y);
+    if(table->row_y == NULL) return;
+
+    /*The offsets of the remaining rows are still valid*/
+    table->row_y_valid = LV_MIN(table->row_y_valid, (uint32_t)table->row_cnt + 1);
+
     /*Free the unused cells*/
     if(old_row_cnt > row_cnt) {
-        uint16_t old_cell_cnt = old_row_cnt * table->col_cnt;
+        uint32_t old_cell_cnt = old_row_cnt * table->col_cnt;
         uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
         uint32_t i;
         for(i = new_cell_cnt; i < old_cell_cnt; i++) {
@@ -233,9 +228,12 @@ void lv_table_set_row_cnt(lv_obj_t * obj, uint16_t row_cnt)
         uint32_t old_cell_cnt = old_row_cnt * table->col_cnt;
         uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
         lv_memset_00(&table->cell_data[old_cell_cnt], (new_cell_cnt - old_cell_cnt) * sizeof(table->cell_data[0]));
+        lv_memset_00(&table->row_h[old_row_cnt], (row_cnt - old_row_cnt) * sizeof(table->row_h[0]));
     }
 
-    refr_size(obj, 0) ;
+    /*Only the new rows need to be measured*/
+    if(old_row_cnt < row_cnt) refr_size(obj, old_row_cnt, row_cnt);
+    else refr_size(obj, row_cnt, row_cnt);
 }
 
 void lv_table_set_col_cnt(lv_obj_t * obj, uint16_t col_cnt)
@@ -251,7 +249,7 @@ void lv_table_set_col_cnt(lv_obj_t * obj, uint16_t col_cnt)
 
     /*Free the unused cells*/
     if(old_col_cnt > col_cnt) {
-       uint16_t old_cell_cnt = old_col_cnt * table->row_cnt;
+       uint32_t old_cell_cnt = old_col_cnt * table->row_cnt;
        uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
        uint32_t i;
        for(i = new_cell_cnt; i < old_cell_cnt; i++) {
@@ -289,7 +287,7 @@ void lv_table_set_col_cnt(lv_obj_t * obj, uint16_t col_cnt)
     table->cell_data = new_cell_data;
 
 
-    refr_size(obj, 0) ;
+    refr_size(obj, 0, table->row_cnt);
 }
 
 void lv_table_set_col_width(lv_obj_t * obj, uint16_t col_id, lv_coord_t w)
@@ -302,7 +300,7 @@ void lv_table_set_col_width(lv_obj_t * obj, uint16_t col_id, lv_coord_t w)
     if(col_id >= table->col_cnt) lv_table_set_col_cnt(obj, col_id + 1);
 
     table->col_w[col_id] = w;
-    refr_size(obj, 0) ;
+    refr_size(obj, 0, table->row_cnt);
 }
 
 void lv_table_add_cell_ctrl(lv_obj_t * obj, uint16_t row, uint16_t col, lv_table_cell_ctrl_t ctrl)
@@ -353,6 +351,34 @@ void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint16_t row, uint16_t col, lv_tab
     table->cell_data[cell][0] &= (~ctrl);
 }
 
+void lv_table_set_cell_value_cb(lv_obj_t * obj, lv_table_cell_value_cb_t cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_value_cb == cb) return;
+
+    table->cell_value_cb = cb;
+    refr_size(obj, 0, table->row_cnt);
+
+    lv_obj_invalidate(obj);
+}
+
+void lv_table_refresh_row(lv_obj_t * obj, uint16_t row)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    if(row >= table->row_cnt) {
+        LV_LOG_WARN("lv_table_refresh_row: invalid row");
+        return;
+    }
+
+    refr_size(obj, row, row + 1);
+
+    lv_obj_invalidate(obj);
+}
+
 /*=====================
  * Getter functions
  *====================*/
@@ -368,9 +394,18 @@ const char * lv_table_get_cell_value(lv_obj_t * obj, uint16_t row, uint16_t col)
     }
     uint32_t cell = row * table->col_cnt + col;
 
-    if(table->cell_data[cell] == NULL) return "";
+    const char * txt = get_cell_txt(obj, cell);
+    if(txt == NULL) return "";
+
+    return txt;
+}
+
+lv_table_cell_value_cb_t lv_table_get_cell_value_cb(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
 
-    return &table->cell_data[cell][1]; /*Skip the format byte*/
+    lv_table_t * table = (lv_table_t *)obj;
+    return table->cell_value_cb;
 }
 
 uint16_t lv_table_get_row_cnt(lv_obj_t * obj)
@@ -440,8 +475,10 @@ static void lv_table_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     table->row_cnt = 1;
     table->col_w = lv_mem_alloc(table->col_cnt * sizeof(table->col_w[0]));
     table->row_h = lv_mem_alloc(table->row_cnt * sizeof(table->row_h[0]));
+    table->row_y = lv_mem_alloc((table->row_cnt + 1) * sizeof(table->row_y[0]));
     table->col_w[0] = LV_DPI_DEF;
     table->row_h[0] = LV_DPI_DEF;
+    table->row_y_valid = 0;
     table->cell_data = lv_mem_realloc(table->cell_data, table->row_cnt * table->col_cnt * sizeof(char *));
     table->cell_data[0] = NULL;
 
@@ -453,7 +490,7 @@ static void lv_table_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     LV_UNUSED(class_p);
     lv_table_t * table = (lv_table_t *)obj;
     /*Free the cell texts*/
-    uint16_t i;
+    uint32_t i;
     for(i = 0; i < table->col_cnt * table->row_cnt; i++) {
         if(table->cell_data[i]) {
             lv_mem_free(table->cell_data[i]);
@@ -463,6 +500,8 @@ static void lv_table_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
     if(table->cell_data) lv_mem_free(table->cell_data);
     if(table->row_h) lv_mem_free(table->row_h);
+    if(table->row_y) lv_mem_free(table->row_y);
+    if(table->col_w) lv_mem_free(table->col_w);
 }
 
 static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -480,7 +519,7 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
     lv_table_t * table = (lv_table_t *)obj;
 
     if(code == LV_EVENT_STYLE_CHANGED) {
-        refr_size(obj, 0);
+        refr_size(obj, 0, table->row_cnt);
     }
     else if(code == LV_EVENT_GET_SELF_SIZE) {
         lv_point_t * p = lv_event_get_param(e);
@@ -488,11 +527,10 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
         lv_coord_t w = 0;
         for(i = 0; i < table->col_cnt; i++) w += table->col_w[i];
 
-        lv_coord_t h = 0;
-        for(i = 0; i < table->row_cnt; i++) h += table->row_h[i];
+        update_row_y(obj);
 
         p->x = w;
-        p->y = h;
+        p->y = table->row_y[table->row_cnt];
     }
     else if(code == LV_EVENT_PRESSED || code == LV_EVENT_PRESSING) {
         uint16_t col;
@@ -616,9 +654,15 @@ static void draw_main(lv_event_t * e)
 
     uint16_t col;
     uint16_t row;
-    uint16_t cell = 0;
+    uint32_t cell;
 
-    cell_area.y2 = obj->coords.y1 + bg_top - 1 - lv_obj_get_scroll_y(obj) ;
+    /*Skip the rows above the clip area without iterating through them*/
+    lv_coord_t row_y_ofs = obj->coords.y1 + bg_top - lv_obj_get_scroll_y(obj);
+    uint16_t row_start = get_row_at(obj, clip_area->y1 - row_y_ofs);
+    if(row_start >= table->row_cnt) return;
+
+    cell = row_start * table->col_cnt;
+    cell_area.y2 = row_y_ofs + table->row_y[row_start] - 1;
     lv_coord_t scroll_x = lv_obj_get_scroll_x(obj) ;
     bool rtl = lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL ? true : false;
 
@@ -631,7 +675,7 @@ static void draw_main(lv_event_t * e)
     part_draw_dsc.rect_dsc = &rect_dsc_act;
     part_draw_dsc.label_dsc = &label_dsc_act;
 
-    for(row = 0; row < table->row_cnt; row++) {
+    for(row = row_start; row < table->row_cnt; row++) {
         lv_coord_t h_row = table->row_h[row];
 
         cell_area.y1 = cell_area.y2 + 1;
@@ -726,7 +770,8 @@ static void draw_main(lv_event_t * e)
 
             lv_draw_rect(&cell_area_border, clip_area, &rect_dsc_act);
 
-            if(table->cell_data[cell]) {
+            const char * txt = get_cell_txt(obj, cell);
+            if(txt) {
                 txt_area.x1 = cell_area.x1 + cell_left;
                 txt_area.x2 = cell_area.x2 - cell_right;
                 txt_area.y1 = cell_area.y1 + cell_top;
@@ -737,7 +782,7 @@ static void draw_main(lv_event_t * e)
                 if(crop) txt_flags = LV_TEXT_FLAG_EXPAND;
                 else txt_flags = LV_TEXT_FLAG_NONE;
 
-                lv_txt_get_size(&txt_size, table->cell_data[cell] + 1, label_dsc_def.font,
+                lv_txt_get_size(&txt_size, txt, label_dsc_def.font,
                         label_dsc_act.letter_space, label_dsc_act.line_space,
                         lv_area_get_width(&txt_area), txt_flags);
 
@@ -751,7 +796,7 @@ static void draw_main(lv_event_t * e)
                 bool label_mask_ok;
                 label_mask_ok = _lv_area_intersect(&label_mask, clip_area, &cell_area);
                 if(label_mask_ok) {
-                    lv_draw_label(&txt_area, &label_mask, &label_dsc_act, table->cell_data[cell] + 1, NULL);
+                    lv_draw_label(&txt_area, &label_mask, &label_dsc_act, txt, NULL);
                 }
             }
 
@@ -763,7 +808,7 @@ static void draw_main(lv_event_t * e)
     }
 }
 
-static void refr_size(lv_obj_t * obj, uint32_t strat_row)
+static void refr_size(lv_obj_t * obj, uint32_t start_row, uint32_t end_row)
 {
     lv_table_t * table = (lv_table_t *)obj;
 
@@ -781,15 +826,87 @@ static void refr_size(lv_obj_t * obj, uint32_t strat_row)
     lv_coord_t minh = lv_obj_get_style_min_height(obj, LV_PART_ITEMS);
     lv_coord_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
 
-    for(i = strat_row; i < table->row_cnt; i++) {
-        table->row_h[i] = get_row_height(obj, i, font, letter_space, line_space,
-                                       cell_left, cell_right, cell_top, cell_bottom);
-        table->row_h[i] = LV_CLAMP(minh, table->row_h[i], maxh);
+    if(end_row > table->row_cnt) end_row = table->row_cnt;
+
+    for(i = start_row; i < end_row; i++) {
+        lv_coord_t h = get_row_height(obj, i, font, letter_space, line_space,
+                                      cell_left, cell_right, cell_top, cell_bottom);
+        h = LV_CLAMP(minh, h, maxh);
+
+        /*The offset of the rows below a changed row needs to be recalculated*/
+        if(table->row_h[i] != h) {
+            table->row_h[i] = h;
+            if(table->row_y_valid > i + 1) table->row_y_valid = i + 1;
+        }
     }
 
     lv_obj_refresh_self_size(obj) ;
 }
 
+/**
+ * Recalculate the outdated elements of the row offset index.
+ * @param obj       pointer to a Table object
+ */
+static void update_row_y(lv_obj_t * obj)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+
+    uint32_t i = table->row_y_valid;
+    if(i == 0) {
+        table->row_y[0] = 0;
+        i = 1;
+    }
+
+    for(; i <= table->row_cnt; i++) {
+        table->row_y[i] = table->row_y[i - 1] + table->row_h[i - 1];
+    }
+
+    table->row_y_valid = table->row_cnt + 1;
+}
+
+/**
+ * Find the row on a given y coordinate with binary search.
+ * @param obj       pointer to a Table object
+ * @param y         y coordinate relative to the top of the first row
+ * @return          id of the row, 0 if `y` is above the first row or `row_cnt` if it's below the last row
+ */
+static uint16_t get_row_at(lv_obj_t * obj, lv_coord_t y)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+
+    update_row_y(obj);
+
+    /*Find the first row whose bottom is below `y`*/
+    uint32_t lo = 0;
+    uint32_t hi = table->row_cnt;
+    while(lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        if(table->row_y[mid + 1] > y) hi = mid;
+        else lo = mid + 1;
+    }
+
+    return (uint16_t)lo;
+}
+
+/**
+ * Get the text of a cell either from the provider callback or from the stored texts
+ * @param obj       pointer to a Table object
+ * @param cell      index of the cell (`row * col_cnt + col`)
+ * @return          the text or `NULL` if the cell is empty
+ */
+static const char * get_cell_txt(lv_obj_t * obj, uint32_t cell)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+
+    if(table->cell_value_cb) {
+        return table->cell_value_cb(obj, cell / table->col_cnt, cell % table->col_cnt);
+    }
+
+    if(table->cell_data[cell] == NULL) return NULL;
+
+    return table->cell_data[cell] + 1;  /*Skip the format byte*/
+}
+
 static lv_coord_t get_row_height(lv_obj_t * obj, uint16_t row_id, const lv_font_t * font,
                                  lv_coord_t letter_space, lv_coord_t line_space,
                                  lv_coord_t cell_left, lv_coord_t cell_right, lv_coord_t cell_top, lv_coord_t cell_bottom)
@@ -798,13 +915,14 @@ static lv_coord_t get_row_height(lv_obj_t * obj, uint16_t row_id, const lv_font_
     lv_point_t txt_size;
     lv_coord_t txt_w;
 
-    uint16_t row_start = row_id * table->col_cnt;
-    uint16_t cell;
+    uint32_t row_start = row_id * table->col_cnt;
+    uint32_t cell;
     uint16_t col;
     lv_coord_t h_max = lv_font_get_line_height(font) + cell_top + cell_bottom;
 
     for(cell = row_start, col = 0; cell < row_start + table->col_cnt; cell++, col++) {
-        if(table->cell_data[cell] != NULL) {
+        const char * txt = get_cell_txt(obj, cell);
+        if(txt != NULL) {
             txt_w              = table->col_w[col];
             uint16_t col_merge = 0;
             for(col_merge = 0; col_merge + col < table->col_cnt - 1; col_merge++) {
@@ -835,7 +953,7 @@ static lv_coord_t get_row_height(lv_obj_t * obj, uint16_t row_id, const lv_font_
             else {
                 txt_w -= cell_left + cell_right;
 
-                lv_txt_get_size(&txt_size, table->cell_data[cell] + 1, font,
+                lv_txt_get_size(&txt_size, txt, font,
                                  letter_space, line_space, txt_w, LV_TEXT_FLAG_NONE);
 
                 h_max = LV_MAX(txt_size.y + cell_top + cell_bottom, h_max);
@@ -887,13 +1005,7 @@ static lv_res_t get_pressed_cell(lv_obj_t * obj, uint16_t * row, uint16_t * col)
         y -= obj->coords.y1;
         y -= lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
 
-        *row = 0;
-        tmp = 0;
-
-        for(*row = 0; *row < table->row_cnt; (*row)++) {
-            tmp += table->row_h[*row];
-            if(y < tmp) break;
-        }
+        *row = get_row_at(obj, y);
     }
 
     return LV_RES_OK;
@@ -46,6 +46,13 @@ enum {
 
 typedef uint8_t  lv_table_cell_ctrl_t;
 
+/**
+ * Provides the text of a cell on demand instead of storing it in the table.
+ * The returned string needs to remain valid until the next call of the callback.
+ * Return `NULL` for empty cells.
+ */
+typedef const char * (*lv_table_cell_value_cb_t)(lv_obj_t * obj, uint16_t row, uint16_t col);
+
 /*Data of table*/
 typedef struct {
     lv_obj_t obj;
@@ -53,7 +60,10 @@ typedef struct {
     uint16_t row_cnt;
     char ** cell_data;
     lv_coord_t * row_h;
+    lv_coord_t * row_y;         /*Prefix sum of `row_h`: `row_y[i]` is the top of the i-th row. Has `row_cnt + 1` elements*/
+    uint32_t row_y_valid;       /*Number of elements at the beginning of `row_y` which are up to date*/
     lv_coord_t * col_w;
+    lv_table_cell_value_cb_t cell_value_cb;
     uint16_t col_act;
     uint16_t row_act;
 } lv_table_t;
@@ -125,6 +135,24 @@ void lv_table_set_col_cnt(lv_obj_t * obj, uint16_t col_cnt);
  */
 void lv_table_set_col_width(lv_obj_t * obj, uint16_t col_id, lv_coord_t w);
 
+/**
+ * Set a callback to provide the cell texts on demand.
+ * With it the texts are not stored in the table which saves memory with large tables.
+ * @param obj       pointer to a Table object
+ * @param cb        the callback or `NULL` to use the texts stored by `lv_table_set_cell_value()`
+ * @note            the control bits of the cells are still stored by the table
+ * @note            call `lv_table_refresh_row()` if the text provided for a row has changed
+ */
+void lv_table_set_cell_value_cb(lv_obj_t * obj, lv_table_cell_value_cb_t cb);
+
+/**
+ * Recalculate the height of a row and redraw the table.
+ * Useful if the text of the cells is provided by a `lv_table_cell_value_cb_t` and it has changed.
+ * @param obj       pointer to a Table object
+ * @param row       id of the row [0 .. row_cnt -1]
+ */
+void lv_table_refresh_row(lv_obj_t * obj, uint16_t row);
+
 /**
  * Add control bits to the cell.
  * @param obj       pointer to a Table object
@@ -157,6 +185,13 @@ void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint16_t row, uint16_t col, lv_tab
  */
 const char * lv_table_get_cell_value(lv_obj_t * obj, uint16_t row, uint16_t col);
 
+/**
+ * Get the cell value callback.
+ * @param obj       pointer to a Table object
+ * @return          the callback set by `lv_table_set_cell_value_cb()` or `NULL`
+ */
+lv_table_cell_value_cb_t lv_table_get_cell_value_cb(lv_obj_t * obj);
+
 /**
  * Get the number of rows.
  * @param obj       table pointer to a Table object
@@ -22,6 +22,8 @@
 /*********************
  *      DEFINES
  *********************/
+#undef LV_MEM_FILE_TAG
+#define LV_MEM_FILE_TAG LV_MEM_TAG_TEXT
 #define MY_CLASS &lv_textarea_class
 
 /*Test configuration*/
@@ -61,6 +63,7 @@ static void draw_cursor(lv_event_t * e);
  *  STATIC VARIABLES
  **********************/
 const lv_obj_class_t lv_textarea_class = {
+    .name = "textarea",
     .constructor_cb = lv_textarea_constructor,
     .destructor_cb = lv_textarea_destructor,
     .event_cb = lv_textarea_event,
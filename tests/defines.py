@@ -66,6 +66,8 @@ normal_16bit_swap = {
   
   "LV_DPI_DEF":40,
   "LV_DRAW_COMPLEX":1,
+  "LV_GRAD_CACHE_DEF_SIZE":2 * 1024,
+  "LV_DITHER_GRADIENT":1,
   
   "LV_USE_LOG":1,
 
@@ -152,6 +154,13 @@ full_32bit = {
 
   "LV_LABEL_TEXT_SELECTION":1,
 
+  "LV_THEME_DEFAULT_CONST":1,
+  "LV_USE_OCCLUSION_CULLING":1,
+  "LV_USE_MEM_TAG":1,
+  "LV_USE_TRACE":1,
+  "LV_USE_REFR_PROFILER":1,
+  "LV_MEM_POOL_EXPAND_SIZE":256 * 1024,
+
   "LV_BUILD_EXAMPLES":1,
   
   "LV_FONT_DEFAULT":"\\\"&lv_font_montserrat_24\\\"",
@@ -163,6 +172,7 @@ test = {
   
   "LV_SHADOW_CACHE_SIZE":10*1024,
   "LV_IMG_CACHE_DEF_SIZE":32,
+  "LV_GRAD_CACHE_DEF_SIZE":8*1024,
   
   "LV_USE_LOG":1,
   "LV_LOG_PRINTF":1,
@@ -197,6 +207,15 @@ test = {
 
   "LV_LABEL_TEXT_SELECTION":1,
 
+  "LV_THEME_DEFAULT_CONST":1,
+  "LV_USE_OCCLUSION_CULLING":1,
+  "LV_USE_MEM_TAG":1,
+  "LV_USE_TRACE":1,
+  "LV_USE_REFR_PROFILER":1,
+  "LV_USE_PERF_MONITOR":1,
+  "LV_PERF_MONITOR_SHOW_LABEL":0,
+  "LV_MEM_POOL_EXPAND_SIZE":256 * 1024,
+
   "LV_BUILD_EXAMPLES":1,
   
   "LV_FONT_DEFAULT":"\\\"&lv_font_montserrat_14\\\"",
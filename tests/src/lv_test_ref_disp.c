@@ -0,0 +1,81 @@
+
+#if LV_BUILD_TEST
+#include "lv_test_ref_disp.h"
+#include <string.h>
+
+lv_color_t lv_test_ref_fb[LV_TEST_REF_DISP_HOR_RES * LV_TEST_REF_DISP_VER_RES];
+
+static lv_disp_drv_t ref_drv;
+static lv_color_t ref_draw_buf1[LV_TEST_REF_DISP_HOR_RES * 10];
+
+static void ref_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    lv_test_fb_copy_area(lv_test_ref_fb, drv->hor_res, area, color_p);
+    lv_disp_flush_ready(drv);
+}
+
+/**
+ * Create a display with a simple single buffer which flushes to `lv_test_ref_fb`.
+ * Render the same content on it as on the tested display and compare the results.
+ * Only one reference display can exist at a time.
+ */
+lv_disp_t * lv_test_ref_disp_create(lv_coord_t hor_res, lv_coord_t ver_res)
+{
+    LV_ASSERT(hor_res * ver_res <= LV_TEST_REF_DISP_HOR_RES * LV_TEST_REF_DISP_VER_RES);
+
+    static lv_disp_draw_buf_t ref_draw_buf;
+    lv_disp_draw_buf_init(&ref_draw_buf, ref_draw_buf1, NULL, LV_TEST_REF_DISP_HOR_RES * 10);
+    lv_disp_drv_init(&ref_drv);
+    ref_drv.draw_buf = &ref_draw_buf;
+    ref_drv.flush_cb = ref_flush_cb;
+    ref_drv.hor_res = hor_res;
+    ref_drv.ver_res = ver_res;
+    lv_memset_00(lv_test_ref_fb, sizeof(lv_test_ref_fb));
+    return lv_disp_drv_register(&ref_drv);
+}
+
+/**
+ * Create the common content of the display tests on the active screen of a display:
+ * a gradient background and a panel with a label.
+ * @return the panel
+ */
+lv_obj_t * lv_test_ref_content_create(lv_disp_t * disp, const char * txt)
+{
+    lv_obj_t * scr = lv_disp_get_scr_act(disp);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x204060), 0);
+    lv_obj_set_style_bg_grad_color(scr, lv_color_hex(0xa0c0e0), 0);
+    lv_obj_set_style_bg_grad_dir(scr, LV_GRAD_DIR_HOR, 0);
+
+    lv_obj_t * obj = lv_obj_create(scr);
+    lv_obj_set_size(obj, 120, 70);
+    lv_obj_set_pos(obj, 15, 25);
+
+    lv_obj_t * label = lv_label_create(obj);
+    lv_label_set_text(label, txt);
+
+    return obj;
+}
+
+/**
+ * Copy the flushed pixels of an area to a frame buffer
+ */
+void lv_test_fb_copy_area(lv_color_t * fb, lv_coord_t stride, const lv_area_t * area, const lv_color_t * color_p)
+{
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&fb[y * stride + area->x1], color_p, w * sizeof(lv_color_t));
+        color_p += w;
+    }
+}
+
+/**
+ * Compare a frame buffer with the resolution of the reference display to `lv_test_ref_fb`
+ */
+bool lv_test_ref_fb_equal(const lv_color_t * fb)
+{
+    uint32_t px_cnt = ref_drv.hor_res * ref_drv.ver_res;
+    return memcmp(fb, lv_test_ref_fb, px_cnt * sizeof(lv_color_t)) == 0;
+}
+
+#endif
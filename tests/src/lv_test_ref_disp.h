@@ -0,0 +1,28 @@
+
+#ifndef LV_TEST_REF_DISP_H
+#define LV_TEST_REF_DISP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "../lvgl.h"
+
+/*The largest resolution of the reference display. The width and height can be swapped.*/
+#define LV_TEST_REF_DISP_HOR_RES    200
+#define LV_TEST_REF_DISP_VER_RES    120
+
+/*The image flushed by the reference display. The stride is the horizontal resolution of the display.*/
+extern lv_color_t lv_test_ref_fb[LV_TEST_REF_DISP_HOR_RES * LV_TEST_REF_DISP_VER_RES];
+
+lv_disp_t * lv_test_ref_disp_create(lv_coord_t hor_res, lv_coord_t ver_res);
+lv_obj_t * lv_test_ref_content_create(lv_disp_t * disp, const char * txt);
+
+void lv_test_fb_copy_area(lv_color_t * fb, lv_coord_t stride, const lv_area_t * area, const lv_color_t * color_p);
+bool lv_test_ref_fb_equal(const lv_color_t * fb);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_TEST_REF_DISP_H*/
@@ -0,0 +1,103 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <time.h>
+
+void test_blur_box_average(void);
+void test_blur_box_stride(void);
+void test_blur_canvas_benchmark(void);
+
+#define BENCH_W 320
+#define BENCH_H 240
+
+static uint16_t values[64];
+static uint16_t ref[64];
+static uint16_t tmp[64];
+static lv_color_t canvas_buf[BENCH_W * BENCH_H];
+
+/*Straightforward implementation to compare with*/
+static void blur_ref(const uint16_t * in, uint16_t * out, int32_t len, int32_t r_back, int32_t r_front, uint32_t div)
+{
+  int32_t i;
+  for(i = 0; i < len; i++) {
+    uint32_t sum = 0;
+    int32_t k;
+    for(k = i - r_back; k <= i + r_front; k++) {
+      sum += in[LV_CLAMP(0, k, len - 1)];
+    }
+    out[i] = sum / div;
+  }
+}
+
+void test_blur_box_average(void)
+{
+  uint32_t len;
+  uint32_t r;
+  for(len = 1; len < 64; len += 7) {
+    for(r = 1; r < 80; r += 3) {
+      uint32_t i;
+      for(i = 0; i < len; i++) values[i] = (i * 37 + r * 11) % 256;
+
+      uint32_t r_back = r / 2;
+      uint32_t r_front = r / 2;
+      if((r & 0x1) == 0) r_back--;
+
+      blur_ref(values, ref, len, r_back, r_front, r);
+      lv_draw_blur_box(values, len, 1, r_back, r_front, r, tmp);
+      TEST_ASSERT_EQUAL_UINT16_ARRAY(ref, values, len);
+    }
+  }
+}
+
+void test_blur_box_stride(void)
+{
+  /*Blur the second column of an 4x16 array, the others shouldn't change*/
+  uint32_t i;
+  uint16_t col[16];
+  for(i = 0; i < 64; i++) values[i] = i % 4 == 1 ? (i & 0x8 ? 256 : 0) : 1000;
+  for(i = 0; i < 16; i++) col[i] = values[i * 4 + 1];
+
+  blur_ref(col, ref, 16, 2, 2, 4);
+  lv_draw_blur_box(&values[1], 16, 4, 2, 2, 4, tmp);
+
+  for(i = 0; i < 64; i++) {
+    if(i % 4 == 1) TEST_ASSERT_EQUAL_UINT16(ref[i / 4], values[i]);
+    else TEST_ASSERT_EQUAL_UINT16(1000, values[i]);
+  }
+}
+
+void test_blur_canvas_benchmark(void)
+{
+  lv_obj_t * canvas = lv_canvas_create(lv_scr_act());
+  lv_canvas_set_buffer(canvas, canvas_buf, BENCH_W, BENCH_H, LV_IMG_CF_TRUE_COLOR);
+
+  uint32_t r;
+  for(r = 4; r <= 64; r *= 2) {
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    rect_dsc.bg_color = lv_color_black();
+    lv_canvas_draw_rect(canvas, BENCH_W / 4, BENCH_H / 4, BENCH_W / 2, BENCH_H / 2, &rect_dsc);
+
+    clock_t t = clock();
+    lv_canvas_blur_hor(canvas, NULL, r);
+    lv_canvas_blur_ver(canvas, NULL, r);
+    t = clock() - t;
+
+    char buf[64];
+    lv_snprintf(buf, sizeof(buf), "canvas blur %dx%d, r=%d: %d us", BENCH_W, BENCH_H, r,
+                (int)((uint64_t)t * 1000000 / CLOCKS_PER_SEC));
+    TEST_MESSAGE(buf);
+
+    /*The center of the rectangle is still black and the corners of the canvas are still white*/
+    lv_color_t c = lv_canvas_get_px(canvas, BENCH_W / 2, BENCH_H / 2);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_to32(lv_color_black()), lv_color_to32(c));
+    c = lv_canvas_get_px(canvas, 0, 0);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_to32(lv_color_white()), lv_color_to32(c));
+  }
+
+  lv_obj_del(canvas);
+}
+
+#endif
@@ -0,0 +1,99 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_ref_disp.h"
+
+void test_buf_age_double(void);
+void test_buf_age_chain(void);
+
+#define DISP_W      LV_TEST_REF_DISP_HOR_RES
+#define DISP_H      LV_TEST_REF_DISP_VER_RES
+#define BUF_CNT     3
+
+static lv_color_t scanout_fb[DISP_W * DISP_H];
+static lv_color_t draw_bufs[BUF_CNT][DISP_W * DISP_H];
+static void * draw_buf_chain[BUF_CNT] = {draw_bufs[0], draw_bufs[1], draw_bufs[2]};
+
+/*Emulate a page flip: the whole buffer is shown*/
+static void flip_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    TEST_ASSERT_EQUAL(0, area->x1);
+    TEST_ASSERT_EQUAL(0, area->y1);
+    TEST_ASSERT_EQUAL(DISP_W - 1, area->x2);
+    TEST_ASSERT_EQUAL(DISP_H - 1, area->y2);
+    lv_memcpy(scanout_fb, color_p, sizeof(scanout_fb));
+    lv_disp_flush_ready(drv);
+}
+
+static lv_obj_t * create_content(lv_disp_t * disp)
+{
+    lv_test_ref_content_create(disp, "");
+
+    lv_obj_t * obj = lv_obj_create(lv_disp_get_scr_act(disp));
+    lv_obj_set_size(obj, 40, 30);
+    return obj;
+}
+
+/*Move the small object and change the text of the panel's label from time to time*/
+static void update_content(lv_obj_t * obj, uint32_t frame)
+{
+    lv_obj_set_pos(obj, 5 + frame * 13, 5 + frame * 7);
+    if(frame % 3 == 0) {
+        lv_obj_t * panel = lv_obj_get_child(lv_obj_get_parent(obj), 0);
+        lv_label_set_text_fmt(lv_obj_get_child(panel, 0), "Frame %d", frame);
+    }
+}
+
+static void test_buf_age(uint32_t buf_cnt)
+{
+    lv_disp_t * def_disp = lv_disp_get_default();
+
+    lv_disp_t * ref_disp = lv_test_ref_disp_create(DISP_W, DISP_H);
+    lv_obj_t * ref_obj = create_content(ref_disp);
+
+    static lv_disp_draw_buf_t draw_buf;
+    if(buf_cnt == 2) lv_disp_draw_buf_init(&draw_buf, draw_bufs[0], draw_bufs[1], DISP_W * DISP_H);
+    else lv_disp_draw_buf_init_chain(&draw_buf, draw_buf_chain, buf_cnt, DISP_W * DISP_H);
+    static lv_disp_drv_t drv;
+    lv_disp_drv_init(&drv);
+    drv.draw_buf = &draw_buf;
+    drv.flush_cb = flip_flush_cb;
+    drv.hor_res = DISP_W;
+    drv.ver_res = DISP_H;
+    drv.full_refresh = 1;
+    drv.buffer_age = 1;
+    lv_disp_t * disp = lv_disp_drv_register(&drv);
+    lv_obj_t * obj = create_content(disp);
+
+    uint32_t frame;
+    for(frame = 0; frame < 10; frame++) {
+        update_content(ref_obj, frame);
+        update_content(obj, frame);
+        lv_refr_now(ref_disp);
+        lv_refr_now(disp);
+
+        /*Only the changed areas are redrawn when all buffers have a frame*/
+        lv_refr_overdraw_t od;
+        lv_refr_get_overdraw(&od);
+        if(frame >= buf_cnt) TEST_ASSERT_LESS_THAN(DISP_W * DISP_H / 2, od.px_refr);
+
+        TEST_ASSERT_TRUE(lv_test_ref_fb_equal(scanout_fb));
+    }
+
+    lv_disp_remove(ref_disp);
+    lv_disp_remove(disp);
+    lv_disp_set_default(def_disp);
+}
+
+void test_buf_age_double(void)
+{
+    test_buf_age(2);
+}
+
+void test_buf_age_chain(void)
+{
+    test_buf_age(BUF_CNT);
+}
+
+#endif
@@ -0,0 +1,281 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_canvas_alpha_formats(void);
+void test_canvas_true_color_alpha(void);
+void test_canvas_draw_img(void);
+void test_canvas_batch(void);
+void test_canvas_draw_while_refreshing(void);
+
+#define CANVAS_W    160
+#define CANVAS_H    40
+
+extern lv_color_t test_fb[];
+
+static uint8_t buf_ref[LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(CANVAS_W, CANVAS_H)];
+static uint8_t buf_test[LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(CANVAS_W, CANVAS_H)];
+
+static lv_obj_t * canvas_create(void * buf, lv_img_cf_t cf)
+{
+    lv_memset_00(buf, LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(CANVAS_W, CANVAS_H));
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(canvas, buf, CANVAS_W, CANVAS_H, cf);
+    if(cf == LV_IMG_CF_TRUE_COLOR) lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_COVER);
+    return canvas;
+}
+
+/*Draw a rounded rectangle, a sloped line and text without overlapping to blend every pixel once*/
+static void draw_scene(lv_obj_t * canvas, lv_color_t color)
+{
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    rect_dsc.bg_color = color;
+    rect_dsc.radius = 8;
+    lv_canvas_draw_rect(canvas, 4, 4, 40, 30, &rect_dsc);
+
+    lv_draw_line_dsc_t line_dsc;
+    lv_draw_line_dsc_init(&line_dsc);
+    line_dsc.color = color;
+    line_dsc.width = 3;
+    lv_point_t points[] = {{54, 4}, {70, 34}};
+    lv_canvas_draw_line(canvas, points, 2, &line_dsc);
+
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    label_dsc.color = color;
+    label_dsc.letter_space = 4;
+    lv_canvas_draw_text(canvas, 90, 10, 60, &label_dsc, "AB");
+}
+
+static uint8_t get_alpha(lv_img_cf_t cf, const uint8_t * buf, uint32_t x, uint32_t y)
+{
+    uint32_t bpp = lv_img_cf_get_px_size(cf);
+    uint32_t row_size = (CANVAS_W * bpp + 7) >> 3;
+    uint32_t bit = x * bpp;
+    return (buf[row_size * y + (bit >> 3)] >> (8 - bpp - (bit & 0x7))) & ((1 << bpp) - 1);
+}
+
+static lv_color32_t get_px32(const uint8_t * buf, uint32_t px_size, uint32_t x, uint32_t y)
+{
+    lv_color_t c = lv_color_black();
+    lv_memcpy_small(&c, &buf[(y * CANVAS_W + x) * px_size], sizeof(lv_color_t));
+    lv_color32_t c32;
+    c32.full = lv_color_to32(c);
+    return c32;
+}
+
+void test_canvas_alpha_formats(void)
+{
+    /*Draw white to a black true color canvas as a reference for the brightness*/
+    lv_obj_t * canvas_ref = canvas_create(buf_ref, LV_IMG_CF_TRUE_COLOR);
+    draw_scene(canvas_ref, lv_color_white());
+
+    static uint8_t buf_a8[LV_CANVAS_BUF_SIZE_ALPHA_8BIT(CANVAS_W, CANVAS_H)];
+    lv_obj_t * canvas_a8 = lv_canvas_create(lv_scr_act());
+    lv_memset_00(buf_a8, sizeof(buf_a8));
+    lv_canvas_set_buffer(canvas_a8, buf_a8, CANVAS_W, CANVAS_H, LV_IMG_CF_ALPHA_8BIT);
+    draw_scene(canvas_a8, lv_color_white());
+
+    uint32_t cover_cnt = 0;
+    uint32_t aa_cnt = 0;
+    uint32_t x;
+    uint32_t y;
+    for(y = 0; y < CANVAS_H; y++) {
+        for(x = 0; x < CANVAS_W; x++) {
+            uint8_t a8 = buf_a8[y * CANVAS_W + x];
+            lv_color32_t ref = get_px32(buf_ref, sizeof(lv_color_t), x, y);
+            TEST_ASSERT_INT_WITHIN(3, ref.ch.green, a8);
+            if(a8 == LV_OPA_COVER) cover_cnt++;
+            else if(a8 > 3) aa_cnt++;
+        }
+    }
+    /*Every shape is drawn with anti-aliased edges*/
+    TEST_ASSERT_GREATER_THAN(1000, cover_cnt);
+    TEST_ASSERT_GREATER_THAN(100, aa_cnt);
+
+    /*The fewer bits store the same values with less precision*/
+    static const lv_img_cf_t cfs[] = {LV_IMG_CF_ALPHA_1BIT, LV_IMG_CF_ALPHA_2BIT, LV_IMG_CF_ALPHA_4BIT};
+    uint32_t i;
+    for(i = 0; i < sizeof(cfs) / sizeof(cfs[0]); i++) {
+        lv_obj_t * canvas = canvas_create(buf_test, cfs[i]);
+        draw_scene(canvas, lv_color_white());
+
+        uint32_t bpp = lv_img_cf_get_px_size(cfs[i]);
+        for(y = 0; y < CANVAS_H; y++) {
+            for(x = 0; x < CANVAS_W; x++) {
+                TEST_ASSERT_EQUAL_UINT8(buf_a8[y * CANVAS_W + x] >> (8 - bpp), get_alpha(cfs[i], buf_test, x, y));
+            }
+        }
+    }
+
+    /*The brightness of the color is stored*/
+    lv_memset_00(buf_a8, sizeof(buf_a8));
+    draw_scene(canvas_a8, lv_color_hex(0x808080));
+    TEST_ASSERT_INT_WITHIN(1, lv_color_brightness(lv_color_hex(0x808080)), buf_a8[20 * CANVAS_W + 20]);
+
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_canvas_true_color_alpha(void)
+{
+    lv_color_t color = lv_color_hex(0x20c040);
+    lv_obj_t * canvas_ref = canvas_create(buf_ref, LV_IMG_CF_TRUE_COLOR);
+    draw_scene(canvas_ref, color);
+
+    lv_obj_t * canvas = canvas_create(buf_test, LV_IMG_CF_TRUE_COLOR_ALPHA);
+    draw_scene(canvas, color);
+
+    /*The transparent canvas on black looks like the canvas drawn on black*/
+    uint32_t x;
+    uint32_t y;
+    for(y = 0; y < CANVAS_H; y++) {
+        for(x = 0; x < CANVAS_W; x++) {
+            const uint8_t * px = &buf_test[(y * CANVAS_W + x) * LV_IMG_PX_SIZE_ALPHA_BYTE];
+            lv_opa_t a = px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+            lv_color32_t ref = get_px32(buf_ref, sizeof(lv_color_t), x, y);
+            if(a == LV_OPA_TRANSP) {
+                TEST_ASSERT_INT_WITHIN(2, 0, ref.ch.green);
+                continue;
+            }
+
+            lv_color32_t c = get_px32(buf_test, LV_IMG_PX_SIZE_ALPHA_BYTE, x, y);
+            TEST_ASSERT_EQUAL_UINT8(0x20, c.ch.red);
+            TEST_ASSERT_EQUAL_UINT8(0xc0, c.ch.green);
+            TEST_ASSERT_EQUAL_UINT8(0x40, c.ch.blue);
+            TEST_ASSERT_INT_WITHIN(3, ref.ch.green, (0xc0 * a) / 255);
+        }
+    }
+
+    /*Semi-transparent drawing on a semi-transparent pixel makes it more opaque*/
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    rect_dsc.bg_color = lv_color_hex(0xff0000);
+    rect_dsc.bg_opa = LV_OPA_50;
+    lv_memset_00(buf_test, sizeof(buf_test));
+    lv_canvas_draw_rect(canvas, 0, 0, 10, 10, &rect_dsc);
+    lv_canvas_draw_rect(canvas, 0, 0, 10, 10, &rect_dsc);
+    lv_opa_t a = buf_test[(5 * CANVAS_W + 5) * LV_IMG_PX_SIZE_ALPHA_BYTE + LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+    TEST_ASSERT_INT_WITHIN(3, 255 - (255 - LV_OPA_50) * (255 - LV_OPA_50) / 255, a);
+    TEST_ASSERT_EQUAL_UINT8(0xff, get_px32(buf_test, LV_IMG_PX_SIZE_ALPHA_BYTE, 5, 5).ch.red);
+
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_canvas_draw_img(void)
+{
+    /*Use a gradient as the image*/
+    static lv_color_t img_buf[LV_CANVAS_BUF_SIZE_TRUE_COLOR(32, 32) / sizeof(lv_color_t)];
+    lv_obj_t * img_canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(img_canvas, img_buf, 32, 32, LV_IMG_CF_TRUE_COLOR);
+    uint32_t x;
+    uint32_t y;
+    for(y = 0; y < 32; y++) {
+        for(x = 0; x < 32; x++) {
+            img_buf[y * 32 + x] = lv_color_make(x * 8, y * 8, 128);
+        }
+    }
+
+    lv_draw_img_dsc_t img_dsc;
+    lv_draw_img_dsc_init(&img_dsc);
+
+    static const lv_img_cf_t cfs[] = {LV_IMG_CF_ALPHA_8BIT, LV_IMG_CF_ALPHA_4BIT, LV_IMG_CF_TRUE_COLOR_ALPHA};
+    uint32_t i;
+    for(i = 0; i < sizeof(cfs) / sizeof(cfs[0]); i++) {
+        lv_obj_t * canvas = canvas_create(buf_test, cfs[i]);
+        lv_canvas_draw_img(canvas, 10, 5, lv_canvas_get_img(img_canvas), &img_dsc);
+
+        for(y = 0; y < 32; y++) {
+            for(x = 0; x < 32; x++) {
+                lv_color_t c = img_buf[y * 32 + x];
+                if(cfs[i] == LV_IMG_CF_TRUE_COLOR_ALPHA) {
+                    const uint8_t * px = &buf_test[((y + 5) * CANVAS_W + x + 10) * LV_IMG_PX_SIZE_ALPHA_BYTE];
+                    TEST_ASSERT_EQUAL_MEMORY(&c, px, LV_IMG_PX_SIZE_ALPHA_BYTE - 1);
+                    TEST_ASSERT_EQUAL_UINT8(LV_OPA_COVER, px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1]);
+                }
+                else {
+                    uint32_t bpp = lv_img_cf_get_px_size(cfs[i]);
+                    TEST_ASSERT_EQUAL_UINT8(lv_color_brightness(c) >> (8 - bpp), get_alpha(cfs[i], buf_test, x + 10, y + 5));
+                }
+            }
+        }
+
+        /*Nothing is drawn out of the image*/
+        if(cfs[i] == LV_IMG_CF_ALPHA_8BIT) {
+            TEST_ASSERT_EQUAL_UINT8(0, buf_test[4 * CANVAS_W + 10]);
+            TEST_ASSERT_EQUAL_UINT8(0, buf_test[5 * CANVAS_W + 9]);
+            TEST_ASSERT_EQUAL_UINT8(0, buf_test[37 * CANVAS_W + 10]);
+            TEST_ASSERT_EQUAL_UINT8(0, buf_test[5 * CANVAS_W + 42]);
+        }
+    }
+
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_canvas_batch(void)
+{
+    static const lv_img_cf_t cfs[] = {LV_IMG_CF_TRUE_COLOR, LV_IMG_CF_TRUE_COLOR_ALPHA,
+                                      LV_IMG_CF_ALPHA_1BIT, LV_IMG_CF_ALPHA_8BIT
+                                     };
+    uint32_t i;
+    for(i = 0; i < sizeof(cfs) / sizeof(cfs[0]); i++) {
+        lv_obj_t * canvas_ref = canvas_create(buf_ref, cfs[i]);
+        draw_scene(canvas_ref, lv_color_hex(0x3080f0));
+        draw_scene(canvas_ref, lv_color_hex(0xf08030));
+
+        /*Drawing between begin/end gives the same result*/
+        lv_obj_t * canvas = canvas_create(buf_test, cfs[i]);
+        lv_canvas_draw_begin(canvas);
+        draw_scene(canvas, lv_color_hex(0x3080f0));
+        draw_scene(canvas, lv_color_hex(0xf08030));
+        lv_canvas_draw_end(canvas);
+
+        TEST_ASSERT_EQUAL_MEMORY(buf_ref, buf_test, sizeof(buf_test));
+    }
+
+    lv_obj_clean(lv_scr_act());
+}
+
+static lv_obj_t * offscreen_canvas;
+
+static void draw_main_event_cb(lv_event_t * e)
+{
+    const lv_area_t * clip_area = lv_event_get_param(e);
+
+    /*Render to the canvas in the middle of a refresh*/
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    rect_dsc.bg_color = lv_color_white();
+    lv_canvas_draw_rect(offscreen_canvas, 0, 0, 20, 20, &rect_dsc);
+
+    /*The display is drawn again after it*/
+    rect_dsc.bg_color = lv_color_hex(0x0000ff);
+    lv_area_t a;
+    lv_area_set(&a, 100, 100, 149, 149);
+    lv_draw_rect(&a, clip_area, &rect_dsc);
+}
+
+void test_canvas_draw_while_refreshing(void)
+{
+    static uint8_t buf_a8[LV_CANVAS_BUF_SIZE_ALPHA_8BIT(CANVAS_W, CANVAS_H)];
+    lv_memset_00(buf_a8, sizeof(buf_a8));
+    offscreen_canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(offscreen_canvas, buf_a8, CANVAS_W, CANVAS_H, LV_IMG_CF_ALPHA_8BIT);
+    lv_obj_add_flag(offscreen_canvas, LV_OBJ_FLAG_HIDDEN);
+
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, 800, 480);
+    lv_obj_add_event_cb(obj, draw_main_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_COVER, buf_a8[10 * CANVAS_W + 10]);
+    TEST_ASSERT_EQUAL_UINT32(lv_color_hex(0x0000ff).full, test_fb[120 * 800 + 120].full);
+
+    lv_obj_clean(lv_scr_act());
+}
+
+#endif
@@ -0,0 +1,245 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_chart_set_next_values_shift(void);
+void test_chart_set_next_values_circular(void);
+void test_chart_set_next_values_overflow(void);
+void test_chart_crowded_shift(void);
+void test_chart_crowded_circular(void);
+
+#define POINT_CNT       1000
+#define CHART_W         200
+#define CHART_H         100
+#define Y_MAX           1100    /*Keep the values away from the edges to not clip the lines*/
+
+extern lv_color_t test_fb[];
+
+static lv_coord_t extent_min[CHART_W];
+static lv_coord_t extent_max[CHART_W];
+static lv_coord_t ref_values[POINT_CNT];
+static uint32_t ref_start;
+
+static lv_obj_t * chart_create(uint32_t point_cnt, lv_chart_update_mode_t mode)
+{
+    lv_obj_set_style_bg_color(lv_scr_act(), lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(lv_scr_act(), LV_OPA_COVER, 0);
+
+    lv_obj_t * chart = lv_chart_create(lv_scr_act());
+    lv_obj_remove_style_all(chart);
+    lv_obj_set_pos(chart, 100, 100);
+    lv_obj_set_size(chart, CHART_W, CHART_H);
+    lv_obj_set_style_line_width(chart, 1, LV_PART_ITEMS);
+    lv_obj_set_style_size(chart, 0, LV_PART_INDICATOR);
+    lv_chart_set_div_line_count(chart, 0, 0);
+    lv_chart_set_update_mode(chart, mode);
+    lv_chart_set_point_count(chart, point_cnt);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, 0, Y_MAX);
+    return chart;
+}
+
+static void render(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+/*Triangle waves with different periods and a little noise*/
+static lv_coord_t get_value(uint32_t i)
+{
+    int32_t a = (i % 200) < 100 ? (i % 200) * 8 : (200 - (i % 200)) * 8;
+    int32_t b = (i % 37) < 18 ? (i % 37) * 5 : (37 - (i % 37)) * 5;
+    int32_t noise = ((i * 7919) % 13) - 6;
+    return LV_CLAMP(0, a + b + noise + 50, 1000);
+}
+
+/*Add the values one by one as a reference*/
+static void add_one_by_one(lv_obj_t * chart, lv_chart_series_t * ser, const lv_coord_t values[], uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) lv_chart_set_next_value(chart, ser, values[i]);
+}
+
+static void test_set_next_values(lv_chart_update_mode_t mode)
+{
+    lv_obj_t * chart = chart_create(10, mode);
+    lv_chart_series_t * ser1 = lv_chart_add_series(chart, lv_color_hex(0xff0000), LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_series_t * ser2 = lv_chart_add_series(chart, lv_color_hex(0x0000ff), LV_CHART_AXIS_PRIMARY_Y);
+
+    static const uint32_t batches[] = {3, 4, 6, 1, 9, 10, 2, 7};
+    uint32_t v = 0;
+    uint32_t b;
+    for(b = 0; b < sizeof(batches) / sizeof(batches[0]); b++) {
+        uint32_t cnt = batches[b];
+        lv_coord_t values[10];
+        uint32_t i;
+        for(i = 0; i < cnt; i++) values[i] = get_value(v++);
+
+        lv_chart_set_next_values(chart, ser1, values, cnt);
+        add_one_by_one(chart, ser2, values, cnt);
+
+        TEST_ASSERT_EQUAL(lv_chart_get_x_start_point(chart, ser2), lv_chart_get_x_start_point(chart, ser1));
+        TEST_ASSERT_EQUAL_INT16_ARRAY(lv_chart_get_y_array(chart, ser2), lv_chart_get_y_array(chart, ser1), 10);
+    }
+
+    /*The start point wrapped around several times*/
+    TEST_ASSERT_EQUAL(42 % 10, lv_chart_get_x_start_point(chart, ser1));
+
+    /*The batch is drawn exactly the same way*/
+    lv_obj_set_style_line_width(chart, 3, LV_PART_ITEMS);
+    lv_chart_hide_series(chart, ser2, true);
+    render();
+    static lv_color_t buf[CHART_W * CHART_H];
+    uint32_t y;
+    for(y = 0; y < CHART_H; y++) {
+        lv_memcpy(&buf[y * CHART_W], &test_fb[(100 + y) * 800 + 100], CHART_W * sizeof(lv_color_t));
+    }
+
+    lv_chart_hide_series(chart, ser1, true);
+    lv_chart_hide_series(chart, ser2, false);
+    lv_chart_set_series_color(chart, ser2, lv_color_hex(0xff0000));
+    render();
+    for(y = 0; y < CHART_H; y++) {
+        TEST_ASSERT_EQUAL_MEMORY(&buf[y * CHART_W], &test_fb[(100 + y) * 800 + 100],
+                                 CHART_W * sizeof(lv_color_t));
+    }
+
+    lv_obj_del(chart);
+}
+
+void test_chart_set_next_values_shift(void)
+{
+    test_set_next_values(LV_CHART_UPDATE_MODE_SHIFT);
+}
+
+void test_chart_set_next_values_circular(void)
+{
+    test_set_next_values(LV_CHART_UPDATE_MODE_CIRCULAR);
+}
+
+void test_chart_set_next_values_overflow(void)
+{
+    lv_obj_t * chart = chart_create(10, LV_CHART_UPDATE_MODE_SHIFT);
+    lv_chart_series_t * ser1 = lv_chart_add_series(chart, lv_color_hex(0xff0000), LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_series_t * ser2 = lv_chart_add_series(chart, lv_color_hex(0x0000ff), LV_CHART_AXIS_PRIMARY_Y);
+
+    lv_coord_t values[25];
+    uint32_t i;
+    for(i = 0; i < 25; i++) values[i] = i;
+
+    /*Only the last values are kept from a too large batch*/
+    lv_chart_set_next_values(chart, ser1, values, 3);
+    add_one_by_one(chart, ser2, values, 3);
+    lv_chart_set_next_values(chart, ser1, values, 25);
+    add_one_by_one(chart, ser2, values, 25);
+    TEST_ASSERT_EQUAL(lv_chart_get_x_start_point(chart, ser2), lv_chart_get_x_start_point(chart, ser1));
+    TEST_ASSERT_EQUAL_INT16_ARRAY(lv_chart_get_y_array(chart, ser2), lv_chart_get_y_array(chart, ser1), 10);
+    TEST_ASSERT_EQUAL(24, lv_chart_get_y_array(chart, ser1)[(28 - 1) % 10]);
+
+    /*An empty batch changes nothing*/
+    lv_chart_set_next_values(chart, ser1, values, 0);
+    TEST_ASSERT_EQUAL(lv_chart_get_x_start_point(chart, ser2), lv_chart_get_x_start_point(chart, ser1));
+
+    lv_obj_del(chart);
+}
+
+/*Draw the series point by point with lines as the chart does when it's not crowded*/
+static void ref_draw_event_cb(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_target(e);
+    const lv_area_t * clip_area = lv_event_get_param(e);
+
+    lv_draw_line_dsc_t line_dsc;
+    lv_draw_line_dsc_init(&line_dsc);
+    line_dsc.color = lv_color_hex(0xff0000);
+    line_dsc.width = 1;
+    line_dsc.raw_end = 1;
+
+    lv_point_t p1;
+    lv_point_t p2;
+    uint32_t i;
+    for(i = 0; i < POINT_CNT; i++) {
+        p1 = p2;
+        p2.x = obj->coords.x1 + (CHART_W * i) / (POINT_CNT - 1);
+        p2.y = obj->coords.y1 + CHART_H - (ref_values[(ref_start + i) % POINT_CNT] * CHART_H) / Y_MAX;
+        if(i > 0) lv_draw_line(&p1, &p2, clip_area, &line_dsc);
+    }
+}
+
+/*Save the topmost and bottommost drawn pixel of each column*/
+static void get_extents(lv_coord_t min[], lv_coord_t max[])
+{
+    uint32_t x;
+    for(x = 0; x < CHART_W; x++) {
+        min[x] = LV_COORD_MAX;
+        max[x] = LV_COORD_MIN;
+        uint32_t y;
+        for(y = 0; y < CHART_H; y++) {
+            /*Count only the mostly covered pixels*/
+            lv_color32_t c;
+            c.full = lv_color_to32(test_fb[(100 + y) * 800 + 100 + x]);
+            if(c.ch.green > 0x80) continue;
+            min[x] = LV_MIN(min[x], (lv_coord_t)y);
+            max[x] = LV_MAX(max[x], (lv_coord_t)y);
+        }
+    }
+}
+
+static void test_crowded(lv_chart_update_mode_t mode)
+{
+    lv_obj_t * chart = chart_create(POINT_CNT, mode);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, lv_color_hex(0xff0000), LV_CHART_AXIS_PRIMARY_Y);
+
+    /*Fill the series in batches with wrap-around*/
+    uint32_t i;
+    for(i = 0; i < POINT_CNT + 321; i += 100) {
+        lv_coord_t values[100];
+        uint32_t j;
+        for(j = 0; j < 100; j++) values[j] = get_value(i + j);
+        lv_chart_set_next_values(chart, ser, values, 100);
+    }
+
+    lv_memcpy(ref_values, lv_chart_get_y_array(chart, ser), sizeof(ref_values));
+    ref_start = mode == LV_CHART_UPDATE_MODE_SHIFT ? lv_chart_get_x_start_point(chart, ser) : 0;
+    TEST_ASSERT_NOT_EQUAL(0, lv_chart_get_x_start_point(chart, ser));
+
+    /*There are more points than pixels so the series is drawn with min/max columns*/
+    TEST_ASSERT_LESS_OR_EQUAL(POINT_CNT, lv_obj_get_content_width(chart));
+    render();
+    get_extents(extent_min, extent_max);
+    lv_obj_del(chart);
+
+    /*Draw the reference*/
+    lv_obj_t * ref = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(ref);
+    lv_obj_set_pos(ref, 100, 100);
+    lv_obj_set_size(ref, CHART_W, CHART_H);
+    lv_obj_add_event_cb(ref, ref_draw_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+    render();
+
+    static lv_coord_t ref_min[CHART_W];
+    static lv_coord_t ref_max[CHART_W];
+    get_extents(ref_min, ref_max);
+    lv_obj_del(ref);
+
+    /*Every column covers the same vertical range (the sloped lines can be 1 px shorter due to anti-aliasing)*/
+    uint32_t x;
+    for(x = 0; x < CHART_W; x++) {
+        TEST_ASSERT_NOT_EQUAL(LV_COORD_MAX, extent_min[x]);
+        TEST_ASSERT_INT_WITHIN(1, ref_min[x], extent_min[x]);
+        TEST_ASSERT_INT_WITHIN(1, ref_max[x], extent_max[x]);
+    }
+}
+
+void test_chart_crowded_shift(void)
+{
+    test_crowded(LV_CHART_UPDATE_MODE_SHIFT);
+}
+
+void test_chart_crowded_circular(void)
+{
+    test_crowded(LV_CHART_UPDATE_MODE_CIRCULAR);
+}
+
+#endif
@@ -0,0 +1,184 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <time.h>
+
+void test_circle_cache_same_result(void);
+void test_circle_cache_reuse(void);
+void test_circle_cache_mem_limit(void);
+void test_circle_cache_cleanup(void);
+void test_circle_cache_benchmark(void);
+
+static lv_opa_t buf_cached[400];
+static lv_opa_t buf_calc[400];
+
+static void apply_rows(lv_draw_mask_radius_param_t * p, lv_opa_t * buf, lv_coord_t abs_x, lv_coord_t abs_y,
+                       lv_coord_t len)
+{
+    lv_memset_ff(buf, len);
+    lv_draw_mask_res_t res = p->dsc.cb(buf, abs_x, abs_y, len, p);
+    if(res == LV_DRAW_MASK_RES_TRANSP) lv_memset_00(buf, len);
+}
+
+/*The cached tables should give exactly the same mask as the calculation*/
+void test_circle_cache_same_result(void)
+{
+    lv_coord_t r;
+    for(r = 1; r <= 120; r++) {
+        uint32_t inv;
+        for(inv = 0; inv < 2; inv++) {
+            lv_area_t rect;
+            lv_area_set(&rect, 30, 20, 30 + 2 * r + r % 7, 20 + 2 * r + r % 3);
+
+            lv_draw_mask_radius_param_t cached;
+            lv_draw_mask_radius_init(&cached, &rect, r, inv);
+            TEST_ASSERT_NOT_NULL(cached.circle);
+
+            lv_draw_mask_radius_param_t calc;
+            lv_draw_mask_radius_init(&calc, &rect, r, inv);
+            calc.circle = NULL;
+
+            lv_coord_t y;
+            for(y = rect.y1 - 1; y <= rect.y2 + 1; y++) {
+                /*The whole row and some partial rows*/
+                apply_rows(&cached, buf_cached, 0, y, 400);
+                apply_rows(&calc, buf_calc, 0, y, 400);
+                TEST_ASSERT_EQUAL_UINT8_ARRAY(buf_calc, buf_cached, 400);
+
+                apply_rows(&cached, buf_cached, rect.x1 + r / 2, y, r + 3);
+                apply_rows(&calc, buf_calc, rect.x1 + r / 2, y, r + 3);
+                TEST_ASSERT_EQUAL_UINT8_ARRAY(buf_calc, buf_cached, r + 3);
+
+                apply_rows(&cached, buf_cached, rect.x2 - r / 3, y, 7);
+                apply_rows(&calc, buf_calc, rect.x2 - r / 3, y, 7);
+                TEST_ASSERT_EQUAL_UINT8_ARRAY(buf_calc, buf_cached, 7);
+            }
+        }
+    }
+}
+
+void test_circle_cache_reuse(void)
+{
+    lv_area_t rect;
+    lv_area_set(&rect, 0, 0, 99, 99);
+
+    lv_draw_mask_radius_param_t p1;
+    lv_draw_mask_radius_init(&p1, &rect, 10, false);
+    lv_draw_mask_radius_param_t p2;
+    lv_draw_mask_radius_init(&p2, &rect, 10, false);
+    TEST_ASSERT_EQUAL_PTR(p1.circle, p2.circle);
+
+    /*The outer mask has its own table*/
+    lv_draw_mask_radius_init(&p2, &rect, 10, true);
+    TEST_ASSERT_TRUE(p1.circle != p2.circle);
+
+    /*Fill the cache with other radii. `p1` should fall back to calculation.*/
+    lv_coord_t r;
+    for(r = 20; r < 20 + LV_CIRCLE_CACHE_SIZE * 2; r++) {
+        lv_draw_mask_radius_init(&p2, &rect, r, false);
+    }
+
+    lv_draw_mask_radius_param_t calc;
+    lv_draw_mask_radius_init(&calc, &rect, 10, false);
+    calc.circle = NULL;
+    apply_rows(&p1, buf_cached, 0, 3, 100);
+    apply_rows(&calc, buf_calc, 0, 3, 100);
+    TEST_ASSERT_NULL(p1.circle);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(buf_calc, buf_cached, 100);
+}
+
+void test_circle_cache_mem_limit(void)
+{
+    lv_area_t rect;
+    lv_area_set(&rect, 0, 0, 3999, 3999);
+    _lv_draw_mask_cleanup();
+
+    /*Too large to cache*/
+    lv_draw_mask_radius_param_t p1;
+    lv_draw_mask_radius_init(&p1, &rect, LV_CIRCLE_CACHE_MEM_SIZE / 7 + 10, false);
+    TEST_ASSERT_NULL(p1.circle);
+
+    /*2 tables fit but 3 don't, even if there are enough entries*/
+    lv_coord_t r = LV_CIRCLE_CACHE_MEM_SIZE / 7 / 5 * 2;
+    lv_draw_mask_radius_init(&p1, &rect, r, false);
+    lv_draw_mask_radius_param_t p2;
+    lv_draw_mask_radius_init(&p2, &rect, r + 1, false);
+    TEST_ASSERT_NOT_NULL(p1.circle);
+    TEST_ASSERT_NOT_NULL(p2.circle);
+
+    /*Use the first table again*/
+    lv_draw_mask_radius_param_t p3;
+    lv_draw_mask_radius_init(&p3, &rect, r, false);
+    TEST_ASSERT_EQUAL_PTR(p1.circle, p3.circle);
+
+    lv_draw_mask_radius_init(&p3, &rect, r + 2, false);
+    TEST_ASSERT_NOT_NULL(p3.circle);
+
+    /*The least recently used table is freed*/
+    apply_rows(&p1, buf_cached, 0, 3, 100);
+    apply_rows(&p2, buf_cached, 0, 3, 100);
+    TEST_ASSERT_NOT_NULL(p1.circle);
+    TEST_ASSERT_NULL(p2.circle);
+}
+
+void test_circle_cache_cleanup(void)
+{
+    lv_area_t rect;
+    lv_area_set(&rect, 0, 0, 99, 99);
+
+    lv_draw_mask_radius_param_t p;
+    lv_draw_mask_radius_init(&p, &rect, 10, false);
+    TEST_ASSERT_NOT_NULL(p.circle);
+
+    /*The masks using the freed tables fall back to calculation*/
+    _lv_draw_mask_cleanup();
+    lv_draw_mask_radius_param_t calc;
+    lv_draw_mask_radius_init(&calc, &rect, 10, false);
+    calc.circle = NULL;
+    apply_rows(&p, buf_cached, 0, 3, 100);
+    apply_rows(&calc, buf_calc, 0, 3, 100);
+    TEST_ASSERT_NULL(p.circle);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(buf_calc, buf_cached, 100);
+
+    /*The cache is usable again*/
+    lv_draw_mask_radius_init(&p, &rect, 10, false);
+    TEST_ASSERT_NOT_NULL(p.circle);
+}
+
+static uint32_t bench_masks(lv_coord_t r, bool cached)
+{
+    lv_area_t rect;
+    lv_area_set(&rect, 0, 0, 2 * r + 99, 2 * r + 99);
+    clock_t t = clock();
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        lv_draw_mask_radius_param_t p;
+        lv_draw_mask_radius_init(&p, &rect, r, i & 1);
+        if(!cached) p.circle = NULL;
+
+        lv_coord_t y;
+        for(y = rect.y1; y <= rect.y2; y++) {
+            apply_rows(&p, buf_cached, 0, y, lv_area_get_width(&rect));
+        }
+    }
+    t = clock() - t;
+    return (uint64_t)t * 1000000 / CLOCKS_PER_SEC;
+}
+
+void test_circle_cache_benchmark(void)
+{
+    static const lv_coord_t radii[] = {4, 10, 25, 50, 100};
+    uint32_t i;
+    for(i = 0; i < sizeof(radii) / sizeof(radii[0]); i++) {
+        uint32_t t_calc = bench_masks(radii[i], false);
+        uint32_t t_cached = bench_masks(radii[i], true);
+
+        char buf[96];
+        lv_snprintf(buf, sizeof(buf), "100 radius masks, r=%d: %d us calculated, %d us cached",
+                    radii[i], t_calc, t_cached);
+        TEST_MESSAGE(buf);
+    }
+}
+
+#endif
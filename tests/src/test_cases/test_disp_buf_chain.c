@@ -0,0 +1,206 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_ref_disp.h"
+
+void test_disp_buf_chain_queue(void);
+void test_disp_buf_chain_frame_stats(void);
+void test_disp_buf_chain_flush_last(void);
+void test_disp_buf_chain_flush_pending(void);
+
+#define DISP_W      LV_TEST_REF_DISP_HOR_RES
+#define DISP_H      LV_TEST_REF_DISP_VER_RES
+#define BUF_CNT     3
+#define BUF_SIZE    (DISP_W * 20)
+#define QUEUE_MAX   8
+
+static lv_color_t chain_fb[DISP_W * DISP_H];
+static lv_color_t draw_bufs[BUF_CNT][BUF_SIZE];
+static void * draw_buf_chain[BUF_CNT] = {draw_bufs[0], draw_bufs[1], draw_bufs[2]};
+
+/*Emulate a flush thread: `flush_cb` only queues the buffers and they are flushed in `wait_cb`*/
+static struct {
+    const lv_color_t * color_p;
+    lv_area_t area;
+} queue[QUEUE_MAX];
+static uint32_t queue_cnt;
+static uint32_t queue_cnt_max;
+static uint32_t buf_used[BUF_CNT];
+
+/*`lv_disp_flush_is_last()` of every flushed buffer*/
+static bool flushed_last[32];
+static uint32_t flushed_cnt;
+
+static void chain_wait_cb(lv_disp_drv_t * drv)
+{
+    if(queue_cnt == 0) return;
+
+    lv_test_fb_copy_area(chain_fb, DISP_W, &queue[0].area, queue[0].color_p);
+    if(flushed_cnt < 32) flushed_last[flushed_cnt] = lv_disp_flush_is_last(drv);
+    flushed_cnt++;
+    queue_cnt--;
+    uint32_t i;
+    for(i = 0; i < queue_cnt; i++) queue[i] = queue[i + 1];
+    lv_disp_flush_ready(drv);
+}
+
+static void chain_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    LV_UNUSED(drv);
+    TEST_ASSERT_LESS_THAN(QUEUE_MAX, queue_cnt);
+
+    /*The buffer shouldn't be in the queue already*/
+    uint32_t i;
+    for(i = 0; i < queue_cnt; i++) {
+        TEST_ASSERT_TRUE(queue[i].color_p != color_p);
+    }
+
+    for(i = 0; i < BUF_CNT; i++) {
+        if(color_p == draw_bufs[i]) buf_used[i]++;
+    }
+
+    queue[queue_cnt].color_p = color_p;
+    queue[queue_cnt].area = *area;
+    queue_cnt++;
+    if(queue_cnt > queue_cnt_max) queue_cnt_max = queue_cnt;
+}
+
+static lv_disp_t * chain_disp_create(void)
+{
+    static lv_disp_draw_buf_t draw_buf;
+    lv_disp_draw_buf_init_chain(&draw_buf, draw_buf_chain, BUF_CNT, BUF_SIZE);
+    static lv_disp_drv_t drv;
+    lv_disp_drv_init(&drv);
+    drv.draw_buf = &draw_buf;
+    drv.flush_cb = chain_flush_cb;
+    drv.wait_cb = chain_wait_cb;
+    drv.hor_res = DISP_W;
+    drv.ver_res = DISP_H;
+    return lv_disp_drv_register(&drv);
+}
+
+void test_disp_buf_chain_queue(void)
+{
+    lv_disp_t * def_disp = lv_disp_get_default();
+
+    lv_disp_t * ref_disp = lv_test_ref_disp_create(DISP_W, DISP_H);
+    lv_test_ref_content_create(ref_disp, "Swap chain");
+    lv_refr_now(ref_disp);
+
+    lv_disp_t * chain_disp = chain_disp_create();
+    lv_test_ref_content_create(chain_disp, "Swap chain");
+
+    queue_cnt = 0;
+    queue_cnt_max = 0;
+    lv_memset_00(buf_used, sizeof(buf_used));
+    lv_refr_now(chain_disp);
+
+    /*Finish the queued flushes*/
+    while(queue_cnt) chain_wait_cb(chain_disp->driver);
+
+    /*The driver got more buffers to flush at once but never the buffer being rendered*/
+    TEST_ASSERT_EQUAL(BUF_CNT - 1, queue_cnt_max);
+    uint32_t i;
+    for(i = 0; i < BUF_CNT; i++) {
+        TEST_ASSERT_GREATER_THAN(0, buf_used[i]);
+    }
+    TEST_ASSERT_TRUE(lv_test_ref_fb_equal(chain_fb));
+
+    lv_disp_remove(ref_disp);
+    lv_disp_remove(chain_disp);
+    lv_disp_set_default(def_disp);
+}
+
+void test_disp_buf_chain_frame_stats(void)
+{
+    lv_disp_t * def_disp = lv_disp_get_default();
+    lv_disp_t * chain_disp = chain_disp_create();
+    lv_test_ref_content_create(chain_disp, "Swap chain");
+
+    queue_cnt = 0;
+    lv_disp_reset_frame_stats(chain_disp);
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_obj_invalidate(lv_disp_get_scr_act(chain_disp));
+        lv_refr_now(chain_disp);
+    }
+    while(queue_cnt) chain_wait_cb(chain_disp->driver);
+
+    /*Nothing to redraw, not a frame*/
+    lv_refr_now(chain_disp);
+
+    lv_disp_frame_stats_t stats;
+    lv_disp_get_frame_stats(chain_disp, &stats);
+    TEST_ASSERT_EQUAL(3, stats.frame_cnt);
+    TEST_ASSERT_TRUE(stats.render_time_sum >= stats.render_time);
+    TEST_ASSERT_TRUE(stats.flush_wait_time_sum >= stats.flush_wait_time);
+
+    lv_disp_remove(chain_disp);
+    lv_disp_set_default(def_disp);
+}
+
+void test_disp_buf_chain_flush_last(void)
+{
+    lv_disp_t * def_disp = lv_disp_get_default();
+    lv_disp_t * chain_disp = chain_disp_create();
+    lv_test_ref_content_create(chain_disp, "Swap chain");
+    lv_refr_now(chain_disp);
+    while(queue_cnt) chain_wait_cb(chain_disp->driver);
+
+    /*Render the second frame while the buffers of the first one are still queued*/
+    queue_cnt = 0;
+    flushed_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_obj_invalidate(lv_disp_get_scr_act(chain_disp));
+        lv_refr_now(chain_disp);
+    }
+    TEST_ASSERT_NOT_EQUAL(0, queue_cnt);
+    while(queue_cnt) chain_wait_cb(chain_disp->driver);
+
+    /*Only the last buffer of each frame is the last one*/
+    uint32_t flush_per_frame = DISP_H / (BUF_SIZE / DISP_W);
+    TEST_ASSERT_EQUAL(2 * flush_per_frame, flushed_cnt);
+    for(i = 0; i < flushed_cnt; i++) {
+        TEST_ASSERT_EQUAL((i + 1) % flush_per_frame == 0, flushed_last[i]);
+    }
+
+    lv_disp_remove(chain_disp);
+    lv_disp_set_default(def_disp);
+}
+
+void test_disp_buf_chain_flush_pending(void)
+{
+    lv_disp_t * def_disp = lv_disp_get_default();
+    lv_disp_t * chain_disp = chain_disp_create();
+    lv_disp_draw_buf_t * draw_buf = chain_disp->driver->draw_buf;
+    lv_test_ref_content_create(chain_disp, "Swap chain");
+
+    queue_cnt = 0;
+    lv_refr_now(chain_disp);
+
+    /*The last buffers are still queued*/
+    TEST_ASSERT_NOT_EQUAL(0, queue_cnt);
+    TEST_ASSERT_TRUE(lv_disp_flush_is_pending(chain_disp->driver));
+    TEST_ASSERT_EQUAL(1, draw_buf->flushing);
+
+    while(queue_cnt > 1) chain_wait_cb(chain_disp->driver);
+    TEST_ASSERT_TRUE(lv_disp_flush_is_pending(chain_disp->driver));
+    TEST_ASSERT_TRUE(lv_disp_flush_is_last(chain_disp->driver));
+
+    chain_wait_cb(chain_disp->driver);
+    TEST_ASSERT_FALSE(lv_disp_flush_is_pending(chain_disp->driver));
+
+    /*The fields follow the counters when the rendering starts a flush or waits for them*/
+    lv_obj_invalidate(lv_disp_get_scr_act(chain_disp));
+    lv_refr_now(chain_disp);
+    TEST_ASSERT_EQUAL(1, draw_buf->flushing);
+    TEST_ASSERT_EQUAL(lv_disp_flush_is_last(chain_disp->driver), draw_buf->flushing_last);
+    while(queue_cnt) chain_wait_cb(chain_disp->driver);
+
+    lv_disp_remove(chain_disp);
+    lv_disp_set_default(def_disp);
+}
+
+#endif
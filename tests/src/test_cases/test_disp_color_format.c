@@ -0,0 +1,123 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_ref_disp.h"
+
+void test_disp_color_format_convert(void);
+void test_disp_color_format_flush(void);
+
+#define DISP_W      LV_TEST_REF_DISP_HOR_RES
+#define DISP_H      LV_TEST_REF_DISP_VER_RES
+
+static uint8_t cf_fb[DISP_W * DISP_H * 4];
+static lv_color_t draw_buf1[DISP_W * 10];
+
+static void cf_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    /*The pixels are in the display's color format*/
+    uint32_t px_size = lv_disp_color_format_get_size(drv->color_format);
+    const uint8_t * buf = (const uint8_t *)color_p;
+    uint32_t line_size = lv_area_get_width(area) * px_size;
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&cf_fb[(y * DISP_W + area->x1) * px_size], buf, line_size);
+        buf += line_size;
+    }
+    lv_disp_flush_ready(drv);
+}
+
+void test_disp_color_format_convert(void)
+{
+    lv_color_t buf[4];
+    buf[0] = lv_color_hex(0xff0000);
+    buf[1] = lv_color_hex(0x00ff00);
+    buf[2] = lv_color_hex(0x0000ff);
+    buf[3] = lv_color_hex(0x808080);
+    lv_color_t ori[4];
+    lv_memcpy(ori, buf, sizeof(buf));
+
+    TEST_ASSERT_TRUE(lv_disp_color_format_is_native(LV_DISP_COLOR_FORMAT_NATIVE));
+    lv_disp_color_format_convert(buf, 4, LV_DISP_COLOR_FORMAT_NATIVE);
+    TEST_ASSERT_EQUAL_MEMORY(ori, buf, sizeof(buf));
+
+    lv_disp_color_format_convert(buf, 4, LV_DISP_COLOR_FORMAT_RGB565);
+    uint16_t rgb565[4];
+    lv_memcpy(rgb565, buf, sizeof(rgb565));
+    TEST_ASSERT_EQUAL_HEX16(0xf800, rgb565[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x07e0, rgb565[1]);
+    TEST_ASSERT_EQUAL_HEX16(0x001f, rgb565[2]);
+    TEST_ASSERT_EQUAL_HEX16(0x8410, rgb565[3]);
+
+    lv_memcpy(buf, ori, sizeof(buf));
+    lv_disp_color_format_convert(buf, 4, LV_DISP_COLOR_FORMAT_RGB565_SWAP);
+    lv_memcpy(rgb565, buf, sizeof(rgb565));
+    TEST_ASSERT_EQUAL_HEX16(0x00f8, rgb565[0]);
+    TEST_ASSERT_EQUAL_HEX16(0xe007, rgb565[1]);
+
+    lv_memcpy(buf, ori, sizeof(buf));
+    lv_disp_color_format_convert(buf, 4, LV_DISP_COLOR_FORMAT_RGB888);
+    const uint8_t rgb888[12] = {0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x80, 0x80, 0x80};
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(rgb888, buf, 12);
+
+    lv_memcpy(buf, ori, sizeof(buf));
+    lv_disp_color_format_convert(buf, 4, LV_DISP_COLOR_FORMAT_L8);
+    const uint8_t * l8 = (const uint8_t *)buf;
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL(lv_color_brightness(ori[i]), l8[i]);
+    }
+}
+
+void test_disp_color_format_flush(void)
+{
+    lv_disp_t * def_disp = lv_disp_get_default();
+
+    lv_disp_t * ref_disp = lv_test_ref_disp_create(DISP_W, DISP_H);
+    lv_test_ref_content_create(ref_disp, "Color format");
+    lv_refr_now(ref_disp);
+
+    static lv_disp_draw_buf_t draw_buf;
+    lv_disp_draw_buf_init(&draw_buf, draw_buf1, NULL, DISP_W * 10);
+    static lv_disp_drv_t drv;
+    lv_disp_drv_init(&drv);
+    drv.draw_buf = &draw_buf;
+    drv.flush_cb = cf_flush_cb;
+    drv.hor_res = DISP_W;
+    drv.ver_res = DISP_H;
+    lv_disp_t * disp = lv_disp_drv_register(&drv);
+    lv_test_ref_content_create(disp, "Color format");
+
+    /*The flushed pixels should be the same as the converted pixels of the reference*/
+    static lv_color_t exp_fb[DISP_W * DISP_H];
+    const lv_disp_color_format_t cfs[] = {LV_DISP_COLOR_FORMAT_RGB565, LV_DISP_COLOR_FORMAT_RGB565_SWAP,
+                                          LV_DISP_COLOR_FORMAT_RGB888, LV_DISP_COLOR_FORMAT_XRGB8888,
+                                          LV_DISP_COLOR_FORMAT_L8
+                                         };
+    uint32_t i;
+    for(i = 0; i < sizeof(cfs) / sizeof(cfs[0]); i++) {
+        drv.color_format = cfs[i];
+        lv_obj_invalidate(lv_disp_get_scr_act(disp));
+        lv_refr_now(disp);
+
+        lv_memcpy(exp_fb, lv_test_ref_fb, sizeof(exp_fb));
+        lv_disp_color_format_convert(exp_fb, DISP_W * DISP_H, cfs[i]);
+        uint32_t px_size = lv_disp_color_format_get_size(cfs[i]);
+        if(cfs[i] == LV_DISP_COLOR_FORMAT_XRGB8888) {
+            /*The X byte can be anything*/
+            uint32_t j;
+            for(j = 0; j < DISP_W * DISP_H; j++) {
+                TEST_ASSERT_EQUAL_HEX32(exp_fb[j].full & 0xffffff, ((lv_color_t *)cf_fb)[j].full & 0xffffff);
+            }
+        }
+        else {
+            TEST_ASSERT_EQUAL_MEMORY(exp_fb, cf_fb, DISP_W * DISP_H * px_size);
+        }
+    }
+
+    lv_disp_remove(ref_disp);
+    lv_disp_remove(disp);
+    lv_disp_set_default(def_disp);
+}
+
+#endif
@@ -0,0 +1,188 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_draw_backend_pass_through(void);
+void test_draw_backend_offload(void);
+
+extern lv_color_t test_fb[];
+
+#define IMG_W   16
+#define IMG_H   16
+
+static lv_color_t img_map[IMG_W * IMG_H];
+static lv_color_t ref_fb[800 * 480];
+
+/*Counts the operations offered to the backend*/
+static struct {
+    uint32_t fill;
+    uint32_t blend_map;
+    uint32_t draw_rect;
+    uint32_t draw_glyph_run;
+    uint32_t draw_img;
+    uint32_t wait;
+} rec;
+
+static lv_res_t rec_res;
+
+static lv_res_t rec_fill(lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, const lv_area_t * dest_area,
+                         const lv_area_t * fill_area, lv_color_t color, lv_opa_t opa)
+{
+    LV_UNUSED(disp_drv);
+    LV_UNUSED(dest_buf);
+    LV_UNUSED(dest_area);
+    LV_UNUSED(fill_area);
+    LV_UNUSED(color);
+    LV_UNUSED(opa);
+    rec.fill++;
+    return LV_RES_INV;
+}
+
+static lv_res_t rec_blend_map(lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, const lv_area_t * dest_area,
+                              const lv_area_t * draw_area, const lv_color_t * src_buf, const lv_area_t * src_area, lv_opa_t opa)
+{
+    LV_UNUSED(disp_drv);
+    LV_UNUSED(dest_buf);
+    LV_UNUSED(dest_area);
+    LV_UNUSED(draw_area);
+    LV_UNUSED(src_buf);
+    LV_UNUSED(src_area);
+    LV_UNUSED(opa);
+    rec.blend_map++;
+    return LV_RES_INV;
+}
+
+static lv_res_t rec_draw_rect(lv_disp_drv_t * disp_drv, const lv_area_t * coords, const lv_area_t * clip,
+                              const lv_draw_rect_dsc_t * dsc)
+{
+    LV_UNUSED(disp_drv);
+    LV_UNUSED(coords);
+    LV_UNUSED(clip);
+    LV_UNUSED(dsc);
+    rec.draw_rect++;
+    return rec_res;
+}
+
+static lv_res_t rec_draw_glyph_run(lv_disp_drv_t * disp_drv, const lv_point_t * pos, const lv_area_t * clip,
+                                   const char * txt, uint32_t txt_len, const lv_draw_label_dsc_t * dsc)
+{
+    LV_UNUSED(disp_drv);
+    LV_UNUSED(pos);
+    LV_UNUSED(clip);
+    LV_UNUSED(dsc);
+    TEST_ASSERT_TRUE(txt_len > 0);
+    TEST_ASSERT_NOT_NULL(txt);
+    rec.draw_glyph_run++;
+    return rec_res;
+}
+
+static lv_res_t rec_draw_img(lv_disp_drv_t * disp_drv, const lv_area_t * coords, const lv_area_t * clip,
+                             const uint8_t * map_p, const lv_draw_img_dsc_t * dsc, bool chroma_key, bool alpha_byte)
+{
+    LV_UNUSED(disp_drv);
+    LV_UNUSED(coords);
+    LV_UNUSED(clip);
+    LV_UNUSED(dsc);
+    LV_UNUSED(chroma_key);
+    LV_UNUSED(alpha_byte);
+    TEST_ASSERT_EQUAL_PTR(img_map, map_p);
+    rec.draw_img++;
+    return rec_res;
+}
+
+static void rec_wait(lv_disp_drv_t * disp_drv)
+{
+    LV_UNUSED(disp_drv);
+    rec.wait++;
+}
+
+static const lv_draw_backend_t rec_backend = {
+    .fill = rec_fill,
+    .blend_map = rec_blend_map,
+    .draw_rect = rec_draw_rect,
+    .draw_glyph_run = rec_draw_glyph_run,
+    .draw_img = rec_draw_img,
+    .wait = rec_wait,
+};
+
+static lv_img_dsc_t img_dsc;
+
+static lv_obj_t * create_content(void)
+{
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, 300, 200);
+
+    lv_obj_t * label = lv_label_create(cont);
+    lv_label_set_text(label, "Draw backend\nsecond line");
+
+    uint32_t i;
+    for(i = 0; i < IMG_W * IMG_H; i++) img_map[i] = lv_color_hex(i * 0x010203);
+    img_dsc.header.cf = LV_IMG_CF_TRUE_COLOR;
+    img_dsc.header.w = IMG_W;
+    img_dsc.header.h = IMG_H;
+    img_dsc.data_size = sizeof(img_map);
+    img_dsc.data = (const uint8_t *)img_map;
+
+    lv_obj_t * img = lv_img_create(cont);
+    lv_img_set_src(img, &img_dsc);
+    lv_obj_align(img, LV_ALIGN_BOTTOM_RIGHT, 0, 0);
+
+    return cont;
+}
+
+static void render(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+void test_draw_backend_pass_through(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    TEST_ASSERT_EQUAL_PTR(lv_draw_backend_get_default(), disp->driver->draw_backend);
+
+    lv_obj_t * cont = create_content();
+    render();
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    /*A backend refusing everything gives the same result as the software renderer*/
+    lv_memset_00(&rec, sizeof(rec));
+    rec_res = LV_RES_INV;
+    disp->driver->draw_backend = &rec_backend;
+    render();
+    disp->driver->draw_backend = lv_draw_backend_get_default();
+
+    TEST_ASSERT_GREATER_THAN(0, rec.fill);
+    TEST_ASSERT_GREATER_THAN(0, rec.blend_map);
+    TEST_ASSERT_GREATER_THAN(0, rec.draw_rect);
+    TEST_ASSERT_EQUAL(2, rec.draw_glyph_run);
+    TEST_ASSERT_GREATER_THAN(0, rec.draw_img);
+    TEST_ASSERT_GREATER_THAN(0, rec.wait);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+
+    lv_obj_del(cont);
+}
+
+void test_draw_backend_offload(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_obj_t * cont = create_content();
+
+    /*The offloaded primitives are not drawn by software*/
+    lv_memset_00(&rec, sizeof(rec));
+    rec_res = LV_RES_OK;
+    disp->driver->draw_backend = &rec_backend;
+    render();
+    disp->driver->draw_backend = lv_draw_backend_get_default();
+
+    TEST_ASSERT_GREATER_THAN(0, rec.draw_rect);
+    TEST_ASSERT_EQUAL(2, rec.draw_glyph_run);
+    TEST_ASSERT_GREATER_THAN(0, rec.draw_img);
+    TEST_ASSERT_EQUAL(0, rec.fill);
+    TEST_ASSERT_EQUAL(0, rec.blend_map);
+
+    lv_obj_del(cont);
+}
+
+#endif
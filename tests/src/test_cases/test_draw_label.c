@@ -0,0 +1,123 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_draw_label_blit(void);
+
+extern lv_color_t test_fb[];
+
+#define GLYPH_W  13
+#define GLYPH_H  11
+#define FB_SIZE  (800 * 480)
+
+static uint8_t glyph_bitmap[GLYPH_W * GLYPH_H + 32];   /*Each letter starts at a different byte*/
+static lv_color_t ref_fb[FB_SIZE];
+static uint8_t font_bpp;
+static bool add_mask;
+
+static bool get_glyph_dsc(const lv_font_t * font, lv_font_glyph_dsc_t * g, uint32_t letter, uint32_t letter_next)
+{
+    LV_UNUSED(font);
+    LV_UNUSED(letter_next);
+    if(letter < 'A' || letter > 'Z') return false;
+
+    g->adv_w = GLYPH_W + 1;
+    g->box_w = GLYPH_W - (letter & 0x3);
+    g->box_h = GLYPH_H;
+    g->ofs_x = letter & 0x1;
+    g->ofs_y = 0;
+    g->bpp = font_bpp;
+    return true;
+}
+
+static const uint8_t * get_glyph_bitmap(const lv_font_t * font, uint32_t letter)
+{
+    LV_UNUSED(font);
+    return &glyph_bitmap[letter - 'A'];
+}
+
+static lv_font_t test_font = {
+    .get_glyph_dsc = get_glyph_dsc,
+    .get_glyph_bitmap = get_glyph_bitmap,
+    .line_height = GLYPH_H + 3,
+    .base_line = 2,
+};
+
+static void draw_event_cb(lv_event_t * e)
+{
+    const lv_area_t * clip_area = lv_event_get_param(e);
+    lv_obj_t * obj = lv_event_get_target(e);
+
+    /*A mask which doesn't change anything but forces the glyphs to be blended with masks*/
+    lv_draw_mask_radius_param_t mask_param;
+    int16_t mask_id = LV_MASK_ID_INV;
+    if(add_mask) {
+        lv_area_t mask_area;
+        lv_area_set(&mask_area, -100, -100, 1000, 1000);
+        lv_draw_mask_radius_init(&mask_param, &mask_area, 0, false);
+        mask_id = lv_draw_mask_add(&mask_param, NULL);
+    }
+
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    label_dsc.font = &test_font;
+    label_dsc.color = lv_color_hex(0x2040ff);
+    label_dsc.opa = lv_obj_get_style_opa(obj, 0);
+    label_dsc.flag = LV_TEXT_FLAG_RECOLOR;
+    lv_draw_label(&obj->coords, clip_area, &label_dsc, "ABCDEFGH\nIJK #ff0000 LMN# OPQ\nRSTUVWXYZ", NULL);
+
+    if(add_mask) lv_draw_mask_remove_id(mask_id);
+}
+
+static void render(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+/*Writing the glyphs directly into the draw buffer should give the same result as blending them*/
+void test_draw_label_blit(void)
+{
+    uint32_t i;
+    for(i = 0; i < sizeof(glyph_bitmap); i++) {
+        glyph_bitmap[i] = i % 5 == 0 ? 0xff : (i * 97 + (i >> 3) * 31) & 0xff;
+    }
+
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_pos(obj, -7, 30);
+    lv_obj_set_size(obj, 230, 60);
+    lv_obj_add_event_cb(obj, draw_event_cb, LV_EVENT_DRAW_POST, NULL);
+
+    static const uint8_t bpps[] = {1, 2, 4, 8};
+    static const lv_opa_t opas[] = {LV_OPA_COVER, LV_OPA_60};
+    uint32_t b;
+    uint32_t o;
+    for(b = 0; b < sizeof(bpps); b++) {
+        for(o = 0; o < sizeof(opas); o++) {
+            font_bpp = bpps[b];
+            lv_obj_set_style_opa(obj, opas[o], 0);
+
+            add_mask = true;
+            render();
+            lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+            add_mask = false;
+            render();
+            TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+
+            /*The re-colored letters should be really drawn*/
+            if(opas[o] == LV_OPA_COVER) {
+                uint32_t red_cnt = 0;
+                for(i = 0; i < FB_SIZE; i++) {
+                    if(test_fb[i].full == lv_color_hex(0xff0000).full) red_cnt++;
+                }
+                TEST_ASSERT_GREATER_THAN(0, red_cnt);
+            }
+        }
+    }
+
+    lv_obj_del(obj);
+}
+
+#endif
@@ -0,0 +1,72 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../src/misc/lv_gc.h"
+
+#include "unity/unity.h"
+
+void test_grad_cache_reuse(void);
+void test_grad_cache_too_large(void);
+void test_grad_cache_evict(void);
+
+void test_grad_cache_reuse(void)
+{
+    _lv_grad_cache_clean();
+
+    _lv_grad_t * g1 = _lv_grad_get(lv_color_hex(0xff0000), lv_color_hex(0x0000ff), 0, 255, 100);
+    TEST_ASSERT_NOT_NULL(g1);
+    TEST_ASSERT_EQUAL(1, g1->cached);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_hex(0xff0000).full, g1->map[0].full);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_hex(0x0000ff).full, g1->map[99].full);
+    _lv_grad_release(g1);
+
+    _lv_grad_t * g2 = _lv_grad_get(lv_color_hex(0xff0000), lv_color_hex(0x0000ff), 0, 255, 100);
+    TEST_ASSERT_EQUAL_PTR(g1, g2);
+    _lv_grad_release(g2);
+
+    /*Other stops need other colors*/
+    g2 = _lv_grad_get(lv_color_hex(0xff0000), lv_color_hex(0x0000ff), 50, 255, 100);
+    TEST_ASSERT_TRUE(g1 != g2);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_hex(0xff0000).full, g2->map[19].full);
+    _lv_grad_release(g2);
+}
+
+void test_grad_cache_too_large(void)
+{
+    lv_coord_t size = LV_GRAD_CACHE_DEF_SIZE / sizeof(lv_color_t) + 1;
+    _lv_grad_t * g = _lv_grad_get(lv_color_hex(0x102030), lv_color_hex(0x302010), 0, 255, size);
+    TEST_ASSERT_NOT_NULL(g);
+    TEST_ASSERT_EQUAL(0, g->cached);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_hex(0x302010).full, g->map[size - 1].full);
+    _lv_grad_release(g);
+}
+
+void test_grad_cache_evict(void)
+{
+    _lv_grad_cache_clean();
+
+    /*Fill the cache with many gradients. The least recently used ones should be dropped.*/
+    _lv_grad_t * g = _lv_grad_get(lv_color_hex(0x000000), lv_color_hex(0xffffff), 0, 255, 200);
+    _lv_grad_release(g);
+
+    uint32_t i;
+    for(i = 1; i < _LV_GRAD_CACHE_MAX_NUM * 2; i++) {
+        g = _lv_grad_get(lv_color_hex(i), lv_color_hex(0xffffff), 0, 255, 200);
+        TEST_ASSERT_NOT_NULL(g);
+        TEST_ASSERT_EQUAL(1, g->cached);
+        _lv_grad_release(g);
+    }
+
+    uint32_t used = 0;
+    uint32_t cnt = 0;
+    for(i = 0; i < _LV_GRAD_CACHE_MAX_NUM; i++) {
+        g = LV_GC_ROOT(_lv_grad_cache)[i];
+        if(g == NULL) continue;
+        TEST_ASSERT_TRUE(g->main_color.full != lv_color_hex(0x000000).full);
+        used += g->mem_size;
+        cnt++;
+    }
+    TEST_ASSERT_GREATER_THAN(0, cnt);
+    TEST_ASSERT_LESS_OR_EQUAL(LV_GRAD_CACHE_DEF_SIZE, used);
+}
+
+#endif
@@ -0,0 +1,95 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_mask_span_radius(void);
+void test_mask_span_fade(void);
+
+/*Check that the spans match the mask calculated pixel by pixel*/
+static void check_rows(lv_coord_t x, lv_coord_t y1, lv_coord_t y2, lv_coord_t len)
+{
+    static lv_opa_t mask_buf[400];
+    lv_coord_t y;
+    for(y = y1; y <= y2; y++) {
+        lv_draw_mask_span_t span;
+        lv_draw_mask_res_t span_res = lv_draw_mask_get_span(x, y, len, &span);
+
+        lv_memset_ff(mask_buf, len);
+        lv_draw_mask_res_t res = lv_draw_mask_apply(mask_buf, x, y, len);
+        if(res == LV_DRAW_MASK_RES_TRANSP) lv_memset_00(mask_buf, len);
+        if(span_res == LV_DRAW_MASK_RES_TRANSP) {
+            span.x1 = x + len;
+            span.x2 = x + len - 1;
+            span.cover_x1 = span.x2 + 1;
+            span.cover_x2 = span.x2;
+        }
+
+        lv_coord_t i;
+        for(i = 0; i < len; i++) {
+            lv_coord_t abs_x = x + i;
+            if(abs_x < span.x1 || abs_x > span.x2) {
+                TEST_ASSERT_EQUAL_UINT8(LV_OPA_TRANSP, mask_buf[i]);
+            }
+            else if(abs_x >= span.cover_x1 && abs_x <= span.cover_x2) {
+                TEST_ASSERT_EQUAL_UINT8(LV_OPA_COVER, mask_buf[i]);
+            }
+        }
+    }
+}
+
+void test_mask_span_radius(void)
+{
+    lv_coord_t r;
+    for(r = 0; r < 80; r += 7) {
+        lv_area_t rect;
+        lv_area_set(&rect, 20, 10, 180, 190);
+        lv_draw_mask_radius_param_t param;
+        lv_draw_mask_radius_init(&param, &rect, r, false);
+        int16_t id = lv_draw_mask_add(&param, NULL);
+
+        check_rows(0, 0, 200, 200);
+        check_rows(100, 0, 200, 100);
+
+        /*The middle of the rectangle should be fully covered in one span*/
+        lv_draw_mask_span_t span;
+        TEST_ASSERT_EQUAL(LV_DRAW_MASK_RES_CHANGED, lv_draw_mask_get_span(0, 100, 200, &span));
+        TEST_ASSERT_EQUAL(20, span.x1);
+        TEST_ASSERT_EQUAL(180, span.x2);
+        TEST_ASSERT_EQUAL(20, span.cover_x1);
+        TEST_ASSERT_EQUAL(180, span.cover_x2);
+
+        /*With a second radius mask*/
+        lv_draw_mask_radius_param_t param2;
+        lv_area_set(&rect, 60, 50, 250, 120);
+        lv_draw_mask_radius_init(&param2, &rect, r / 2, false);
+        int16_t id2 = lv_draw_mask_add(&param2, NULL);
+        check_rows(0, 0, 200, 300);
+        lv_draw_mask_remove_id(id2);
+
+        lv_draw_mask_remove_id(id);
+    }
+}
+
+void test_mask_span_fade(void)
+{
+    lv_area_t coords;
+    lv_area_set(&coords, 30, 20, 150, 160);
+    lv_draw_mask_fade_param_t fade;
+    lv_draw_mask_fade_init(&fade, &coords, LV_OPA_TRANSP, 40, LV_OPA_COVER, 120);
+    int16_t id = lv_draw_mask_add(&fade, NULL);
+    check_rows(0, 0, 200, 200);
+    check_rows(30, 0, 200, 170);
+
+    lv_area_t rect;
+    lv_area_set(&rect, 0, 0, 199, 199);
+    lv_draw_mask_radius_param_t param;
+    lv_draw_mask_radius_init(&param, &rect, 50, false);
+    int16_t id2 = lv_draw_mask_add(&param, NULL);
+    check_rows(0, 0, 200, 200);
+
+    lv_draw_mask_remove_id(id2);
+    lv_draw_mask_remove_id(id);
+}
+
+#endif
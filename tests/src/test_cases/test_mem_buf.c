@@ -0,0 +1,212 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_mem_buf_arena(void);
+void test_mem_buf_invalid_release(void);
+void test_mem_buf_realloc(void);
+void test_mem_buf_shrink(void);
+
+void test_mem_buf_arena(void)
+{
+    lv_mem_buf_monitor_t mon;
+    lv_mem_buf_free_all();
+    lv_mem_buf_monitor(&mon);
+    uint32_t fallback_cnt = mon.fallback_cnt;
+    uint32_t ooo_release_cnt = mon.ooo_release_cnt;
+
+    /*There is no arena yet so the buffers are allocated from the heap*/
+    uint8_t * b1 = lv_mem_buf_get(100);
+    uint8_t * b2 = lv_mem_buf_get(200);
+    TEST_ASSERT_NOT_NULL(b1);
+    TEST_ASSERT_NOT_NULL(b2);
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_EQUAL(fallback_cnt + 2, mon.fallback_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(300, mon.used);
+    lv_mem_buf_release(b2);
+    lv_mem_buf_release(b1);
+
+    /*The arena is allocated for the largest usage of the frame*/
+    _lv_mem_buf_frame_end();
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_GREATER_OR_EQUAL(300, mon.arena_size);
+    TEST_ASSERT_EQUAL(mon.max_used, mon.arena_size);
+    TEST_ASSERT_EQUAL(0, mon.used);
+    fallback_cnt = mon.fallback_cnt;
+
+    /*Released in reverse order the same memory is reused*/
+    b1 = lv_mem_buf_get(100);
+    b2 = lv_mem_buf_get(200);
+    lv_mem_buf_release(b2);
+    uint8_t * b3 = lv_mem_buf_get(150);
+    TEST_ASSERT_EQUAL_PTR(b2, b3);
+    lv_mem_buf_release(b3);
+    lv_mem_buf_release(b1);
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_EQUAL(0, mon.used);
+    TEST_ASSERT_EQUAL(fallback_cnt, mon.fallback_cnt);
+
+    /*Released out of order the memory is reclaimed when the buffers after it are released too*/
+    b1 = lv_mem_buf_get(100);
+    b2 = lv_mem_buf_get(100);
+    lv_mem_buf_release(b1);
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_EQUAL(ooo_release_cnt + 1, mon.ooo_release_cnt);
+    TEST_ASSERT_NOT_EQUAL(0, mon.used);
+    lv_mem_buf_release(b2);
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_EQUAL(0, mon.used);
+
+    /*Too large buffers are allocated from the heap and the arena grows at the end of the frame*/
+    uint32_t arena_size = mon.arena_size;
+    b1 = lv_mem_buf_get(arena_size * 2);
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_EQUAL(fallback_cnt + 1, mon.fallback_cnt);
+    lv_memset_ff(b1, arena_size * 2);
+    lv_mem_buf_release(b1);
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_EQUAL(0, mon.used);
+
+    _lv_mem_buf_frame_end();
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_GREATER_THAN(arena_size * 2, mon.arena_size);
+
+    lv_mem_buf_free_all();
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_EQUAL(0, mon.arena_size);
+}
+
+void test_mem_buf_invalid_release(void)
+{
+    lv_mem_buf_monitor_t mon;
+    lv_mem_buf_free_all();
+    lv_mem_buf_release(lv_mem_buf_get(200));
+    _lv_mem_buf_frame_end();
+    lv_mem_buf_monitor(&mon);
+    uint32_t invalid_cnt = mon.invalid_release_cnt;
+
+    /*A buffer held across the end of the frame is invalid and it's not freed*/
+    uint8_t * b1 = lv_mem_buf_get(100);
+    _lv_mem_buf_frame_end();
+    lv_mem_buf_release(b1);
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_EQUAL(invalid_cnt + 1, mon.invalid_release_cnt);
+    TEST_ASSERT_EQUAL(0, mon.used);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+
+    /*The arena is still usable from the same place*/
+    uint8_t * b2 = lv_mem_buf_get(100);
+    TEST_ASSERT_EQUAL_PTR(b1, b2);
+    lv_mem_buf_release(b2);
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_EQUAL(invalid_cnt + 1, mon.invalid_release_cnt);
+    TEST_ASSERT_EQUAL(0, mon.used);
+
+    /*Double release of the last buffer and of a buffer in the middle*/
+    lv_mem_buf_release(b2);
+    b1 = lv_mem_buf_get(50);
+    b2 = lv_mem_buf_get(50);
+    lv_mem_buf_release(b1);
+    lv_mem_buf_release(b1);
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_EQUAL(invalid_cnt + 3, mon.invalid_release_cnt);
+    lv_mem_buf_release(b2);
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_EQUAL(0, mon.used);
+
+    /*A buffer from the heap can be released later but only once*/
+    b1 = lv_mem_buf_get(mon.arena_size * 2);
+    _lv_mem_buf_frame_end();
+    lv_mem_buf_release(b1);
+    lv_mem_buf_release(b1);
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_EQUAL(invalid_cnt + 4, mon.invalid_release_cnt);
+    TEST_ASSERT_EQUAL(0, mon.used);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+
+    /*Buffers held when the arena is freed*/
+    b1 = lv_mem_buf_get(100);
+    lv_mem_buf_free_all();
+    lv_mem_buf_release(b1);
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_EQUAL(invalid_cnt + 5, mon.invalid_release_cnt);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+}
+
+void test_mem_buf_realloc(void)
+{
+    lv_mem_buf_monitor_t mon;
+    lv_mem_buf_free_all();
+    lv_mem_buf_release(lv_mem_buf_get(1000));
+    _lv_mem_buf_frame_end();
+    lv_mem_buf_monitor(&mon);
+    uint32_t ooo_release_cnt = mon.ooo_release_cnt;
+
+    /*The last buffer grows in place*/
+    uint8_t * b1 = lv_mem_buf_realloc(NULL, 10);
+    lv_memset(b1, 0xaa, 10);
+    uint8_t * b2 = lv_mem_buf_realloc(b1, 100);
+    TEST_ASSERT_EQUAL_PTR(b1, b2);
+    b2 = lv_mem_buf_realloc(b1, 200);
+    TEST_ASSERT_EQUAL_PTR(b1, b2);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0xaa, b2, 10);
+
+    /*Other buffers are moved and the content is kept*/
+    uint8_t * b3 = lv_mem_buf_get(10);
+    b1 = lv_mem_buf_realloc(b2, 300);
+    TEST_ASSERT_NOT_EQUAL(b2, b1);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0xaa, b1, 10);
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_EQUAL(ooo_release_cnt + 1, mon.ooo_release_cnt);
+
+    lv_mem_buf_release(b1);
+    lv_mem_buf_release(b3);
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_EQUAL(0, mon.used);
+
+    /*Growing a buffer item by item doesn't waste the arena*/
+    uint32_t i;
+    b1 = NULL;
+    for(i = 1; i <= 50; i++) b1 = lv_mem_buf_realloc(b1, i * 16);
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_LESS_THAN(50 * 16 + 64, mon.used);
+    lv_mem_buf_release(b1);
+}
+
+void test_mem_buf_shrink(void)
+{
+    lv_mem_buf_monitor_t mon;
+    lv_mem_buf_free_all();
+
+    /*The arena grows only up to the max size*/
+    lv_mem_buf_release(lv_mem_buf_get(LV_MEM_BUF_ARENA_MAX_SIZE + 100));
+    _lv_mem_buf_frame_end();
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_EQUAL(LV_MEM_BUF_ARENA_MAX_SIZE, mon.arena_size);
+
+    /*Kept if the usage is only a little lower*/
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        lv_mem_buf_release(lv_mem_buf_get(LV_MEM_BUF_ARENA_MAX_SIZE / 2 + 100));
+        _lv_mem_buf_frame_end();
+    }
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_EQUAL(LV_MEM_BUF_ARENA_MAX_SIZE, mon.arena_size);
+
+    /*Shrunk after many light frames*/
+    for(i = 0; i < 100; i++) {
+        lv_mem_buf_release(lv_mem_buf_get(i % 2 ? 100 : 200));
+        _lv_mem_buf_frame_end();
+    }
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_GREATER_OR_EQUAL(200, mon.arena_size);
+    TEST_ASSERT_LESS_THAN(300, mon.arena_size);
+
+    /*Freed if not used at all*/
+    for(i = 0; i < 100; i++) _lv_mem_buf_frame_end();
+    lv_mem_buf_monitor(&mon);
+    TEST_ASSERT_EQUAL(0, mon.arena_size);
+}
+
+#endif
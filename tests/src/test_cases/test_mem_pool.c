@@ -0,0 +1,60 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_mem_pool_expand(void);
+void test_mem_pool_add(void);
+
+void test_mem_pool_expand(void)
+{
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon_start);
+    uint32_t pool_cnt = lv_mem_get_pool_cnt();
+    TEST_ASSERT_GREATER_OR_EQUAL(1, pool_cnt);
+
+    /*Larger than the first pool so a new pool is added for it*/
+    uint8_t * p = lv_mem_alloc(LV_MEM_SIZE + 1024);
+    TEST_ASSERT_NOT_NULL(p);
+    lv_memset_ff(p, LV_MEM_SIZE + 1024);
+    TEST_ASSERT_EQUAL(pool_cnt + 1, lv_mem_get_pool_cnt());
+
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_GREATER_THAN(mon_start.total_size + LV_MEM_SIZE, mon.total_size);
+
+    lv_mem_monitor_t pool_mon;
+    lv_mem_monitor_pool(pool_cnt, &pool_mon);
+    TEST_ASSERT_GREATER_OR_EQUAL(LV_MEM_SIZE + 1024, pool_mon.total_size);
+    TEST_ASSERT_EQUAL(1, pool_mon.used_cnt);
+
+    /*Grow it in the new pool*/
+    p = lv_mem_realloc(p, LV_MEM_SIZE + 100 * 1024);
+    TEST_ASSERT_NOT_NULL(p);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+
+    lv_mem_free(p);
+    lv_mem_monitor_pool(pool_cnt, &pool_mon);
+    TEST_ASSERT_EQUAL(0, pool_mon.used_cnt);
+
+    /*The pools can't grow above LV_MEM_POOL_MAX_SIZE*/
+    p = lv_mem_alloc(LV_MEM_POOL_MAX_SIZE);
+    TEST_ASSERT_NULL(p);
+}
+
+void test_mem_pool_add(void)
+{
+    static uint64_t buf[4096];
+    uint32_t pool_cnt = lv_mem_get_pool_cnt();
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_mem_add_pool((uint8_t *)buf + 1, sizeof(buf) - 8));
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_add_pool(buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL(pool_cnt + 1, lv_mem_get_pool_cnt());
+
+    lv_mem_monitor_t pool_mon;
+    lv_mem_monitor_pool(pool_cnt, &pool_mon);
+    TEST_ASSERT_EQUAL(sizeof(buf), pool_mon.total_size);
+    TEST_ASSERT_GREATER_THAN(sizeof(buf) - 256, pool_mon.free_biggest_size);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+}
+
+#endif
@@ -0,0 +1,99 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <string.h>
+
+void test_mem_tag_alloc_free(void);
+void test_mem_tag_push(void);
+void test_mem_tag_obj(void);
+
+void test_mem_tag_alloc_free(void)
+{
+    lv_mem_tag_monitor_t mon_start;
+    lv_mem_tag_monitor_t mon;
+    lv_mem_tag_monitor(LV_MEM_TAG_OTHER, &mon_start);
+
+    uint8_t * p = lv_mem_alloc(100);
+    TEST_ASSERT_NOT_NULL(p);
+    lv_mem_tag_monitor(LV_MEM_TAG_OTHER, &mon);
+    TEST_ASSERT_EQUAL(mon_start.live_size + 100, mon.live_size);
+    TEST_ASSERT_EQUAL(mon_start.live_cnt + 1, mon.live_cnt);
+    TEST_ASSERT_EQUAL(mon_start.alloc_cnt + 1, mon.alloc_cnt);
+
+    /*The call site of this test is tracked*/
+    const lv_mem_tag_site_t * site = NULL;
+    uint32_t i;
+    for(i = 0; i < lv_mem_tag_get_site_cnt(); i++) {
+        const lv_mem_tag_site_t * s = lv_mem_tag_get_site(i);
+        if(strcmp(s->file, __FILE__) == 0 && s->mon.live_size == 100) site = s;
+    }
+    TEST_ASSERT_NOT_NULL(site);
+    TEST_ASSERT_EQUAL(LV_MEM_TAG_OTHER, site->tag);
+    TEST_ASSERT_EQUAL(1, site->mon.live_cnt);
+
+    p = lv_mem_realloc(p, 300);
+    TEST_ASSERT_NOT_NULL(p);
+    lv_mem_tag_monitor(LV_MEM_TAG_OTHER, &mon);
+    TEST_ASSERT_EQUAL(mon_start.live_size + 300, mon.live_size);
+    TEST_ASSERT_EQUAL(mon_start.live_cnt + 1, mon.live_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(mon_start.live_size + 300, mon.peak_size);
+    TEST_ASSERT_EQUAL(0, site->mon.live_size);
+
+    lv_mem_free(p);
+    lv_mem_tag_monitor(LV_MEM_TAG_OTHER, &mon);
+    TEST_ASSERT_EQUAL(mon_start.live_size, mon.live_size);
+    TEST_ASSERT_EQUAL(mon_start.live_cnt, mon.live_cnt);
+    TEST_ASSERT_EQUAL(mon_start.alloc_cnt + 2, mon.alloc_cnt);
+
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+}
+
+void test_mem_tag_push(void)
+{
+    lv_mem_tag_monitor_t mon_start;
+    lv_mem_tag_monitor_t mon;
+    lv_mem_tag_monitor(LV_MEM_TAG_FONT, &mon_start);
+
+    LV_MEM_TAG_PUSH(LV_MEM_TAG_FONT);
+    void * p = lv_mem_alloc(64);
+    LV_MEM_TAG_POP();
+
+    lv_mem_tag_monitor(LV_MEM_TAG_FONT, &mon);
+    TEST_ASSERT_EQUAL(mon_start.live_size + 64, mon.live_size);
+
+    lv_mem_free(p);
+    lv_mem_tag_monitor(LV_MEM_TAG_FONT, &mon);
+    TEST_ASSERT_EQUAL(mon_start.live_size, mon.live_size);
+
+    TEST_ASSERT_EQUAL_STRING("font", lv_mem_tag_get_name(LV_MEM_TAG_FONT));
+}
+
+void test_mem_tag_obj(void)
+{
+    lv_mem_tag_monitor_t obj_start;
+    lv_mem_tag_monitor_t text_start;
+    lv_mem_tag_monitor_t mon;
+    lv_mem_tag_monitor(LV_MEM_TAG_OBJ, &obj_start);
+    lv_mem_tag_monitor(LV_MEM_TAG_TEXT, &text_start);
+
+    /*Use a new screen because the active screen keeps the memory allocated for its children*/
+    lv_obj_t * parent = lv_obj_create(NULL);
+    lv_obj_t * label = lv_label_create(parent);
+    lv_label_set_text(label, "Hello world");
+
+    lv_mem_tag_monitor(LV_MEM_TAG_OBJ, &mon);
+    TEST_ASSERT_GREATER_THAN(obj_start.live_size, mon.live_size);
+    lv_mem_tag_monitor(LV_MEM_TAG_TEXT, &mon);
+    TEST_ASSERT_GREATER_OR_EQUAL(text_start.live_size + sizeof("Hello world"), mon.live_size);
+
+    lv_mem_tag_dump();
+
+    lv_obj_del(parent);
+    lv_mem_tag_monitor(LV_MEM_TAG_OBJ, &mon);
+    TEST_ASSERT_EQUAL(obj_start.live_size, mon.live_size);
+    lv_mem_tag_monitor(LV_MEM_TAG_TEXT, &mon);
+    TEST_ASSERT_EQUAL(text_start.live_size, mon.live_size);
+}
+
+#endif
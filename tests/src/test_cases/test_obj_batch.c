@@ -0,0 +1,271 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_obj_batch_same_result(void);
+void test_obj_batch_deferred_work(void);
+void test_obj_batch_style_order(void);
+void test_obj_batch_remove_style(void);
+
+#define MAX_OBJ     4000
+
+typedef struct {
+    lv_area_t coords;
+    lv_coord_t ext_draw_size;
+}obj_info_t;
+
+typedef struct {
+    uint32_t theme_apply;
+    uint32_t style_changed;
+    uint32_t ext_draw_size;
+    uint32_t layout_changed;
+}counters_t;
+
+static obj_info_t infos[2][MAX_OBJ];
+static uint32_t info_cnt[2];
+static counters_t counters;
+static uint32_t obj_cnt;
+static lv_theme_t test_theme;
+
+static void count_event_cb(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    if(code == LV_EVENT_STYLE_CHANGED) counters.style_changed++;
+    else if(code == LV_EVENT_REFR_EXT_DRAW_SIZE) counters.ext_draw_size++;
+    else if(code == LV_EVENT_LAYOUT_CHANGED) counters.layout_changed++;
+}
+
+/*Count the events of an object. The theme is applied before the constructor so it's the earliest point.
+ *In a batch it's applied at the end so the objects are tracked after their creation too.*/
+static lv_obj_t * track(lv_obj_t * obj)
+{
+    if(lv_obj_get_user_data(obj) == &counters) return obj;
+
+    lv_obj_set_user_data(obj, &counters);
+    lv_obj_add_event_cb(obj, count_event_cb, LV_EVENT_ALL, NULL);
+    obj_cnt++;
+    return obj;
+}
+
+static void count_theme_apply_cb(lv_theme_t * th, lv_obj_t * obj)
+{
+    LV_UNUSED(th);
+    counters.theme_apply++;
+    if(lv_obj_get_parent(obj)) track(obj);
+}
+
+static void create_screen(uint32_t row_cnt)
+{
+    lv_obj_t * cont = track(lv_obj_create(lv_scr_act()));
+    lv_obj_set_size(cont, lv_pct(100), lv_pct(100));
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < row_cnt; i++) {
+        lv_obj_t * row = track(lv_obj_create(cont));
+        lv_obj_set_size(row, lv_pct(100), LV_SIZE_CONTENT);
+        lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
+
+        lv_obj_t * label = track(lv_label_create(row));
+        lv_label_set_text_fmt(label, "Row %d", (int)i);
+
+        lv_obj_t * btn = track(lv_btn_create(row));
+        label = track(lv_label_create(btn));
+        lv_label_set_text(label, "Button");
+
+        track(lv_slider_create(row));
+        track(lv_switch_create(row));
+        track(lv_checkbox_create(row));
+    }
+}
+
+/*Use the default theme but count how many times it's applied*/
+static void count_theme_init(void)
+{
+    lv_theme_t * th_def = lv_disp_get_theme(NULL);
+    if(th_def == &test_theme) th_def = test_theme.parent;   /*Not removed by a failed test*/
+    test_theme = *th_def;
+    lv_theme_set_parent(&test_theme, th_def);
+    lv_theme_set_apply_cb(&test_theme, count_theme_apply_cb);
+    lv_disp_set_theme(NULL, &test_theme);
+}
+
+static void count_theme_deinit(void)
+{
+    lv_disp_set_theme(NULL, test_theme.parent);
+}
+
+static void counters_reset(void)
+{
+    lv_memset_00(&counters, sizeof(counters));
+    obj_cnt = 0;
+}
+
+static void save_info(lv_obj_t * obj, uint32_t idx)
+{
+    TEST_ASSERT_FALSE(obj->batch_pending);
+    TEST_ASSERT_LESS_THAN(MAX_OBJ, info_cnt[idx]);
+    lv_area_copy(&infos[idx][info_cnt[idx]].coords, &obj->coords);
+    infos[idx][info_cnt[idx]].ext_draw_size = _lv_obj_get_ext_draw_size(obj);
+    info_cnt[idx]++;
+
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+        save_info(lv_obj_get_child(obj, i), idx);
+    }
+}
+
+void test_obj_batch_same_result(void)
+{
+    create_screen(20);
+    lv_obj_update_layout(lv_scr_act());
+    info_cnt[0] = 0;
+    save_info(lv_scr_act(), 0);
+    lv_obj_clean(lv_scr_act());
+
+    lv_obj_batch_begin();
+    lv_obj_batch_begin();
+    TEST_ASSERT_TRUE(lv_obj_is_batch_active());
+    create_screen(20);
+    lv_obj_batch_end();
+    TEST_ASSERT_TRUE(lv_obj_is_batch_active());
+    TEST_ASSERT_TRUE(lv_obj_get_child(lv_scr_act(), 0)->batch_pending);
+    lv_obj_batch_end();
+    TEST_ASSERT_FALSE(lv_obj_is_batch_active());
+
+    lv_obj_update_layout(lv_scr_act());
+    info_cnt[1] = 0;
+    save_info(lv_scr_act(), 1);
+
+    TEST_ASSERT_EQUAL(info_cnt[0], info_cnt[1]);
+    uint32_t i;
+    for(i = 0; i < info_cnt[0]; i++) {
+        TEST_ASSERT_EQUAL(infos[0][i].coords.x1, infos[1][i].coords.x1);
+        TEST_ASSERT_EQUAL(infos[0][i].coords.y1, infos[1][i].coords.y1);
+        TEST_ASSERT_EQUAL(infos[0][i].coords.x2, infos[1][i].coords.x2);
+        TEST_ASSERT_EQUAL(infos[0][i].coords.y2, infos[1][i].coords.y2);
+        TEST_ASSERT_EQUAL(infos[0][i].ext_draw_size, infos[1][i].ext_draw_size);
+    }
+
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_obj_batch_deferred_work(void)
+{
+    count_theme_init();
+
+    /*Without a batch the setters refresh the style of the new objects again and again*/
+    counters_reset();
+    create_screen(20);
+    lv_obj_update_layout(lv_scr_act());
+    counters_t normal = counters;
+    TEST_ASSERT_EQUAL(obj_cnt, normal.theme_apply);
+    TEST_ASSERT_GREATER_THAN(obj_cnt, normal.style_changed);
+    TEST_ASSERT_GREATER_OR_EQUAL(obj_cnt, normal.ext_draw_size);
+    TEST_ASSERT_NOT_EQUAL(0, normal.layout_changed);
+    lv_obj_clean(lv_scr_act());
+
+    /*In a batch nothing is applied or refreshed until the end*/
+    counters_reset();
+    lv_obj_batch_begin();
+    create_screen(20);
+    TEST_ASSERT_EQUAL(0, counters.theme_apply);
+    TEST_ASSERT_EQUAL(0, counters.style_changed);
+    TEST_ASSERT_EQUAL(0, counters.ext_draw_size);
+    TEST_ASSERT_EQUAL(1, lv_obj_get_child(lv_scr_act(), 0)->style_cnt);   /*Only the local style*/
+
+    /*Every object is themed and refreshed once at the end*/
+    lv_obj_batch_end();
+    TEST_ASSERT_EQUAL(obj_cnt, counters.theme_apply);
+    TEST_ASSERT_EQUAL(obj_cnt, counters.style_changed);
+    TEST_ASSERT_EQUAL(obj_cnt, counters.ext_draw_size);
+    TEST_ASSERT_EQUAL(0, counters.layout_changed);
+
+    /*The layout is updated as usual*/
+    lv_obj_update_layout(lv_scr_act());
+    TEST_ASSERT_EQUAL(normal.layout_changed, counters.layout_changed);
+
+    lv_obj_clean(lv_scr_act());
+    count_theme_deinit();
+}
+
+static void create_styled_btn(lv_obj_t * parent, lv_style_t * style)
+{
+    lv_obj_t * btn = lv_btn_create(parent);
+    lv_obj_set_style_radius(btn, 3, 0);
+    lv_obj_add_style(btn, style, 0);
+    lv_obj_add_style(btn, style, LV_STATE_PRESSED);
+}
+
+void test_obj_batch_style_order(void)
+{
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_bg_color(&style, lv_color_hex(0xff0000));
+
+    /*The styles added in a batch override the theme as if it was applied on creation*/
+    create_styled_btn(lv_scr_act(), &style);
+    lv_obj_t * btn1 = lv_obj_get_child(lv_scr_act(), 0);
+
+    /*Add a style of the theme too*/
+    lv_style_t * theme_style = btn1->styles[btn1->style_cnt - 1].style;
+    lv_obj_add_style(btn1, theme_style, LV_STATE_CHECKED);
+
+    lv_obj_batch_begin();
+    create_styled_btn(lv_scr_act(), &style);
+    lv_obj_t * btn2 = lv_obj_get_child(lv_scr_act(), 1);
+    lv_obj_add_style(btn2, theme_style, LV_STATE_CHECKED);
+    lv_obj_batch_end();
+    TEST_ASSERT_EQUAL(btn1->style_cnt, btn2->style_cnt);
+    uint32_t i;
+    for(i = 0; i < btn1->style_cnt; i++) {
+        TEST_ASSERT_EQUAL(btn1->styles[i].selector, btn2->styles[i].selector);
+        TEST_ASSERT_EQUAL(btn1->styles[i].is_local, btn2->styles[i].is_local);
+        if(!btn1->styles[i].is_local) TEST_ASSERT_EQUAL_PTR(btn1->styles[i].style, btn2->styles[i].style);
+    }
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_bg_color(btn2, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(3, lv_obj_get_style_radius(btn2, LV_PART_MAIN));
+
+    /*The button is a user of the style only once, so it's not referenced after deleting it*/
+    lv_obj_del(btn1);
+    lv_obj_del(btn2);
+    lv_style_set_bg_color(&style, lv_color_hex(0x00ff00));
+    lv_obj_report_style_change(&style);
+
+    lv_style_reset(&style);
+}
+
+void test_obj_batch_remove_style(void)
+{
+    count_theme_init();
+    counters_reset();
+
+    /*The theme is not applied at all if all the styles are removed*/
+    lv_obj_batch_begin();
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_batch_end();
+    TEST_ASSERT_EQUAL(0, counters.theme_apply);
+    TEST_ASSERT_EQUAL(1, obj->style_cnt);
+    TEST_ASSERT_EQUAL(0, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    /*If some styles are removed the theme is applied first*/
+    uint32_t i;
+    lv_obj_batch_begin();
+    lv_obj_t * slider = lv_slider_create(lv_scr_act());
+    lv_obj_remove_style(slider, NULL, LV_PART_KNOB | LV_STATE_ANY);
+    TEST_ASSERT_EQUAL(1, counters.theme_apply);
+    lv_obj_batch_end();
+    TEST_ASSERT_EQUAL(1, counters.theme_apply);
+    for(i = 0; i < slider->style_cnt; i++) {
+        TEST_ASSERT_NOT_EQUAL(LV_PART_KNOB, lv_obj_style_get_selector_part(slider->styles[i].selector));
+    }
+    TEST_ASSERT_NOT_EQUAL(0, slider->style_cnt);
+
+    lv_obj_clean(lv_scr_act());
+    count_theme_deinit();
+}
+
+#endif
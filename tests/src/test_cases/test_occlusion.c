@@ -0,0 +1,86 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_occlusion_covered_parts_skipped(void);
+void test_occlusion_keep_visible_parts(void);
+
+extern lv_color_t test_fb[];
+
+static lv_obj_t * panel_create(lv_obj_t * parent, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h,
+                               lv_color_t color)
+{
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(obj, color, 0);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+    return obj;
+}
+
+static lv_color_t px_get(lv_coord_t x, lv_coord_t y)
+{
+    return test_fb[y * 800 + x];
+}
+
+static void render(lv_refr_overdraw_t * od)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    lv_refr_get_overdraw(od);
+}
+
+void test_occlusion_covered_parts_skipped(void)
+{
+    /*A full screen background with opaque panels stacked on it*/
+    lv_obj_t * bg = panel_create(lv_scr_act(), 0, 0, 800, 480, lv_color_hex(0x808080));
+    lv_obj_t * p1 = panel_create(bg, 0, 0, 800, 240, lv_color_hex(0xff0000));
+    panel_create(p1, 100, 50, 200, 100, lv_color_hex(0x00ff00));
+    panel_create(bg, 0, 240, 800, 240, lv_color_hex(0x0000ff));
+
+    lv_refr_overdraw_t od;
+    render(&od);
+    TEST_ASSERT_EQUAL(800 * 480, od.px_refr);
+#if LV_USE_OCCLUSION_CULLING
+    /*The background is fully covered by the panels*/
+    TEST_ASSERT_GREATER_OR_EQUAL(800 * 480, od.px_culled);
+#endif
+
+    TEST_ASSERT_EQUAL_HEX32(lv_color_hex(0xff0000).full, px_get(10, 10).full);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_hex(0x00ff00).full, px_get(150, 100).full);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_hex(0x0000ff).full, px_get(10, 300).full);
+
+    lv_obj_del(bg);
+}
+
+void test_occlusion_keep_visible_parts(void)
+{
+    lv_obj_t * red = panel_create(lv_scr_act(), 0, 0, 800, 200, lv_color_hex(0xff0000));
+    lv_obj_t * blue = panel_create(lv_scr_act(), 0, 100, 800, 200, lv_color_hex(0x0000ff));
+
+    /*The not covered part of the red panel should be still drawn*/
+    lv_refr_overdraw_t od;
+    render(&od);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_hex(0xff0000).full, px_get(400, 99).full);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_hex(0x0000ff).full, px_get(400, 100).full);
+
+    /*A rounded panel doesn't cover its corners*/
+    lv_obj_set_style_radius(blue, 20, 0);
+    render(&od);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_hex(0xff0000).full, px_get(0, 100).full);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_hex(0x0000ff).full, px_get(400, 150).full);
+
+    /*A semi-transparent panel doesn't cover anything*/
+    lv_obj_set_style_radius(blue, 0, 0);
+    lv_obj_set_style_bg_opa(blue, LV_OPA_50, 0);
+    render(&od);
+    TEST_ASSERT_TRUE(px_get(400, 150).full != lv_color_hex(0x0000ff).full);
+    TEST_ASSERT_TRUE(px_get(400, 150).full != lv_color_hex(0xff0000).full);
+
+    lv_obj_del(red);
+    lv_obj_del(blue);
+}
+
+#endif
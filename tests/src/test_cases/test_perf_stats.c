@@ -0,0 +1,134 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_perf_stats_inv_px(void);
+void test_perf_stats_times(void);
+void test_perf_stats_percentiles(void);
+
+static uint32_t render_ms;
+static uint32_t layout_ms;
+
+/*Simulate slow drawing and layout by stepping the tick*/
+static void slow_event_cb(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    if(code == LV_EVENT_DRAW_MAIN) lv_tick_inc(render_ms);
+    else if(code == LV_EVENT_SIZE_CHANGED) lv_tick_inc(layout_ms);
+}
+
+static lv_obj_t * slow_obj_create(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_pos(obj, 10, 10);
+    lv_obj_set_size(obj, 100, 50);
+    lv_obj_add_event_cb(obj, slow_event_cb, LV_EVENT_ALL, NULL);
+    return obj;
+}
+
+void test_perf_stats_inv_px(void)
+{
+    render_ms = 0;
+    layout_ms = 0;
+    lv_obj_t * obj = slow_obj_create();
+    lv_refr_now(NULL);
+    lv_disp_reset_perf_stats(NULL);
+
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+
+    lv_disp_perf_stats_t stats;
+    lv_disp_get_perf_stats(NULL, &stats);
+    TEST_ASSERT_EQUAL(1, stats.frame_cnt);
+    TEST_ASSERT_EQUAL(100 * 50, stats.inv_px_last);
+    TEST_ASSERT_EQUAL(100 * 50, stats.inv_px_max);
+    TEST_ASSERT_EQUAL(100 * 50, stats.inv_px_avg);
+    TEST_ASSERT_LESS_OR_EQUAL(100, stats.cpu_idle);
+
+    /*Nothing is counted if nothing was redrawn*/
+    lv_refr_now(NULL);
+    lv_disp_get_perf_stats(NULL, &stats);
+    TEST_ASSERT_EQUAL(1, stats.frame_cnt);
+
+    lv_obj_del(obj);
+}
+
+void test_perf_stats_times(void)
+{
+    render_ms = 5;
+    layout_ms = 2;
+    lv_obj_t * obj = slow_obj_create();
+    lv_refr_now(NULL);
+    lv_disp_reset_perf_stats(NULL);
+    lv_disp_set_frame_deadline(NULL, 6);
+
+    /*Layout and render*/
+    lv_obj_set_width(obj, 120);
+    lv_refr_now(NULL);
+
+    const lv_disp_perf_data_t * data = lv_disp_get_perf_data(NULL);
+    TEST_ASSERT_EQUAL(1, data->frame_cnt);
+    TEST_ASSERT_EQUAL(1, data->layout[2]);
+    TEST_ASSERT_EQUAL(1, data->render[5]);
+    TEST_ASSERT_EQUAL(1, data->flush_wait[0]);
+    TEST_ASSERT_EQUAL(1, data->frame[7]);
+    TEST_ASSERT_EQUAL(1, data->jank_cnt);
+
+    /*Only render, within the deadline*/
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(2, data->frame_cnt);
+    TEST_ASSERT_EQUAL(1, data->layout[0]);
+    TEST_ASSERT_EQUAL(2, data->render[5]);
+    TEST_ASSERT_EQUAL(1, data->jank_cnt);
+
+    /*Too long frames go to the last bin*/
+    render_ms = LV_PERF_MONITOR_HIST_SIZE + 10;
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, data->render[LV_PERF_MONITOR_HIST_SIZE - 1]);
+    TEST_ASSERT_EQUAL(2, data->jank_cnt);
+
+    /*The deadline is kept on reset*/
+    lv_disp_reset_perf_stats(NULL);
+    TEST_ASSERT_EQUAL(0, data->frame_cnt);
+    TEST_ASSERT_EQUAL(6, data->deadline);
+
+    lv_disp_set_frame_deadline(NULL, 0);
+    lv_obj_del(obj);
+}
+
+void test_perf_stats_percentiles(void)
+{
+    layout_ms = 0;
+    lv_obj_t * obj = slow_obj_create();
+    lv_refr_now(NULL);
+    lv_disp_reset_perf_stats(NULL);
+
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        render_ms = i < 90 ? 1 : 20;
+        lv_obj_invalidate(obj);
+        lv_refr_now(NULL);
+    }
+
+    lv_disp_perf_stats_t stats;
+    lv_disp_get_perf_stats(NULL, &stats);
+    TEST_ASSERT_EQUAL(100, stats.frame_cnt);
+    TEST_ASSERT_EQUAL(1, stats.render.p50);
+    TEST_ASSERT_EQUAL(20, stats.render.p95);
+    TEST_ASSERT_EQUAL(20, stats.render.p99);
+    TEST_ASSERT_EQUAL(20, stats.render.max);
+    TEST_ASSERT_EQUAL(0, stats.layout.p99);
+    TEST_ASSERT_EQUAL(stats.render.p95, stats.frame.p95);
+
+    /*The refresh period is the default deadline*/
+    TEST_ASSERT_EQUAL(lv_disp_get_default()->refr_timer->period, stats.deadline);
+    TEST_ASSERT_EQUAL(stats.deadline < 20 ? 10 : 0, stats.jank_cnt);
+
+    lv_obj_del(obj);
+}
+
+#endif
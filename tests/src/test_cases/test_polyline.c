@@ -0,0 +1,305 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_polyline_joints(void);
+void test_polyline_clip(void);
+void test_polyline_dash(void);
+void test_polyline_line_widget(void);
+void test_polyline_chart(void);
+void test_polyline_chart_part_end(void);
+
+extern lv_color_t test_fb[];
+
+static lv_point_t points[4];
+static uint32_t point_cnt;
+static lv_draw_line_dsc_t line_dsc;
+static lv_area_t clip_limit;
+
+static void draw_event_cb(lv_event_t * e)
+{
+    const lv_area_t * clip_area = lv_event_get_param(e);
+    lv_area_t clip;
+    if(_lv_area_intersect(&clip, clip_area, &clip_limit) == false) return;
+    lv_draw_polyline(points, point_cnt, &clip, &line_dsc);
+}
+
+static void polyline_create(void)
+{
+    lv_obj_set_style_bg_color(lv_scr_act(), lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(lv_scr_act(), LV_OPA_COVER, 0);
+
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, 800, 480);
+    lv_obj_add_event_cb(obj, draw_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    lv_draw_line_dsc_init(&line_dsc);
+    line_dsc.color = lv_color_hex(0xff0000);
+    lv_area_set(&clip_limit, 0, 0, 799, 479);
+}
+
+static void render(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+static bool px_is(lv_coord_t x, lv_coord_t y, lv_color_t color)
+{
+    return test_fb[y * 800 + x].full == color.full;
+}
+
+/*The pixels inside the line can be a little anti-aliased*/
+static bool px_is_near(lv_coord_t x, lv_coord_t y, lv_color_t color)
+{
+    uint32_t c1 = lv_color_to32(test_fb[y * 800 + x]);
+    uint32_t c2 = lv_color_to32(color);
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        int32_t d = (int32_t)((c1 >> (i * 8)) & 0xff) - (int32_t)((c2 >> (i * 8)) & 0xff);
+        if(LV_ABS(d) > 16) return false;
+    }
+    return true;
+}
+
+void test_polyline_joints(void)
+{
+    polyline_create();
+    points[0].x = 100;
+    points[0].y = 100;
+    points[1].x = 200;
+    points[1].y = 100;
+    points[2].x = 200;
+    points[2].y = 200;
+    point_cnt = 3;
+    line_dsc.width = 10;
+    render();
+
+    TEST_ASSERT_TRUE(px_is(150, 100, line_dsc.color));
+    TEST_ASSERT_TRUE(px_is(200, 150, line_dsc.color));
+
+    /*The outer side of the joint is round*/
+    TEST_ASSERT_TRUE(px_is(202, 97, line_dsc.color));
+    TEST_ASSERT_TRUE(px_is(204, 95, lv_color_white()));
+
+    /*The ends are not rounded*/
+    TEST_ASSERT_TRUE(px_is(96, 100, lv_color_white()));
+    TEST_ASSERT_TRUE(px_is(200, 203, lv_color_white()));
+
+    line_dsc.round_start = 1;
+    line_dsc.round_end = 1;
+    render();
+    TEST_ASSERT_TRUE(px_is(96, 100, line_dsc.color));
+    TEST_ASSERT_TRUE(px_is(200, 203, line_dsc.color));
+    TEST_ASSERT_TRUE(px_is(202, 97, line_dsc.color));
+
+    /*A semi-transparent polyline is not darker on the joint*/
+    line_dsc.opa = LV_OPA_50;
+    render();
+    lv_color_t c = test_fb[100 * 800 + 150];
+    TEST_ASSERT_FALSE(px_is(150, 100, lv_color_white()));
+    TEST_ASSERT_TRUE(px_is(200, 100, c));
+    TEST_ASSERT_TRUE(px_is(198, 102, c));
+
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_polyline_clip(void)
+{
+    polyline_create();
+    points[0].x = 100;
+    points[0].y = 100;
+    points[1].x = 200;
+    points[1].y = 100;
+    points[2].x = 200;
+    points[2].y = 200;
+    point_cnt = 3;
+    line_dsc.width = 10;
+    lv_area_set(&clip_limit, 0, 0, 149, 479);
+    render();
+
+    TEST_ASSERT_TRUE(px_is(140, 100, line_dsc.color));
+    TEST_ASSERT_TRUE(px_is(149, 100, line_dsc.color));
+    TEST_ASSERT_TRUE(px_is(150, 100, lv_color_white()));
+    TEST_ASSERT_TRUE(px_is(200, 150, lv_color_white()));
+
+    /*Points out of the screen*/
+    points[0].x = -50;
+    points[0].y = 300;
+    points[1].x = 850;
+    points[1].y = 300;
+    points[2].x = 850;
+    points[2].y = 600;
+    lv_area_set(&clip_limit, 0, 0, 799, 479);
+    render();
+    TEST_ASSERT_TRUE(px_is(0, 300, line_dsc.color));
+    TEST_ASSERT_TRUE(px_is(400, 300, line_dsc.color));
+    TEST_ASSERT_TRUE(px_is(799, 300, line_dsc.color));
+    TEST_ASSERT_TRUE(px_is(400, 310, lv_color_white()));
+
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_polyline_dash(void)
+{
+    polyline_create();
+    points[0].x = 100;
+    points[0].y = 100;
+    points[1].x = 300;
+    points[1].y = 100;
+    points[2].x = 300;
+    points[2].y = 300;
+    point_cnt = 3;
+    line_dsc.width = 4;
+    line_dsc.dash_width = 10;
+    line_dsc.dash_gap = 10;
+    render();
+
+    /*The dashes are aligned to the screen*/
+    TEST_ASSERT_TRUE(px_is(105, 100, line_dsc.color));
+    TEST_ASSERT_TRUE(px_is(115, 100, lv_color_white()));
+    TEST_ASSERT_TRUE(px_is(300, 125, line_dsc.color));
+    TEST_ASSERT_TRUE(px_is(300, 135, lv_color_white()));
+
+    /*The inner joint is round with dashes too*/
+    TEST_ASSERT_TRUE(px_is(300, 99, line_dsc.color));
+
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_polyline_line_widget(void)
+{
+    lv_obj_set_style_bg_color(lv_scr_act(), lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(lv_scr_act(), LV_OPA_COVER, 0);
+
+    static lv_point_t line_points[] = {{0, 0}, {100, 0}, {100, 100}};
+    lv_obj_t * line = lv_line_create(lv_scr_act());
+    lv_line_set_points(line, line_points, 3);
+    lv_obj_set_pos(line, 100, 100);
+    lv_obj_set_style_line_width(line, 10, 0);
+    lv_obj_set_style_line_color(line, lv_color_hex(0x0000ff), 0);
+    render();
+
+    lv_color_t c = lv_color_hex(0x0000ff);
+    TEST_ASSERT_TRUE(px_is(150, 100, c));
+    TEST_ASSERT_TRUE(px_is(200, 150, c));
+    TEST_ASSERT_TRUE(px_is(202, 97, c));
+    TEST_ASSERT_TRUE(px_is(96, 100, lv_color_white()));
+
+    /*Rounded ends*/
+    lv_obj_set_style_line_rounded(line, true, 0);
+    render();
+    TEST_ASSERT_TRUE(px_is(96, 100, c));
+    TEST_ASSERT_TRUE(px_is(200, 203, c));
+    TEST_ASSERT_TRUE(px_is(202, 97, c));
+
+    /*Inverted y*/
+    lv_line_set_y_invert(line, true);
+    render();
+    /*The first segment is at the bottom of the widget now*/
+    lv_coord_t y = line->coords.y1 + lv_obj_get_height(line);
+    TEST_ASSERT_TRUE(px_is(150, y, c));
+    TEST_ASSERT_TRUE(px_is(150, 100, lv_color_white()));
+
+    lv_obj_clean(lv_scr_act());
+}
+
+static void chart_draw_part_cb(lv_event_t * e)
+{
+    lv_obj_draw_part_dsc_t * dsc = lv_event_get_draw_part_dsc(e);
+    if(dsc->part != LV_PART_ITEMS || dsc->line_dsc == NULL) return;
+
+    /*Change the style of a segment in the middle*/
+    dsc->line_dsc->color = dsc->id == 2 ? lv_color_hex(0x0000ff) : lv_color_hex(0xff0000);
+}
+
+void test_polyline_chart(void)
+{
+    lv_obj_set_style_bg_color(lv_scr_act(), lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(lv_scr_act(), LV_OPA_COVER, 0);
+
+    lv_obj_t * chart = lv_chart_create(lv_scr_act());
+    lv_obj_remove_style_all(chart);
+    lv_obj_set_pos(chart, 100, 100);
+    lv_obj_set_size(chart, 400, 200);
+    lv_obj_set_style_line_width(chart, 3, LV_PART_ITEMS);
+    lv_obj_set_style_size(chart, 0, LV_PART_INDICATOR);
+    lv_chart_set_div_line_count(chart, 0, 0);
+    lv_chart_set_point_count(chart, 5);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, 0, 100);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, lv_color_hex(0xff0000), LV_CHART_AXIS_PRIMARY_Y);
+    static const lv_coord_t values[] = {0, 100, 0, 100, 0};
+    uint32_t i;
+    for(i = 0; i < 5; i++) lv_chart_set_next_value(chart, ser, values[i]);
+    render();
+
+    /*The points are at x = 100, 200, ... 500 and y = 300 or 100*/
+    lv_color_t red = lv_color_hex(0xff0000);
+    lv_color_t blue = lv_color_hex(0x0000ff);
+    TEST_ASSERT_TRUE(px_is_near(150, 200, red));
+    TEST_ASSERT_TRUE(px_is_near(350, 200, red));
+    TEST_ASSERT_TRUE(px_is_near(200, 101, red));
+    TEST_ASSERT_TRUE(px_is(150, 150, lv_color_white()));
+
+    /*Changing the style of a segment breaks the polyline*/
+    lv_obj_add_event_cb(chart, chart_draw_part_cb, LV_EVENT_DRAW_PART_BEGIN, NULL);
+    render();
+    TEST_ASSERT_TRUE(px_is_near(150, 200, red));
+    TEST_ASSERT_TRUE(px_is_near(250, 200, red));
+    TEST_ASSERT_TRUE(px_is_near(350, 200, blue));
+    TEST_ASSERT_TRUE(px_is_near(450, 200, red));
+
+    /*A gap breaks the polyline too*/
+    lv_chart_set_value_by_id(chart, ser, 1, LV_CHART_POINT_NONE);
+    render();
+    TEST_ASSERT_TRUE(px_is(150, 200, lv_color_white()));
+    TEST_ASSERT_TRUE(px_is(250, 200, lv_color_white()));
+    TEST_ASSERT_TRUE(px_is_near(350, 200, blue));
+
+    lv_obj_clean(lv_scr_act());
+}
+
+static void chart_draw_part_end_cb(lv_event_t * e)
+{
+    lv_obj_draw_part_dsc_t * dsc = lv_event_get_draw_part_dsc(e);
+    if(dsc->part != LV_PART_ITEMS || dsc->p1 == NULL || dsc->p2 == NULL) return;
+
+    /*Draw a mark on the first segment. It should be above the line.*/
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    rect_dsc.bg_color = lv_color_hex(0x00ff00);
+    lv_area_t a = {146, 196, 154, 204};
+    lv_draw_rect(&a, dsc->clip_area, &rect_dsc);
+}
+
+void test_polyline_chart_part_end(void)
+{
+    lv_obj_set_style_bg_color(lv_scr_act(), lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(lv_scr_act(), LV_OPA_COVER, 0);
+
+    lv_obj_t * chart = lv_chart_create(lv_scr_act());
+    lv_obj_remove_style_all(chart);
+    lv_obj_set_pos(chart, 100, 100);
+    lv_obj_set_size(chart, 400, 200);
+    lv_obj_set_style_line_width(chart, 3, LV_PART_ITEMS);
+    lv_obj_set_style_size(chart, 0, LV_PART_INDICATOR);
+    lv_chart_set_div_line_count(chart, 0, 0);
+    lv_chart_set_point_count(chart, 5);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, 0, 100);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, lv_color_hex(0xff0000), LV_CHART_AXIS_PRIMARY_Y);
+    static const lv_coord_t values[] = {0, 100, 0, 100, 0};
+    uint32_t i;
+    for(i = 0; i < 5; i++) lv_chart_set_next_value(chart, ser, values[i]);
+
+    /*The lines should be drawn already when LV_EVENT_DRAW_PART_END is sent*/
+    lv_obj_add_event_cb(chart, chart_draw_part_end_cb, LV_EVENT_DRAW_PART_END, NULL);
+    render();
+    TEST_ASSERT_TRUE(px_is(150, 200, lv_color_hex(0x00ff00)));
+    TEST_ASSERT_TRUE(px_is_near(350, 200, lv_color_hex(0xff0000)));
+
+    lv_obj_clean(lv_scr_act());
+}
+
+#endif
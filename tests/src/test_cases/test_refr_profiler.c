@@ -0,0 +1,228 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <string.h>
+
+void test_refr_profiler_classes(void);
+void test_refr_profiler_objs(void);
+void test_refr_profiler_del(void);
+void test_refr_profiler_window(void);
+void test_refr_profiler_many_objs(void);
+
+static uint32_t fake_time;
+
+/*Every call advances the time by 10 us, so each measured part takes 10 us*/
+static uint32_t fake_time_cb(void)
+{
+    fake_time += 10;
+    return fake_time;
+}
+
+static void slow_draw_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    fake_time += 1000;
+}
+
+static const lv_refr_profiler_entry_t * find_class(const lv_refr_profiler_entry_t entries[], uint32_t cnt,
+                                                   const char * name)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        if(strcmp(lv_refr_profiler_get_class_name(entries[i].class_p), name) == 0) return &entries[i];
+    }
+    return NULL;
+}
+
+static void profiler_start(void)
+{
+    lv_refr_profiler_register_time_cb(fake_time_cb);
+    lv_refr_profiler_set_window(0);
+    lv_refr_profiler_reset();
+}
+
+static void profiler_stop(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_refr_profiler_show_overlay(false);
+    lv_refr_profiler_register_time_cb(NULL);
+}
+
+void test_refr_profiler_classes(void)
+{
+    profiler_start();
+
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_obj_t * btn = lv_btn_create(lv_scr_act());
+        lv_obj_set_size(btn, 100, 50);
+        lv_obj_set_pos(btn, 50, 50 + i * 100);
+    }
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_obj_set_pos(label, 200, 0);
+    lv_refr_now(NULL);
+
+    /*The area of the shadow is drawn too*/
+    int32_t ext = _lv_obj_get_ext_draw_size(lv_obj_get_child(lv_scr_act(), 0));
+    uint32_t btn_px = (100 + 2 * ext) * (50 + 2 * ext);
+
+    lv_refr_profiler_entry_t top[8];
+    uint32_t cnt = lv_refr_profiler_get_top_classes(top, 8);
+    TEST_ASSERT_GREATER_OR_EQUAL(2, cnt);
+
+    const lv_refr_profiler_entry_t * e = find_class(top, cnt, "btn");
+    TEST_ASSERT_NOT_NULL(e);
+    TEST_ASSERT_NULL(e->obj);
+    TEST_ASSERT_EQUAL(3, e->draw_cnt);
+    TEST_ASSERT_EQUAL(3 * btn_px, e->px);
+    TEST_ASSERT_EQUAL(3 * 2 * 10, e->time);   /*DRAW_MAIN and DRAW_POST per button*/
+
+    TEST_ASSERT_NOT_NULL(find_class(top, cnt, "label"));
+
+    /*Sorted by time*/
+    for(i = 1; i < cnt; i++) {
+        TEST_ASSERT_GREATER_OR_EQUAL(top[i].time, top[i - 1].time);
+    }
+
+    /*The limit is respected*/
+    TEST_ASSERT_EQUAL(1, lv_refr_profiler_get_top_classes(top, 1));
+    TEST_ASSERT_EQUAL(0, lv_refr_profiler_get_top_classes(top, 0));
+
+    profiler_stop();
+}
+
+void test_refr_profiler_objs(void)
+{
+    profiler_start();
+
+    lv_obj_t * btn = lv_btn_create(lv_scr_act());
+    lv_obj_set_size(btn, 100, 50);
+    lv_obj_set_pos(btn, 50, 50);
+    lv_refr_now(NULL);
+
+    lv_obj_invalidate(btn);
+    lv_refr_now(NULL);
+
+    int32_t ext = _lv_obj_get_ext_draw_size(btn);
+    uint32_t btn_px = (100 + 2 * ext) * (50 + 2 * ext);
+
+    lv_refr_profiler_entry_t top[16];
+    uint32_t cnt = lv_refr_profiler_get_top_objs(top, 16);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        if(top[i].obj == btn) break;
+    }
+    TEST_ASSERT_LESS_THAN(cnt, i);
+    TEST_ASSERT_EQUAL_PTR(&lv_btn_class, top[i].class_p);
+    TEST_ASSERT_EQUAL(2, top[i].draw_cnt);
+    TEST_ASSERT_EQUAL(2 * btn_px, top[i].px);
+
+    /*Reset clears everything*/
+    lv_refr_profiler_reset();
+    TEST_ASSERT_EQUAL(0, lv_refr_profiler_get_top_objs(top, 16));
+    TEST_ASSERT_EQUAL(0, lv_refr_profiler_get_top_classes(top, 16));
+
+    profiler_stop();
+}
+
+void test_refr_profiler_del(void)
+{
+    profiler_start();
+
+    lv_obj_t * btn = lv_btn_create(lv_scr_act());
+    lv_obj_set_size(btn, 100, 50);
+    lv_refr_now(NULL);
+    lv_obj_del(btn);
+
+    /*The statistics are kept but the deleted object is not referenced*/
+    lv_refr_profiler_entry_t top[16];
+    uint32_t cnt = lv_refr_profiler_get_top_objs(top, 16);
+    uint32_t i;
+    bool found = false;
+    for(i = 0; i < cnt; i++) {
+        TEST_ASSERT_NOT_EQUAL(btn, top[i].obj);
+        if(top[i].class_p == &lv_btn_class && top[i].obj == NULL) found = true;
+    }
+    TEST_ASSERT_TRUE(found);
+
+    profiler_stop();
+}
+
+void test_refr_profiler_window(void)
+{
+    profiler_start();
+
+    lv_refr_profiler_set_window(1);
+    lv_refr_profiler_show_overlay(true);
+
+    lv_obj_t * btn = lv_btn_create(lv_scr_act());
+    lv_obj_set_size(btn, 100, 50);
+    lv_refr_now(NULL);
+
+    /*Let the window elapse and close it with an other refresh*/
+    lv_tick_inc(2);
+    lv_obj_invalidate(btn);
+    lv_refr_now(NULL);
+
+    lv_refr_profiler_entry_t top[8];
+    uint32_t cnt = lv_refr_profiler_get_top_classes(top, 8);
+    TEST_ASSERT_NOT_NULL(find_class(top, cnt, "btn"));
+
+    /*The overlay shows the results but it's not profiled*/
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, lv_obj_get_child_cnt(lv_layer_sys()));
+    lv_obj_t * overlay = lv_obj_get_child(lv_layer_sys(), 0);
+    TEST_ASSERT_NOT_NULL(strstr(lv_label_get_text(overlay), "btn"));
+
+    lv_tick_inc(2);
+    lv_obj_invalidate(btn);
+    lv_refr_now(NULL);
+    cnt = lv_refr_profiler_get_top_objs(top, 8);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        TEST_ASSERT_NOT_EQUAL(overlay, top[i].obj);
+    }
+
+    profiler_stop();
+}
+
+void test_refr_profiler_many_objs(void)
+{
+    profiler_start();
+
+    /*Fill the table with cheap objects*/
+    uint32_t i;
+    for(i = 0; i < LV_REFR_PROFILER_OBJ_CNT + 10; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_scr_act());
+        lv_obj_remove_style_all(obj);
+        lv_obj_set_size(obj, 10, 10);
+        lv_obj_set_pos(obj, (i % 20) * 12, (i / 20) * 12);
+    }
+    lv_refr_now(NULL);
+
+    /*A late expensive object still gets an entry*/
+    lv_obj_t * slow = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(slow);
+    lv_obj_set_size(slow, 10, 10);
+    lv_obj_set_pos(slow, 300, 200);
+    lv_obj_add_event_cb(slow, slow_draw_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_refr_now(NULL);
+
+    lv_refr_profiler_entry_t top[4];
+    TEST_ASSERT_EQUAL(4, lv_refr_profiler_get_top_objs(top, 4));
+    TEST_ASSERT_EQUAL_PTR(slow, top[0].obj);
+    TEST_ASSERT_EQUAL(1, top[0].draw_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(1000, top[0].time);
+
+    /*The cheap ones can't evict it*/
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    lv_refr_profiler_get_top_objs(top, 4);
+    TEST_ASSERT_EQUAL_PTR(slow, top[0].obj);
+    TEST_ASSERT_EQUAL(2, top[0].draw_cnt);
+
+    profiler_stop();
+}
+
+#endif
@@ -0,0 +1,122 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_ref_disp.h"
+
+void test_rotation_partial(void);
+void test_rotation_full_refresh(void);
+void test_rotation_full_refresh_double(void);
+
+/*The native resolution of the rotated display*/
+#define NAT_W   LV_TEST_REF_DISP_HOR_RES
+#define NAT_H   LV_TEST_REF_DISP_VER_RES
+
+static lv_color_t rot_fb[NAT_W * NAT_H];
+static lv_color_t draw_buf1[NAT_W * NAT_H];
+static lv_color_t draw_buf2[NAT_W * NAT_H];
+
+/*The flush is finished only in `wait_cb` to emulate a DMA reading the buffer in the background*/
+static const lv_color_t * pending_p;
+static lv_area_t pending_area;
+static uint32_t last_cnt;
+
+static void rot_wait_cb(lv_disp_drv_t * drv)
+{
+    if(pending_p == NULL) return;
+
+    lv_test_fb_copy_area(rot_fb, drv->hor_res, &pending_area, pending_p);
+    pending_p = NULL;
+    if(lv_disp_flush_is_last(drv)) last_cnt++;
+    lv_disp_flush_ready(drv);
+}
+
+static void rot_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    TEST_ASSERT_NULL(pending_p);
+    TEST_ASSERT_TRUE(area->x1 >= 0 && area->x2 < drv->hor_res);
+    TEST_ASSERT_TRUE(area->y1 >= 0 && area->y2 < drv->ver_res);
+    pending_p = color_p;
+    pending_area = *area;
+}
+
+static void create_content(lv_disp_t * disp)
+{
+    lv_test_ref_content_create(disp, "Rotated");
+
+    /*An object crossing the panel and most of the rotated screen*/
+    lv_obj_t * obj = lv_obj_create(lv_disp_get_scr_act(disp));
+    lv_obj_set_size(obj, 30, 150);
+    lv_obj_set_pos(obj, 80, 20);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x00ff00), 0);
+}
+
+static void test_rotation(lv_disp_rot_t rot, bool full_refresh, uint32_t buf_size, bool double_buf)
+{
+    lv_disp_t * def_disp = lv_disp_get_default();
+
+    /*Reference display with the rotated (logical) resolution*/
+    lv_disp_t * ref_disp = lv_test_ref_disp_create(NAT_H, NAT_W);
+    create_content(ref_disp);
+    lv_refr_now(ref_disp);
+
+    /*Display rotated in software*/
+    static lv_disp_draw_buf_t rot_draw_buf;
+    lv_disp_draw_buf_init(&rot_draw_buf, draw_buf1, double_buf ? draw_buf2 : NULL, buf_size);
+    static lv_disp_drv_t rot_drv;
+    lv_disp_drv_init(&rot_drv);
+    rot_drv.draw_buf = &rot_draw_buf;
+    rot_drv.flush_cb = rot_flush_cb;
+    rot_drv.wait_cb = rot_wait_cb;
+    rot_drv.hor_res = NAT_W;
+    rot_drv.ver_res = NAT_H;
+    rot_drv.rotated = rot;
+    rot_drv.sw_rotate = 1;
+    rot_drv.full_refresh = full_refresh ? 1 : 0;
+    lv_disp_t * rot_disp = lv_disp_drv_register(&rot_drv);
+    create_content(rot_disp);
+
+    last_cnt = 0;
+    lv_memset_00(rot_fb, sizeof(rot_fb));
+    lv_refr_now(rot_disp);
+    rot_wait_cb(&rot_drv);  /*Finish the last flush*/
+    TEST_ASSERT_EQUAL(1, last_cnt);
+
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = 0; y < NAT_W; y++) {
+        for(x = 0; x < NAT_H; x++) {
+            lv_coord_t nat_x = rot == LV_DISP_ROT_90 ? y : NAT_W - 1 - y;
+            lv_coord_t nat_y = rot == LV_DISP_ROT_90 ? NAT_H - 1 - x : x;
+            uint32_t ref_c = lv_color_to32(lv_test_ref_fb[y * NAT_H + x]);
+            uint32_t rot_c = lv_color_to32(rot_fb[nat_y * NAT_W + nat_x]);
+            if(ref_c != rot_c) {
+                TEST_FAIL_MESSAGE("The rotated image is different");
+            }
+        }
+    }
+
+    lv_disp_remove(ref_disp);
+    lv_disp_remove(rot_disp);
+    lv_disp_set_default(def_disp);
+}
+
+void test_rotation_partial(void)
+{
+    test_rotation(LV_DISP_ROT_90, false, NAT_W * NAT_H / 3, false);
+    test_rotation(LV_DISP_ROT_270, false, NAT_W * NAT_H / 3, false);
+}
+
+void test_rotation_full_refresh(void)
+{
+    test_rotation(LV_DISP_ROT_90, true, NAT_W * NAT_H, false);
+    test_rotation(LV_DISP_ROT_270, true, NAT_W * NAT_H, false);
+}
+
+void test_rotation_full_refresh_double(void)
+{
+    test_rotation(LV_DISP_ROT_90, true, NAT_W * NAT_H, true);
+    test_rotation(LV_DISP_ROT_270, true, NAT_W * NAT_H, true);
+}
+
+#endif
@@ -0,0 +1,197 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_style_inherit_invalidate(void);
+void test_style_inherit_subtree(void);
+void test_style_inherit_hit_rate(void);
+
+static void assert_text_color(lv_obj_t * obj, uint32_t c)
+{
+    lv_color_t act = lv_obj_get_style_text_color(obj, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_hex(c).full, act.full);
+}
+
+void test_style_inherit_invalidate(void)
+{
+    lv_obj_t * root1 = lv_obj_create(lv_scr_act());
+    lv_obj_t * root2 = lv_obj_create(lv_scr_act());
+    lv_obj_t * mid = lv_obj_create(root1);
+    lv_obj_remove_style_all(mid);
+    lv_obj_t * label1 = lv_label_create(mid);
+    lv_obj_t * label2 = lv_label_create(mid);
+
+    lv_obj_set_style_text_color(root1, lv_color_hex(0x112233), 0);
+    lv_obj_set_style_text_color(root2, lv_color_hex(0x445566), 0);
+    assert_text_color(label1, 0x112233);
+    assert_text_color(label2, 0x112233);
+
+    /*Local style change on an ancestor*/
+    lv_obj_set_style_text_color(root1, lv_color_hex(0x223344), 0);
+    assert_text_color(label1, 0x223344);
+    assert_text_color(label2, 0x223344);
+
+    /*Style added and changed on a closer ancestor*/
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_text_color(&style, lv_color_hex(0x0000ff));
+    lv_obj_add_style(mid, &style, 0);
+    assert_text_color(label1, 0x0000ff);
+    lv_style_set_text_color(&style, lv_color_hex(0x00ff00));
+    assert_text_color(label2, 0x00ff00);
+    lv_obj_remove_style(mid, &style, 0);
+    assert_text_color(label1, 0x223344);
+
+    /*State change of an ancestor*/
+    lv_obj_add_style(mid, &style, LV_STATE_CHECKED);
+    assert_text_color(label1, 0x223344);
+    lv_obj_add_state(mid, LV_STATE_CHECKED);
+    assert_text_color(label1, 0x00ff00);
+    lv_obj_clear_state(mid, LV_STATE_CHECKED);
+    assert_text_color(label1, 0x223344);
+
+    /*New parent*/
+    lv_obj_set_parent(mid, root2);
+    assert_text_color(label1, 0x445566);
+    assert_text_color(label2, 0x445566);
+
+    /*Removed inherited property*/
+    lv_obj_remove_local_style_prop(root2, LV_STYLE_TEXT_COLOR, 0);
+    assert_text_color(label2, lv_color_to32(lv_obj_get_style_text_color(root2, LV_PART_MAIN)));
+
+    lv_obj_del(root1);
+    lv_obj_del(root2);
+    lv_style_reset(&style);
+}
+
+static lv_obj_style_inherit_cache_monitor_t mon_start;
+
+static void monitor_start(void)
+{
+    lv_obj_style_inherit_cache_monitor(&mon_start);
+}
+
+/*Percentage of the inherited values found in the cache since `monitor_start()`*/
+static uint32_t get_hit_rate(void)
+{
+    lv_obj_style_inherit_cache_monitor_t mon;
+    lv_obj_style_inherit_cache_monitor(&mon);
+    uint32_t hit = mon.hit_cnt - mon_start.hit_cnt;
+    uint32_t miss = mon.miss_cnt - mon_start.miss_cnt;
+    TEST_ASSERT_GREATER_THAN(0, hit + miss);
+    return (hit * 100) / (hit + miss);
+}
+
+static uint32_t get_miss_cnt(void)
+{
+    lv_obj_style_inherit_cache_monitor_t mon;
+    lv_obj_style_inherit_cache_monitor(&mon);
+    return mon.miss_cnt - mon_start.miss_cnt;
+}
+
+static lv_obj_t * btn_list_create(lv_obj_t * btns[], uint32_t cnt)
+{
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, 300, 460);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        btns[i] = lv_btn_create(cont);
+        lv_obj_t * label = lv_label_create(btns[i]);
+        lv_label_set_text_fmt(label, "Button %d", (int)i);
+    }
+    return cont;
+}
+
+void test_style_inherit_subtree(void)
+{
+#if LV_STYLE_INHERIT_CACHE_SIZE < 64
+    TEST_IGNORE_MESSAGE("The cache is too small, the values might be evicted");
+#endif
+    lv_obj_t * btns[2];
+    lv_obj_t * cont = btn_list_create(btns, 2);
+    lv_obj_t * label0 = lv_obj_get_child(btns[0], 0);
+    lv_obj_t * label1 = lv_obj_get_child(btns[1], 0);
+    lv_obj_get_style_text_color(label0, LV_PART_MAIN);
+    lv_obj_get_style_text_color(label1, LV_PART_MAIN);
+
+    /*Only the values of the changed object and its children are invalidated*/
+    monitor_start();
+    lv_obj_add_state(btns[1], LV_STATE_PRESSED);
+    lv_obj_get_style_text_color(label0, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(0, get_miss_cnt());
+    lv_obj_get_style_text_color(label1, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(1, get_miss_cnt());
+
+    monitor_start();
+    lv_obj_set_style_text_color(label1, lv_color_hex(0xff0000), 0);
+    lv_obj_get_style_text_color(label0, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(0, get_miss_cnt());
+    assert_text_color(label1, 0xff0000);
+    TEST_ASSERT_EQUAL(1, get_miss_cnt());
+
+    lv_obj_t * label2 = lv_label_create(btns[1]);
+    lv_obj_get_style_text_color(label2, LV_PART_MAIN);
+    lv_obj_get_style_text_color(label0, LV_PART_MAIN);
+    monitor_start();
+    lv_obj_del(label2);
+    lv_obj_get_style_text_color(label0, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(0, get_miss_cnt());
+
+    /*A shared style can be used anywhere so its change invalidates everything*/
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_obj_add_style(btns[0], &style, 0);
+    lv_obj_get_style_text_color(label0, LV_PART_MAIN);
+    lv_obj_get_style_text_color(label1, LV_PART_MAIN);
+    monitor_start();
+    lv_style_set_text_color(&style, lv_color_hex(0x00ff00));
+    lv_obj_get_style_text_color(label1, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(1, get_miss_cnt());
+    assert_text_color(label0, 0x00ff00);
+    TEST_ASSERT_EQUAL(2, get_miss_cnt());
+
+    lv_obj_del(cont);
+    lv_style_reset(&style);
+}
+
+void test_style_inherit_hit_rate(void)
+{
+#if LV_STYLE_INHERIT_CACHE_SIZE < 64
+    TEST_IGNORE_MESSAGE("The hit rate is measured with the default cache size");
+#endif
+    /*A list of buttons with labels as a typical screen*/
+    lv_obj_t * btns[20];
+    lv_obj_t * cont = btn_list_create(btns, 20);
+    lv_refr_now(NULL);
+
+    /*Most of the values are found on the label or on a common ancestor*/
+    monitor_start();
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_OR_EQUAL(85, get_hit_rate());
+
+    monitor_start();
+    lv_obj_scroll_by(cont, 0, -20, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_OR_EQUAL(85, get_hit_rate());
+
+    /*A frequently updated label elsewhere doesn't make the list miss*/
+    lv_obj_t * status = lv_label_create(lv_scr_act());
+    lv_obj_align(status, LV_ALIGN_TOP_RIGHT, 0, 0);
+    lv_refr_now(NULL);
+    monitor_start();
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_obj_set_style_text_color(status, lv_color_hex(0x100000 * i), 0);
+        lv_obj_scroll_by(cont, 0, i % 2 ? 10 : -10, LV_ANIM_OFF);
+        lv_refr_now(NULL);
+    }
+    TEST_ASSERT_GREATER_OR_EQUAL(85, get_hit_rate());
+
+    lv_obj_del(status);
+    lv_obj_del(cont);
+}
+
+#endif
@@ -0,0 +1,203 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_style_report_users(void);
+void test_style_report_all(void);
+void test_style_report_many_users(void);
+void test_style_report_const(void);
+
+static uint32_t changed_cnt[4];
+
+static void style_changed_cb(lv_event_t * e)
+{
+    uint32_t * cnt = lv_event_get_user_data(e);
+    (*cnt)++;
+}
+
+static lv_obj_t * create_obj(uint32_t i)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(obj);
+    lv_obj_add_event_cb(obj, style_changed_cb, LV_EVENT_STYLE_CHANGED, &changed_cnt[i]);
+    return obj;
+}
+
+static uint32_t get_changed_sum(void)
+{
+    return changed_cnt[0] + changed_cnt[1] + changed_cnt[2] + changed_cnt[3];
+}
+
+void test_style_report_users(void)
+{
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_bg_color(&style, lv_color_hex(0xff0000));
+
+    lv_obj_t * objs[4];
+    uint32_t i;
+    for(i = 0; i < 4; i++) objs[i] = create_obj(i);
+    lv_obj_add_style(objs[0], &style, 0);
+    lv_obj_add_style(objs[1], &style, 0);
+    lv_obj_add_style(objs[1], &style, LV_STATE_PRESSED);
+    lv_obj_add_style(objs[2], &style, 0);
+    /*objs[3] doesn't use the style*/
+    lv_obj_report_style_change(&style);
+
+    /*A color change requires only redraw*/
+    lv_memset_00(changed_cnt, sizeof(changed_cnt));
+    lv_style_set_bg_color(&style, lv_color_hex(0x00ff00));
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL(0, get_changed_sum());
+
+    /*A size change requires layout update on the users only*/
+    lv_style_set_width(&style, 33);
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL(1, changed_cnt[0]);
+    TEST_ASSERT_EQUAL(1, changed_cnt[1]);
+    TEST_ASSERT_EQUAL(1, changed_cnt[2]);
+    TEST_ASSERT_EQUAL(0, changed_cnt[3]);
+    lv_obj_update_layout(objs[0]);
+    TEST_ASSERT_EQUAL(33, lv_obj_get_width(objs[0]));
+
+    /*The changes are reported only once*/
+    lv_memset_00(changed_cnt, sizeof(changed_cnt));
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL(0, get_changed_sum());
+
+    /*Removing the style with one selector keeps the object as a user*/
+    lv_obj_remove_style(objs[1], &style, LV_STATE_PRESSED);
+    lv_obj_remove_style(objs[0], &style, 0);
+    lv_obj_del(objs[2]);
+    lv_memset_00(changed_cnt, sizeof(changed_cnt));
+    lv_style_remove_prop(&style, LV_STYLE_WIDTH);
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL(0, changed_cnt[0]);
+    TEST_ASSERT_EQUAL(1, changed_cnt[1]);
+    TEST_ASSERT_EQUAL(0, changed_cnt[3]);
+
+    /*Resetting the style reports its removed properties too*/
+    lv_style_set_pad_left(&style, 5);
+    lv_obj_report_style_change(&style);
+    lv_memset_00(changed_cnt, sizeof(changed_cnt));
+    lv_style_reset(&style);
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL(1, changed_cnt[1]);
+
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_style_report_all(void)
+{
+    static lv_style_t style1;
+    static lv_style_t style2;
+    lv_style_init(&style1);
+    lv_style_init(&style2);
+
+    lv_obj_t * objs[3];
+    uint32_t i;
+    for(i = 0; i < 3; i++) objs[i] = create_obj(i);
+    lv_obj_add_style(objs[0], &style1, 0);
+    lv_obj_add_style(objs[1], &style2, 0);
+    lv_obj_add_style(objs[2], &style1, 0);
+    lv_obj_add_style(objs[2], &style2, 0);
+    lv_obj_report_style_change(NULL);
+
+    /*Only the objects with styles requiring refresh are refreshed*/
+    lv_memset_00(changed_cnt, sizeof(changed_cnt));
+    lv_style_set_text_color(&style1, lv_color_hex(0x0000ff));
+    lv_style_set_height(&style2, 20);
+    lv_obj_report_style_change(NULL);
+    TEST_ASSERT_EQUAL(0, changed_cnt[0]);
+    TEST_ASSERT_EQUAL(1, changed_cnt[1]);
+    TEST_ASSERT_EQUAL(1, changed_cnt[2]);
+
+    lv_memset_00(changed_cnt, sizeof(changed_cnt));
+    lv_obj_report_style_change(&style2);
+    TEST_ASSERT_EQUAL(0, get_changed_sum());
+
+    lv_obj_clean(lv_scr_act());
+    lv_style_reset(&style1);
+    lv_style_reset(&style2);
+}
+
+void test_style_report_many_users(void)
+{
+    static lv_style_t style;
+    static lv_obj_t * objs[100];
+    lv_style_init(&style);
+
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        objs[i] = create_obj(i % 4);
+        lv_obj_add_style(objs[i], &style, 0);
+    }
+    lv_obj_report_style_change(&style);
+
+    /*Remove every second user, the others are still reported*/
+    for(i = 0; i < 100; i += 2) {
+        if(i % 4) lv_obj_del(objs[i]);
+        else lv_obj_remove_style(objs[i], &style, 0);
+    }
+
+    lv_memset_00(changed_cnt, sizeof(changed_cnt));
+    lv_style_set_width(&style, 10);
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL(0, changed_cnt[0]);
+    TEST_ASSERT_EQUAL(25, changed_cnt[1]);
+    TEST_ASSERT_EQUAL(0, changed_cnt[2]);
+    TEST_ASSERT_EQUAL(25, changed_cnt[3]);
+
+    /*The style can be added again*/
+    for(i = 0; i < 100; i += 4) lv_obj_add_style(objs[i], &style, 0);
+    lv_memset_00(changed_cnt, sizeof(changed_cnt));
+    lv_style_set_width(&style, 20);
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL(75, get_changed_sum());
+
+    lv_obj_clean(lv_scr_act());
+    lv_style_reset(&style);
+}
+
+void test_style_report_const(void)
+{
+    static const lv_style_const_prop_t props[] = {
+        LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xff, 0x00, 0x00)),
+        { .prop = LV_STYLE_PROP_INV }
+    };
+    static LV_STYLE_CONST_INIT(style_const, props);
+
+    /*A copy of a constant style in RAM, like the ones of the default theme*/
+    static lv_style_t style_copy;
+    style_copy = style_const;
+    style_copy.is_const_copy = 1;
+    style_copy.changed_flags = LV_STYLE_PROP_ANY;
+
+    lv_obj_t * objs[2];
+    uint32_t i;
+    for(i = 0; i < 2; i++) objs[i] = create_obj(i);
+    lv_obj_add_style(objs[0], &style_const, 0);
+    lv_obj_add_style(objs[1], &style_copy, 0);
+
+    /*The users of constant styles are always refreshed. The copies are refreshed only if they are changed.*/
+    lv_memset_00(changed_cnt, sizeof(changed_cnt));
+    lv_obj_report_style_change(NULL);
+    TEST_ASSERT_EQUAL(1, changed_cnt[0]);
+    TEST_ASSERT_EQUAL(1, changed_cnt[1]);
+
+    lv_memset_00(changed_cnt, sizeof(changed_cnt));
+    lv_obj_report_style_change(NULL);
+    TEST_ASSERT_EQUAL(1, changed_cnt[0]);
+    TEST_ASSERT_EQUAL(0, changed_cnt[1]);
+
+    lv_memset_00(changed_cnt, sizeof(changed_cnt));
+    lv_obj_report_style_change((lv_style_t *)&style_const);
+    lv_obj_report_style_change(&style_copy);
+    TEST_ASSERT_EQUAL(1, changed_cnt[0]);
+    TEST_ASSERT_EQUAL(0, changed_cnt[1]);
+
+    lv_obj_clean(lv_scr_act());
+}
+
+#endif
@@ -0,0 +1,118 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_indev.h"
+
+void test_table_row_height(void);
+void test_table_value_cb(void);
+void test_table_click(void);
+
+static char cb_buf[32];
+static uint32_t cb_cnt;
+
+static const char * cell_value_cb(lv_obj_t * obj, uint16_t row, uint16_t col)
+{
+  LV_UNUSED(obj);
+  cb_cnt++;
+  if(col == 1) return NULL;
+  lv_snprintf(cb_buf, sizeof(cb_buf), row == 5 ? "Row\n%d" : "Row %d", row);
+  return cb_buf;
+}
+
+void test_table_row_height(void)
+{
+  lv_obj_clean(lv_scr_act());
+  lv_obj_t * table = lv_table_create(lv_scr_act());
+  lv_table_set_col_cnt(table, 2);
+  lv_table_set_row_cnt(table, 100);
+  lv_obj_update_layout(table);
+
+  lv_coord_t h_ori = lv_obj_get_self_height(table);
+
+  /*A 2 line text in only one row should increase the height by one line*/
+  lv_table_set_cell_value(table, 50, 1, "a\nb");
+  lv_obj_update_layout(table);
+  const lv_font_t * font = lv_obj_get_style_text_font(table, LV_PART_ITEMS);
+  lv_coord_t line_h = lv_font_get_line_height(font) + lv_obj_get_style_text_line_space(table, LV_PART_ITEMS);
+  TEST_ASSERT_EQUAL(h_ori + line_h, lv_obj_get_self_height(table));
+
+  lv_table_set_cell_value_fmt(table, 50, 1, "%d", 1);
+  lv_obj_update_layout(table);
+  TEST_ASSERT_EQUAL(h_ori, lv_obj_get_self_height(table));
+
+  /*Removing rows should remove their height*/
+  lv_table_set_row_cnt(table, 50);
+  lv_obj_update_layout(table);
+  TEST_ASSERT_EQUAL(h_ori / 2, lv_obj_get_self_height(table));
+
+  lv_obj_del(table);
+}
+
+void test_table_value_cb(void)
+{
+  lv_obj_clean(lv_scr_act());
+  lv_obj_t * table = lv_table_create(lv_scr_act());
+  lv_table_set_col_cnt(table, 2);
+  lv_table_set_row_cnt(table, 10000);
+  lv_obj_set_height(table, 200);
+
+  lv_table_set_cell_value_cb(table, cell_value_cb);
+  TEST_ASSERT_EQUAL_PTR(cell_value_cb, lv_table_get_cell_value_cb(table));
+  TEST_ASSERT_EQUAL_STRING("Row 123", lv_table_get_cell_value(table, 123, 0));
+  TEST_ASSERT_EQUAL_STRING("", lv_table_get_cell_value(table, 123, 1));
+
+  /*Only the visible rows should be drawn even if the table is scrolled to the end*/
+  lv_obj_update_layout(table);
+  lv_obj_scroll_to_y(table, LV_COORD_MAX, LV_ANIM_OFF);
+  lv_refr_now(NULL);
+  cb_cnt = 0;
+  lv_obj_invalidate(table);
+  lv_refr_now(NULL);
+  TEST_ASSERT_LESS_THAN(100, cb_cnt);
+
+  /*Refreshing a row should measure only that row*/
+  cb_cnt = 0;
+  lv_table_refresh_row(table, 9000);
+  TEST_ASSERT_EQUAL(2, cb_cnt);
+
+  lv_obj_del(table);
+}
+
+void test_table_click(void)
+{
+  lv_obj_clean(lv_scr_act());
+  lv_obj_t * table = lv_table_create(lv_scr_act());
+  lv_table_set_col_cnt(table, 2);
+  lv_table_set_row_cnt(table, 6);
+  lv_table_set_cell_value(table, 1, 0, "a\nb\nc");
+  lv_obj_update_layout(table);
+
+  lv_coord_t row_h = lv_font_get_line_height(lv_obj_get_style_text_font(table, LV_PART_ITEMS)) +
+                     lv_obj_get_style_pad_top(table, LV_PART_ITEMS) + lv_obj_get_style_pad_bottom(table, LV_PART_ITEMS);
+  lv_coord_t y = table->coords.y1 + lv_obj_get_style_pad_top(table, LV_PART_MAIN);
+
+  uint16_t row;
+  uint16_t col;
+  lv_test_mouse_move_to(table->coords.x1 + 10, y + row_h / 2);
+  lv_test_mouse_press();
+  lv_test_indev_wait(50);
+  lv_table_get_selected_cell(table, &row, &col);
+  TEST_ASSERT_EQUAL(0, row);
+  TEST_ASSERT_EQUAL(0, col);
+  lv_test_mouse_release();
+  lv_test_indev_wait(50);
+
+  /*The 3 line high row is skipped*/
+  lv_test_mouse_move_to(table->coords.x1 + 10, y + lv_obj_get_self_height(table) - row_h * 3 - row_h / 2);
+  lv_test_mouse_press();
+  lv_test_indev_wait(50);
+  lv_table_get_selected_cell(table, &row, &col);
+  TEST_ASSERT_EQUAL(2, row);
+  lv_test_mouse_release();
+  lv_test_indev_wait(50);
+
+  lv_obj_del(table);
+}
+
+#endif
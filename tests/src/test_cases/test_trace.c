@@ -0,0 +1,105 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <string.h>
+
+void test_trace_refr(void);
+void test_trace_ring(void);
+void test_trace_dump(void);
+
+static char dump_buf[64 * 1024];
+static uint32_t dump_len;
+
+static void dump_write_cb(const char * buf, uint32_t len, void * user_data)
+{
+    LV_UNUSED(user_data);
+    TEST_ASSERT_LESS_THAN(sizeof(dump_buf), dump_len + len);
+    memcpy(&dump_buf[dump_len], buf, len);
+    dump_len += len;
+    dump_buf[dump_len] = '\0';
+}
+
+static uint32_t count_events(const char * name, lv_trace_type_t type)
+{
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < lv_trace_get_event_cnt(); i++) {
+        const lv_trace_event_t * e = lv_trace_get_event(i);
+        if(e->type == type && strcmp(e->name, name) == 0) cnt++;
+    }
+    return cnt;
+}
+
+void test_trace_refr(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj, 100, 100);
+    lv_refr_now(NULL);
+
+    lv_trace_clear();
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL(1, count_events("refr", LV_TRACE_TYPE_BEGIN));
+    TEST_ASSERT_EQUAL(1, count_events("refr", LV_TRACE_TYPE_END));
+    TEST_ASSERT_GREATER_OR_EQUAL(1, count_events("refr_area_part", LV_TRACE_TYPE_BEGIN));
+    TEST_ASSERT_GREATER_OR_EQUAL(2, count_events("draw_main", LV_TRACE_TYPE_BEGIN));
+    TEST_ASSERT_EQUAL(count_events("draw_main", LV_TRACE_TYPE_BEGIN), count_events("draw_main", LV_TRACE_TYPE_END));
+    TEST_ASSERT_GREATER_OR_EQUAL(1, count_events("blend_fill", LV_TRACE_TYPE_BEGIN));
+    TEST_ASSERT_GREATER_OR_EQUAL(1, count_events("flush", LV_TRACE_TYPE_BEGIN));
+    TEST_ASSERT_EQUAL(1, count_events("refr_px", LV_TRACE_TYPE_COUNTER));
+
+    /*The first event is the begin of the refresh*/
+    const lv_trace_event_t * e = lv_trace_get_event(0);
+    TEST_ASSERT_EQUAL_STRING("refr", e->name);
+    TEST_ASSERT_EQUAL(LV_TRACE_TYPE_BEGIN, e->type);
+
+    /*Nothing is recorded if disabled*/
+    lv_trace_clear();
+    lv_trace_set_enabled(false);
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(0, lv_trace_get_event_cnt());
+    lv_trace_set_enabled(true);
+
+    lv_obj_del(obj);
+}
+
+void test_trace_ring(void)
+{
+    lv_trace_clear();
+    int32_t i;
+    for(i = 0; i < LV_TRACE_BUF_SIZE + 10; i++) {
+        LV_TRACE_COUNTER("cnt", i);
+    }
+
+    /*The oldest events are overwritten*/
+    TEST_ASSERT_EQUAL(LV_TRACE_BUF_SIZE, lv_trace_get_event_cnt());
+    TEST_ASSERT_EQUAL(10, lv_trace_get_event(0)->value);
+    TEST_ASSERT_EQUAL(LV_TRACE_BUF_SIZE + 9, lv_trace_get_event(LV_TRACE_BUF_SIZE - 1)->value);
+    TEST_ASSERT_NULL(lv_trace_get_event(LV_TRACE_BUF_SIZE));
+}
+
+void test_trace_dump(void)
+{
+    lv_trace_clear();
+    LV_TRACE_BEGIN_ARG("span", 12);
+    LV_TRACE_COUNTER("cnt", 34);
+    LV_TRACE_END("span");
+
+    dump_len = 0;
+    lv_trace_dump(dump_write_cb, NULL);
+
+    TEST_ASSERT_EQUAL(0, strncmp(dump_buf, "{\"traceEvents\":[\n", 17));
+    TEST_ASSERT_NOT_NULL(strstr(dump_buf, "{\"name\":\"span\",\"ph\":\"B\","));
+    TEST_ASSERT_NOT_NULL(strstr(dump_buf, "\"args\":{\"value\":12}}\n"));
+    TEST_ASSERT_NOT_NULL(strstr(dump_buf, ",{\"name\":\"cnt\",\"ph\":\"C\","));
+    TEST_ASSERT_NOT_NULL(strstr(dump_buf, ",{\"name\":\"span\",\"ph\":\"E\","));
+    TEST_ASSERT_EQUAL_STRING("]}\n", &dump_buf[dump_len - 3]);
+
+    /*Dumping doesn't add events*/
+    TEST_ASSERT_EQUAL(3, lv_trace_get_event_cnt());
+}
+
+#endif